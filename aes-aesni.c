@@ -0,0 +1,360 @@
+/*****************************************************************************
+ * aes-aesni.c
+ *
+ * AES-128, AES-192 and AES-256 implementation using the x86 AES-NI
+ * instructions.
+ *
+ * Functions are compiled with a target attribute rather than a global -maes
+ * compiler option, so the library still runs on CPUs without AES-NI. Callers
+ * must check aes_cpu_has_aesni() before calling these functions.
+ *
+ * The key schedule is the standard one, byte-for-byte identical to that
+ * calculated by aes128_key_schedule(), aes192_key_schedule() and
+ * aes256_key_schedule(), so it can be shared with the portable
+ * implementation.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-aesni.h"
+
+#include <wmmintrin.h>
+#include <emmintrin.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AESNI_TARGET                __attribute__((target("aes,sse2")))
+
+/* Number of blocks encrypted in parallel by aes_aesni_encrypt_blocks().
+ * AESENC has a latency of several cycles but a throughput of one or two per
+ * cycle, so independent blocks are interleaved to keep the AES unit busy. */
+#define AESNI_PARALLEL_BLOCKS       8u
+
+/* The parallel blocks must be fully unrolled so they are kept in registers. */
+#define AESNI_UNROLL                _Pragma("GCC unroll 8")
+
+/* _mm_aeskeygenassist_si128() requires rcon to be an immediate value, so
+ * this must be a macro rather than a loop. */
+#define AES128_AESNI_KEY_EXPAND(KEY, RCON)  \
+    aes128_aesni_key_expand((KEY), _mm_aeskeygenassist_si128((KEY), (RCON)))
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+static inline AESNI_TARGET __m128i aes_aesni_load_round_key(const uint8_t * p_key_schedule, uint_fast8_t round)
+{
+    return _mm_loadu_si128((const __m128i *)(p_key_schedule + round * AES_BLOCK_SIZE));
+}
+
+/*
+ * One round of AES-128 key schedule. keygened is the output of
+ * AESKEYGENASSIST on the previous round key, which has done the S-box,
+ * rotate and Rcon XOR of the last word.
+ */
+static inline AESNI_TARGET __m128i aes128_aesni_key_expand(__m128i key, __m128i keygened)
+{
+    keygened = _mm_shuffle_epi32(keygened, _MM_SHUFFLE(3, 3, 3, 3));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, keygened);
+}
+
+/*
+ * Encrypt num_blocks (at most AESNI_PARALLEL_BLOCKS) contiguous independent
+ * blocks with one key schedule, with the rounds interleaved. This is always
+ * inlined so num_blocks is a constant and the loops are fully unrolled.
+ */
+static inline AESNI_TARGET __attribute__((always_inline)) void aes_aesni_encrypt_blocks_batch(uint8_t * p_blocks, uint_fast8_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+    __m128i         round_key;
+    __m128i         blocks[AESNI_PARALLEL_BLOCKS];
+
+    round_key = aes_aesni_load_round_key(p_key_schedule, 0);
+    AESNI_UNROLL
+    for (i = 0; i < num_blocks; ++i)
+    {
+        blocks[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p_blocks + i * AES_BLOCK_SIZE)), round_key);
+    }
+    for (round = 1; round < num_rounds; ++round)
+    {
+        round_key = aes_aesni_load_round_key(p_key_schedule, round);
+        AESNI_UNROLL
+        for (i = 0; i < num_blocks; ++i)
+        {
+            blocks[i] = _mm_aesenc_si128(blocks[i], round_key);
+        }
+    }
+    round_key = aes_aesni_load_round_key(p_key_schedule, num_rounds);
+    AESNI_UNROLL
+    for (i = 0; i < num_blocks; ++i)
+    {
+        _mm_storeu_si128((__m128i *)(p_blocks + i * AES_BLOCK_SIZE), _mm_aesenclast_si128(blocks[i], round_key));
+    }
+}
+
+/*
+ * Encrypt num_blocks (at most AESNI_PARALLEL_BLOCKS) independent blocks, each
+ * with its own key schedule, with the rounds interleaved. This is always
+ * inlined so num_blocks is a constant and the loops are fully unrolled.
+ */
+static inline AESNI_TARGET __attribute__((always_inline)) void aes_aesni_encrypt_multi_batch(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], uint_fast8_t num_blocks, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+    __m128i         blocks[AESNI_PARALLEL_BLOCKS];
+
+    AESNI_UNROLL
+    for (i = 0; i < num_blocks; ++i)
+    {
+        blocks[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)p_blocks[i]), aes_aesni_load_round_key(p_key_schedules[i], 0));
+    }
+    for (round = 1; round < num_rounds; ++round)
+    {
+        AESNI_UNROLL
+        for (i = 0; i < num_blocks; ++i)
+        {
+            blocks[i] = _mm_aesenc_si128(blocks[i], aes_aesni_load_round_key(p_key_schedules[i], round));
+        }
+    }
+    AESNI_UNROLL
+    for (i = 0; i < num_blocks; ++i)
+    {
+        _mm_storeu_si128((__m128i *)p_blocks[i], _mm_aesenclast_si128(blocks[i], aes_aesni_load_round_key(p_key_schedules[i], num_rounds)));
+    }
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/* AES encryption using AESENC/AESENCLAST, with num_rounds for the key size. */
+AESNI_TARGET void aes_aesni_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    __m128i         block;
+
+    block = _mm_loadu_si128((const __m128i *)p_block);
+    block = _mm_xor_si128(block, aes_aesni_load_round_key(p_key_schedule, 0));
+    for (round = 1; round < num_rounds; ++round)
+    {
+        block = _mm_aesenc_si128(block, aes_aesni_load_round_key(p_key_schedule, round));
+    }
+    block = _mm_aesenclast_si128(block, aes_aesni_load_round_key(p_key_schedule, num_rounds));
+    _mm_storeu_si128((__m128i *)p_block, block);
+}
+
+/* AES encryption of several independent blocks, with the rounds of
+ * AESNI_PARALLEL_BLOCKS blocks interleaved, then of 4 and 2 blocks, so short
+ * runs of blocks, such as CCM's MAC and counter block pair, still get some
+ * interleaving.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, which are
+ * encrypted in-place.
+ */
+AESNI_TARGET void aes_aesni_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    while (num_blocks >= AESNI_PARALLEL_BLOCKS)
+    {
+        aes_aesni_encrypt_blocks_batch(p_blocks, AESNI_PARALLEL_BLOCKS, p_key_schedule, num_rounds);
+        p_blocks += AESNI_PARALLEL_BLOCKS * AES_BLOCK_SIZE;
+        num_blocks -= AESNI_PARALLEL_BLOCKS;
+    }
+    if (num_blocks >= 4u)
+    {
+        aes_aesni_encrypt_blocks_batch(p_blocks, 4u, p_key_schedule, num_rounds);
+        p_blocks += 4u * AES_BLOCK_SIZE;
+        num_blocks -= 4u;
+    }
+    if (num_blocks >= 2u)
+    {
+        aes_aesni_encrypt_blocks_batch(p_blocks, 2u, p_key_schedule, num_rounds);
+        p_blocks += 2u * AES_BLOCK_SIZE;
+        num_blocks -= 2u;
+    }
+    if (num_blocks)
+    {
+        aes_aesni_encrypt(p_blocks, p_key_schedule, num_rounds);
+    }
+}
+
+/* AES encryption of several independent blocks, each with its own key.
+ *
+ * p_blocks[i] is encrypted in-place with p_key_schedules[i]. The rounds of
+ * AESNI_PARALLEL_BLOCKS blocks are interleaved, then of 4 blocks, so short
+ * runs of blocks still get some interleaving.
+ */
+AESNI_TARGET void aes_aesni_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds)
+{
+    while (num_blocks >= AESNI_PARALLEL_BLOCKS)
+    {
+        aes_aesni_encrypt_multi_batch(p_blocks, p_key_schedules, AESNI_PARALLEL_BLOCKS, num_rounds);
+        p_blocks += AESNI_PARALLEL_BLOCKS;
+        p_key_schedules += AESNI_PARALLEL_BLOCKS;
+        num_blocks -= AESNI_PARALLEL_BLOCKS;
+    }
+    if (num_blocks >= 4u)
+    {
+        aes_aesni_encrypt_multi_batch(p_blocks, p_key_schedules, 4u, num_rounds);
+        p_blocks += 4u;
+        p_key_schedules += 4u;
+        num_blocks -= 4u;
+    }
+    while (num_blocks)
+    {
+        aes_aesni_encrypt(*p_blocks++, *p_key_schedules++, num_rounds);
+        num_blocks--;
+    }
+}
+
+/* AES decryption using AESDEC/AESDECLAST, with num_rounds for the key size.
+ *
+ * AESDEC implements the equivalent inverse cipher, which needs InvMixColumns
+ * applied to the round keys of all but the first and last rounds. Since the
+ * standard key schedule is used, that is done on-the-fly here with AESIMC.
+ */
+AESNI_TARGET void aes_aesni_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    __m128i         block;
+
+    block = _mm_loadu_si128((const __m128i *)p_block);
+    block = _mm_xor_si128(block, aes_aesni_load_round_key(p_key_schedule, num_rounds));
+    for (round = num_rounds - 1u; round >= 1; --round)
+    {
+        block = _mm_aesdec_si128(block, _mm_aesimc_si128(aes_aesni_load_round_key(p_key_schedule, round)));
+    }
+    block = _mm_aesdeclast_si128(block, aes_aesni_load_round_key(p_key_schedule, 0));
+    _mm_storeu_si128((__m128i *)p_block, block);
+}
+
+/* AES decryption by the equivalent inverse cipher, using AESDEC/AESDECLAST
+ * with a decryption key schedule, so no AESIMC is needed per block.
+ */
+AESNI_TARGET void aes_aesni_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    __m128i         block;
+
+    block = _mm_loadu_si128((const __m128i *)p_block);
+    block = _mm_xor_si128(block, aes_aesni_load_round_key(p_decrypt_key_schedule, 0));
+    for (round = 1; round < num_rounds; ++round)
+    {
+        block = _mm_aesdec_si128(block, aes_aesni_load_round_key(p_decrypt_key_schedule, round));
+    }
+    block = _mm_aesdeclast_si128(block, aes_aesni_load_round_key(p_decrypt_key_schedule, num_rounds));
+    _mm_storeu_si128((__m128i *)p_block, block);
+}
+
+/* AES decryption of several independent blocks by the equivalent inverse
+ * cipher, as used by CBC mode, with the rounds of AESNI_PARALLEL_BLOCKS
+ * blocks interleaved.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, which are
+ * decrypted in-place with a decryption key schedule.
+ */
+AESNI_TARGET void aes_aesni_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+    __m128i         round_key;
+    __m128i         blocks[AESNI_PARALLEL_BLOCKS];
+
+    while (num_blocks >= AESNI_PARALLEL_BLOCKS)
+    {
+        round_key = aes_aesni_load_round_key(p_decrypt_key_schedule, 0);
+        AESNI_UNROLL
+        for (i = 0; i < AESNI_PARALLEL_BLOCKS; ++i)
+        {
+            blocks[i] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(p_blocks + i * AES_BLOCK_SIZE)), round_key);
+        }
+        for (round = 1; round < num_rounds; ++round)
+        {
+            round_key = aes_aesni_load_round_key(p_decrypt_key_schedule, round);
+            AESNI_UNROLL
+            for (i = 0; i < AESNI_PARALLEL_BLOCKS; ++i)
+            {
+                blocks[i] = _mm_aesdec_si128(blocks[i], round_key);
+            }
+        }
+        round_key = aes_aesni_load_round_key(p_decrypt_key_schedule, num_rounds);
+        AESNI_UNROLL
+        for (i = 0; i < AESNI_PARALLEL_BLOCKS; ++i)
+        {
+            _mm_storeu_si128((__m128i *)(p_blocks + i * AES_BLOCK_SIZE), _mm_aesdeclast_si128(blocks[i], round_key));
+        }
+        p_blocks += AESNI_PARALLEL_BLOCKS * AES_BLOCK_SIZE;
+        num_blocks -= AESNI_PARALLEL_BLOCKS;
+    }
+    while (num_blocks)
+    {
+        aes_aesni_decrypt_eqinv(p_blocks, p_decrypt_key_schedule, num_rounds);
+        p_blocks += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+}
+
+/* Convert a standard key schedule in-place to a decryption key schedule,
+ * reversing the order of the round keys and applying AESIMC to all but the
+ * first and last.
+ */
+AESNI_TARGET void aes_aesni_key_schedule_decrypt_convert(uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    __m128i *       p_first = (__m128i *)p_key_schedule;
+    __m128i *       p_last = (__m128i *)(p_key_schedule + num_rounds * AES_BLOCK_SIZE);
+    __m128i         first;
+    __m128i         last;
+
+    first = _mm_loadu_si128(p_first);
+    last = _mm_loadu_si128(p_last);
+    _mm_storeu_si128(p_first++, last);
+    _mm_storeu_si128(p_last--, first);
+    while (p_first < p_last)
+    {
+        first = _mm_loadu_si128(p_first);
+        last = _mm_loadu_si128(p_last);
+        _mm_storeu_si128(p_first++, _mm_aesimc_si128(last));
+        _mm_storeu_si128(p_last--, _mm_aesimc_si128(first));
+    }
+    if (p_first == p_last)
+    {
+        _mm_storeu_si128(p_first, _mm_aesimc_si128(_mm_loadu_si128(p_first)));
+    }
+}
+
+/* AES-128 key schedule using AESKEYGENASSIST. */
+AESNI_TARGET void aes128_aesni_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE])
+{
+    __m128i *       p_out = (__m128i *)p_key_schedule;
+    __m128i         key;
+
+    key = _mm_loadu_si128((const __m128i *)p_key);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x01);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x02);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x04);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x08);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x10);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x20);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x40);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x80);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x1B);
+    _mm_storeu_si128(p_out++, key);
+    key = AES128_AESNI_KEY_EXPAND(key, 0x36);
+    _mm_storeu_si128(p_out, key);
+}
@@ -0,0 +1,36 @@
+/*****************************************************************************
+ * aes-aesni.h
+ *
+ * AES implementation using the x86 AES-NI instructions.
+ * This is used internally by aes-min.c when ENABLE_AESNI is defined, if the
+ * CPU supports AES-NI at run-time.
+ ****************************************************************************/
+
+#ifndef AES_AESNI_H
+#define AES_AESNI_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stddef.h>
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes_aesni_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_aesni_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_aesni_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds);
+void aes_aesni_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_aesni_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+void aes_aesni_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+
+void aes_aesni_key_schedule_decrypt_convert(uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+
+void aes128_aesni_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE]);
+
+
+#endif /* !defined(AES_AESNI_H) */
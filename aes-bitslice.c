@@ -0,0 +1,576 @@
+/*****************************************************************************
+ * aes-bitslice.c
+ *
+ * Constant-time bitsliced AES encryption implementation, on 64-bit words.
+ *
+ * The state of four blocks is held in eight 64-bit words q[0..7], where q[i]
+ * holds bit i of every byte of all four blocks. The S-box is then computed
+ * for all 64 bytes in parallel by a circuit of 113 logic gates (Boyar and
+ * Peralta), with no table look-ups or data-dependent branches, so it is not
+ * vulnerable to cache-timing attacks.
+ *
+ * With GCC-compatible compilers, two such states are held in the two lanes of
+ * 128-bit vectors (SSE2 on x86-64, NEON on AArch64), so eight blocks are
+ * encrypted at once.
+ *
+ * The bit ordering and the data conversion functions follow Thomas Pornin's
+ * "ct64" implementation in BearSSL.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-bitslice.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AES_BITSLICE_NUM_WORDS      8u
+
+#if defined(__GNUC__)
+#define AES_BITSLICE_LANES          2u
+#else
+#define AES_BITSLICE_LANES          1u
+#endif
+
+/* Number of blocks held in one bitsliced state */
+#define AES_BITSLICE_BLOCKS         (4u * AES_BITSLICE_LANES)
+
+#define AES_BITSLICE_SWAPN(CL, CH, S, X, Y) \
+    do {                                    \
+        aes_bitslice_word_t a = (X);        \
+        aes_bitslice_word_t b = (Y);        \
+        (X) = (a & (CL)) | ((b & (CL)) << (S)); \
+        (Y) = ((a & (CH)) >> (S)) | (b & (CH)); \
+    } while (0)
+
+#define AES_BITSLICE_SWAP2(X, Y)    AES_BITSLICE_SWAPN(0x5555555555555555u, 0xAAAAAAAAAAAAAAAAu, 1u, X, Y)
+#define AES_BITSLICE_SWAP4(X, Y)    AES_BITSLICE_SWAPN(0x3333333333333333u, 0xCCCCCCCCCCCCCCCCu, 2u, X, Y)
+#define AES_BITSLICE_SWAP8(X, Y)    AES_BITSLICE_SWAPN(0x0F0F0F0F0F0F0F0Fu, 0xF0F0F0F0F0F0F0F0u, 4u, X, Y)
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/* One bitsliced word for each lane. Operators are applied lane-wise. */
+#if defined(__GNUC__)
+typedef uint64_t aes_bitslice_word_t __attribute__((vector_size(8u * AES_BITSLICE_LANES)));
+#else
+typedef uint64_t aes_bitslice_word_t;
+#endif
+
+/* Bitsliced state, also accessible per lane. */
+typedef union
+{
+    aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS];
+    uint64_t            lane[AES_BITSLICE_NUM_WORDS][AES_BITSLICE_LANES];
+} aes_bitslice_state_t;
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void aes_bitslice_sbox(aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS]);
+static void aes_bitslice_key_expand(aes_bitslice_word_t * p_skey, const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+static void aes_bitslice_key_expand_multi(aes_bitslice_word_t * p_skey, const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds);
+static void aes_bitslice_encrypt_batch(uint8_t * p_blocks, size_t num_blocks, const aes_bitslice_word_t * p_skey, uint_fast8_t num_rounds);
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+static inline uint32_t aes_bitslice_load_le32(const uint8_t * p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8u) | ((uint32_t)p[2] << 16u) | ((uint32_t)p[3] << 24u);
+}
+
+static inline void aes_bitslice_store_le32(uint8_t * p, uint32_t w)
+{
+    p[0] = w;
+    p[1] = w >> 8u;
+    p[2] = w >> 16u;
+    p[3] = w >> 24u;
+}
+
+/*
+ * Transpose the 8x8 bit matrices formed by each byte position of q[0..7].
+ * This converts between one block (half) per word, and one bit per word.
+ * It is its own inverse.
+ */
+static inline void aes_bitslice_ortho(aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS])
+{
+    AES_BITSLICE_SWAP2(q[0], q[1]);
+    AES_BITSLICE_SWAP2(q[2], q[3]);
+    AES_BITSLICE_SWAP2(q[4], q[5]);
+    AES_BITSLICE_SWAP2(q[6], q[7]);
+
+    AES_BITSLICE_SWAP4(q[0], q[2]);
+    AES_BITSLICE_SWAP4(q[1], q[3]);
+    AES_BITSLICE_SWAP4(q[4], q[6]);
+    AES_BITSLICE_SWAP4(q[5], q[7]);
+
+    AES_BITSLICE_SWAP8(q[0], q[4]);
+    AES_BITSLICE_SWAP8(q[1], q[5]);
+    AES_BITSLICE_SWAP8(q[2], q[6]);
+    AES_BITSLICE_SWAP8(q[3], q[7]);
+}
+
+/*
+ * Spread one 16-byte block into two words: the even and odd 16-bit halves
+ * of its columns, ready for aes_bitslice_ortho().
+ */
+static inline void aes_bitslice_interleave_in(uint64_t * p_q0, uint64_t * p_q1, const uint8_t p_block[AES_BLOCK_SIZE])
+{
+    uint64_t        x0, x1, x2, x3;
+
+    x0 = aes_bitslice_load_le32(p_block + 0);
+    x1 = aes_bitslice_load_le32(p_block + 4);
+    x2 = aes_bitslice_load_le32(p_block + 8);
+    x3 = aes_bitslice_load_le32(p_block + 12);
+    x0 |= (x0 << 16u);
+    x1 |= (x1 << 16u);
+    x2 |= (x2 << 16u);
+    x3 |= (x3 << 16u);
+    x0 &= 0x0000FFFF0000FFFFu;
+    x1 &= 0x0000FFFF0000FFFFu;
+    x2 &= 0x0000FFFF0000FFFFu;
+    x3 &= 0x0000FFFF0000FFFFu;
+    x0 |= (x0 << 8u);
+    x1 |= (x1 << 8u);
+    x2 |= (x2 << 8u);
+    x3 |= (x3 << 8u);
+    x0 &= 0x00FF00FF00FF00FFu;
+    x1 &= 0x00FF00FF00FF00FFu;
+    x2 &= 0x00FF00FF00FF00FFu;
+    x3 &= 0x00FF00FF00FF00FFu;
+    *p_q0 = x0 | (x2 << 8u);
+    *p_q1 = x1 | (x3 << 8u);
+}
+
+/* Inverse of aes_bitslice_interleave_in(). */
+static inline void aes_bitslice_interleave_out(uint8_t p_block[AES_BLOCK_SIZE], uint64_t q0, uint64_t q1)
+{
+    uint64_t        x0, x1, x2, x3;
+
+    x0 = q0 & 0x00FF00FF00FF00FFu;
+    x1 = q1 & 0x00FF00FF00FF00FFu;
+    x2 = (q0 >> 8u) & 0x00FF00FF00FF00FFu;
+    x3 = (q1 >> 8u) & 0x00FF00FF00FF00FFu;
+    x0 |= (x0 >> 8u);
+    x1 |= (x1 >> 8u);
+    x2 |= (x2 >> 8u);
+    x3 |= (x3 >> 8u);
+    x0 &= 0x0000FFFF0000FFFFu;
+    x1 &= 0x0000FFFF0000FFFFu;
+    x2 &= 0x0000FFFF0000FFFFu;
+    x3 &= 0x0000FFFF0000FFFFu;
+    aes_bitslice_store_le32(p_block + 0, (uint32_t)x0 | (uint32_t)(x0 >> 16u));
+    aes_bitslice_store_le32(p_block + 4, (uint32_t)x1 | (uint32_t)(x1 >> 16u));
+    aes_bitslice_store_le32(p_block + 8, (uint32_t)x2 | (uint32_t)(x2 >> 16u));
+    aes_bitslice_store_le32(p_block + 12, (uint32_t)x3 | (uint32_t)(x3 >> 16u));
+}
+
+static inline void aes_bitslice_add_round_key(aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS], const aes_bitslice_word_t * p_skey)
+{
+    uint_fast8_t    i;
+
+    for (i = 0; i < AES_BITSLICE_NUM_WORDS; ++i)
+    {
+        q[i] ^= p_skey[i];
+    }
+}
+
+static inline void aes_bitslice_shift_rows(aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS])
+{
+    uint_fast8_t    i;
+    aes_bitslice_word_t x;
+
+    for (i = 0; i < AES_BITSLICE_NUM_WORDS; ++i)
+    {
+        x = q[i];
+        q[i] = (x & 0x000000000000FFFFu)
+             | ((x & 0x00000000FFF00000u) >> 4u)
+             | ((x & 0x00000000000F0000u) << 12u)
+             | ((x & 0x0000FF0000000000u) >> 8u)
+             | ((x & 0x000000FF00000000u) << 8u)
+             | ((x & 0xF000000000000000u) >> 12u)
+             | ((x & 0x0FFF000000000000u) << 4u);
+    }
+}
+
+static inline aes_bitslice_word_t aes_bitslice_rotr32(aes_bitslice_word_t x)
+{
+    return (x << 32u) | (x >> 32u);
+}
+
+static inline void aes_bitslice_mix_columns(aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS])
+{
+    aes_bitslice_word_t q0, q1, q2, q3, q4, q5, q6, q7;
+    aes_bitslice_word_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 16u) | (q0 << 48u);
+    r1 = (q1 >> 16u) | (q1 << 48u);
+    r2 = (q2 >> 16u) | (q2 << 48u);
+    r3 = (q3 >> 16u) | (q3 << 48u);
+    r4 = (q4 >> 16u) | (q4 << 48u);
+    r5 = (q5 >> 16u) | (q5 << 48u);
+    r6 = (q6 >> 16u) | (q6 << 48u);
+    r7 = (q7 >> 16u) | (q7 << 48u);
+
+    q[0] = q7 ^ r7 ^ r0 ^ aes_bitslice_rotr32(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ aes_bitslice_rotr32(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ aes_bitslice_rotr32(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ aes_bitslice_rotr32(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ aes_bitslice_rotr32(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ aes_bitslice_rotr32(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ aes_bitslice_rotr32(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ aes_bitslice_rotr32(q7 ^ r7);
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/* AES-128 encryption, bitsliced implementation.
+ *
+ * Same interface as aes128_encrypt(), with num_rounds for the key size
+ * (10, 12 or 14), using the standard key schedule. This does the work of
+ * several blocks, so it is better to use aes_bitslice_encrypt_blocks() where
+ * possible.
+ */
+void aes_bitslice_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_bitslice_encrypt_blocks(p_block, 1u, p_key_schedule, num_rounds);
+}
+
+/* AES encryption of several independent blocks, bitsliced
+ * implementation.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, which are
+ * encrypted in-place. The bitsliced round keys are calculated once from the
+ * standard key schedule, then blocks are encrypted AES_BITSLICE_BLOCKS at a
+ * time.
+ */
+void aes_bitslice_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_bitslice_word_t skey[AES_BITSLICE_NUM_WORDS * (AES256_NUM_ROUNDS + 1u)];
+    size_t          batch_blocks;
+
+    aes_bitslice_key_expand(skey, p_key_schedule, num_rounds);
+    while (num_blocks)
+    {
+        batch_blocks = (num_blocks < AES_BITSLICE_BLOCKS) ? num_blocks : AES_BITSLICE_BLOCKS;
+        aes_bitslice_encrypt_batch(p_blocks, batch_blocks, skey, num_rounds);
+        p_blocks += batch_blocks * AES_BLOCK_SIZE;
+        num_blocks -= batch_blocks;
+    }
+}
+
+/* AES encryption of several independent blocks, each with its own key,
+ * bitsliced implementation.
+ *
+ * p_blocks[i] is encrypted in-place with p_key_schedules[i]. Each block slot
+ * of the bitsliced state gets its own round keys, so the cost per batch is
+ * the same as aes_bitslice_encrypt_blocks() plus the key conversion.
+ */
+void aes_bitslice_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds)
+{
+    aes_bitslice_word_t skey[AES_BITSLICE_NUM_WORDS * (AES256_NUM_ROUNDS + 1u)];
+    uint8_t         batch[AES_BITSLICE_BLOCKS * AES_BLOCK_SIZE];
+    size_t          batch_blocks;
+    size_t          i;
+
+    while (num_blocks)
+    {
+        batch_blocks = (num_blocks < AES_BITSLICE_BLOCKS) ? num_blocks : AES_BITSLICE_BLOCKS;
+        aes_bitslice_key_expand_multi(skey, p_key_schedules, batch_blocks, num_rounds);
+        for (i = 0; i < batch_blocks; ++i)
+        {
+            memcpy(batch + i * AES_BLOCK_SIZE, p_blocks[i], AES_BLOCK_SIZE);
+        }
+        aes_bitslice_encrypt_batch(batch, batch_blocks, skey, num_rounds);
+        for (i = 0; i < batch_blocks; ++i)
+        {
+            memcpy(p_blocks[i], batch + i * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+        }
+        p_blocks += batch_blocks;
+        p_key_schedules += batch_blocks;
+        num_blocks -= batch_blocks;
+    }
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * Convert the standard key schedule to bitsliced round keys. Each round key
+ * is replicated for all blocks of the bitsliced state.
+ */
+static void aes_bitslice_key_expand(aes_bitslice_word_t * p_skey, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_bitslice_state_t state;
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+    uint_fast8_t    lane;
+
+    for (round = 0; round <= num_rounds; ++round)
+    {
+        aes_bitslice_interleave_in(&state.lane[0][0], &state.lane[4][0], p_key_schedule + round * AES_BLOCK_SIZE);
+        for (lane = 0; lane < AES_BITSLICE_LANES; ++lane)
+        {
+            for (i = 0; i < AES_BITSLICE_NUM_WORDS; ++i)
+            {
+                state.lane[i][lane] = state.lane[i & 4u][0];
+            }
+        }
+        aes_bitslice_ortho(state.q);
+        for (i = 0; i < AES_BITSLICE_NUM_WORDS; ++i)
+        {
+            p_skey[round * AES_BITSLICE_NUM_WORDS + i] = state.q[i];
+        }
+    }
+}
+
+/*
+ * Convert up to AES_BITSLICE_BLOCKS standard key schedules to bitsliced round
+ * keys, with the round keys of key schedule i in the slot of block i. Unused
+ * block slots get zero round keys.
+ */
+static void aes_bitslice_key_expand_multi(aes_bitslice_word_t * p_skey, const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds)
+{
+    static const uint8_t zero_block[AES_BLOCK_SIZE];
+    aes_bitslice_state_t state;
+    uint_fast8_t    round;
+    uint_fast8_t    i;
+
+    for (round = 0; round <= num_rounds; ++round)
+    {
+        for (i = 0; i < AES_BITSLICE_BLOCKS; ++i)
+        {
+            aes_bitslice_interleave_in(&state.lane[i % 4u][i / 4u], &state.lane[i % 4u + 4u][i / 4u],
+                                       (i < num_blocks) ? (p_key_schedules[i] + round * AES_BLOCK_SIZE) : zero_block);
+        }
+        aes_bitslice_ortho(state.q);
+        for (i = 0; i < AES_BITSLICE_NUM_WORDS; ++i)
+        {
+            p_skey[round * AES_BITSLICE_NUM_WORDS + i] = state.q[i];
+        }
+    }
+}
+
+/*
+ * Encrypt up to AES_BITSLICE_BLOCKS blocks in one bitsliced state. Unused
+ * block slots are encrypted as zeros and discarded.
+ */
+static void aes_bitslice_encrypt_batch(uint8_t * p_blocks, size_t num_blocks, const aes_bitslice_word_t * p_skey, uint_fast8_t num_rounds)
+{
+    static const uint8_t zero_block[AES_BLOCK_SIZE];
+    aes_bitslice_state_t state;
+    uint_fast8_t    i;
+    uint_fast8_t    round;
+
+    /* Block i goes in lane i / 4, words i % 4 and i % 4 + 4. */
+    for (i = 0; i < AES_BITSLICE_BLOCKS; ++i)
+    {
+        aes_bitslice_interleave_in(&state.lane[i % 4u][i / 4u], &state.lane[i % 4u + 4u][i / 4u],
+                                   (i < num_blocks) ? (p_blocks + i * AES_BLOCK_SIZE) : zero_block);
+    }
+    aes_bitslice_ortho(state.q);
+
+    aes_bitslice_add_round_key(state.q, p_skey);
+    for (round = 1; round < num_rounds; ++round)
+    {
+        aes_bitslice_sbox(state.q);
+        aes_bitslice_shift_rows(state.q);
+        aes_bitslice_mix_columns(state.q);
+        aes_bitslice_add_round_key(state.q, p_skey + round * AES_BITSLICE_NUM_WORDS);
+    }
+    aes_bitslice_sbox(state.q);
+    aes_bitslice_shift_rows(state.q);
+    aes_bitslice_add_round_key(state.q, p_skey + num_rounds * AES_BITSLICE_NUM_WORDS);
+
+    aes_bitslice_ortho(state.q);
+    for (i = 0; i < num_blocks; ++i)
+    {
+        aes_bitslice_interleave_out(p_blocks + i * AES_BLOCK_SIZE, state.lane[i % 4u][i / 4u], state.lane[i % 4u + 4u][i / 4u]);
+    }
+}
+
+/*
+ * Bitsliced AES S-box, on all 64 bytes of the state at once.
+ *
+ * This is the 113-gate circuit by Joan Boyar and Rene Peralta: a top linear
+ * layer, a shared non-linear inversion in GF(2^4) tower field form, and a
+ * bottom linear layer which includes the affine transformation.
+ */
+static void aes_bitslice_sbox(aes_bitslice_word_t q[AES_BITSLICE_NUM_WORDS])
+{
+    aes_bitslice_word_t x0, x1, x2, x3, x4, x5, x6, x7;
+    aes_bitslice_word_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    aes_bitslice_word_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    aes_bitslice_word_t y20, y21;
+    aes_bitslice_word_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    aes_bitslice_word_t z10, z11, z12, z13, z14, z15, z16, z17;
+    aes_bitslice_word_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    aes_bitslice_word_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    aes_bitslice_word_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    aes_bitslice_word_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    aes_bitslice_word_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    aes_bitslice_word_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    aes_bitslice_word_t t60, t61, t62, t63, t64, t65, t66, t67;
+    aes_bitslice_word_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* Top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
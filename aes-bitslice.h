@@ -0,0 +1,28 @@
+/*****************************************************************************
+ * aes-bitslice.h
+ *
+ * Constant-time bitsliced AES encryption, on 64-bit words.
+ * This is used internally by aes-min.c when ENABLE_AES_BITSLICE is defined.
+ ****************************************************************************/
+
+#ifndef AES_BITSLICE_H
+#define AES_BITSLICE_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stddef.h>
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes_bitslice_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_bitslice_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_bitslice_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds);
+
+
+#endif /* !defined(AES_BITSLICE_H) */
@@ -0,0 +1,109 @@
+/*****************************************************************************
+ * aes-cbc.c
+ *
+ * AES-128 CBC mode encryption/decryption.
+ *
+ * Encryption is inherently serial, but each decrypted block depends only on
+ * two ciphertext blocks, so decryption decrypts several blocks at a time with
+ * aes128_decrypt_eqinv_blocks() before the chaining XOR.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-cbc.h"
+#include "aes-internal.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * AES-128 CBC mode encryption, without padding.
+ *
+ * p_key_schedule is a key schedule calculated by aes128_key_schedule().
+ * num_blocks 16-byte blocks are encrypted from p_in to p_out, which may point
+ * to the same buffer for in-place operation.
+ * p_iv holds the IV, and is updated to the last ciphertext block, so a long
+ * message can be processed in several calls.
+ */
+void aes128_cbc_encrypt(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                        uint8_t p_iv[AES128_CBC_IV_SIZE],
+                        const uint8_t * p_in, uint8_t * p_out, size_t num_blocks)
+{
+    const uint8_t     * p_chain = p_iv;
+
+    while (num_blocks)
+    {
+        if (p_out != p_in)
+        {
+            memcpy(p_out, p_in, AES_BLOCK_SIZE);
+        }
+        aes_block_xor64(p_out, p_chain);
+        aes128_encrypt(p_out, p_key_schedule);
+        p_chain = p_out;
+        p_in += AES_BLOCK_SIZE;
+        p_out += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+    if (p_chain != p_iv)
+    {
+        memcpy(p_iv, p_chain, AES_BLOCK_SIZE);
+    }
+}
+
+/*
+ * AES-128 CBC mode decryption, without padding.
+ *
+ * p_decrypt_key_schedule is a decryption key schedule calculated by
+ * aes128_key_schedule_decrypt(), so the equivalent inverse cipher can be
+ * used without transforming the round keys for each block.
+ * num_blocks 16-byte blocks are decrypted from p_in to p_out, which may point
+ * to the same buffer for in-place operation.
+ * p_iv holds the IV, and is updated to the last ciphertext block, so a long
+ * message can be processed in several calls.
+ *
+ * Blocks are decrypted AES_PARALLEL_BLOCKS at a time in p_out, keeping a
+ * copy of their ciphertext for the chaining XOR, so no other buffer is
+ * needed for in-place operation.
+ */
+void aes128_cbc_decrypt(const uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                        uint8_t p_iv[AES128_CBC_IV_SIZE],
+                        const uint8_t * p_in, uint8_t * p_out, size_t num_blocks)
+{
+    const aes_engine_t * p_engine = aes_engine_current();
+    uint8_t             saved[AES_PARALLEL_BLOCKS * AES_BLOCK_SIZE];
+    size_t              batch_blocks;
+    size_t              i;
+
+    while (num_blocks)
+    {
+        batch_blocks = (num_blocks < AES_PARALLEL_BLOCKS) ? num_blocks : AES_PARALLEL_BLOCKS;
+
+        /* Block-sized copies, which the compiler does inline. */
+        for (i = 0; i < batch_blocks; i++)
+        {
+            memcpy(&saved[i * AES_BLOCK_SIZE], p_in + i * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+            if (p_out != p_in)
+            {
+                memcpy(p_out + i * AES_BLOCK_SIZE, &saved[i * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+            }
+        }
+        p_engine->decrypt_eqinv_blocks(p_out, batch_blocks, p_decrypt_key_schedule, AES128_NUM_ROUNDS);
+
+        /* Plaintext block i is the decrypted block XOR ciphertext i - 1. */
+        aes_block_xor64(p_out, p_iv);
+        for (i = 1; i < batch_blocks; i++)
+        {
+            aes_block_xor64(p_out + i * AES_BLOCK_SIZE, &saved[(i - 1u) * AES_BLOCK_SIZE]);
+        }
+        memcpy(p_iv, &saved[(batch_blocks - 1u) * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+
+        p_in += batch_blocks * AES_BLOCK_SIZE;
+        p_out += batch_blocks * AES_BLOCK_SIZE;
+        num_blocks -= batch_blocks;
+    }
+}
@@ -0,0 +1,36 @@
+/*****************************************************************************
+ * aes-cbc.h
+ *
+ * AES-128 CBC mode encryption/decryption.
+ ****************************************************************************/
+
+#ifndef AES_CBC_H
+#define AES_CBC_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stddef.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AES128_CBC_IV_SIZE          AES_BLOCK_SIZE
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes128_cbc_encrypt(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                        uint8_t p_iv[AES128_CBC_IV_SIZE],
+                        const uint8_t * p_in, uint8_t * p_out, size_t num_blocks);
+void aes128_cbc_decrypt(const uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                        uint8_t p_iv[AES128_CBC_IV_SIZE],
+                        const uint8_t * p_in, uint8_t * p_out, size_t num_blocks);
+
+
+#endif /* !defined(AES_CBC_H) */
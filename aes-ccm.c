@@ -0,0 +1,507 @@
+/*****************************************************************************
+ * aes-ccm.c
+ *
+ * AES-128-CCM authenticated encryption (NIST SP 800-38C, RFC 3610), and the
+ * CCM* variant of IEEE 802.15.4.
+ *
+ * CCM computes a CBC-MAC over a header block B0, the associated data and the
+ * payload, and encrypts the payload and the MAC in CTR mode, all under one
+ * key. Rather than two passes over the payload, each payload block is done in
+ * one step: its CBC-MAC block and its CTR keystream block are independent,
+ * so they are encrypted together by one aes128_encrypt_blocks() call. The
+ * on-the-fly key schedule form does the same with
+ * aes128_otfks_encrypt_blocks(), so each round key is only calculated once
+ * for the two blocks.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-ccm.h"
+#include "aes-internal.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AES_CCM_FLAGS_ADATA         0x40u
+
+/* Associated data lengths from this up are encoded as 0xFF 0xFE and 4 bytes,
+ * or 0xFF 0xFF and 8 bytes, rather than in 2 bytes. */
+#define AES_CCM_AAD_LEN_SHORT_MAX   0xFF00u
+#define AES_CCM_AAD_LEN_MARKER      0xFFu
+#define AES_CCM_AAD_LEN_32          0xFEu
+#define AES_CCM_AAD_LEN_64          0xFFu
+
+/* The work buffer holds the CBC-MAC state, followed by up to two counter
+ * blocks which are encrypted to keystream. */
+#define AES_CCM_WORK_MAC            0u
+#define AES_CCM_WORK_CTR            AES_BLOCK_SIZE
+#define AES_CCM_WORK_CTR_NEXT       (2u * AES_BLOCK_SIZE)
+#define AES_CCM_WORK_SIZE           (3u * AES_BLOCK_SIZE)
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+#ifdef AES_NATIVE_LE
+/* A block as one vector, so counter blocks are made with a byte swap and a
+ * whole-block XOR, and stored whole rather than in two words. */
+typedef uint64_t aes_ccm_block_t __attribute__((vector_size(AES_BLOCK_SIZE)));
+#endif
+
+/* The block cipher: either an engine with an expanded key schedule, or the
+ * on-the-fly key schedule calculation from the key. */
+typedef struct
+{
+    const aes_engine_t * p_engine;
+    const uint8_t     * p_key_schedule;
+    const uint8_t     * p_key;
+} aes_ccm_cipher_t;
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static bool aes_ccm_params_valid(size_t nonce_len, size_t len, size_t tag_len);
+static void aes_ccm_start(const aes_ccm_cipher_t * p_cipher, uint8_t p_work[AES_CCM_WORK_SIZE],
+                          uint8_t p_ctr0[AES_BLOCK_SIZE], uint8_t p_s0[AES_BLOCK_SIZE],
+                          const uint8_t * p_nonce, size_t nonce_len,
+                          const uint8_t * p_aad, size_t aad_len,
+                          size_t len, size_t tag_len, bool is_ctr1_needed);
+static void aes_ccm_mac_aad(const aes_ccm_cipher_t * p_cipher, uint8_t p_mac[AES_BLOCK_SIZE],
+                            const uint8_t * p_aad, size_t aad_len);
+static bool aes_ccm_seal(const aes_ccm_cipher_t * p_cipher,
+                         const uint8_t * p_nonce, size_t nonce_len,
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         uint8_t * p_tag, size_t tag_len);
+static bool aes_ccm_open(const aes_ccm_cipher_t * p_cipher,
+                         const uint8_t * p_nonce, size_t nonce_len,
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         const uint8_t * p_tag, size_t tag_len);
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+/* Encrypt contiguous blocks in-place. The on-the-fly form works on a copy of
+ * the key, since the key state is modified. */
+static inline void aes_ccm_encrypt_blocks(const aes_ccm_cipher_t * p_cipher, uint8_t * p_blocks, size_t num_blocks)
+{
+    uint8_t             key[AES128_KEY_SIZE];
+
+    if (p_cipher->p_key_schedule != NULL)
+    {
+        p_cipher->p_engine->encrypt_blocks(p_blocks, num_blocks, p_cipher->p_key_schedule, AES128_NUM_ROUNDS);
+    }
+    else
+    {
+        memcpy(key, p_cipher->p_key, AES128_KEY_SIZE);
+        aes128_otfks_encrypt_blocks(p_blocks, num_blocks, key);
+    }
+}
+
+/* p_out = p_in ^ p_data, for len of 0 to 16 bytes. Whole blocks are XORed
+ * with aes_block_xor64(). p_out may be the same as p_in or p_data. */
+static inline void aes_ccm_xor(uint8_t * p_out, const uint8_t * p_in, const uint8_t * p_data, size_t len)
+{
+    size_t              i;
+
+    if (len == AES_BLOCK_SIZE)
+    {
+        if (p_out == p_data)
+        {
+            p_data = p_in;
+        }
+        else if (p_out != p_in)
+        {
+            memcpy(p_out, p_in, AES_BLOCK_SIZE);
+        }
+        aes_block_xor64(p_out, p_data);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+        {
+            p_out[i] = p_in[i] ^ p_data[i];
+        }
+    }
+}
+
+/*
+ * Make counter block ctr in p_out, from counter block 0. The counter is at
+ * most q bytes, so it is simply XORed into the last 8 bytes; the message
+ * length check ensures it can't overflow into the nonce. The block is
+ * written whole, since reading back a block just stored in parts stalls.
+ */
+static inline void aes_ccm_ctr_set(uint8_t p_out[AES_BLOCK_SIZE], const uint8_t p_ctr0[AES_BLOCK_SIZE], uint64_t ctr)
+{
+#ifdef AES_NATIVE_LE
+    aes_ccm_block_t     block;
+    aes_ccm_block_t     ctr_block = { 0, __builtin_bswap64(ctr) };
+
+    memcpy(&block, p_ctr0, AES_BLOCK_SIZE);
+    block ^= ctr_block;
+    memcpy(p_out, &block, AES_BLOCK_SIZE);
+#else
+    uint_fast8_t        i;
+
+    memcpy(p_out, p_ctr0, AES_BLOCK_SIZE);
+    for (i = AES_BLOCK_SIZE; ctr != 0; ctr >>= 8u)
+    {
+        i--;
+        p_out[i] ^= (uint8_t)ctr;
+    }
+#endif
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * AES-128-CCM encryption.
+ *
+ * Encrypts len bytes from p_in to p_out, which may be the same buffer, and
+ * outputs a tag of tag_len bytes authenticating the nonce, the aad_len bytes
+ * of associated data at p_aad, and the message.
+ * nonce_len is from AES128_CCM_NONCE_MIN_SIZE to AES128_CCM_NONCE_MAX_SIZE;
+ * the longer the nonce, the shorter the longest message: with a 13-byte nonce
+ * it is 65535 bytes. tag_len is an even number of bytes from 4 to 16, or 0
+ * for CCM* encryption without authentication.
+ *
+ * Returns false, without output, if the sizes are invalid.
+ */
+bool aes128_ccm_seal(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                     const uint8_t * p_nonce, size_t nonce_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     uint8_t * p_tag, size_t tag_len)
+{
+    aes_ccm_cipher_t    cipher;
+
+    cipher.p_engine = aes_engine_current();
+    cipher.p_key_schedule = p_key_schedule;
+    cipher.p_key = NULL;
+    return aes_ccm_seal(&cipher, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+}
+
+/*
+ * AES-128-CCM decryption.
+ *
+ * Decrypts len bytes from p_in to p_out, which may be the same buffer, and
+ * checks the tag_len-byte tag at p_tag in constant time. Parameters are as
+ * for aes128_ccm_seal(); with tag_len 0 there is nothing to check.
+ *
+ * Returns true if the tag is correct. If not, or if the sizes are invalid,
+ * it returns false and the output is cleared.
+ */
+bool aes128_ccm_open(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                     const uint8_t * p_nonce, size_t nonce_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     const uint8_t * p_tag, size_t tag_len)
+{
+    aes_ccm_cipher_t    cipher;
+
+    cipher.p_engine = aes_engine_current();
+    cipher.p_key_schedule = p_key_schedule;
+    cipher.p_key = NULL;
+    return aes_ccm_open(&cipher, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+}
+
+/*
+ * AES-128-CCM encryption with on-the-fly key schedule calculation.
+ *
+ * As aes128_ccm_seal(), but p_key is the 16-byte AES key itself, which is
+ * not modified. This needs no key schedule in RAM.
+ */
+bool aes128_otfks_ccm_seal(const uint8_t p_key[AES128_KEY_SIZE],
+                           const uint8_t * p_nonce, size_t nonce_len,
+                           const uint8_t * p_aad, size_t aad_len,
+                           uint8_t * p_out, const uint8_t * p_in, size_t len,
+                           uint8_t * p_tag, size_t tag_len)
+{
+    aes_ccm_cipher_t    cipher;
+
+    cipher.p_engine = NULL;
+    cipher.p_key_schedule = NULL;
+    cipher.p_key = p_key;
+    return aes_ccm_seal(&cipher, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+}
+
+/*
+ * AES-128-CCM decryption with on-the-fly key schedule calculation.
+ *
+ * As aes128_ccm_open(), but p_key is the 16-byte AES key itself, which is
+ * not modified.
+ */
+bool aes128_otfks_ccm_open(const uint8_t p_key[AES128_KEY_SIZE],
+                           const uint8_t * p_nonce, size_t nonce_len,
+                           const uint8_t * p_aad, size_t aad_len,
+                           uint8_t * p_out, const uint8_t * p_in, size_t len,
+                           const uint8_t * p_tag, size_t tag_len)
+{
+    aes_ccm_cipher_t    cipher;
+
+    cipher.p_engine = NULL;
+    cipher.p_key_schedule = NULL;
+    cipher.p_key = p_key;
+    return aes_ccm_open(&cipher, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Check the nonce and tag sizes, and that len fits the q-byte length field
+ * left by the nonce. */
+static bool aes_ccm_params_valid(size_t nonce_len, size_t len, size_t tag_len)
+{
+    size_t              q;
+
+    if (nonce_len < AES128_CCM_NONCE_MIN_SIZE || nonce_len > AES128_CCM_NONCE_MAX_SIZE)
+    {
+        return false;
+    }
+    if (tag_len != 0 && (tag_len < 4u || tag_len > AES128_CCM_TAG_MAX_SIZE || (tag_len & 1u)))
+    {
+        return false;
+    }
+    q = AES_BLOCK_SIZE - 1u - nonce_len;
+    if (q < sizeof(len) && (len >> (8u * q)) != 0)
+    {
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Set up the work buffer for the payload: the CBC-MAC of B0 and the
+ * associated data in the MAC block, and counter block 0 in p_ctr0. The
+ * keystream block S0 which encrypts the tag is output to p_s0. B0 and counter
+ * 0 are encrypted together.
+ * If is_ctr1_needed, counter 1 is encrypted with them too, and its keystream
+ * block is left in the work buffer's counter block.
+ */
+static void aes_ccm_start(const aes_ccm_cipher_t * p_cipher, uint8_t p_work[AES_CCM_WORK_SIZE],
+                          uint8_t p_ctr0[AES_BLOCK_SIZE], uint8_t p_s0[AES_BLOCK_SIZE],
+                          const uint8_t * p_nonce, size_t nonce_len,
+                          const uint8_t * p_aad, size_t aad_len,
+                          size_t len, size_t tag_len, bool is_ctr1_needed)
+{
+    uint8_t           * p_b0 = &p_work[AES_CCM_WORK_MAC];
+    uint_fast8_t        q = AES_BLOCK_SIZE - 1u - nonce_len;
+    uint_fast8_t        i;
+
+    /* Counter blocks are flags (q - 1), the nonce, then the counter. */
+    p_ctr0[0] = q - 1u;
+    memcpy(&p_ctr0[1], p_nonce, nonce_len);
+    memset(&p_ctr0[1u + nonce_len], 0, q);
+    memcpy(&p_work[AES_CCM_WORK_CTR], p_ctr0, AES_BLOCK_SIZE);
+
+    /* B0 is flags (Adata, (t - 2) / 2, q - 1), the nonce, then the message
+     * length. CCM* encodes an empty tag as 0. */
+    p_b0[0] = (aad_len ? AES_CCM_FLAGS_ADATA : 0) | ((tag_len ? (tag_len - 2u) / 2u : 0) << 3u) | (q - 1u);
+    memcpy(&p_b0[1], p_nonce, nonce_len);
+    for (i = AES_BLOCK_SIZE; i > 1u + nonce_len; )
+    {
+        i--;
+        p_b0[i] = (uint8_t)len;
+        len >>= 8u;
+    }
+
+    if (is_ctr1_needed)
+    {
+        aes_ccm_ctr_set(&p_work[AES_CCM_WORK_CTR_NEXT], p_ctr0, 1u);
+        aes_ccm_encrypt_blocks(p_cipher, p_work, 3u);
+        memcpy(p_s0, &p_work[AES_CCM_WORK_CTR], AES_BLOCK_SIZE);
+        memcpy(&p_work[AES_CCM_WORK_CTR], &p_work[AES_CCM_WORK_CTR_NEXT], AES_BLOCK_SIZE);
+    }
+    else
+    {
+        aes_ccm_encrypt_blocks(p_cipher, p_work, 2u);
+        memcpy(p_s0, &p_work[AES_CCM_WORK_CTR], AES_BLOCK_SIZE);
+    }
+
+    aes_ccm_mac_aad(p_cipher, &p_work[AES_CCM_WORK_MAC], p_aad, aad_len);
+}
+
+/*
+ * CBC-MAC the associated data, preceded by its encoded length and zero-padded
+ * to a whole number of blocks. Each block depends on the last, so this is
+ * serial.
+ */
+static void aes_ccm_mac_aad(const aes_ccm_cipher_t * p_cipher, uint8_t p_mac[AES_BLOCK_SIZE],
+                            const uint8_t * p_aad, size_t aad_len)
+{
+    uint8_t             block[AES_BLOCK_SIZE];
+    uint64_t            len64 = aad_len;
+    size_t              pos;
+    size_t              copy_len;
+    uint_fast8_t        num_len_bytes;
+
+    if (aad_len == 0)
+    {
+        return;
+    }
+    if (len64 < AES_CCM_AAD_LEN_SHORT_MAX)
+    {
+        num_len_bytes = 2u;
+        pos = 0;
+    }
+    else
+    {
+        block[0] = AES_CCM_AAD_LEN_MARKER;
+        if (len64 <= UINT32_MAX)
+        {
+            block[1] = AES_CCM_AAD_LEN_32;
+            num_len_bytes = 4u;
+        }
+        else
+        {
+            block[1] = AES_CCM_AAD_LEN_64;
+            num_len_bytes = 8u;
+        }
+        pos = 2u;
+    }
+    pos += num_len_bytes;
+    for (copy_len = pos; num_len_bytes; num_len_bytes--)
+    {
+        block[--copy_len] = (uint8_t)len64;
+        len64 >>= 8u;
+    }
+
+    while (aad_len)
+    {
+        copy_len = AES_BLOCK_SIZE - pos;
+        if (copy_len > aad_len)
+        {
+            copy_len = aad_len;
+            memset(&block[pos + copy_len], 0, AES_BLOCK_SIZE - pos - copy_len);
+        }
+        if (pos == 0 && copy_len == AES_BLOCK_SIZE)
+        {
+            aes_ccm_xor(p_mac, p_mac, p_aad, AES_BLOCK_SIZE);
+        }
+        else
+        {
+            memcpy(&block[pos], p_aad, copy_len);
+            aes_ccm_xor(p_mac, p_mac, block, AES_BLOCK_SIZE);
+        }
+        aes_ccm_encrypt_blocks(p_cipher, p_mac, 1u);
+        p_aad += copy_len;
+        aad_len -= copy_len;
+        pos = 0;
+    }
+}
+
+/*
+ * Encryption, for either cipher form. For each payload block, the plain text
+ * is added to the MAC, then the MAC block and the next counter block are
+ * encrypted together.
+ */
+static bool aes_ccm_seal(const aes_ccm_cipher_t * p_cipher,
+                         const uint8_t * p_nonce, size_t nonce_len,
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             work[AES_CCM_WORK_SIZE];
+    uint8_t             ctr0[AES_BLOCK_SIZE];
+    uint8_t             s0[AES_BLOCK_SIZE];
+    uint64_t            ctr = 0;
+    size_t              block_len;
+
+    if (!aes_ccm_params_valid(nonce_len, len, tag_len))
+    {
+        return false;
+    }
+    aes_ccm_start(p_cipher, work, ctr0, s0, p_nonce, nonce_len, p_aad, aad_len, len, tag_len, false);
+
+    while (len)
+    {
+        block_len = (len < AES_BLOCK_SIZE) ? len : AES_BLOCK_SIZE;
+        /* A partial last block is zero-padded for the MAC, so only its bytes
+         * are XORed in. */
+        aes_ccm_xor(&work[AES_CCM_WORK_MAC], &work[AES_CCM_WORK_MAC], p_in, block_len);
+        aes_ccm_ctr_set(&work[AES_CCM_WORK_CTR], ctr0, ++ctr);
+        aes_ccm_encrypt_blocks(p_cipher, work, 2u);
+        aes_ccm_xor(p_out, p_in, &work[AES_CCM_WORK_CTR], block_len);
+        p_in += block_len;
+        p_out += block_len;
+        len -= block_len;
+    }
+
+    aes_ccm_xor(p_tag, &work[AES_CCM_WORK_MAC], s0, tag_len);
+    return true;
+}
+
+/*
+ * Decryption, for either cipher form. A payload block must be decrypted
+ * before it is added to the MAC, so the keystream for the next block is
+ * encrypted along with the MAC of the current one; the keystream for the
+ * first payload block is encrypted with B0.
+ */
+static bool aes_ccm_open(const aes_ccm_cipher_t * p_cipher,
+                         const uint8_t * p_nonce, size_t nonce_len,
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         const uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             work[AES_CCM_WORK_SIZE];
+    uint8_t             ctr0[AES_BLOCK_SIZE];
+    uint8_t             s0[AES_BLOCK_SIZE];
+    uint64_t            ctr = 1u;
+    uint8_t           * p_out_start = p_out;
+    size_t              out_len = len;
+    size_t              block_len;
+    size_t              i;
+    uint8_t             diff = 0;
+
+    if (!aes_ccm_params_valid(nonce_len, len, tag_len))
+    {
+        if (len)
+        {
+            memset(p_out, 0, len);
+        }
+        return false;
+    }
+    aes_ccm_start(p_cipher, work, ctr0, s0, p_nonce, nonce_len, p_aad, aad_len, len, tag_len, (len != 0));
+
+    while (len)
+    {
+        block_len = (len < AES_BLOCK_SIZE) ? len : AES_BLOCK_SIZE;
+        aes_ccm_xor(p_out, p_in, &work[AES_CCM_WORK_CTR], block_len);
+        aes_ccm_xor(&work[AES_CCM_WORK_MAC], &work[AES_CCM_WORK_MAC], p_out, block_len);
+        p_in += block_len;
+        p_out += block_len;
+        len -= block_len;
+        if (len)
+        {
+            aes_ccm_ctr_set(&work[AES_CCM_WORK_CTR], ctr0, ++ctr);
+            aes_ccm_encrypt_blocks(p_cipher, work, 2u);
+        }
+        else
+        {
+            aes_ccm_encrypt_blocks(p_cipher, work, 1u);
+        }
+    }
+
+    aes_ccm_xor(work, &work[AES_CCM_WORK_MAC], s0, AES_BLOCK_SIZE);
+    for (i = 0; i < tag_len; i++)
+    {
+        diff |= work[i] ^ p_tag[i];
+    }
+    if (diff != 0)
+    {
+        memset(p_out_start, 0, out_len);
+        return false;
+    }
+    return true;
+}
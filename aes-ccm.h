@@ -0,0 +1,65 @@
+/*****************************************************************************
+ * aes-ccm.h
+ *
+ * AES-128-CCM authenticated encryption (NIST SP 800-38C, RFC 3610), and the
+ * CCM* variant of IEEE 802.15.4 which also allows an empty tag.
+ *
+ * There are two forms of each function: one using an expanded key schedule
+ * from aes128_key_schedule(), and an aes128_otfks_ form which takes the
+ * 16-byte key itself and calculates the key schedule on the fly, for devices
+ * short of RAM.
+ ****************************************************************************/
+
+#ifndef AES_CCM_H
+#define AES_CCM_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* The nonce is 15 - q bytes, where q is the size of the message length
+ * field, from 2 to 8 bytes. */
+#define AES128_CCM_NONCE_MIN_SIZE   7u
+#define AES128_CCM_NONCE_MAX_SIZE   13u
+
+/* The tag is 4, 6, 8, 10, 12, 14 or 16 bytes, or 0 bytes for CCM*. */
+#define AES128_CCM_TAG_MAX_SIZE     AES_BLOCK_SIZE
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+bool aes128_ccm_seal(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                     const uint8_t * p_nonce, size_t nonce_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     uint8_t * p_tag, size_t tag_len);
+bool aes128_ccm_open(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                     const uint8_t * p_nonce, size_t nonce_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     const uint8_t * p_tag, size_t tag_len);
+
+bool aes128_otfks_ccm_seal(const uint8_t p_key[AES128_KEY_SIZE],
+                           const uint8_t * p_nonce, size_t nonce_len,
+                           const uint8_t * p_aad, size_t aad_len,
+                           uint8_t * p_out, const uint8_t * p_in, size_t len,
+                           uint8_t * p_tag, size_t tag_len);
+bool aes128_otfks_ccm_open(const uint8_t p_key[AES128_KEY_SIZE],
+                           const uint8_t * p_nonce, size_t nonce_len,
+                           const uint8_t * p_aad, size_t aad_len,
+                           uint8_t * p_out, const uint8_t * p_in, size_t len,
+                           const uint8_t * p_tag, size_t tag_len);
+
+
+#endif /* !defined(AES_CCM_H) */
@@ -0,0 +1,312 @@
+/*****************************************************************************
+ * aes-cmac.c
+ *
+ * AES-128-CMAC message authentication (NIST SP 800-38B, RFC 4493).
+ *
+ * CMAC is CBC-MAC with the last block XORed with subkey K1 if it is
+ * complete, or padded with 0x80 0x00... and XORed with subkey K2 if not.
+ * Each message is serial, but aes128_cmac_batch() runs several messages side
+ * by side, encrypting one block of each with aes128_encrypt_blocks().
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-cmac.h"
+#include "aes-internal.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* x^128 = x^7 + x^2 + x + 1, for subkey doubling. */
+#define AES_CMAC_REDUCE_BYTE        0x87u
+
+#define AES_CMAC_PAD_BYTE           0x80u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/* A message being processed by aes128_cmac_batch(). */
+typedef struct
+{
+    const uint8_t     * p_data;
+    size_t              len;
+    size_t              msg_index;
+    bool                is_done;
+} aes_cmac_lane_t;
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void aes_cmac_subkey_mul2(uint8_t p_dst[AES_BLOCK_SIZE], const uint8_t p_src[AES_BLOCK_SIZE]);
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+/*
+ * XOR the final block of a message, of 0 to 16 bytes, into p_state, with
+ * padding and the subkey.
+ */
+static inline void aes_cmac_last_block_xor(uint8_t p_state[AES_BLOCK_SIZE], const aes128_cmac_key_t * p_key,
+                                           const uint8_t * p_data, size_t len)
+{
+    uint8_t             block[AES_BLOCK_SIZE];
+
+    if (len == AES_BLOCK_SIZE)
+    {
+        memcpy(block, p_data, AES_BLOCK_SIZE);
+        aes_block_xor64(block, p_key->k1);
+    }
+    else
+    {
+        if (len)
+        {
+            memcpy(block, p_data, len);
+        }
+        block[len] = AES_CMAC_PAD_BYTE;
+        memset(block + len + 1u, 0, AES_BLOCK_SIZE - 1u - len);
+        aes_block_xor64(block, p_key->k2);
+    }
+    aes_block_xor64(p_state, block);
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Prepare AES-128-CMAC key data.
+ *
+ * Calculates the AES-128 key schedule, and the subkeys K1 = L * x and
+ * K2 = L * x^2, where L = E(K, 0^128).
+ */
+void aes128_cmac_init(aes128_cmac_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE])
+{
+    uint8_t             l[AES_BLOCK_SIZE];
+
+    aes128_key_schedule(p_key->key_schedule, p_aes_key);
+    memset(l, 0, sizeof(l));
+    aes128_encrypt(l, p_key->key_schedule);
+    aes_cmac_subkey_mul2(p_key->k1, l);
+    aes_cmac_subkey_mul2(p_key->k2, p_key->k1);
+}
+
+/*
+ * Start an AES-128-CMAC calculation.
+ *
+ * p_key is the key data calculated by aes128_cmac_init(). It must remain
+ * valid until the calculation is finished.
+ */
+void aes128_cmac_start(aes128_cmac_ctx_t * p_ctx, const aes128_cmac_key_t * p_key)
+{
+    p_ctx->p_key = p_key;
+    memset(p_ctx->state, 0, AES_BLOCK_SIZE);
+    p_ctx->block_pos = 0;
+}
+
+/*
+ * Add data to the message. This can be called several times, with any
+ * lengths.
+ */
+void aes128_cmac_update(aes128_cmac_ctx_t * p_ctx, const uint8_t * p_data, size_t len)
+{
+    size_t              copy_len;
+
+    if (len == 0)
+    {
+        return;
+    }
+    if (p_ctx->block_pos)
+    {
+        copy_len = AES_BLOCK_SIZE - p_ctx->block_pos;
+        if (copy_len > len)
+        {
+            copy_len = len;
+        }
+        memcpy(p_ctx->block + p_ctx->block_pos, p_data, copy_len);
+        p_ctx->block_pos += copy_len;
+        p_data += copy_len;
+        len -= copy_len;
+        if (len == 0)
+        {
+            return;
+        }
+        /* More data follows, so the buffered block isn't the last. */
+        aes_block_xor64(p_ctx->state, p_ctx->block);
+        aes128_encrypt(p_ctx->state, p_ctx->p_key->key_schedule);
+    }
+    /* Keep back the last block, even if it is complete. */
+    while (len > AES_BLOCK_SIZE)
+    {
+        aes_block_xor64(p_ctx->state, p_data);
+        aes128_encrypt(p_ctx->state, p_ctx->p_key->key_schedule);
+        p_data += AES_BLOCK_SIZE;
+        len -= AES_BLOCK_SIZE;
+    }
+    memcpy(p_ctx->block, p_data, len);
+    p_ctx->block_pos = len;
+}
+
+/*
+ * Finish an AES-128-CMAC calculation, and get the tag.
+ *
+ * tag_len is the length of the tag to output, up to AES128_CMAC_TAG_SIZE
+ * bytes.
+ */
+void aes128_cmac_finish(aes128_cmac_ctx_t * p_ctx, uint8_t * p_tag, size_t tag_len)
+{
+    aes_cmac_last_block_xor(p_ctx->state, p_ctx->p_key, p_ctx->block, p_ctx->block_pos);
+    aes128_encrypt(p_ctx->state, p_ctx->p_key->key_schedule);
+
+    if (tag_len > AES128_CMAC_TAG_SIZE)
+    {
+        tag_len = AES128_CMAC_TAG_SIZE;
+    }
+    memcpy(p_tag, p_ctx->state, tag_len);
+}
+
+/*
+ * Finish an AES-128-CMAC calculation, and check the tag. The comparison is
+ * done in constant time.
+ *
+ * Returns true if the tag is correct.
+ */
+bool aes128_cmac_verify(aes128_cmac_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             tag[AES128_CMAC_TAG_SIZE];
+    uint8_t             diff = 0;
+    size_t              i;
+
+    if (tag_len == 0 || tag_len > AES128_CMAC_TAG_SIZE)
+    {
+        return false;
+    }
+    aes128_cmac_finish(p_ctx, tag, tag_len);
+    for (i = 0; i < tag_len; i++)
+    {
+        diff |= tag[i] ^ p_tag[i];
+    }
+    return (diff == 0);
+}
+
+/*
+ * One-shot AES-128-CMAC.
+ */
+void aes128_cmac(const aes128_cmac_key_t * p_key, const uint8_t * p_data, size_t len,
+                 uint8_t * p_tag, size_t tag_len)
+{
+    aes128_cmac_ctx_t   ctx;
+
+    aes128_cmac_start(&ctx, p_key);
+    aes128_cmac_update(&ctx, p_data, len);
+    aes128_cmac_finish(&ctx, p_tag, tag_len);
+}
+
+/*
+ * AES-128-CMAC of num_msgs independent messages under one key.
+ *
+ * Message i is msg_lens[i] bytes at p_msgs[i], and its full
+ * AES128_CMAC_TAG_SIZE-byte tag is written at
+ * p_tags + i * AES128_CMAC_TAG_SIZE. The messages may have any lengths.
+ *
+ * Up to AES_PARALLEL_BLOCKS messages are processed side by side, one block
+ * of each encrypted per aes128_encrypt_blocks() call. When a message finishes,
+ * the next one takes its lane, so the lanes stay full for messages of mixed
+ * lengths. This is much faster than aes128_cmac() for each message where
+ * the AES implementation interleaves blocks, such as AES-NI.
+ */
+void aes128_cmac_batch(const aes128_cmac_key_t * p_key,
+                       const uint8_t * const p_msgs[], const size_t msg_lens[],
+                       uint8_t * p_tags, size_t num_msgs)
+{
+    const aes_engine_t * p_engine = aes_engine_current();
+    aes_cmac_lane_t     lanes[AES_PARALLEL_BLOCKS];
+    uint8_t             states[AES_PARALLEL_BLOCKS * AES_BLOCK_SIZE];
+    aes_cmac_lane_t   * p_lane;
+    size_t              next_msg = 0;
+    size_t              num_lanes = 0;
+    size_t              i;
+
+    for (;;)
+    {
+        /* Start new messages in any free lanes. */
+        while (num_lanes < AES_PARALLEL_BLOCKS && next_msg < num_msgs)
+        {
+            p_lane = &lanes[num_lanes];
+            p_lane->p_data = p_msgs[next_msg];
+            p_lane->len = msg_lens[next_msg];
+            p_lane->msg_index = next_msg;
+            p_lane->is_done = false;
+            memset(&states[num_lanes * AES_BLOCK_SIZE], 0, AES_BLOCK_SIZE);
+            num_lanes++;
+            next_msg++;
+        }
+        if (num_lanes == 0)
+        {
+            break;
+        }
+
+        for (i = 0; i < num_lanes; i++)
+        {
+            p_lane = &lanes[i];
+            if (p_lane->len > AES_BLOCK_SIZE)
+            {
+                aes_block_xor64(&states[i * AES_BLOCK_SIZE], p_lane->p_data);
+                p_lane->p_data += AES_BLOCK_SIZE;
+                p_lane->len -= AES_BLOCK_SIZE;
+            }
+            else
+            {
+                aes_cmac_last_block_xor(&states[i * AES_BLOCK_SIZE], p_key, p_lane->p_data, p_lane->len);
+                p_lane->is_done = true;
+            }
+        }
+        p_engine->encrypt_blocks(states, num_lanes, p_key->key_schedule, AES128_NUM_ROUNDS);
+
+        /* Output finished tags, and fill each lane freed with the last lane.
+         * Going down, the last lane has already been checked. */
+        for (i = num_lanes; i != 0; )
+        {
+            i--;
+            if (lanes[i].is_done)
+            {
+                memcpy(p_tags + lanes[i].msg_index * AES128_CMAC_TAG_SIZE, &states[i * AES_BLOCK_SIZE], AES128_CMAC_TAG_SIZE);
+                num_lanes--;
+                if (i != num_lanes)
+                {
+                    lanes[i] = lanes[num_lanes];
+                    memcpy(&states[i * AES_BLOCK_SIZE], &states[num_lanes * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+                }
+            }
+        }
+    }
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * Multiply by x for subkey generation: a left shift of the big-endian block,
+ * with the reduction into the last byte if the top bit was set. The carry is
+ * turned into a mask rather than tested, so the time doesn't depend on the
+ * key.
+ */
+static void aes_cmac_subkey_mul2(uint8_t p_dst[AES_BLOCK_SIZE], const uint8_t p_src[AES_BLOCK_SIZE])
+{
+    uint8_t             carry = p_src[0] >> 7u;
+    uint_fast8_t        i;
+
+    for (i = 0; i < AES_BLOCK_SIZE - 1u; i++)
+    {
+        p_dst[i] = (p_src[i] << 1u) | (p_src[i + 1u] >> 7u);
+    }
+    p_dst[AES_BLOCK_SIZE - 1u] = (p_src[AES_BLOCK_SIZE - 1u] << 1u) ^ (AES_CMAC_REDUCE_BYTE & -carry);
+}
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ * aes-cmac.h
+ *
+ * AES-128-CMAC message authentication (NIST SP 800-38B, RFC 4493).
+ *
+ * This provides a streaming interface (aes128_cmac_start(),
+ * aes128_cmac_update(), then aes128_cmac_finish() or aes128_cmac_verify()),
+ * one-shot aes128_cmac(), and aes128_cmac_batch() for many independent
+ * messages under one key.
+ ****************************************************************************/
+
+#ifndef AES_CMAC_H
+#define AES_CMAC_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AES128_CMAC_TAG_SIZE        AES_BLOCK_SIZE
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Key data for AES-128-CMAC: the expanded AES key schedule, and the subkeys
+ * K1 and K2 derived from it.
+ * This is calculated once per key by aes128_cmac_init(), and is not modified
+ * by use, so it can be shared by several concurrent aes128_cmac_ctx_t.
+ */
+typedef struct
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t             k1[AES_BLOCK_SIZE];
+    uint8_t             k2[AES_BLOCK_SIZE];
+} aes128_cmac_key_t;
+
+/*
+ * State of one AES-128-CMAC calculation. The last block of data added is
+ * kept in block[] until it is known whether it is the final block.
+ */
+typedef struct
+{
+    const aes128_cmac_key_t * p_key;
+    uint8_t             state[AES_BLOCK_SIZE];
+    uint8_t             block[AES_BLOCK_SIZE];
+    uint_fast8_t        block_pos;
+} aes128_cmac_ctx_t;
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes128_cmac_init(aes128_cmac_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE]);
+
+void aes128_cmac_start(aes128_cmac_ctx_t * p_ctx, const aes128_cmac_key_t * p_key);
+void aes128_cmac_update(aes128_cmac_ctx_t * p_ctx, const uint8_t * p_data, size_t len);
+void aes128_cmac_finish(aes128_cmac_ctx_t * p_ctx, uint8_t * p_tag, size_t tag_len);
+bool aes128_cmac_verify(aes128_cmac_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len);
+
+void aes128_cmac(const aes128_cmac_key_t * p_key, const uint8_t * p_data, size_t len,
+                 uint8_t * p_tag, size_t tag_len);
+void aes128_cmac_batch(const aes128_cmac_key_t * p_key,
+                       const uint8_t * const p_msgs[], const size_t msg_lens[],
+                       uint8_t * p_tags, size_t num_msgs);
+
+
+#endif /* !defined(AES_CMAC_H) */
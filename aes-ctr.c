@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * aes-ctr.c
+ *
+ * AES-128 CTR mode encryption/decryption.
+ *
+ * Counter blocks are built several at a time and encrypted by
+ * aes128_encrypt_blocks().
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-ctr.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Number of counter blocks encrypted per call of aes128_encrypt_blocks().
+ * This is a multiple of the number of blocks that implementations encrypt in
+ * parallel, and large enough to amortise per-call set-up, such as conversion
+ * of the key schedule for the bitsliced implementation. */
+#define AES_CTR_BATCH_BLOCKS        32u
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+static inline void aes_ctr_store_be32(uint8_t * p, uint32_t a)
+{
+    p[0] = a >> 24u;
+    p[1] = a >> 16u;
+    p[2] = a >> 8u;
+    p[3] = a;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * AES-128 CTR mode encryption or decryption (they are the same operation).
+ *
+ * p_key_schedule is a key schedule calculated by aes128_key_schedule().
+ * The counter block for each block of data is p_iv followed by counter as a
+ * 32-bit big-endian value. counter is incremented for each block, modulo
+ * 2^32, as for GCM's inc32() function.
+ * p_in and p_out may point to the same buffer, for in-place operation. len
+ * need not be a multiple of the block size; the keystream for a trailing
+ * partial block is discarded.
+ *
+ * Returns the counter value for the block following the last one used, so a
+ * long message can be processed in several calls if each one except the
+ * last is a multiple of the block size.
+ */
+uint32_t aes128_ctr_xcrypt(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                           const uint8_t p_iv[AES128_CTR_IV_SIZE], uint32_t counter,
+                           const uint8_t * p_in, uint8_t * p_out, size_t len)
+{
+    uint8_t             keystream[AES_CTR_BATCH_BLOCKS * AES_BLOCK_SIZE];
+    size_t              num_blocks;
+    size_t              batch_len;
+    size_t              i;
+
+    while (len)
+    {
+        num_blocks = (len + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE;
+        if (num_blocks > AES_CTR_BATCH_BLOCKS)
+        {
+            num_blocks = AES_CTR_BATCH_BLOCKS;
+        }
+        for (i = 0; i < num_blocks; i++)
+        {
+            memcpy(keystream + i * AES_BLOCK_SIZE, p_iv, AES128_CTR_IV_SIZE);
+            aes_ctr_store_be32(keystream + i * AES_BLOCK_SIZE + AES128_CTR_IV_SIZE, counter++);
+        }
+        aes128_encrypt_blocks(keystream, num_blocks, p_key_schedule);
+
+        batch_len = num_blocks * AES_BLOCK_SIZE;
+        if (batch_len > len)
+        {
+            batch_len = len;
+        }
+        for (i = 0; i < batch_len; i++)
+        {
+            p_out[i] = p_in[i] ^ keystream[i];
+        }
+        p_in += batch_len;
+        p_out += batch_len;
+        len -= batch_len;
+    }
+    return counter;
+}
@@ -0,0 +1,35 @@
+/*****************************************************************************
+ * aes-ctr.h
+ *
+ * AES-128 CTR mode encryption/decryption.
+ ****************************************************************************/
+
+#ifndef AES_CTR_H
+#define AES_CTR_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stddef.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* The counter block is a 12-byte IV followed by a 32-bit big-endian counter,
+ * as used by GCM. */
+#define AES128_CTR_IV_SIZE          12u
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+uint32_t aes128_ctr_xcrypt(const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                           const uint8_t p_iv[AES128_CTR_IV_SIZE], uint32_t counter,
+                           const uint8_t * p_in, uint8_t * p_out, size_t len);
+
+
+#endif /* !defined(AES_CTR_H) */
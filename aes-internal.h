@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * aes-internal.h
+ *
+ * Helpers shared by the block cipher mode implementations.
+ * This is used internally by the library, and is not installed.
+ ****************************************************************************/
+
+#ifndef AES_INTERNAL_H
+#define AES_INTERNAL_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Defined with a GCC-compatible compiler on a little-endian CPU, where the
+ * block cipher modes can use little-endian words as they are in memory,
+ * rather than converting them byte by byte. */
+#if defined(__GNUC__) && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define AES_NATIVE_LE
+#endif
+#endif
+
+/*****************************************************************************
+ * Inline functions
+ ****************************************************************************/
+
+/*
+ * XOR p_data into the AES block, in 64-bit words.
+ * This is faster than aes_block_xor() on 32-bit and 64-bit CPUs, so the
+ * block cipher modes use it; aes_block_xor() suits small microprocessors.
+ */
+static inline void aes_block_xor64(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_data[AES_BLOCK_SIZE])
+{
+    uint64_t            block[2];
+    uint64_t            data[2];
+
+    memcpy(block, p_block, AES_BLOCK_SIZE);
+    memcpy(data, p_data, AES_BLOCK_SIZE);
+    block[0] ^= data[0];
+    block[1] ^= data[1];
+    memcpy(p_block, block, AES_BLOCK_SIZE);
+}
+
+
+#endif /* !defined(AES_INTERNAL_H) */
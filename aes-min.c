@@ -1,8 +1,8 @@
 /*****************************************************************************
  * aes-min.c
  *
- * Minimal byte-oriented AES-128 encryption/decryption implementation suitable
- * for small microprocessors.
+ * Minimal byte-oriented AES-128/192/256 encryption/decryption implementation
+ * suitable for small microprocessors.
  ****************************************************************************/
 
 /*****************************************************************************
@@ -11,6 +11,20 @@
 
 #include "aes-min.h"
 
+#ifdef ENABLE_AES_TTABLE
+#include "aes-ttable.h"
+#endif
+
+#ifdef ENABLE_AES_BITSLICE
+#include "aes-bitslice.h"
+#endif
+
+#ifdef ENABLE_AESNI
+#include "aes-aesni.h"
+#include "cpu-features.h"
+#endif
+
+#include <stdlib.h>
 #include <string.h>
 
 /*****************************************************************************
@@ -19,6 +33,8 @@
 
 #define AES_KEY_SCHEDULE_FIRST_RCON     1u
 #define AES128_KEY_SCHEDULE_LAST_RCON   54u
+#define AES192_KEY_SCHEDULE_LAST_RCON   128u
+#define AES256_KEY_SCHEDULE_LAST_RCON   64u
 
 #define AES_REDUCE_BYTE                 0x1Bu
 #define AES_2_INVERSE                   141u
@@ -77,8 +93,30 @@ static const uint8_t aes_sbox_inv_table[256u] =
  * Local function prototypes
  ****************************************************************************/
 
-static void aes128_key_schedule_round(uint8_t p_key[AES128_KEY_SIZE], uint8_t rcon);
-static void aes128_key_schedule_inv_round(uint8_t p_key[AES128_KEY_SIZE], uint8_t rcon);
+static const aes_engine_t * aes_engine_init(void);
+static bool aes_engine_is_available(const aes_engine_t * p_engine);
+static void aes_byte_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+static void aes_byte_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+static void aes_byte_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds);
+static void aes_byte_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+static void aes_byte_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+static void aes_byte_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+static void aes_byte_key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size);
+static void aes_byte_key_schedule_decrypt_convert(uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+#ifdef ENABLE_AESNI
+static void aes_aesni_engine_key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size);
+#endif
+static void aes_key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t key_schedule_size);
+static void aes_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t num_rounds);
+static void aes_otfks_decrypt_start_key(uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t key_schedule_size);
+static void aes_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t num_rounds, uint8_t last_rcon);
+static void aes_otfks_add_round_key(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size,
+                                    uint_fast8_t * p_key_pos, uint8_t * p_rcon);
+static void aes_otfks_add_round_key_inv(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size,
+                                        uint_fast8_t * p_key_pos, uint8_t * p_rcon);
+static void aes_key_schedule_round(uint8_t * p_key, uint_fast8_t key_size, uint8_t rcon);
+static void aes_key_schedule_inv_round(uint8_t * p_key, uint_fast8_t key_size, uint8_t rcon);
+static void aes_sbox_apply_word(uint8_t p_out[AES_KEY_SCHEDULE_WORD_SIZE], const uint8_t p_in[AES_KEY_SCHEDULE_WORD_SIZE]);
 static uint8_t aes_mul(uint8_t a, uint8_t b);
 static uint8_t aes_inv(uint8_t a);
 static uint8_t aes_sbox(uint8_t a);
@@ -90,6 +128,68 @@ static void aes_shift_rows_inv(uint8_t p_block[AES_BLOCK_SIZE]);
 static void aes_mix_columns(uint8_t p_block[AES_BLOCK_SIZE]);
 static void aes_mix_columns_inv(uint8_t p_block[AES_BLOCK_SIZE]);
 
+/*****************************************************************************
+ * Engines
+ ****************************************************************************/
+
+#ifdef ENABLE_AES_TTABLE
+#define AES_FALLBACK_DECRYPT            aes_ttable_decrypt
+#define AES_FALLBACK_DECRYPT_EQINV      aes_ttable_decrypt_eqinv
+#define AES_FALLBACK_DECRYPT_EQINV_BLOCKS aes_ttable_decrypt_eqinv_blocks
+#else
+#define AES_FALLBACK_DECRYPT            aes_byte_decrypt
+#define AES_FALLBACK_DECRYPT_EQINV      aes_byte_decrypt_eqinv
+#define AES_FALLBACK_DECRYPT_EQINV_BLOCKS aes_byte_decrypt_eqinv_blocks
+#endif
+
+/* The compiled-in engines, in increasing order of preference, which is the
+ * order of their measured speed. The bitsliced engine is the only one that is
+ * constant-time without AES-NI, but it is slower than the T-table engine even
+ * for 8 blocks at a time, and a single block costs a whole 8-block pass plus
+ * the round key conversion, so it is only the default without the T-table
+ * engine. Select it by name (see aes_engine_current()) where cache-timing
+ * attacks are a concern. It has no decryption of its own, so it uses the
+ * T-table decryption if that is compiled in, otherwise the byte-oriented one,
+ * neither of which is constant-time. */
+static const aes_engine_t aes_engines[] =
+{
+    {
+        "byte", NULL, aes_byte_key_schedule,
+        aes_byte_encrypt, aes_byte_encrypt_blocks, aes_byte_encrypt_multi,
+        aes_byte_decrypt, aes_byte_decrypt_eqinv, aes_byte_decrypt_eqinv_blocks,
+        aes_byte_key_schedule_decrypt_convert
+    },
+#ifdef ENABLE_AES_BITSLICE
+    {
+        "bitslice", NULL, aes_byte_key_schedule,
+        aes_bitslice_encrypt, aes_bitslice_encrypt_blocks, aes_bitslice_encrypt_multi,
+        AES_FALLBACK_DECRYPT, AES_FALLBACK_DECRYPT_EQINV, AES_FALLBACK_DECRYPT_EQINV_BLOCKS,
+        aes_byte_key_schedule_decrypt_convert
+    },
+#endif
+#ifdef ENABLE_AES_TTABLE
+    {
+        "ttable", NULL, aes_byte_key_schedule,
+        aes_ttable_encrypt, aes_ttable_encrypt_blocks, aes_ttable_encrypt_multi,
+        aes_ttable_decrypt, aes_ttable_decrypt_eqinv, aes_ttable_decrypt_eqinv_blocks,
+        aes_byte_key_schedule_decrypt_convert
+    },
+#endif
+#ifdef ENABLE_AESNI
+    {
+        "aesni", aes_cpu_has_aesni, aes_aesni_engine_key_schedule,
+        aes_aesni_encrypt, aes_aesni_encrypt_blocks, aes_aesni_encrypt_multi,
+        aes_aesni_decrypt, aes_aesni_decrypt_eqinv, aes_aesni_decrypt_eqinv_blocks,
+        aes_aesni_key_schedule_decrypt_convert
+    },
+#endif
+};
+
+#define AES_NUM_ENGINES                 (sizeof(aes_engines) / sizeof(aes_engines[0]))
+
+/* The engine used by the aesNNN_ functions, or NULL before the first use. */
+static const aes_engine_t * volatile p_aes_engine_current;
+
 /*****************************************************************************
  * Inline functions
  ****************************************************************************/
@@ -170,6 +270,83 @@ static inline uint8_t aes_rotate_left_uint8(uint8_t a, uint_fast8_t num_bits)
     return ((a << num_bits) | (a >> (8u - num_bits)));
 }
 
+#ifdef ENABLE_AES_WORD32
+
+/* Multiply each of the 4 bytes packed in a word by 2 in GF(2^8). */
+static inline uint32_t aes_mul2_uint32(uint32_t a)
+{
+    return ((a & 0x7F7F7F7Fu) << 1u) ^ (((a >> 7u) & 0x01010101u) * AES_REDUCE_BYTE);
+}
+
+/* Compilers reliably reduce this to a single rotate instruction. */
+static inline uint32_t aes_rotate_right_uint32(uint32_t a, uint_fast8_t num_bits)
+{
+    return ((a >> num_bits) | (a << (32u - num_bits)));
+}
+
+static inline uint32_t aes_load_column(const uint8_t p_column[AES_COLUMN_SIZE])
+{
+    return (uint32_t)p_column[0] |
+           ((uint32_t)p_column[1] << 8u) |
+           ((uint32_t)p_column[2] << 16u) |
+           ((uint32_t)p_column[3] << 24u);
+}
+
+static inline void aes_store_column(uint8_t p_column[AES_COLUMN_SIZE], uint32_t column)
+{
+    p_column[0] = (uint8_t)column;
+    p_column[1] = (uint8_t)(column >> 8u);
+    p_column[2] = (uint8_t)(column >> 16u);
+    p_column[3] = (uint8_t)(column >> 24u);
+}
+
+#endif
+
+/* Get the current engine, choosing it on first use. */
+static inline const aes_engine_t * aes_engine(void)
+{
+    const aes_engine_t * p_engine = p_aes_engine_current;
+
+    return (p_engine != NULL) ? p_engine : aes_engine_init();
+}
+
+/* Operations for any key size, with num_rounds 10, 12 or 14, dispatched to
+ * the current engine. */
+static inline void aes_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_engine()->encrypt(p_block, p_key_schedule, num_rounds);
+}
+
+static inline void aes_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_engine()->encrypt_blocks(p_blocks, num_blocks, p_key_schedule, num_rounds);
+}
+
+static inline void aes_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds)
+{
+    aes_engine()->encrypt_multi(p_blocks, p_key_schedules, num_blocks, num_rounds);
+}
+
+static inline void aes_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_engine()->decrypt(p_block, p_key_schedule, num_rounds);
+}
+
+static inline void aes_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_engine()->decrypt_eqinv(p_block, p_decrypt_key_schedule, num_rounds);
+}
+
+static inline void aes_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_engine()->decrypt_eqinv_blocks(p_blocks, num_blocks, p_decrypt_key_schedule, num_rounds);
+}
+
+static inline void aes_key_schedule_decrypt_convert(uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    aes_engine()->key_schedule_decrypt_convert(p_key_schedule, num_rounds);
+}
+
 /*****************************************************************************
  * Functions
  ****************************************************************************/
@@ -180,13 +357,507 @@ static inline uint8_t aes_rotate_left_uint8(uint8_t a, uint_fast8_t num_bits)
  * is done in-place in that buffer.
  * p_key_schedule points to a pre-calculated key schedule, which can be
  * calculated by aes128_key_schedule().
+ *
+ * The implementation used is the current engine, see aes_engine_current().
+ * By default, if ENABLE_AESNI is defined and the CPU supports AES-NI, the
+ * AES-NI implementation is used. Otherwise, if ENABLE_AES_TTABLE is defined,
+ * the 32-bit T-table implementation is used, or if ENABLE_AES_BITSLICE is
+ * defined, the constant-time bitsliced implementation is used, instead of the
+ * byte-oriented implementation.
  */
 void aes128_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_encrypt(p_block, p_key_schedule, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 encryption of several independent blocks, as used by CTR mode.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, which are
+ * encrypted in-place with the same key schedule.
+ *
+ * The blocks are encrypted by the current engine, see aes_engine_current().
+ * The AES-NI engine interleaves the rounds of up to 8 blocks, so the latency
+ * of each AES instruction is hidden. The bitsliced engine encrypts 8 blocks
+ * per pass (two 4-block lanes) when compiled with GCC, otherwise 4. The
+ * T-table and byte-oriented engines encrypt one block at a time.
+ *
+ * The block cipher modes pass independent blocks to this function (and to
+ * aes128_encrypt_multi() and aes128_decrypt_eqinv_blocks()) several at a
+ * time, rather than one by one, so engines which can interleave the rounds
+ * of independent blocks do so. Where the modes keep per-block state, such as
+ * saved ciphertext, tweaks or messages in progress, they batch
+ * AES_PARALLEL_BLOCKS blocks, the number that the AES-NI engine interleaves.
+ * They look up the engine once per call rather than once per batch, as the
+ * per-batch overhead is significant next to AES-NI.
+ */
+void aes128_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_encrypt_blocks(p_blocks, num_blocks, p_key_schedule, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 encryption of several independent blocks, each with its own key.
+ *
+ * p_blocks[i] points to a 16-byte block which is encrypted in-place with the
+ * key schedule p_key_schedules[i]. This suits protocols that handle many
+ * short messages under different keys, such as per-flow or per-session keys,
+ * where aes128_encrypt_blocks() can't be used.
+ *
+ * The blocks are encrypted by the current engine, see aes_engine_current().
+ * The AES-NI engine interleaves the rounds of up to 8 blocks, loading each
+ * block's round key separately. The bitsliced engine gives each block slot
+ * of the bitsliced state its own round keys. The T-table and byte-oriented
+ * engines encrypt one block at a time.
+ */
+void aes128_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks)
+{
+    aes_encrypt_multi(p_blocks, p_key_schedules, num_blocks, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 decryption.
+ *
+ * p_block points to a 16-byte buffer of encrypted data to decrypt. Decryption
+ * is done in-place in that buffer.
+ * p_key_schedule points to a pre-calculated key schedule, which can be
+ * calculated by aes128_key_schedule().
+ *
+ * The implementation used is the current engine, see aes_engine_current().
+ * The bitsliced engine has no decryption of its own, so with it, decryption
+ * falls back to the T-table implementation if ENABLE_AES_TTABLE is defined,
+ * otherwise the byte-oriented one. Neither of those is constant-time.
+ */
+void aes128_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt(p_block, p_key_schedule, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 decryption of several independent blocks, as used by CBC mode.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, which are
+ * decrypted in-place with the same key schedule, calculated by
+ * aes128_key_schedule().
+ *
+ * The key schedule is converted to a decryption key schedule once, and the
+ * blocks are decrypted by aes128_decrypt_eqinv_blocks(), so the round keys
+ * aren't transformed for each block.
+ */
+void aes128_decrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    uint8_t         decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE];
+
+    if (num_blocks <= 1u)
+    {
+        if (num_blocks)
+        {
+            aes_decrypt(p_blocks, p_key_schedule, AES128_NUM_ROUNDS);
+        }
+        return;
+    }
+    memcpy(decrypt_key_schedule, p_key_schedule, AES128_KEY_SCHEDULE_SIZE);
+    aes_key_schedule_decrypt_convert(decrypt_key_schedule, AES128_NUM_ROUNDS);
+    aes_decrypt_eqinv_blocks(p_blocks, num_blocks, decrypt_key_schedule, AES128_NUM_ROUNDS);
+    memset(decrypt_key_schedule, 0, sizeof(decrypt_key_schedule));
+}
+
+/* AES-128 key schedule calculation.
+ *
+ * p_key_schedule points to a buffer to receive the key schedule, for use by
+ * aes128_encrypt() and aes128_decrypt().
+ * p_key points to the 16-byte AES-128 key.
+ *
+ * The key schedule is calculated by the current engine, see
+ * aes_engine_current(). The result is the same for all engines; only the
+ * AES-NI engine has its own implementation.
+ */
+void aes128_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE])
+{
+    aes_engine()->key_schedule(p_key_schedule, p_key, AES128_KEY_SIZE);
+}
+
+/* AES-128 decryption key schedule calculation, for the equivalent inverse
+ * cipher.
+ *
+ * p_decrypt_key_schedule points to a buffer to receive the key schedule, for
+ * use by aes128_decrypt_eqinv(). It holds the round keys in the order used
+ * for decryption, with InvMixColumns applied to all but the first and last.
+ * p_key points to the 16-byte AES-128 key.
+ */
+void aes128_key_schedule_decrypt(uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE])
+{
+    aes128_key_schedule(p_decrypt_key_schedule, p_key);
+    aes_key_schedule_decrypt_convert(p_decrypt_key_schedule, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 decryption by the equivalent inverse cipher.
+ *
+ * p_block points to a 16-byte buffer of encrypted data to decrypt. Decryption
+ * is done in-place in that buffer.
+ * p_decrypt_key_schedule points to a pre-calculated decryption key schedule,
+ * which can be calculated by aes128_key_schedule_decrypt().
+ *
+ * This has the same round structure as encryption, so the T-table and AES-NI
+ * implementations need no per-block transformation of the round keys, as
+ * aes128_decrypt() does. The byte-oriented implementation gains nothing, so
+ * aes128_decrypt() remains the choice for ROM-minimal builds, needing only
+ * one key schedule for both directions.
+ */
+void aes128_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt_eqinv(p_block, p_decrypt_key_schedule, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 decryption of several independent blocks by the equivalent inverse
+ * cipher.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, which are
+ * decrypted in-place with a decryption key schedule calculated by
+ * aes128_key_schedule_decrypt(). With AES-NI, the rounds of 8 blocks are
+ * interleaved; otherwise each block is decrypted by aes128_decrypt_eqinv().
+ */
+void aes128_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt_eqinv_blocks(p_blocks, num_blocks, p_decrypt_key_schedule, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 encryption with on-the-fly key schedule calculation.
+ *
+ * p_block points to a 16-byte buffer of plain data to encrypt. Encryption
+ * is done in-place in that buffer.
+ * p_key must initially point to a starting key state for encryption, which is
+ * simply the 16 bytes of the AES-128 key. Key schedule is calculated on-the-
+ * fly in that buffer, so the buffer must re-initialised for subsequent
+ * encryption operations.
+ */
+void aes128_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES128_KEY_SIZE])
+{
+    aes_otfks_encrypt(p_block, p_key, AES128_KEY_SIZE, AES128_NUM_ROUNDS);
+}
+
+/* AES-128 encryption of several blocks with on-the-fly key schedule
+ * calculation.
+ *
+ * p_blocks points to num_blocks contiguous 16-byte blocks, encrypted in-place.
+ * p_key is as for aes128_otfks_encrypt(). For AES-128 the key state is exactly
+ * one round key, so each round key is calculated once and applied to all the
+ * blocks, rather than recalculated for each block.
+ */
+void aes128_otfks_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, uint8_t p_key[AES128_KEY_SIZE])
+{
+    uint_fast8_t    round;
+    uint8_t         rcon = AES_KEY_SCHEDULE_FIRST_RCON;
+    size_t          i;
+
+    for (i = 0; i < num_blocks; ++i)
+    {
+        aes_block_xor(&p_blocks[i * AES_BLOCK_SIZE], p_key);
+    }
+    for (round = 1; round <= AES128_NUM_ROUNDS; ++round)
+    {
+        aes_key_schedule_round(p_key, AES128_KEY_SIZE, rcon);
+        rcon = aes_mul2(rcon);
+        for (i = 0; i < num_blocks; ++i)
+        {
+            aes_sbox_apply_block(&p_blocks[i * AES_BLOCK_SIZE]);
+            aes_shift_rows(&p_blocks[i * AES_BLOCK_SIZE]);
+            if (round < AES128_NUM_ROUNDS)
+            {
+                aes_mix_columns(&p_blocks[i * AES_BLOCK_SIZE]);
+            }
+            aes_block_xor(&p_blocks[i * AES_BLOCK_SIZE], p_key);
+        }
+    }
+}
+
+/* Calculate the starting key state needed for decryption with on-the-fly key
+ * schedule calculation. The starting decryption key state is the last 16 bytes
+ * of the AES-128 key schedule.
+ * The decryption start key calculation is done in-place in the buffer p_key[].
+ * So p_key points to a 16-byte buffer containing the AES-128 key. On exit, it
+ * contains the decryption start key state suitable for aes128_otfks_decrypt().
+ */
+void aes128_otfks_decrypt_start_key(uint8_t p_key[AES128_KEY_SIZE])
+{
+    aes_otfks_decrypt_start_key(p_key, AES128_KEY_SIZE, AES128_KEY_SCHEDULE_SIZE);
+}
+
+/* AES-128 decryption with on-the-fly key schedule calculation.
+ *
+ * p_block points to a 16-byte buffer of encrypted data to decrypt. Decryption
+ * is done in-place in that buffer.
+ * p_key must initially point to a starting key state for decryption, which is
+ * the last 16 bytes of the AES-128 key schedule. It can be calculated from the
+ * AES-128 16-byte key by aes128_otfks_decrypt_start_key(). Key schedule is
+ * calculated on-the-fly in that buffer, so the buffer must re-initialised for
+ * subsequent decryption operations.
+ */
+void aes128_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES128_KEY_SIZE])
+{
+    aes_otfks_decrypt(p_block, p_key, AES128_KEY_SIZE, AES128_NUM_ROUNDS, AES128_KEY_SCHEDULE_LAST_RCON);
+}
+
+/* AES-192 encryption, as aes128_encrypt() but with a key schedule calculated
+ * by aes192_key_schedule().
+ */
+void aes192_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES192_KEY_SCHEDULE_SIZE])
+{
+    aes_encrypt(p_block, p_key_schedule, AES192_NUM_ROUNDS);
+}
+
+/* AES-192 decryption, as aes128_decrypt() but with a key schedule calculated
+ * by aes192_key_schedule().
+ */
+void aes192_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES192_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt(p_block, p_key_schedule, AES192_NUM_ROUNDS);
+}
+
+/* AES-192 key schedule calculation, from the 24-byte AES-192 key. */
+void aes192_key_schedule(uint8_t p_key_schedule[AES192_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES192_KEY_SIZE])
+{
+    aes_engine()->key_schedule(p_key_schedule, p_key, AES192_KEY_SIZE);
+}
+
+/* AES-192 decryption key schedule calculation, as
+ * aes128_key_schedule_decrypt() but from the 24-byte AES-192 key.
+ */
+void aes192_key_schedule_decrypt(uint8_t p_decrypt_key_schedule[AES192_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES192_KEY_SIZE])
+{
+    aes192_key_schedule(p_decrypt_key_schedule, p_key);
+    aes_key_schedule_decrypt_convert(p_decrypt_key_schedule, AES192_NUM_ROUNDS);
+}
+
+/* AES-192 decryption by the equivalent inverse cipher, as
+ * aes128_decrypt_eqinv() but with a key schedule calculated by
+ * aes192_key_schedule_decrypt().
+ */
+void aes192_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_decrypt_key_schedule[AES192_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt_eqinv(p_block, p_decrypt_key_schedule, AES192_NUM_ROUNDS);
+}
+
+/* AES-192 encryption with on-the-fly key schedule calculation.
+ *
+ * p_key must initially contain the 24 bytes of the AES-192 key. As for
+ * aes128_otfks_encrypt(), it is modified, so it must be re-initialised for
+ * subsequent encryption operations.
+ */
+void aes192_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES192_KEY_SIZE])
+{
+    aes_otfks_encrypt(p_block, p_key, AES192_KEY_SIZE, AES192_NUM_ROUNDS);
+}
+
+/* Calculate the 24-byte starting key state needed for AES-192 decryption with
+ * on-the-fly key schedule calculation, in-place from the AES-192 key.
+ */
+void aes192_otfks_decrypt_start_key(uint8_t p_key[AES192_KEY_SIZE])
+{
+    aes_otfks_decrypt_start_key(p_key, AES192_KEY_SIZE, AES192_KEY_SCHEDULE_SIZE);
+}
+
+/* AES-192 decryption with on-the-fly key schedule calculation.
+ *
+ * p_key must initially contain the key state calculated by
+ * aes192_otfks_decrypt_start_key(). It is modified, so it must be
+ * re-initialised for subsequent decryption operations.
+ */
+void aes192_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES192_KEY_SIZE])
+{
+    aes_otfks_decrypt(p_block, p_key, AES192_KEY_SIZE, AES192_NUM_ROUNDS, AES192_KEY_SCHEDULE_LAST_RCON);
+}
+
+/* AES-256 encryption, as aes128_encrypt() but with a key schedule calculated
+ * by aes256_key_schedule().
+ */
+void aes256_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES256_KEY_SCHEDULE_SIZE])
+{
+    aes_encrypt(p_block, p_key_schedule, AES256_NUM_ROUNDS);
+}
+
+/* AES-256 decryption, as aes128_decrypt() but with a key schedule calculated
+ * by aes256_key_schedule().
+ */
+void aes256_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES256_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt(p_block, p_key_schedule, AES256_NUM_ROUNDS);
+}
+
+/* AES-256 key schedule calculation, from the 32-byte AES-256 key. */
+void aes256_key_schedule(uint8_t p_key_schedule[AES256_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES256_KEY_SIZE])
+{
+    aes_engine()->key_schedule(p_key_schedule, p_key, AES256_KEY_SIZE);
+}
+
+/* AES-256 decryption key schedule calculation, as
+ * aes128_key_schedule_decrypt() but from the 32-byte AES-256 key.
+ */
+void aes256_key_schedule_decrypt(uint8_t p_decrypt_key_schedule[AES256_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES256_KEY_SIZE])
+{
+    aes256_key_schedule(p_decrypt_key_schedule, p_key);
+    aes_key_schedule_decrypt_convert(p_decrypt_key_schedule, AES256_NUM_ROUNDS);
+}
+
+/* AES-256 decryption by the equivalent inverse cipher, as
+ * aes128_decrypt_eqinv() but with a key schedule calculated by
+ * aes256_key_schedule_decrypt().
+ */
+void aes256_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_decrypt_key_schedule[AES256_KEY_SCHEDULE_SIZE])
+{
+    aes_decrypt_eqinv(p_block, p_decrypt_key_schedule, AES256_NUM_ROUNDS);
+}
+
+/* AES-256 encryption with on-the-fly key schedule calculation.
+ *
+ * p_key must initially contain the 32 bytes of the AES-256 key. As for
+ * aes128_otfks_encrypt(), it is modified, so it must be re-initialised for
+ * subsequent encryption operations.
+ */
+void aes256_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES256_KEY_SIZE])
+{
+    aes_otfks_encrypt(p_block, p_key, AES256_KEY_SIZE, AES256_NUM_ROUNDS);
+}
+
+/* Calculate the 32-byte starting key state needed for AES-256 decryption with
+ * on-the-fly key schedule calculation, in-place from the AES-256 key.
+ */
+void aes256_otfks_decrypt_start_key(uint8_t p_key[AES256_KEY_SIZE])
+{
+    aes_otfks_decrypt_start_key(p_key, AES256_KEY_SIZE, AES256_KEY_SCHEDULE_SIZE);
+}
+
+/* AES-256 decryption with on-the-fly key schedule calculation.
+ *
+ * p_key must initially contain the key state calculated by
+ * aes256_otfks_decrypt_start_key(). It is modified, so it must be
+ * re-initialised for subsequent decryption operations.
+ */
+void aes256_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES256_KEY_SIZE])
+{
+    aes_otfks_decrypt(p_block, p_key, AES256_KEY_SIZE, AES256_NUM_ROUNDS, AES256_KEY_SCHEDULE_LAST_RCON);
+}
+
+/*
+ * Get the compiled-in engine with the given index, counting from 0 and only
+ * counting engines which the CPU supports, or NULL if index is past the last
+ * one. The last one is the default.
+ */
+const aes_engine_t * aes_engine_get(size_t index)
+{
+    size_t              i;
+
+    for (i = 0; i < AES_NUM_ENGINES; i++)
+    {
+        if (aes_engine_is_available(&aes_engines[i]))
+        {
+            if (index == 0)
+            {
+                return &aes_engines[i];
+            }
+            index--;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Get a compiled-in engine which the CPU supports by name, or NULL if there
+ * is none.
+ */
+const aes_engine_t * aes_engine_find(const char * p_name)
+{
+    const aes_engine_t    * p_engine;
+    size_t                  i;
+
+    for (i = 0; (p_engine = aes_engine_get(i)) != NULL; i++)
+    {
+        if (strcmp(p_engine->name, p_name) == 0)
+        {
+            return p_engine;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Get the engine used by the aes128_, aes192_ and aes256_ functions.
+ *
+ * On first use, this is the engine named by the AES_MIN_ENGINE environment
+ * variable if that is set to an available one, otherwise the default.
+ */
+const aes_engine_t * aes_engine_current(void)
+{
+    return aes_engine();
+}
+
+/*
+ * Set the engine used by the aes128_, aes192_ and aes256_ functions. Returns
+ * false, leaving the engine unchanged, if p_engine is NULL or the CPU
+ * doesn't support it.
+ *
+ * Key schedules are the same for all engines, so keys calculated before the
+ * change can still be used. This should not be called while other threads
+ * are using the library, as they may use either engine for a while.
+ */
+bool aes_engine_set(const aes_engine_t * p_engine)
+{
+    if (p_engine == NULL || !aes_engine_is_available(p_engine))
+    {
+        return false;
+    }
+    p_aes_engine_current = p_engine;
+    return true;
+}
+
+uint8_t _aes_inv_for_test(uint8_t a)
+{
+    return aes_inv(a);
+}
+
+void _aes_sbox_apply_block_for_test(uint8_t p_block[AES_BLOCK_SIZE])
+{
+    aes_sbox_apply_block(p_block);
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Choose the engine on first use. If several threads race on this, each
+ * stores the same engine, so no locking is needed. */
+static const aes_engine_t * aes_engine_init(void)
+{
+    const aes_engine_t    * p_engine = NULL;
+    const char            * p_name;
+    size_t                  i;
+
+    p_name = getenv(AES_ENGINE_ENV_NAME);
+    if (p_name != NULL)
+    {
+        p_engine = aes_engine_find(p_name);
+    }
+    for (i = AES_NUM_ENGINES; p_engine == NULL; i--)
+    {
+        /* The byte-oriented engine is always available. */
+        if (aes_engine_is_available(&aes_engines[i - 1u]))
+        {
+            p_engine = &aes_engines[i - 1u];
+        }
+    }
+    p_aes_engine_current = p_engine;
+    return p_engine;
+}
+
+static bool aes_engine_is_available(const aes_engine_t * p_engine)
+{
+    return (p_engine->is_available == NULL) || p_engine->is_available();
+}
+
+/* Byte-oriented encryption for any key size, with num_rounds 10, 12 or 14.
+ */
+static void aes_byte_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
 {
     uint_fast8_t    round;
 
     aes_block_xor(p_block, p_key_schedule);
-    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    for (round = 1; round < num_rounds; ++round)
     {
         aes_sbox_apply_block(p_block);
         aes_shift_rows(p_block);
@@ -195,24 +866,42 @@ void aes128_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedul
     }
     aes_sbox_apply_block(p_block);
     aes_shift_rows(p_block);
-    aes_block_xor(p_block, &p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+    aes_block_xor(p_block, &p_key_schedule[num_rounds * AES_BLOCK_SIZE]);
 }
 
-/* AES-128 decryption.
- *
- * p_block points to a 16-byte buffer of encrypted data to decrypt. Decryption
- * is done in-place in that buffer.
- * p_key_schedule points to a pre-calculated key schedule, which can be
- * calculated by aes128_key_schedule().
+/* Byte-oriented encryption of several independent blocks, one at a time. */
+static void aes_byte_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    while (num_blocks)
+    {
+        aes_byte_encrypt(p_blocks, p_key_schedule, num_rounds);
+        p_blocks += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+}
+
+/* Byte-oriented encryption of several independent blocks with different
+ * keys, one at a time.
  */
-void aes128_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE])
+static void aes_byte_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds)
+{
+    while (num_blocks)
+    {
+        aes_byte_encrypt(*p_blocks++, *p_key_schedules++, num_rounds);
+        num_blocks--;
+    }
+}
+
+/* Byte-oriented decryption for any key size, with num_rounds 10, 12 or 14.
+ */
+static void aes_byte_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
 {
     uint_fast8_t    round;
 
-    aes_block_xor(p_block, &p_key_schedule[AES128_NUM_ROUNDS * AES_BLOCK_SIZE]);
+    aes_block_xor(p_block, &p_key_schedule[num_rounds * AES_BLOCK_SIZE]);
     aes_shift_rows_inv(p_block);
     aes_sbox_inv_apply_block(p_block);
-    for (round = AES128_NUM_ROUNDS - 1u; round >= 1; --round)
+    for (round = num_rounds - 1u; round >= 1; --round)
     {
         aes_block_xor(p_block, &p_key_schedule[round * AES_BLOCK_SIZE]);
         aes_mix_columns_inv(p_block);
@@ -222,21 +911,83 @@ void aes128_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedul
     aes_block_xor(p_block, p_key_schedule);
 }
 
-void aes128_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE])
+/* Byte-oriented decryption of several independent blocks by the equivalent
+ * inverse cipher, one at a time. */
+static void aes_byte_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    while (num_blocks)
+    {
+        aes_byte_decrypt_eqinv(p_blocks, p_decrypt_key_schedule, num_rounds);
+        p_blocks += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+}
+
+/* Byte-oriented decryption by the equivalent inverse cipher for any key
+ * size, with num_rounds 10, 12 or 14.
+ */
+static void aes_byte_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
 {
     uint_fast8_t    round;
-    uint8_t       * p_key_0 = p_key_schedule + AES128_KEY_SIZE;
+
+    aes_block_xor(p_block, p_decrypt_key_schedule);
+    for (round = 1; round < num_rounds; ++round)
+    {
+        aes_sbox_inv_apply_block(p_block);
+        aes_shift_rows_inv(p_block);
+        aes_mix_columns_inv(p_block);
+        aes_block_xor(p_block, &p_decrypt_key_schedule[round * AES_BLOCK_SIZE]);
+    }
+    aes_sbox_inv_apply_block(p_block);
+    aes_shift_rows_inv(p_block);
+    aes_block_xor(p_block, &p_decrypt_key_schedule[num_rounds * AES_BLOCK_SIZE]);
+}
+
+/* Key schedule calculation for the byte-oriented engine, for any key size. */
+static void aes_byte_key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size)
+{
+    aes_key_schedule(p_key_schedule, p_key, key_size,
+                     AES_BLOCK_SIZE * (key_size / AES_KEY_SCHEDULE_WORD_SIZE + 7u));
+}
+
+#ifdef ENABLE_AESNI
+
+/* Key schedule calculation for the AES-NI engine, which has its own
+ * calculation for AES-128 only. */
+static void aes_aesni_engine_key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size)
+{
+    if (key_size == AES128_KEY_SIZE)
+    {
+        aes128_aesni_key_schedule(p_key_schedule, p_key);
+    }
+    else
+    {
+        aes_byte_key_schedule(p_key_schedule, p_key, key_size);
+    }
+}
+
+#endif
+
+/* Key schedule calculation for any key size.
+ *
+ * key_size is 16, 24 or 32 bytes. key_schedule_size is the size of the whole
+ * key schedule, 16 bytes for each round plus one.
+ */
+static void aes_key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t key_schedule_size)
+{
+    uint_fast8_t    word;
+    uint8_t       * p_key_0 = p_key_schedule + key_size;
     uint8_t         temp_byte;
     uint8_t         rcon = AES_KEY_SCHEDULE_FIRST_RCON;
 
-    /* Initial part of key schedule is simply the AES-128 key copied verbatim. */
-    memcpy(p_key_schedule, p_key, AES128_KEY_SIZE);
+    /* Initial part of key schedule is simply the AES key copied verbatim. */
+    memcpy(p_key_schedule, p_key, key_size);
 
-    for (round = 0; round < (AES128_KEY_SCHEDULE_SIZE - AES128_KEY_SIZE) / AES_KEY_SCHEDULE_WORD_SIZE; ++round)
+    for (word = 0; word < (key_schedule_size - key_size) / AES_KEY_SCHEDULE_WORD_SIZE; ++word)
     {
         memcpy(p_key_0, p_key_0 - AES_KEY_SCHEDULE_WORD_SIZE, AES_KEY_SCHEDULE_WORD_SIZE);
 
-        if ((round % (AES128_KEY_SIZE / AES_KEY_SCHEDULE_WORD_SIZE)) == 0)
+        if ((word % (key_size / AES_KEY_SCHEDULE_WORD_SIZE)) == 0)
         {
             /* Rotate previous word and apply S-box. Also XOR Rcon for first byte. */
             temp_byte = p_key_0[0];
@@ -248,129 +999,194 @@ void aes128_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const
             /* Next rcon */
             rcon = aes_mul2(rcon);
         }
+        else if (key_size == AES256_KEY_SIZE &&
+                 (word % (key_size / AES_KEY_SCHEDULE_WORD_SIZE)) == AES_NUM_COLUMNS)
+        {
+            /* AES-256 only: apply S-box to previous word, in the middle. */
+            aes_sbox_apply_word(p_key_0, p_key_0);
+        }
 
-        /* XOR in bytes from AES128_KEY_SIZE bytes ago */
-        p_key_0[0] ^= p_key_0[0 - (signed)AES128_KEY_SIZE];
-        p_key_0[1] ^= p_key_0[1 - (signed)AES128_KEY_SIZE];
-        p_key_0[2] ^= p_key_0[2 - (signed)AES128_KEY_SIZE];
-        p_key_0[3] ^= p_key_0[3 - (signed)AES128_KEY_SIZE];
+        /* XOR in bytes from key_size bytes ago */
+        p_key_0[0] ^= p_key_0[0 - (signed)key_size];
+        p_key_0[1] ^= p_key_0[1 - (signed)key_size];
+        p_key_0[2] ^= p_key_0[2 - (signed)key_size];
+        p_key_0[3] ^= p_key_0[3 - (signed)key_size];
 
         p_key_0 += AES_KEY_SCHEDULE_WORD_SIZE;
     }
 }
 
-/* AES-128 encryption with on-the-fly key schedule calculation.
+/* Convert a standard key schedule in-place to a decryption key schedule for
+ * the equivalent inverse cipher: the round keys are reversed, and
+ * InvMixColumns is applied to all but the first and last.
+ */
+static void aes_byte_key_schedule_decrypt_convert(uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    uint8_t       * p_first;
+    uint8_t       * p_last;
+    uint8_t         temp_byte;
+    uint_fast8_t    i;
+
+    p_first = p_key_schedule;
+    p_last = p_key_schedule + num_rounds * AES_BLOCK_SIZE;
+    while (p_first < p_last)
+    {
+        for (i = 0; i < AES_BLOCK_SIZE; ++i)
+        {
+            temp_byte = p_first[i];
+            p_first[i] = p_last[i];
+            p_last[i] = temp_byte;
+        }
+        p_first += AES_BLOCK_SIZE;
+        p_last -= AES_BLOCK_SIZE;
+    }
+    for (i = 1; i < num_rounds; ++i)
+    {
+        aes_mix_columns_inv(&p_key_schedule[i * AES_BLOCK_SIZE]);
+    }
+}
+
+/* Encryption with on-the-fly key schedule calculation, for any key size.
  *
- * p_block points to a 16-byte buffer of plain data to encrypt. Encryption
- * is done in-place in that buffer.
- * p_key must initially point to a starting key state for encryption, which is
- * simply the 16 bytes of the AES-128 key. Key schedule is calculated on-the-
- * fly in that buffer, so the buffer must re-initialised for subsequent
- * encryption operations.
+ * The key state in p_key holds key_size bytes of the key schedule. Each round
+ * key is taken from it a word at a time, and the key state is advanced by
+ * aes_key_schedule_round() whenever all of its words have been used. For
+ * AES-128 that is once per round; for AES-192 and AES-256 round keys may
+ * straddle two key states.
  */
-void aes128_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES128_KEY_SIZE])
+static void aes_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t num_rounds)
 {
     uint_fast8_t    round;
+    uint_fast8_t    key_pos = 0;
     uint8_t         rcon = AES_KEY_SCHEDULE_FIRST_RCON;
 
-    aes_block_xor(p_block, p_key);
-    for (round = 1; round < AES128_NUM_ROUNDS; ++round)
+    aes_otfks_add_round_key(p_block, p_key, key_size, &key_pos, &rcon);
+    for (round = 1; round < num_rounds; ++round)
     {
-        aes128_key_schedule_round(p_key, rcon);
         aes_sbox_apply_block(p_block);
         aes_shift_rows(p_block);
         aes_mix_columns(p_block);
-        aes_block_xor(p_block, p_key);
-
-        /* Next rcon */
-        rcon = aes_mul2(rcon);
+        aes_otfks_add_round_key(p_block, p_key, key_size, &key_pos, &rcon);
     }
-    aes128_key_schedule_round(p_key, rcon);
     aes_sbox_apply_block(p_block);
     aes_shift_rows(p_block);
-    aes_block_xor(p_block, p_key);
+    aes_otfks_add_round_key(p_block, p_key, key_size, &key_pos, &rcon);
 }
 
-/* Calculate the starting key state needed for decryption with on-the-fly key
- * schedule calculation. The starting decryption key state is the last 16 bytes
- * of the AES-128 key schedule.
- * The decryption start key calculation is done in-place in the buffer p_key[].
- * So p_key points to a 16-byte buffer containing the AES-128 key. On exit, it
- * contains the decryption start key state suitable for aes128_otfks_decrypt().
+/* Calculate the starting key state for decryption with on-the-fly key
+ * schedule calculation, for any key size. This is the key state which
+ * starts with the last round key: the last key state reached by
+ * aes_otfks_encrypt(), and the first one to cover the end of the key
+ * schedule, so its first 16 bytes are always the last round key.
  */
-void aes128_otfks_decrypt_start_key(uint8_t p_key[AES128_KEY_SIZE])
+static void aes_otfks_decrypt_start_key(uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t key_schedule_size)
 {
-    uint_fast8_t    round;
+    uint_fast8_t    step;
+    uint_fast8_t    num_steps;
     uint8_t         rcon = AES_KEY_SCHEDULE_FIRST_RCON;
 
-    for (round = 0; round < AES128_NUM_ROUNDS; ++round)
+    num_steps = (key_schedule_size - 1u) / key_size;
+    for (step = 0; step < num_steps; ++step)
     {
-        aes128_key_schedule_round(p_key, rcon);
+        aes_key_schedule_round(p_key, key_size, rcon);
 
         /* Next rcon */
         rcon = aes_mul2(rcon);
     }
 }
 
-/* AES-128 decryption with on-the-fly key schedule calculation.
+/* Decryption with on-the-fly key schedule calculation, for any key size.
  *
- * p_block points to a 16-byte buffer of encrypted data to decrypt. Decryption
- * is done in-place in that buffer.
- * p_key must initially point to a starting key state for decryption, which is
- * the last 16 bytes of the AES-128 key schedule. It can be calculated from the
- * AES-128 16-byte key by aes128_otfks_decrypt_start_key(). Key schedule is
- * calculated on-the-fly in that buffer, so the buffer must re-initialised for
- * subsequent decryption operations.
+ * The key state is walked backwards a word at a time, starting at the last
+ * round key which is the first 16 bytes of the starting key state, and
+ * stepped back by aes_key_schedule_inv_round() whenever all of its words have
+ * been used. last_rcon is the rcon of the last step done by
+ * aes_otfks_decrypt_start_key().
  */
-void aes128_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES128_KEY_SIZE])
+static void aes_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size, uint_fast8_t num_rounds, uint8_t last_rcon)
 {
     uint_fast8_t    round;
-    uint8_t         rcon = AES128_KEY_SCHEDULE_LAST_RCON;
+    uint_fast8_t    key_pos = AES_BLOCK_SIZE;
+    uint8_t         rcon = last_rcon;
 
-    aes_block_xor(p_block, p_key);
+    aes_otfks_add_round_key_inv(p_block, p_key, key_size, &key_pos, &rcon);
     aes_shift_rows_inv(p_block);
     aes_sbox_inv_apply_block(p_block);
-    for (round = AES128_NUM_ROUNDS - 1u; round >= 1; --round)
+    for (round = num_rounds - 1u; round >= 1; --round)
     {
-        aes128_key_schedule_inv_round(p_key, rcon);
-        aes_block_xor(p_block, p_key);
+        aes_otfks_add_round_key_inv(p_block, p_key, key_size, &key_pos, &rcon);
         aes_mix_columns_inv(p_block);
         aes_shift_rows_inv(p_block);
         aes_sbox_inv_apply_block(p_block);
-
-        /* Previous rcon */
-        rcon = aes_div2(rcon);
     }
-    aes128_key_schedule_inv_round(p_key, rcon);
-    aes_block_xor(p_block, p_key);
+    aes_otfks_add_round_key_inv(p_block, p_key, key_size, &key_pos, &rcon);
 }
 
-uint8_t _aes_inv_for_test(uint8_t a)
+/* XOR the next round key into the block for aes_otfks_encrypt(), word by
+ * word from the key state at *p_key_pos, advancing the key state as needed.
+ */
+static void aes_otfks_add_round_key(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size,
+                                    uint_fast8_t * p_key_pos, uint8_t * p_rcon)
 {
-    return aes_inv(a);
+    uint_fast8_t    column;
+    uint_fast8_t    i;
+
+    for (column = 0; column < AES_NUM_COLUMNS; ++column)
+    {
+        if (*p_key_pos == key_size)
+        {
+            aes_key_schedule_round(p_key, key_size, *p_rcon);
+            *p_rcon = aes_mul2(*p_rcon);
+            *p_key_pos = 0;
+        }
+        for (i = 0; i < AES_KEY_SCHEDULE_WORD_SIZE; ++i)
+        {
+            p_block[column * AES_COLUMN_SIZE + i] ^= p_key[*p_key_pos + i];
+        }
+        *p_key_pos += AES_KEY_SCHEDULE_WORD_SIZE;
+    }
 }
 
-void _aes_sbox_apply_block_for_test(uint8_t p_block[AES_BLOCK_SIZE])
+/* XOR the previous round key into the block for aes_otfks_decrypt(), word by
+ * word backwards from the key state at *p_key_pos, stepping the key state
+ * back as needed.
+ */
+static void aes_otfks_add_round_key_inv(uint8_t p_block[AES_BLOCK_SIZE], uint8_t * p_key, uint_fast8_t key_size,
+                                        uint_fast8_t * p_key_pos, uint8_t * p_rcon)
 {
-    aes_sbox_apply_block(p_block);
-}
+    uint_fast8_t    column;
+    uint_fast8_t    i;
 
-/*****************************************************************************
- * Local functions
- ****************************************************************************/
+    for (column = AES_NUM_COLUMNS; column-- > 0; )
+    {
+        if (*p_key_pos == 0)
+        {
+            aes_key_schedule_inv_round(p_key, key_size, *p_rcon);
+            *p_rcon = aes_div2(*p_rcon);
+            *p_key_pos = key_size;
+        }
+        *p_key_pos -= AES_KEY_SCHEDULE_WORD_SIZE;
+        for (i = 0; i < AES_KEY_SCHEDULE_WORD_SIZE; ++i)
+        {
+            p_block[column * AES_COLUMN_SIZE + i] ^= p_key[*p_key_pos + i];
+        }
+    }
+}
 
-/* This is used for aes128_otfks_encrypt(), on-the-fly key schedule encryption.
- * It is also used by aes128_otfks_decrypt_start_key() to calculate the
- * starting key state for decryption with on-the-fly key schedule calculation.
- * rcon for the round must be provided, out of the sequence:
+/* This advances the key_size-byte key state by one step of the key schedule,
+ * for on-the-fly key schedule encryption. It is also used by
+ * aes_otfks_decrypt_start_key() to calculate the starting key state for
+ * decryption with on-the-fly key schedule calculation.
+ * rcon for the step must be provided, out of the sequence:
  *     1, 2, 4, 8, 16, 32, 64, 128, 27, 54
  * Subsequent values can be calculated with aes_mul2().
  */
-static void aes128_key_schedule_round(uint8_t p_key[AES128_KEY_SIZE], uint8_t rcon)
+static void aes_key_schedule_round(uint8_t * p_key, uint_fast8_t key_size, uint8_t rcon)
 {
-    uint_fast8_t    round;
+    uint_fast8_t    word;
     uint8_t       * p_key_0 = p_key;
-    uint8_t       * p_key_m1 = p_key + AES128_KEY_SIZE - AES_KEY_SCHEDULE_WORD_SIZE;
+    uint8_t       * p_key_m1 = p_key + key_size - AES_KEY_SCHEDULE_WORD_SIZE;
+    uint8_t         sbox_word[AES_KEY_SCHEDULE_WORD_SIZE];
 
     /* Rotate previous word and apply S-box. Also XOR Rcon for first byte. */
     p_key_0[0] ^= aes_sbox(p_key_m1[1]) ^ rcon;
@@ -378,11 +1194,18 @@ static void aes128_key_schedule_round(uint8_t p_key[AES128_KEY_SIZE], uint8_t rc
     p_key_0[2] ^= aes_sbox(p_key_m1[3]);
     p_key_0[3] ^= aes_sbox(p_key_m1[0]);
 
-    for (round = 1; round < AES128_KEY_SIZE / AES_KEY_SCHEDULE_WORD_SIZE; ++round)
+    for (word = 1; word < key_size / AES_KEY_SCHEDULE_WORD_SIZE; ++word)
     {
         p_key_m1 = p_key_0;
         p_key_0 += AES_KEY_SCHEDULE_WORD_SIZE;
 
+        if (key_size == AES256_KEY_SIZE && word == AES_NUM_COLUMNS)
+        {
+            /* AES-256 only: XOR in previous word with S-box applied */
+            aes_sbox_apply_word(sbox_word, p_key_m1);
+            p_key_m1 = sbox_word;
+        }
+
         /* XOR in previous word */
         p_key_0[0] ^= p_key_m1[0];
         p_key_0[1] ^= p_key_m1[1];
@@ -391,37 +1214,61 @@ static void aes128_key_schedule_round(uint8_t p_key[AES128_KEY_SIZE], uint8_t rc
     }
 }
 
-/* This is used for aes128_otfks_decrypt(), on-the-fly key schedule decryption.
- * rcon for the round must be provided, out of the sequence:
+/* This steps the key_size-byte key state back by one step of the key
+ * schedule, for on-the-fly key schedule decryption.
+ * rcon for the step must be provided, out of the sequence:
  *     54, 27, 128, 64, 32, 16, 8, 4, 2, 1
  * Subsequent values can be calculated with aes_div2().
  */
-static void aes128_key_schedule_inv_round(uint8_t p_key[AES128_KEY_SIZE], uint8_t rcon)
+static void aes_key_schedule_inv_round(uint8_t * p_key, uint_fast8_t key_size, uint8_t rcon)
 {
-    uint_fast8_t    round;
-    uint8_t       * p_key_0 = p_key + AES128_KEY_SIZE - AES_KEY_SCHEDULE_WORD_SIZE;
+    uint_fast8_t    word;
+    uint8_t       * p_key_0 = p_key + key_size - AES_KEY_SCHEDULE_WORD_SIZE;
     uint8_t       * p_key_m1 = p_key_0 - AES_KEY_SCHEDULE_WORD_SIZE;
+    const uint8_t * p_prev;
+    uint8_t         sbox_word[AES_KEY_SCHEDULE_WORD_SIZE];
 
-    for (round = 1; round < AES128_KEY_SIZE / AES_KEY_SCHEDULE_WORD_SIZE; ++round)
+    for (word = key_size / AES_KEY_SCHEDULE_WORD_SIZE - 1u; word >= 1; --word)
     {
+        p_prev = p_key_m1;
+        if (key_size == AES256_KEY_SIZE && word == AES_NUM_COLUMNS)
+        {
+            /* AES-256 only: XOR in previous word with S-box applied */
+            aes_sbox_apply_word(sbox_word, p_key_m1);
+            p_prev = sbox_word;
+        }
+
         /* XOR in previous word */
-        p_key_0[0] ^= p_key_m1[0];
-        p_key_0[1] ^= p_key_m1[1];
-        p_key_0[2] ^= p_key_m1[2];
-        p_key_0[3] ^= p_key_m1[3];
+        p_key_0[0] ^= p_prev[0];
+        p_key_0[1] ^= p_prev[1];
+        p_key_0[2] ^= p_prev[2];
+        p_key_0[3] ^= p_prev[3];
 
         p_key_0 = p_key_m1;
         p_key_m1 -= AES_KEY_SCHEDULE_WORD_SIZE;
     }
 
     /* Rotate previous word and apply S-box. Also XOR Rcon for first byte. */
-    p_key_m1 = p_key + AES128_KEY_SIZE - AES_KEY_SCHEDULE_WORD_SIZE;
+    p_key_m1 = p_key + key_size - AES_KEY_SCHEDULE_WORD_SIZE;
     p_key_0[0] ^= aes_sbox(p_key_m1[1]) ^ rcon;
     p_key_0[1] ^= aes_sbox(p_key_m1[2]);
     p_key_0[2] ^= aes_sbox(p_key_m1[3]);
     p_key_0[3] ^= aes_sbox(p_key_m1[0]);
 }
 
+/* Apply the S-box to each byte of a 4-byte key schedule word. p_out may be
+ * the same as p_in.
+ */
+static void aes_sbox_apply_word(uint8_t p_out[AES_KEY_SCHEDULE_WORD_SIZE], const uint8_t p_in[AES_KEY_SCHEDULE_WORD_SIZE])
+{
+    uint_fast8_t    i;
+
+    for (i = 0; i < AES_KEY_SCHEDULE_WORD_SIZE; ++i)
+    {
+        p_out[i] = aes_sbox(p_in[i]);
+    }
+}
+
 /* Multiply two numbers in Galois field GF(2^8) with reduction polynomial
  * 0x11B.
  * TODO: To prevent timing attacks, analyse the compiler-generated code
@@ -535,6 +1382,94 @@ static void aes_sbox_inv_apply_block(uint8_t p_block[AES_BLOCK_SIZE])
     }
 }
 
+#ifdef ENABLE_AES_WORD32
+
+/* Word-oriented ShiftRows and MixColumns. Each column is handled as a
+ * uint32_t, with row 0 in the least significant byte, so that a rotate of the
+ * word rotates the bytes of the column. The column words are loaded and
+ * stored a byte at a time, so this doesn't depend on alignment or
+ * endianness. No tables are needed.
+ */
+
+static void aes_shift_rows(uint8_t p_block[AES_BLOCK_SIZE])
+{
+    uint32_t        columns[AES_NUM_COLUMNS];
+    uint_fast8_t    i;
+
+    for (i = 0; i < AES_NUM_COLUMNS; i++)
+    {
+        columns[i] = aes_load_column(&p_block[i * AES_COLUMN_SIZE]);
+    }
+    /* Row r of column i comes from column (i + r) */
+    for (i = 0; i < AES_NUM_COLUMNS; i++)
+    {
+        aes_store_column(&p_block[i * AES_COLUMN_SIZE],
+                         (columns[i] & 0x000000FFu) |
+                         (columns[(i + 1u) % AES_NUM_COLUMNS] & 0x0000FF00u) |
+                         (columns[(i + 2u) % AES_NUM_COLUMNS] & 0x00FF0000u) |
+                         (columns[(i + 3u) % AES_NUM_COLUMNS] & 0xFF000000u));
+    }
+}
+
+static void aes_shift_rows_inv(uint8_t p_block[AES_BLOCK_SIZE])
+{
+    uint32_t        columns[AES_NUM_COLUMNS];
+    uint_fast8_t    i;
+
+    for (i = 0; i < AES_NUM_COLUMNS; i++)
+    {
+        columns[i] = aes_load_column(&p_block[i * AES_COLUMN_SIZE]);
+    }
+    /* Row r of column i comes from column (i - r) */
+    for (i = 0; i < AES_NUM_COLUMNS; i++)
+    {
+        aes_store_column(&p_block[i * AES_COLUMN_SIZE],
+                         (columns[i] & 0x000000FFu) |
+                         (columns[(i + 3u) % AES_NUM_COLUMNS] & 0x0000FF00u) |
+                         (columns[(i + 2u) % AES_NUM_COLUMNS] & 0x00FF0000u) |
+                         (columns[(i + 1u) % AES_NUM_COLUMNS] & 0xFF000000u));
+    }
+}
+
+/* Each output byte is 2 * a[j] ^ 3 * a[j + 1] ^ a[j + 2] ^ a[j + 3]. With
+ * t = w ^ rotr8(w), that is xtime(t) ^ rotr8(w) ^ rotr16(t).
+ */
+static void aes_mix_columns(uint8_t p_block[AES_BLOCK_SIZE])
+{
+    uint_fast8_t    i;
+    uint32_t        column;
+    uint32_t        temp;
+
+    for (i = 0; i < AES_NUM_COLUMNS; i++)
+    {
+        column = aes_load_column(&p_block[i * AES_COLUMN_SIZE]);
+        temp = column ^ aes_rotate_right_uint32(column, 8u);
+        column = aes_mul2_uint32(temp) ^ aes_rotate_right_uint32(column, 8u) ^ aes_rotate_right_uint32(temp, 16u);
+        aes_store_column(&p_block[i * AES_COLUMN_SIZE], column);
+    }
+}
+
+/* The inverse MixColumns matrix is the MixColumns matrix multiplied by
+ * {05, 00, 04, 00}, so first apply that, which is
+ *     w ^ xtime(xtime(w ^ rotr16(w)))
+ * then do MixColumns.
+ */
+static void aes_mix_columns_inv(uint8_t p_block[AES_BLOCK_SIZE])
+{
+    uint_fast8_t    i;
+    uint32_t        column;
+
+    for (i = 0; i < AES_NUM_COLUMNS; i++)
+    {
+        column = aes_load_column(&p_block[i * AES_COLUMN_SIZE]);
+        column ^= aes_mul2_uint32(aes_mul2_uint32(column ^ aes_rotate_right_uint32(column, 16u)));
+        aes_store_column(&p_block[i * AES_COLUMN_SIZE], column);
+    }
+    aes_mix_columns(p_block);
+}
+
+#else
+
 static void aes_shift_rows(uint8_t p_block[AES_BLOCK_SIZE])
 {
     uint8_t temp_byte;
@@ -649,3 +1584,5 @@ static void aes_mix_columns_inv(uint8_t p_block[AES_BLOCK_SIZE])
         memcpy(&p_block[i * AES_COLUMN_SIZE], temp_column, AES_COLUMN_SIZE);
     }
 }
+
+#endif
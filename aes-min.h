@@ -1,8 +1,8 @@
 /*****************************************************************************
  * aes-min.h
  *
- * Minimal byte-oriented AES-128 encryption/decryption implementation suitable
- * for small microprocessors.
+ * Minimal byte-oriented AES-128/192/256 encryption/decryption implementation
+ * suitable for small microprocessors.
  ****************************************************************************/
 
 #ifndef AES_MIN_H
@@ -12,6 +12,8 @@
  * Includes
  ****************************************************************************/
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*****************************************************************************
@@ -28,6 +30,46 @@
 #define AES128_KEY_SIZE             16u
 #define AES128_KEY_SCHEDULE_SIZE    (AES_BLOCK_SIZE * (AES128_NUM_ROUNDS + 1u))
 
+#define AES192_NUM_ROUNDS           12u
+#define AES192_KEY_SIZE             24u
+#define AES192_KEY_SCHEDULE_SIZE    (AES_BLOCK_SIZE * (AES192_NUM_ROUNDS + 1u))
+
+#define AES256_NUM_ROUNDS           14u
+#define AES256_KEY_SIZE             32u
+#define AES256_KEY_SCHEDULE_SIZE    (AES_BLOCK_SIZE * (AES256_NUM_ROUNDS + 1u))
+
+/* Number of independent blocks worth passing to aes128_encrypt_blocks() and
+ * the like at once, see aes128_encrypt_blocks(). */
+#define AES_PARALLEL_BLOCKS         8u
+
+/* Environment variable naming the engine to use, see aes_engine_current(). */
+#define AES_ENGINE_ENV_NAME         "AES_MIN_ENGINE"
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Operations of one AES implementation ("engine"), for any key size, with
+ * key_size 16, 24 or 32 and num_rounds 10, 12 or 14. The key schedules are
+ * the same for all engines.
+ *
+ * is_available is NULL if the engine runs on any CPU.
+ */
+typedef struct
+{
+    const char        * name;
+    bool             (* is_available)(void);
+    void             (* key_schedule)(uint8_t * p_key_schedule, const uint8_t * p_key, uint_fast8_t key_size);
+    void             (* encrypt)(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+    void             (* encrypt_blocks)(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+    void             (* encrypt_multi)(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds);
+    void             (* decrypt)(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+    void             (* decrypt_eqinv)(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+    void             (* decrypt_eqinv_blocks)(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+    void             (* key_schedule_decrypt_convert)(uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+} aes_engine_t;
+
 /*****************************************************************************
  * Inline functions
  ****************************************************************************/
@@ -53,12 +95,52 @@ static inline void aes_block_xor(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t
 void aes128_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
 void aes128_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
 
+void aes128_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+void aes128_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks);
+void aes128_decrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+
 void aes128_key_schedule(uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE]);
 
+void aes128_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+void aes128_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE]);
+void aes128_key_schedule_decrypt(uint8_t p_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES128_KEY_SIZE]);
+
 void aes128_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES128_KEY_SIZE]);
+void aes128_otfks_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, uint8_t p_key[AES128_KEY_SIZE]);
 void aes128_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_decrypt_start_key[AES128_KEY_SIZE]);
 
 void aes128_otfks_decrypt_start_key(uint8_t p_key[AES128_KEY_SIZE]);
 
+void aes192_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES192_KEY_SCHEDULE_SIZE]);
+void aes192_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES192_KEY_SCHEDULE_SIZE]);
+
+void aes192_key_schedule(uint8_t p_key_schedule[AES192_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES192_KEY_SIZE]);
+
+void aes192_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_decrypt_key_schedule[AES192_KEY_SCHEDULE_SIZE]);
+void aes192_key_schedule_decrypt(uint8_t p_decrypt_key_schedule[AES192_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES192_KEY_SIZE]);
+
+void aes192_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES192_KEY_SIZE]);
+void aes192_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_decrypt_start_key[AES192_KEY_SIZE]);
+
+void aes192_otfks_decrypt_start_key(uint8_t p_key[AES192_KEY_SIZE]);
+
+void aes256_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES256_KEY_SCHEDULE_SIZE]);
+void aes256_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key_schedule[AES256_KEY_SCHEDULE_SIZE]);
+
+void aes256_key_schedule(uint8_t p_key_schedule[AES256_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES256_KEY_SIZE]);
+
+void aes256_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_decrypt_key_schedule[AES256_KEY_SCHEDULE_SIZE]);
+void aes256_key_schedule_decrypt(uint8_t p_decrypt_key_schedule[AES256_KEY_SCHEDULE_SIZE], const uint8_t p_key[AES256_KEY_SIZE]);
+
+void aes256_otfks_encrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_key[AES256_KEY_SIZE]);
+void aes256_otfks_decrypt(uint8_t p_block[AES_BLOCK_SIZE], uint8_t p_decrypt_start_key[AES256_KEY_SIZE]);
+
+void aes256_otfks_decrypt_start_key(uint8_t p_key[AES256_KEY_SIZE]);
+
+const aes_engine_t * aes_engine_get(size_t index);
+const aes_engine_t * aes_engine_find(const char * p_name);
+const aes_engine_t * aes_engine_current(void);
+bool aes_engine_set(const aes_engine_t * p_engine);
+
 
 #endif /* !defined(AES_MIN_H) */
@@ -0,0 +1,354 @@
+/*****************************************************************************
+ * aes-parallel.c
+ *
+ * Thread pool, and multi-threaded bulk AES-128 CTR mode.
+ *
+ * Work is submitted to the pool as a number of independent tasks. Idle
+ * threads, including the submitting thread, take the next task number until
+ * all are done. For CTR mode each task is a chunk of whole blocks, starting
+ * at the corresponding counter value. AES-128-GCM is in gcm.c.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-parallel.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+struct aes_thread_pool_s
+{
+    pthread_mutex_t         submit_mutex;   /* Serialises aes_thread_pool_run() */
+    pthread_mutex_t         mutex;          /* Protects the fields below */
+    pthread_cond_t          work_cond;
+    pthread_cond_t          done_cond;
+    aes_thread_pool_task_t  task;
+    void                  * p_arg;
+    size_t                  num_tasks;
+    size_t                  next_task;
+    size_t                  tasks_done;
+    bool                    shutdown;
+    size_t                  num_threads;
+    size_t                  num_workers;
+    pthread_t               workers[];
+};
+
+typedef struct
+{
+    const uint8_t         * p_key_schedule;
+    const uint8_t         * p_iv;
+    uint32_t                counter;
+    const uint8_t         * p_in;
+    uint8_t               * p_out;
+    size_t                  len;
+    size_t                  chunk_blocks;
+} aes_ctr_parallel_job_t;
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+static pthread_once_t       aes_thread_pool_default_once = PTHREAD_ONCE_INIT;
+static aes_thread_pool_t  * p_aes_thread_pool_default;
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void * aes_thread_pool_worker(void * p_arg);
+static bool aes_thread_pool_next_task(aes_thread_pool_t * p_pool, aes_thread_pool_task_t * p_task, void ** pp_arg, size_t * p_task_index, bool wait);
+static void aes_thread_pool_task_done(aes_thread_pool_t * p_pool);
+static void aes_thread_pool_default_create(void);
+static void aes_ctr_parallel_task(void * p_arg, size_t task_index);
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Create a pool of num_threads threads, including the thread which submits
+ * work, so num_threads - 1 worker threads are started. If num_threads is 0,
+ * the number of online CPUs is used.
+ *
+ * Returns NULL on failure.
+ */
+aes_thread_pool_t * aes_thread_pool_create(size_t num_threads)
+{
+    aes_thread_pool_t     * p_pool;
+    long                    num_cpus;
+
+    if (num_threads == 0)
+    {
+        num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (num_cpus > 0) ? (size_t)num_cpus : 1u;
+    }
+
+    p_pool = calloc(1u, sizeof(*p_pool) + (num_threads - 1u) * sizeof(pthread_t));
+    if (p_pool == NULL)
+    {
+        return NULL;
+    }
+    p_pool->num_threads = num_threads;
+    pthread_mutex_init(&p_pool->submit_mutex, NULL);
+    pthread_mutex_init(&p_pool->mutex, NULL);
+    pthread_cond_init(&p_pool->work_cond, NULL);
+    pthread_cond_init(&p_pool->done_cond, NULL);
+
+    for (p_pool->num_workers = 0; p_pool->num_workers < num_threads - 1u; p_pool->num_workers++)
+    {
+        if (pthread_create(&p_pool->workers[p_pool->num_workers], NULL, aes_thread_pool_worker, p_pool) != 0)
+        {
+            aes_thread_pool_destroy(p_pool);
+            return NULL;
+        }
+    }
+    return p_pool;
+}
+
+/*
+ * Stop the worker threads of a pool created by aes_thread_pool_create(), and
+ * free it. There must be no work running on the pool.
+ */
+void aes_thread_pool_destroy(aes_thread_pool_t * p_pool)
+{
+    size_t                  i;
+
+    if (p_pool == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&p_pool->mutex);
+    p_pool->shutdown = true;
+    pthread_cond_broadcast(&p_pool->work_cond);
+    pthread_mutex_unlock(&p_pool->mutex);
+    for (i = 0; i < p_pool->num_workers; i++)
+    {
+        pthread_join(p_pool->workers[i], NULL);
+    }
+    pthread_cond_destroy(&p_pool->done_cond);
+    pthread_cond_destroy(&p_pool->work_cond);
+    pthread_mutex_destroy(&p_pool->mutex);
+    pthread_mutex_destroy(&p_pool->submit_mutex);
+    free(p_pool);
+}
+
+/*
+ * Get the built-in pool, with one thread per online CPU, which is created on
+ * first use and never destroyed. This is used by the parallel functions if
+ * they are passed a NULL pool.
+ *
+ * Returns NULL if it couldn't be created, in which case work runs in the
+ * calling thread only.
+ */
+aes_thread_pool_t * aes_thread_pool_default(void)
+{
+    pthread_once(&aes_thread_pool_default_once, aes_thread_pool_default_create);
+    return p_aes_thread_pool_default;
+}
+
+/*
+ * Get the number of threads of a pool, including the submitting thread. A NULL
+ * pool has 1.
+ */
+size_t aes_thread_pool_num_threads(const aes_thread_pool_t * p_pool)
+{
+    return p_pool ? p_pool->num_threads : 1u;
+}
+
+/*
+ * Run tasks 0 to num_tasks - 1 on the pool, and wait for them all to finish.
+ * The calling thread runs tasks too. If p_pool is NULL, all tasks run in the
+ * calling thread.
+ */
+void aes_thread_pool_run(aes_thread_pool_t * p_pool, aes_thread_pool_task_t task, void * p_arg, size_t num_tasks)
+{
+    size_t                  task_index;
+
+    if (p_pool == NULL || p_pool->num_workers == 0 || num_tasks <= 1u)
+    {
+        for (task_index = 0; task_index < num_tasks; task_index++)
+        {
+            task(p_arg, task_index);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&p_pool->submit_mutex);
+
+    pthread_mutex_lock(&p_pool->mutex);
+    p_pool->task = task;
+    p_pool->p_arg = p_arg;
+    p_pool->num_tasks = num_tasks;
+    p_pool->next_task = 0;
+    p_pool->tasks_done = 0;
+    pthread_cond_broadcast(&p_pool->work_cond);
+    pthread_mutex_unlock(&p_pool->mutex);
+
+    while (aes_thread_pool_next_task(p_pool, &task, &p_arg, &task_index, false))
+    {
+        task(p_arg, task_index);
+        aes_thread_pool_task_done(p_pool);
+    }
+
+    pthread_mutex_lock(&p_pool->mutex);
+    while (p_pool->tasks_done < p_pool->num_tasks)
+    {
+        pthread_cond_wait(&p_pool->done_cond, &p_pool->mutex);
+    }
+    p_pool->num_tasks = 0;
+    pthread_mutex_unlock(&p_pool->mutex);
+
+    pthread_mutex_unlock(&p_pool->submit_mutex);
+}
+
+/*
+ * Get the number of blocks per chunk to split num_blocks blocks into, one
+ * chunk per task, for a pool.
+ */
+size_t aes_thread_pool_chunk_blocks(const aes_thread_pool_t * p_pool, size_t num_blocks)
+{
+    size_t                  num_chunks;
+    size_t                  chunk_blocks;
+
+    num_chunks = aes_thread_pool_num_threads(p_pool) * AES_PARALLEL_TASKS_PER_THREAD;
+    if (num_chunks > AES_PARALLEL_MAX_CHUNKS)
+    {
+        num_chunks = AES_PARALLEL_MAX_CHUNKS;
+    }
+    chunk_blocks = (num_blocks + num_chunks - 1u) / num_chunks;
+    if (chunk_blocks < AES_PARALLEL_MIN_CHUNK_BLOCKS)
+    {
+        chunk_blocks = AES_PARALLEL_MIN_CHUNK_BLOCKS;
+    }
+    return chunk_blocks;
+}
+
+/*
+ * Multi-threaded AES-128 CTR mode encryption or decryption.
+ *
+ * Same as aes128_ctr_xcrypt(), with the data split into chunks which are
+ * processed by the threads of p_pool, or of the built-in pool if p_pool is
+ * NULL. Short data is processed in the calling thread only.
+ */
+uint32_t aes128_ctr_xcrypt_parallel(aes_thread_pool_t * p_pool,
+                                    const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                                    const uint8_t p_iv[AES128_CTR_IV_SIZE], uint32_t counter,
+                                    const uint8_t * p_in, uint8_t * p_out, size_t len)
+{
+    aes_ctr_parallel_job_t  job;
+    size_t                  num_blocks;
+    size_t                  num_chunks;
+
+    num_blocks = (len + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE;
+    if (p_pool == NULL && num_blocks > AES_PARALLEL_MIN_CHUNK_BLOCKS)
+    {
+        p_pool = aes_thread_pool_default();
+    }
+
+    job.p_key_schedule = p_key_schedule;
+    job.p_iv = p_iv;
+    job.counter = counter;
+    job.p_in = p_in;
+    job.p_out = p_out;
+    job.len = len;
+    job.chunk_blocks = aes_thread_pool_chunk_blocks(p_pool, num_blocks);
+    num_chunks = (num_blocks + job.chunk_blocks - 1u) / job.chunk_blocks;
+    aes_thread_pool_run(p_pool, aes_ctr_parallel_task, &job, num_chunks);
+
+    return counter + (uint32_t)num_blocks;
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static void * aes_thread_pool_worker(void * p_arg)
+{
+    aes_thread_pool_t     * p_pool = p_arg;
+    aes_thread_pool_task_t  task;
+    void                  * p_task_arg;
+    size_t                  task_index;
+
+    while (aes_thread_pool_next_task(p_pool, &task, &p_task_arg, &task_index, true))
+    {
+        task(p_task_arg, task_index);
+        aes_thread_pool_task_done(p_pool);
+    }
+    return NULL;
+}
+
+/*
+ * Take the next task of the current work. If wait is true, wait for work to
+ * be submitted.
+ *
+ * Returns false if there is no task, or if wait is true, when the pool is
+ * shut down.
+ */
+static bool aes_thread_pool_next_task(aes_thread_pool_t * p_pool, aes_thread_pool_task_t * p_task, void ** pp_arg, size_t * p_task_index, bool wait)
+{
+    bool                    have_task = false;
+
+    pthread_mutex_lock(&p_pool->mutex);
+    for (;;)
+    {
+        if (p_pool->next_task < p_pool->num_tasks)
+        {
+            *p_task = p_pool->task;
+            *pp_arg = p_pool->p_arg;
+            *p_task_index = p_pool->next_task++;
+            have_task = true;
+            break;
+        }
+        if (!wait || p_pool->shutdown)
+        {
+            break;
+        }
+        pthread_cond_wait(&p_pool->work_cond, &p_pool->mutex);
+    }
+    pthread_mutex_unlock(&p_pool->mutex);
+    return have_task;
+}
+
+static void aes_thread_pool_task_done(aes_thread_pool_t * p_pool)
+{
+    pthread_mutex_lock(&p_pool->mutex);
+    p_pool->tasks_done++;
+    if (p_pool->tasks_done == p_pool->num_tasks)
+    {
+        pthread_cond_signal(&p_pool->done_cond);
+    }
+    pthread_mutex_unlock(&p_pool->mutex);
+}
+
+static void aes_thread_pool_default_create(void)
+{
+    p_aes_thread_pool_default = aes_thread_pool_create(0);
+}
+
+/*
+ * CTR mode for one chunk. The last chunk may be shorter, and may end with a
+ * partial block.
+ */
+static void aes_ctr_parallel_task(void * p_arg, size_t task_index)
+{
+    const aes_ctr_parallel_job_t * p_job = p_arg;
+    size_t                  offset;
+    size_t                  len;
+
+    offset = task_index * p_job->chunk_blocks * AES_BLOCK_SIZE;
+    len = p_job->len - offset;
+    if (len > p_job->chunk_blocks * AES_BLOCK_SIZE)
+    {
+        len = p_job->chunk_blocks * AES_BLOCK_SIZE;
+    }
+    aes128_ctr_xcrypt(p_job->p_key_schedule, p_job->p_iv,
+                      p_job->counter + (uint32_t)(task_index * p_job->chunk_blocks),
+                      p_job->p_in + offset, p_job->p_out + offset, len);
+}
@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * aes-parallel.h
+ *
+ * Multi-threaded bulk AES-128 CTR and AES-128-GCM, on a pool of POSIX
+ * threads.
+ ****************************************************************************/
+
+#ifndef AES_PARALLEL_H
+#define AES_PARALLEL_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-ctr.h"
+#include "gcm.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Data is split into chunks of whole blocks, one per task. Chunks are at least
+ * this many blocks (64 KiB), so the per-task overhead is small. */
+#define AES_PARALLEL_MIN_CHUNK_BLOCKS   4096u
+
+/* Number of tasks per thread that data is split into, if that gives large
+ * enough chunks, so the load is balanced if some threads are slower. */
+#define AES_PARALLEL_TASKS_PER_THREAD   4u
+
+/* Maximum number of chunks, which bounds the per-call state for GCM. */
+#define AES_PARALLEL_MAX_CHUNKS         256u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * A pool of worker threads. The thread that submits work also runs tasks, so
+ * a pool of N threads has N - 1 worker threads. One piece of work runs on a
+ * pool at a time; concurrent callers are serialised.
+ */
+typedef struct aes_thread_pool_s aes_thread_pool_t;
+
+/* Run task number task_index, out of the tasks submitted by
+ * aes_thread_pool_run(). */
+typedef void (*aes_thread_pool_task_t)(void * p_arg, size_t task_index);
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+aes_thread_pool_t * aes_thread_pool_create(size_t num_threads);
+void aes_thread_pool_destroy(aes_thread_pool_t * p_pool);
+aes_thread_pool_t * aes_thread_pool_default(void);
+size_t aes_thread_pool_num_threads(const aes_thread_pool_t * p_pool);
+void aes_thread_pool_run(aes_thread_pool_t * p_pool, aes_thread_pool_task_t task, void * p_arg, size_t num_tasks);
+size_t aes_thread_pool_chunk_blocks(const aes_thread_pool_t * p_pool, size_t num_blocks);
+
+uint32_t aes128_ctr_xcrypt_parallel(aes_thread_pool_t * p_pool,
+                                    const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                                    const uint8_t p_iv[AES128_CTR_IV_SIZE], uint32_t counter,
+                                    const uint8_t * p_in, uint8_t * p_out, size_t len);
+
+void aes128_gcm_seal_parallel(aes_thread_pool_t * p_pool,
+                              const aes128_gcm_key_t * p_key,
+                              const uint8_t * p_iv, size_t iv_len,
+                              const uint8_t * p_aad, size_t aad_len,
+                              uint8_t * p_out, const uint8_t * p_in, size_t len,
+                              uint8_t * p_tag, size_t tag_len);
+bool aes128_gcm_open_parallel(aes_thread_pool_t * p_pool,
+                              const aes128_gcm_key_t * p_key,
+                              const uint8_t * p_iv, size_t iv_len,
+                              const uint8_t * p_aad, size_t aad_len,
+                              uint8_t * p_out, const uint8_t * p_in, size_t len,
+                              const uint8_t * p_tag, size_t tag_len);
+
+
+#endif /* !defined(AES_PARALLEL_H) */
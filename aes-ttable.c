@@ -0,0 +1,542 @@
+/*****************************************************************************
+ * aes-ttable.c
+ *
+ * 32-bit T-table AES-128 encryption/decryption implementation.
+ *
+ * SubBytes, ShiftRows and MixColumns are merged into four 1 KiB look-up
+ * tables, so that each round is 16 table look-ups and XORs on 32-bit words.
+ * This is much faster than the byte-oriented implementation on 32- and 64-bit
+ * processors, at the cost of 8 KiB of tables (encrypt plus decrypt sets).
+ *
+ * Note that table look-ups are indexed by secret data, so this implementation
+ * is not immune to cache-timing attacks.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-ttable.h"
+
+/*****************************************************************************
+ * Look-up tables
+ *
+ * Generated by Python program aes-ttable.py.
+ * Words are big-endian with respect to the AES column, i.e. row 0 of the
+ * column is in the most-significant byte.
+ ****************************************************************************/
+
+static const uint32_t aes_te0[256u] =
+{
+    0xC66363A5u, 0xF87C7C84u, 0xEE777799u, 0xF67B7B8Du, 0xFFF2F20Du, 0xD66B6BBDu, 0xDE6F6FB1u, 0x91C5C554u,
+    0x60303050u, 0x02010103u, 0xCE6767A9u, 0x562B2B7Du, 0xE7FEFE19u, 0xB5D7D762u, 0x4DABABE6u, 0xEC76769Au,
+    0x8FCACA45u, 0x1F82829Du, 0x89C9C940u, 0xFA7D7D87u, 0xEFFAFA15u, 0xB25959EBu, 0x8E4747C9u, 0xFBF0F00Bu,
+    0x41ADADECu, 0xB3D4D467u, 0x5FA2A2FDu, 0x45AFAFEAu, 0x239C9CBFu, 0x53A4A4F7u, 0xE4727296u, 0x9BC0C05Bu,
+    0x75B7B7C2u, 0xE1FDFD1Cu, 0x3D9393AEu, 0x4C26266Au, 0x6C36365Au, 0x7E3F3F41u, 0xF5F7F702u, 0x83CCCC4Fu,
+    0x6834345Cu, 0x51A5A5F4u, 0xD1E5E534u, 0xF9F1F108u, 0xE2717193u, 0xABD8D873u, 0x62313153u, 0x2A15153Fu,
+    0x0804040Cu, 0x95C7C752u, 0x46232365u, 0x9DC3C35Eu, 0x30181828u, 0x379696A1u, 0x0A05050Fu, 0x2F9A9AB5u,
+    0x0E070709u, 0x24121236u, 0x1B80809Bu, 0xDFE2E23Du, 0xCDEBEB26u, 0x4E272769u, 0x7FB2B2CDu, 0xEA75759Fu,
+    0x1209091Bu, 0x1D83839Eu, 0x582C2C74u, 0x341A1A2Eu, 0x361B1B2Du, 0xDC6E6EB2u, 0xB45A5AEEu, 0x5BA0A0FBu,
+    0xA45252F6u, 0x763B3B4Du, 0xB7D6D661u, 0x7DB3B3CEu, 0x5229297Bu, 0xDDE3E33Eu, 0x5E2F2F71u, 0x13848497u,
+    0xA65353F5u, 0xB9D1D168u, 0x00000000u, 0xC1EDED2Cu, 0x40202060u, 0xE3FCFC1Fu, 0x79B1B1C8u, 0xB65B5BEDu,
+    0xD46A6ABEu, 0x8DCBCB46u, 0x67BEBED9u, 0x7239394Bu, 0x944A4ADEu, 0x984C4CD4u, 0xB05858E8u, 0x85CFCF4Au,
+    0xBBD0D06Bu, 0xC5EFEF2Au, 0x4FAAAAE5u, 0xEDFBFB16u, 0x864343C5u, 0x9A4D4DD7u, 0x66333355u, 0x11858594u,
+    0x8A4545CFu, 0xE9F9F910u, 0x04020206u, 0xFE7F7F81u, 0xA05050F0u, 0x783C3C44u, 0x259F9FBAu, 0x4BA8A8E3u,
+    0xA25151F3u, 0x5DA3A3FEu, 0x804040C0u, 0x058F8F8Au, 0x3F9292ADu, 0x219D9DBCu, 0x70383848u, 0xF1F5F504u,
+    0x63BCBCDFu, 0x77B6B6C1u, 0xAFDADA75u, 0x42212163u, 0x20101030u, 0xE5FFFF1Au, 0xFDF3F30Eu, 0xBFD2D26Du,
+    0x81CDCD4Cu, 0x180C0C14u, 0x26131335u, 0xC3ECEC2Fu, 0xBE5F5FE1u, 0x359797A2u, 0x884444CCu, 0x2E171739u,
+    0x93C4C457u, 0x55A7A7F2u, 0xFC7E7E82u, 0x7A3D3D47u, 0xC86464ACu, 0xBA5D5DE7u, 0x3219192Bu, 0xE6737395u,
+    0xC06060A0u, 0x19818198u, 0x9E4F4FD1u, 0xA3DCDC7Fu, 0x44222266u, 0x542A2A7Eu, 0x3B9090ABu, 0x0B888883u,
+    0x8C4646CAu, 0xC7EEEE29u, 0x6BB8B8D3u, 0x2814143Cu, 0xA7DEDE79u, 0xBC5E5EE2u, 0x160B0B1Du, 0xADDBDB76u,
+    0xDBE0E03Bu, 0x64323256u, 0x743A3A4Eu, 0x140A0A1Eu, 0x924949DBu, 0x0C06060Au, 0x4824246Cu, 0xB85C5CE4u,
+    0x9FC2C25Du, 0xBDD3D36Eu, 0x43ACACEFu, 0xC46262A6u, 0x399191A8u, 0x319595A4u, 0xD3E4E437u, 0xF279798Bu,
+    0xD5E7E732u, 0x8BC8C843u, 0x6E373759u, 0xDA6D6DB7u, 0x018D8D8Cu, 0xB1D5D564u, 0x9C4E4ED2u, 0x49A9A9E0u,
+    0xD86C6CB4u, 0xAC5656FAu, 0xF3F4F407u, 0xCFEAEA25u, 0xCA6565AFu, 0xF47A7A8Eu, 0x47AEAEE9u, 0x10080818u,
+    0x6FBABAD5u, 0xF0787888u, 0x4A25256Fu, 0x5C2E2E72u, 0x381C1C24u, 0x57A6A6F1u, 0x73B4B4C7u, 0x97C6C651u,
+    0xCBE8E823u, 0xA1DDDD7Cu, 0xE874749Cu, 0x3E1F1F21u, 0x964B4BDDu, 0x61BDBDDCu, 0x0D8B8B86u, 0x0F8A8A85u,
+    0xE0707090u, 0x7C3E3E42u, 0x71B5B5C4u, 0xCC6666AAu, 0x904848D8u, 0x06030305u, 0xF7F6F601u, 0x1C0E0E12u,
+    0xC26161A3u, 0x6A35355Fu, 0xAE5757F9u, 0x69B9B9D0u, 0x17868691u, 0x99C1C158u, 0x3A1D1D27u, 0x279E9EB9u,
+    0xD9E1E138u, 0xEBF8F813u, 0x2B9898B3u, 0x22111133u, 0xD26969BBu, 0xA9D9D970u, 0x078E8E89u, 0x339494A7u,
+    0x2D9B9BB6u, 0x3C1E1E22u, 0x15878792u, 0xC9E9E920u, 0x87CECE49u, 0xAA5555FFu, 0x50282878u, 0xA5DFDF7Au,
+    0x038C8C8Fu, 0x59A1A1F8u, 0x09898980u, 0x1A0D0D17u, 0x65BFBFDAu, 0xD7E6E631u, 0x844242C6u, 0xD06868B8u,
+    0x824141C3u, 0x299999B0u, 0x5A2D2D77u, 0x1E0F0F11u, 0x7BB0B0CBu, 0xA85454FCu, 0x6DBBBBD6u, 0x2C16163Au
+};
+
+static const uint32_t aes_te1[256u] =
+{
+    0xA5C66363u, 0x84F87C7Cu, 0x99EE7777u, 0x8DF67B7Bu, 0x0DFFF2F2u, 0xBDD66B6Bu, 0xB1DE6F6Fu, 0x5491C5C5u,
+    0x50603030u, 0x03020101u, 0xA9CE6767u, 0x7D562B2Bu, 0x19E7FEFEu, 0x62B5D7D7u, 0xE64DABABu, 0x9AEC7676u,
+    0x458FCACAu, 0x9D1F8282u, 0x4089C9C9u, 0x87FA7D7Du, 0x15EFFAFAu, 0xEBB25959u, 0xC98E4747u, 0x0BFBF0F0u,
+    0xEC41ADADu, 0x67B3D4D4u, 0xFD5FA2A2u, 0xEA45AFAFu, 0xBF239C9Cu, 0xF753A4A4u, 0x96E47272u, 0x5B9BC0C0u,
+    0xC275B7B7u, 0x1CE1FDFDu, 0xAE3D9393u, 0x6A4C2626u, 0x5A6C3636u, 0x417E3F3Fu, 0x02F5F7F7u, 0x4F83CCCCu,
+    0x5C683434u, 0xF451A5A5u, 0x34D1E5E5u, 0x08F9F1F1u, 0x93E27171u, 0x73ABD8D8u, 0x53623131u, 0x3F2A1515u,
+    0x0C080404u, 0x5295C7C7u, 0x65462323u, 0x5E9DC3C3u, 0x28301818u, 0xA1379696u, 0x0F0A0505u, 0xB52F9A9Au,
+    0x090E0707u, 0x36241212u, 0x9B1B8080u, 0x3DDFE2E2u, 0x26CDEBEBu, 0x694E2727u, 0xCD7FB2B2u, 0x9FEA7575u,
+    0x1B120909u, 0x9E1D8383u, 0x74582C2Cu, 0x2E341A1Au, 0x2D361B1Bu, 0xB2DC6E6Eu, 0xEEB45A5Au, 0xFB5BA0A0u,
+    0xF6A45252u, 0x4D763B3Bu, 0x61B7D6D6u, 0xCE7DB3B3u, 0x7B522929u, 0x3EDDE3E3u, 0x715E2F2Fu, 0x97138484u,
+    0xF5A65353u, 0x68B9D1D1u, 0x00000000u, 0x2CC1EDEDu, 0x60402020u, 0x1FE3FCFCu, 0xC879B1B1u, 0xEDB65B5Bu,
+    0xBED46A6Au, 0x468DCBCBu, 0xD967BEBEu, 0x4B723939u, 0xDE944A4Au, 0xD4984C4Cu, 0xE8B05858u, 0x4A85CFCFu,
+    0x6BBBD0D0u, 0x2AC5EFEFu, 0xE54FAAAAu, 0x16EDFBFBu, 0xC5864343u, 0xD79A4D4Du, 0x55663333u, 0x94118585u,
+    0xCF8A4545u, 0x10E9F9F9u, 0x06040202u, 0x81FE7F7Fu, 0xF0A05050u, 0x44783C3Cu, 0xBA259F9Fu, 0xE34BA8A8u,
+    0xF3A25151u, 0xFE5DA3A3u, 0xC0804040u, 0x8A058F8Fu, 0xAD3F9292u, 0xBC219D9Du, 0x48703838u, 0x04F1F5F5u,
+    0xDF63BCBCu, 0xC177B6B6u, 0x75AFDADAu, 0x63422121u, 0x30201010u, 0x1AE5FFFFu, 0x0EFDF3F3u, 0x6DBFD2D2u,
+    0x4C81CDCDu, 0x14180C0Cu, 0x35261313u, 0x2FC3ECECu, 0xE1BE5F5Fu, 0xA2359797u, 0xCC884444u, 0x392E1717u,
+    0x5793C4C4u, 0xF255A7A7u, 0x82FC7E7Eu, 0x477A3D3Du, 0xACC86464u, 0xE7BA5D5Du, 0x2B321919u, 0x95E67373u,
+    0xA0C06060u, 0x98198181u, 0xD19E4F4Fu, 0x7FA3DCDCu, 0x66442222u, 0x7E542A2Au, 0xAB3B9090u, 0x830B8888u,
+    0xCA8C4646u, 0x29C7EEEEu, 0xD36BB8B8u, 0x3C281414u, 0x79A7DEDEu, 0xE2BC5E5Eu, 0x1D160B0Bu, 0x76ADDBDBu,
+    0x3BDBE0E0u, 0x56643232u, 0x4E743A3Au, 0x1E140A0Au, 0xDB924949u, 0x0A0C0606u, 0x6C482424u, 0xE4B85C5Cu,
+    0x5D9FC2C2u, 0x6EBDD3D3u, 0xEF43ACACu, 0xA6C46262u, 0xA8399191u, 0xA4319595u, 0x37D3E4E4u, 0x8BF27979u,
+    0x32D5E7E7u, 0x438BC8C8u, 0x596E3737u, 0xB7DA6D6Du, 0x8C018D8Du, 0x64B1D5D5u, 0xD29C4E4Eu, 0xE049A9A9u,
+    0xB4D86C6Cu, 0xFAAC5656u, 0x07F3F4F4u, 0x25CFEAEAu, 0xAFCA6565u, 0x8EF47A7Au, 0xE947AEAEu, 0x18100808u,
+    0xD56FBABAu, 0x88F07878u, 0x6F4A2525u, 0x725C2E2Eu, 0x24381C1Cu, 0xF157A6A6u, 0xC773B4B4u, 0x5197C6C6u,
+    0x23CBE8E8u, 0x7CA1DDDDu, 0x9CE87474u, 0x213E1F1Fu, 0xDD964B4Bu, 0xDC61BDBDu, 0x860D8B8Bu, 0x850F8A8Au,
+    0x90E07070u, 0x427C3E3Eu, 0xC471B5B5u, 0xAACC6666u, 0xD8904848u, 0x05060303u, 0x01F7F6F6u, 0x121C0E0Eu,
+    0xA3C26161u, 0x5F6A3535u, 0xF9AE5757u, 0xD069B9B9u, 0x91178686u, 0x5899C1C1u, 0x273A1D1Du, 0xB9279E9Eu,
+    0x38D9E1E1u, 0x13EBF8F8u, 0xB32B9898u, 0x33221111u, 0xBBD26969u, 0x70A9D9D9u, 0x89078E8Eu, 0xA7339494u,
+    0xB62D9B9Bu, 0x223C1E1Eu, 0x92158787u, 0x20C9E9E9u, 0x4987CECEu, 0xFFAA5555u, 0x78502828u, 0x7AA5DFDFu,
+    0x8F038C8Cu, 0xF859A1A1u, 0x80098989u, 0x171A0D0Du, 0xDA65BFBFu, 0x31D7E6E6u, 0xC6844242u, 0xB8D06868u,
+    0xC3824141u, 0xB0299999u, 0x775A2D2Du, 0x111E0F0Fu, 0xCB7BB0B0u, 0xFCA85454u, 0xD66DBBBBu, 0x3A2C1616u
+};
+
+static const uint32_t aes_te2[256u] =
+{
+    0x63A5C663u, 0x7C84F87Cu, 0x7799EE77u, 0x7B8DF67Bu, 0xF20DFFF2u, 0x6BBDD66Bu, 0x6FB1DE6Fu, 0xC55491C5u,
+    0x30506030u, 0x01030201u, 0x67A9CE67u, 0x2B7D562Bu, 0xFE19E7FEu, 0xD762B5D7u, 0xABE64DABu, 0x769AEC76u,
+    0xCA458FCAu, 0x829D1F82u, 0xC94089C9u, 0x7D87FA7Du, 0xFA15EFFAu, 0x59EBB259u, 0x47C98E47u, 0xF00BFBF0u,
+    0xADEC41ADu, 0xD467B3D4u, 0xA2FD5FA2u, 0xAFEA45AFu, 0x9CBF239Cu, 0xA4F753A4u, 0x7296E472u, 0xC05B9BC0u,
+    0xB7C275B7u, 0xFD1CE1FDu, 0x93AE3D93u, 0x266A4C26u, 0x365A6C36u, 0x3F417E3Fu, 0xF702F5F7u, 0xCC4F83CCu,
+    0x345C6834u, 0xA5F451A5u, 0xE534D1E5u, 0xF108F9F1u, 0x7193E271u, 0xD873ABD8u, 0x31536231u, 0x153F2A15u,
+    0x040C0804u, 0xC75295C7u, 0x23654623u, 0xC35E9DC3u, 0x18283018u, 0x96A13796u, 0x050F0A05u, 0x9AB52F9Au,
+    0x07090E07u, 0x12362412u, 0x809B1B80u, 0xE23DDFE2u, 0xEB26CDEBu, 0x27694E27u, 0xB2CD7FB2u, 0x759FEA75u,
+    0x091B1209u, 0x839E1D83u, 0x2C74582Cu, 0x1A2E341Au, 0x1B2D361Bu, 0x6EB2DC6Eu, 0x5AEEB45Au, 0xA0FB5BA0u,
+    0x52F6A452u, 0x3B4D763Bu, 0xD661B7D6u, 0xB3CE7DB3u, 0x297B5229u, 0xE33EDDE3u, 0x2F715E2Fu, 0x84971384u,
+    0x53F5A653u, 0xD168B9D1u, 0x00000000u, 0xED2CC1EDu, 0x20604020u, 0xFC1FE3FCu, 0xB1C879B1u, 0x5BEDB65Bu,
+    0x6ABED46Au, 0xCB468DCBu, 0xBED967BEu, 0x394B7239u, 0x4ADE944Au, 0x4CD4984Cu, 0x58E8B058u, 0xCF4A85CFu,
+    0xD06BBBD0u, 0xEF2AC5EFu, 0xAAE54FAAu, 0xFB16EDFBu, 0x43C58643u, 0x4DD79A4Du, 0x33556633u, 0x85941185u,
+    0x45CF8A45u, 0xF910E9F9u, 0x02060402u, 0x7F81FE7Fu, 0x50F0A050u, 0x3C44783Cu, 0x9FBA259Fu, 0xA8E34BA8u,
+    0x51F3A251u, 0xA3FE5DA3u, 0x40C08040u, 0x8F8A058Fu, 0x92AD3F92u, 0x9DBC219Du, 0x38487038u, 0xF504F1F5u,
+    0xBCDF63BCu, 0xB6C177B6u, 0xDA75AFDAu, 0x21634221u, 0x10302010u, 0xFF1AE5FFu, 0xF30EFDF3u, 0xD26DBFD2u,
+    0xCD4C81CDu, 0x0C14180Cu, 0x13352613u, 0xEC2FC3ECu, 0x5FE1BE5Fu, 0x97A23597u, 0x44CC8844u, 0x17392E17u,
+    0xC45793C4u, 0xA7F255A7u, 0x7E82FC7Eu, 0x3D477A3Du, 0x64ACC864u, 0x5DE7BA5Du, 0x192B3219u, 0x7395E673u,
+    0x60A0C060u, 0x81981981u, 0x4FD19E4Fu, 0xDC7FA3DCu, 0x22664422u, 0x2A7E542Au, 0x90AB3B90u, 0x88830B88u,
+    0x46CA8C46u, 0xEE29C7EEu, 0xB8D36BB8u, 0x143C2814u, 0xDE79A7DEu, 0x5EE2BC5Eu, 0x0B1D160Bu, 0xDB76ADDBu,
+    0xE03BDBE0u, 0x32566432u, 0x3A4E743Au, 0x0A1E140Au, 0x49DB9249u, 0x060A0C06u, 0x246C4824u, 0x5CE4B85Cu,
+    0xC25D9FC2u, 0xD36EBDD3u, 0xACEF43ACu, 0x62A6C462u, 0x91A83991u, 0x95A43195u, 0xE437D3E4u, 0x798BF279u,
+    0xE732D5E7u, 0xC8438BC8u, 0x37596E37u, 0x6DB7DA6Du, 0x8D8C018Du, 0xD564B1D5u, 0x4ED29C4Eu, 0xA9E049A9u,
+    0x6CB4D86Cu, 0x56FAAC56u, 0xF407F3F4u, 0xEA25CFEAu, 0x65AFCA65u, 0x7A8EF47Au, 0xAEE947AEu, 0x08181008u,
+    0xBAD56FBAu, 0x7888F078u, 0x256F4A25u, 0x2E725C2Eu, 0x1C24381Cu, 0xA6F157A6u, 0xB4C773B4u, 0xC65197C6u,
+    0xE823CBE8u, 0xDD7CA1DDu, 0x749CE874u, 0x1F213E1Fu, 0x4BDD964Bu, 0xBDDC61BDu, 0x8B860D8Bu, 0x8A850F8Au,
+    0x7090E070u, 0x3E427C3Eu, 0xB5C471B5u, 0x66AACC66u, 0x48D89048u, 0x03050603u, 0xF601F7F6u, 0x0E121C0Eu,
+    0x61A3C261u, 0x355F6A35u, 0x57F9AE57u, 0xB9D069B9u, 0x86911786u, 0xC15899C1u, 0x1D273A1Du, 0x9EB9279Eu,
+    0xE138D9E1u, 0xF813EBF8u, 0x98B32B98u, 0x11332211u, 0x69BBD269u, 0xD970A9D9u, 0x8E89078Eu, 0x94A73394u,
+    0x9BB62D9Bu, 0x1E223C1Eu, 0x87921587u, 0xE920C9E9u, 0xCE4987CEu, 0x55FFAA55u, 0x28785028u, 0xDF7AA5DFu,
+    0x8C8F038Cu, 0xA1F859A1u, 0x89800989u, 0x0D171A0Du, 0xBFDA65BFu, 0xE631D7E6u, 0x42C68442u, 0x68B8D068u,
+    0x41C38241u, 0x99B02999u, 0x2D775A2Du, 0x0F111E0Fu, 0xB0CB7BB0u, 0x54FCA854u, 0xBBD66DBBu, 0x163A2C16u
+};
+
+static const uint32_t aes_te3[256u] =
+{
+    0x6363A5C6u, 0x7C7C84F8u, 0x777799EEu, 0x7B7B8DF6u, 0xF2F20DFFu, 0x6B6BBDD6u, 0x6F6FB1DEu, 0xC5C55491u,
+    0x30305060u, 0x01010302u, 0x6767A9CEu, 0x2B2B7D56u, 0xFEFE19E7u, 0xD7D762B5u, 0xABABE64Du, 0x76769AECu,
+    0xCACA458Fu, 0x82829D1Fu, 0xC9C94089u, 0x7D7D87FAu, 0xFAFA15EFu, 0x5959EBB2u, 0x4747C98Eu, 0xF0F00BFBu,
+    0xADADEC41u, 0xD4D467B3u, 0xA2A2FD5Fu, 0xAFAFEA45u, 0x9C9CBF23u, 0xA4A4F753u, 0x727296E4u, 0xC0C05B9Bu,
+    0xB7B7C275u, 0xFDFD1CE1u, 0x9393AE3Du, 0x26266A4Cu, 0x36365A6Cu, 0x3F3F417Eu, 0xF7F702F5u, 0xCCCC4F83u,
+    0x34345C68u, 0xA5A5F451u, 0xE5E534D1u, 0xF1F108F9u, 0x717193E2u, 0xD8D873ABu, 0x31315362u, 0x15153F2Au,
+    0x04040C08u, 0xC7C75295u, 0x23236546u, 0xC3C35E9Du, 0x18182830u, 0x9696A137u, 0x05050F0Au, 0x9A9AB52Fu,
+    0x0707090Eu, 0x12123624u, 0x80809B1Bu, 0xE2E23DDFu, 0xEBEB26CDu, 0x2727694Eu, 0xB2B2CD7Fu, 0x75759FEAu,
+    0x09091B12u, 0x83839E1Du, 0x2C2C7458u, 0x1A1A2E34u, 0x1B1B2D36u, 0x6E6EB2DCu, 0x5A5AEEB4u, 0xA0A0FB5Bu,
+    0x5252F6A4u, 0x3B3B4D76u, 0xD6D661B7u, 0xB3B3CE7Du, 0x29297B52u, 0xE3E33EDDu, 0x2F2F715Eu, 0x84849713u,
+    0x5353F5A6u, 0xD1D168B9u, 0x00000000u, 0xEDED2CC1u, 0x20206040u, 0xFCFC1FE3u, 0xB1B1C879u, 0x5B5BEDB6u,
+    0x6A6ABED4u, 0xCBCB468Du, 0xBEBED967u, 0x39394B72u, 0x4A4ADE94u, 0x4C4CD498u, 0x5858E8B0u, 0xCFCF4A85u,
+    0xD0D06BBBu, 0xEFEF2AC5u, 0xAAAAE54Fu, 0xFBFB16EDu, 0x4343C586u, 0x4D4DD79Au, 0x33335566u, 0x85859411u,
+    0x4545CF8Au, 0xF9F910E9u, 0x02020604u, 0x7F7F81FEu, 0x5050F0A0u, 0x3C3C4478u, 0x9F9FBA25u, 0xA8A8E34Bu,
+    0x5151F3A2u, 0xA3A3FE5Du, 0x4040C080u, 0x8F8F8A05u, 0x9292AD3Fu, 0x9D9DBC21u, 0x38384870u, 0xF5F504F1u,
+    0xBCBCDF63u, 0xB6B6C177u, 0xDADA75AFu, 0x21216342u, 0x10103020u, 0xFFFF1AE5u, 0xF3F30EFDu, 0xD2D26DBFu,
+    0xCDCD4C81u, 0x0C0C1418u, 0x13133526u, 0xECEC2FC3u, 0x5F5FE1BEu, 0x9797A235u, 0x4444CC88u, 0x1717392Eu,
+    0xC4C45793u, 0xA7A7F255u, 0x7E7E82FCu, 0x3D3D477Au, 0x6464ACC8u, 0x5D5DE7BAu, 0x19192B32u, 0x737395E6u,
+    0x6060A0C0u, 0x81819819u, 0x4F4FD19Eu, 0xDCDC7FA3u, 0x22226644u, 0x2A2A7E54u, 0x9090AB3Bu, 0x8888830Bu,
+    0x4646CA8Cu, 0xEEEE29C7u, 0xB8B8D36Bu, 0x14143C28u, 0xDEDE79A7u, 0x5E5EE2BCu, 0x0B0B1D16u, 0xDBDB76ADu,
+    0xE0E03BDBu, 0x32325664u, 0x3A3A4E74u, 0x0A0A1E14u, 0x4949DB92u, 0x06060A0Cu, 0x24246C48u, 0x5C5CE4B8u,
+    0xC2C25D9Fu, 0xD3D36EBDu, 0xACACEF43u, 0x6262A6C4u, 0x9191A839u, 0x9595A431u, 0xE4E437D3u, 0x79798BF2u,
+    0xE7E732D5u, 0xC8C8438Bu, 0x3737596Eu, 0x6D6DB7DAu, 0x8D8D8C01u, 0xD5D564B1u, 0x4E4ED29Cu, 0xA9A9E049u,
+    0x6C6CB4D8u, 0x5656FAACu, 0xF4F407F3u, 0xEAEA25CFu, 0x6565AFCAu, 0x7A7A8EF4u, 0xAEAEE947u, 0x08081810u,
+    0xBABAD56Fu, 0x787888F0u, 0x25256F4Au, 0x2E2E725Cu, 0x1C1C2438u, 0xA6A6F157u, 0xB4B4C773u, 0xC6C65197u,
+    0xE8E823CBu, 0xDDDD7CA1u, 0x74749CE8u, 0x1F1F213Eu, 0x4B4BDD96u, 0xBDBDDC61u, 0x8B8B860Du, 0x8A8A850Fu,
+    0x707090E0u, 0x3E3E427Cu, 0xB5B5C471u, 0x6666AACCu, 0x4848D890u, 0x03030506u, 0xF6F601F7u, 0x0E0E121Cu,
+    0x6161A3C2u, 0x35355F6Au, 0x5757F9AEu, 0xB9B9D069u, 0x86869117u, 0xC1C15899u, 0x1D1D273Au, 0x9E9EB927u,
+    0xE1E138D9u, 0xF8F813EBu, 0x9898B32Bu, 0x11113322u, 0x6969BBD2u, 0xD9D970A9u, 0x8E8E8907u, 0x9494A733u,
+    0x9B9BB62Du, 0x1E1E223Cu, 0x87879215u, 0xE9E920C9u, 0xCECE4987u, 0x5555FFAAu, 0x28287850u, 0xDFDF7AA5u,
+    0x8C8C8F03u, 0xA1A1F859u, 0x89898009u, 0x0D0D171Au, 0xBFBFDA65u, 0xE6E631D7u, 0x4242C684u, 0x6868B8D0u,
+    0x4141C382u, 0x9999B029u, 0x2D2D775Au, 0x0F0F111Eu, 0xB0B0CB7Bu, 0x5454FCA8u, 0xBBBBD66Du, 0x16163A2Cu
+};
+
+static const uint32_t aes_td0[256u] =
+{
+    0x51F4A750u, 0x7E416553u, 0x1A17A4C3u, 0x3A275E96u, 0x3BAB6BCBu, 0x1F9D45F1u, 0xACFA58ABu, 0x4BE30393u,
+    0x2030FA55u, 0xAD766DF6u, 0x88CC7691u, 0xF5024C25u, 0x4FE5D7FCu, 0xC52ACBD7u, 0x26354480u, 0xB562A38Fu,
+    0xDEB15A49u, 0x25BA1B67u, 0x45EA0E98u, 0x5DFEC0E1u, 0xC32F7502u, 0x814CF012u, 0x8D4697A3u, 0x6BD3F9C6u,
+    0x038F5FE7u, 0x15929C95u, 0xBF6D7AEBu, 0x955259DAu, 0xD4BE832Du, 0x587421D3u, 0x49E06929u, 0x8EC9C844u,
+    0x75C2896Au, 0xF48E7978u, 0x99583E6Bu, 0x27B971DDu, 0xBEE14FB6u, 0xF088AD17u, 0xC920AC66u, 0x7DCE3AB4u,
+    0x63DF4A18u, 0xE51A3182u, 0x97513360u, 0x62537F45u, 0xB16477E0u, 0xBB6BAE84u, 0xFE81A01Cu, 0xF9082B94u,
+    0x70486858u, 0x8F45FD19u, 0x94DE6C87u, 0x527BF8B7u, 0xAB73D323u, 0x724B02E2u, 0xE31F8F57u, 0x6655AB2Au,
+    0xB2EB2807u, 0x2FB5C203u, 0x86C57B9Au, 0xD33708A5u, 0x302887F2u, 0x23BFA5B2u, 0x02036ABAu, 0xED16825Cu,
+    0x8ACF1C2Bu, 0xA779B492u, 0xF307F2F0u, 0x4E69E2A1u, 0x65DAF4CDu, 0x0605BED5u, 0xD134621Fu, 0xC4A6FE8Au,
+    0x342E539Du, 0xA2F355A0u, 0x058AE132u, 0xA4F6EB75u, 0x0B83EC39u, 0x4060EFAAu, 0x5E719F06u, 0xBD6E1051u,
+    0x3E218AF9u, 0x96DD063Du, 0xDD3E05AEu, 0x4DE6BD46u, 0x91548DB5u, 0x71C45D05u, 0x0406D46Fu, 0x605015FFu,
+    0x1998FB24u, 0xD6BDE997u, 0x894043CCu, 0x67D99E77u, 0xB0E842BDu, 0x07898B88u, 0xE7195B38u, 0x79C8EEDBu,
+    0xA17C0A47u, 0x7C420FE9u, 0xF8841EC9u, 0x00000000u, 0x09808683u, 0x322BED48u, 0x1E1170ACu, 0x6C5A724Eu,
+    0xFD0EFFFBu, 0x0F853856u, 0x3DAED51Eu, 0x362D3927u, 0x0A0FD964u, 0x685CA621u, 0x9B5B54D1u, 0x24362E3Au,
+    0x0C0A67B1u, 0x9357E70Fu, 0xB4EE96D2u, 0x1B9B919Eu, 0x80C0C54Fu, 0x61DC20A2u, 0x5A774B69u, 0x1C121A16u,
+    0xE293BA0Au, 0xC0A02AE5u, 0x3C22E043u, 0x121B171Du, 0x0E090D0Bu, 0xF28BC7ADu, 0x2DB6A8B9u, 0x141EA9C8u,
+    0x57F11985u, 0xAF75074Cu, 0xEE99DDBBu, 0xA37F60FDu, 0xF701269Fu, 0x5C72F5BCu, 0x44663BC5u, 0x5BFB7E34u,
+    0x8B432976u, 0xCB23C6DCu, 0xB6EDFC68u, 0xB8E4F163u, 0xD731DCCAu, 0x42638510u, 0x13972240u, 0x84C61120u,
+    0x854A247Du, 0xD2BB3DF8u, 0xAEF93211u, 0xC729A16Du, 0x1D9E2F4Bu, 0xDCB230F3u, 0x0D8652ECu, 0x77C1E3D0u,
+    0x2BB3166Cu, 0xA970B999u, 0x119448FAu, 0x47E96422u, 0xA8FC8CC4u, 0xA0F03F1Au, 0x567D2CD8u, 0x223390EFu,
+    0x87494EC7u, 0xD938D1C1u, 0x8CCAA2FEu, 0x98D40B36u, 0xA6F581CFu, 0xA57ADE28u, 0xDAB78E26u, 0x3FADBFA4u,
+    0x2C3A9DE4u, 0x5078920Du, 0x6A5FCC9Bu, 0x547E4662u, 0xF68D13C2u, 0x90D8B8E8u, 0x2E39F75Eu, 0x82C3AFF5u,
+    0x9F5D80BEu, 0x69D0937Cu, 0x6FD52DA9u, 0xCF2512B3u, 0xC8AC993Bu, 0x10187DA7u, 0xE89C636Eu, 0xDB3BBB7Bu,
+    0xCD267809u, 0x6E5918F4u, 0xEC9AB701u, 0x834F9AA8u, 0xE6956E65u, 0xAAFFE67Eu, 0x21BCCF08u, 0xEF15E8E6u,
+    0xBAE79BD9u, 0x4A6F36CEu, 0xEA9F09D4u, 0x29B07CD6u, 0x31A4B2AFu, 0x2A3F2331u, 0xC6A59430u, 0x35A266C0u,
+    0x744EBC37u, 0xFC82CAA6u, 0xE090D0B0u, 0x33A7D815u, 0xF104984Au, 0x41ECDAF7u, 0x7FCD500Eu, 0x1791F62Fu,
+    0x764DD68Du, 0x43EFB04Du, 0xCCAA4D54u, 0xE49604DFu, 0x9ED1B5E3u, 0x4C6A881Bu, 0xC12C1FB8u, 0x4665517Fu,
+    0x9D5EEA04u, 0x018C355Du, 0xFA877473u, 0xFB0B412Eu, 0xB3671D5Au, 0x92DBD252u, 0xE9105633u, 0x6DD64713u,
+    0x9AD7618Cu, 0x37A10C7Au, 0x59F8148Eu, 0xEB133C89u, 0xCEA927EEu, 0xB761C935u, 0xE11CE5EDu, 0x7A47B13Cu,
+    0x9CD2DF59u, 0x55F2733Fu, 0x1814CE79u, 0x73C737BFu, 0x53F7CDEAu, 0x5FFDAA5Bu, 0xDF3D6F14u, 0x7844DB86u,
+    0xCAAFF381u, 0xB968C43Eu, 0x3824342Cu, 0xC2A3405Fu, 0x161DC372u, 0xBCE2250Cu, 0x283C498Bu, 0xFF0D9541u,
+    0x39A80171u, 0x080CB3DEu, 0xD8B4E49Cu, 0x6456C190u, 0x7BCB8461u, 0xD532B670u, 0x486C5C74u, 0xD0B85742u
+};
+
+static const uint32_t aes_td1[256u] =
+{
+    0x5051F4A7u, 0x537E4165u, 0xC31A17A4u, 0x963A275Eu, 0xCB3BAB6Bu, 0xF11F9D45u, 0xABACFA58u, 0x934BE303u,
+    0x552030FAu, 0xF6AD766Du, 0x9188CC76u, 0x25F5024Cu, 0xFC4FE5D7u, 0xD7C52ACBu, 0x80263544u, 0x8FB562A3u,
+    0x49DEB15Au, 0x6725BA1Bu, 0x9845EA0Eu, 0xE15DFEC0u, 0x02C32F75u, 0x12814CF0u, 0xA38D4697u, 0xC66BD3F9u,
+    0xE7038F5Fu, 0x9515929Cu, 0xEBBF6D7Au, 0xDA955259u, 0x2DD4BE83u, 0xD3587421u, 0x2949E069u, 0x448EC9C8u,
+    0x6A75C289u, 0x78F48E79u, 0x6B99583Eu, 0xDD27B971u, 0xB6BEE14Fu, 0x17F088ADu, 0x66C920ACu, 0xB47DCE3Au,
+    0x1863DF4Au, 0x82E51A31u, 0x60975133u, 0x4562537Fu, 0xE0B16477u, 0x84BB6BAEu, 0x1CFE81A0u, 0x94F9082Bu,
+    0x58704868u, 0x198F45FDu, 0x8794DE6Cu, 0xB7527BF8u, 0x23AB73D3u, 0xE2724B02u, 0x57E31F8Fu, 0x2A6655ABu,
+    0x07B2EB28u, 0x032FB5C2u, 0x9A86C57Bu, 0xA5D33708u, 0xF2302887u, 0xB223BFA5u, 0xBA02036Au, 0x5CED1682u,
+    0x2B8ACF1Cu, 0x92A779B4u, 0xF0F307F2u, 0xA14E69E2u, 0xCD65DAF4u, 0xD50605BEu, 0x1FD13462u, 0x8AC4A6FEu,
+    0x9D342E53u, 0xA0A2F355u, 0x32058AE1u, 0x75A4F6EBu, 0x390B83ECu, 0xAA4060EFu, 0x065E719Fu, 0x51BD6E10u,
+    0xF93E218Au, 0x3D96DD06u, 0xAEDD3E05u, 0x464DE6BDu, 0xB591548Du, 0x0571C45Du, 0x6F0406D4u, 0xFF605015u,
+    0x241998FBu, 0x97D6BDE9u, 0xCC894043u, 0x7767D99Eu, 0xBDB0E842u, 0x8807898Bu, 0x38E7195Bu, 0xDB79C8EEu,
+    0x47A17C0Au, 0xE97C420Fu, 0xC9F8841Eu, 0x00000000u, 0x83098086u, 0x48322BEDu, 0xAC1E1170u, 0x4E6C5A72u,
+    0xFBFD0EFFu, 0x560F8538u, 0x1E3DAED5u, 0x27362D39u, 0x640A0FD9u, 0x21685CA6u, 0xD19B5B54u, 0x3A24362Eu,
+    0xB10C0A67u, 0x0F9357E7u, 0xD2B4EE96u, 0x9E1B9B91u, 0x4F80C0C5u, 0xA261DC20u, 0x695A774Bu, 0x161C121Au,
+    0x0AE293BAu, 0xE5C0A02Au, 0x433C22E0u, 0x1D121B17u, 0x0B0E090Du, 0xADF28BC7u, 0xB92DB6A8u, 0xC8141EA9u,
+    0x8557F119u, 0x4CAF7507u, 0xBBEE99DDu, 0xFDA37F60u, 0x9FF70126u, 0xBC5C72F5u, 0xC544663Bu, 0x345BFB7Eu,
+    0x768B4329u, 0xDCCB23C6u, 0x68B6EDFCu, 0x63B8E4F1u, 0xCAD731DCu, 0x10426385u, 0x40139722u, 0x2084C611u,
+    0x7D854A24u, 0xF8D2BB3Du, 0x11AEF932u, 0x6DC729A1u, 0x4B1D9E2Fu, 0xF3DCB230u, 0xEC0D8652u, 0xD077C1E3u,
+    0x6C2BB316u, 0x99A970B9u, 0xFA119448u, 0x2247E964u, 0xC4A8FC8Cu, 0x1AA0F03Fu, 0xD8567D2Cu, 0xEF223390u,
+    0xC787494Eu, 0xC1D938D1u, 0xFE8CCAA2u, 0x3698D40Bu, 0xCFA6F581u, 0x28A57ADEu, 0x26DAB78Eu, 0xA43FADBFu,
+    0xE42C3A9Du, 0x0D507892u, 0x9B6A5FCCu, 0x62547E46u, 0xC2F68D13u, 0xE890D8B8u, 0x5E2E39F7u, 0xF582C3AFu,
+    0xBE9F5D80u, 0x7C69D093u, 0xA96FD52Du, 0xB3CF2512u, 0x3BC8AC99u, 0xA710187Du, 0x6EE89C63u, 0x7BDB3BBBu,
+    0x09CD2678u, 0xF46E5918u, 0x01EC9AB7u, 0xA8834F9Au, 0x65E6956Eu, 0x7EAAFFE6u, 0x0821BCCFu, 0xE6EF15E8u,
+    0xD9BAE79Bu, 0xCE4A6F36u, 0xD4EA9F09u, 0xD629B07Cu, 0xAF31A4B2u, 0x312A3F23u, 0x30C6A594u, 0xC035A266u,
+    0x37744EBCu, 0xA6FC82CAu, 0xB0E090D0u, 0x1533A7D8u, 0x4AF10498u, 0xF741ECDAu, 0x0E7FCD50u, 0x2F1791F6u,
+    0x8D764DD6u, 0x4D43EFB0u, 0x54CCAA4Du, 0xDFE49604u, 0xE39ED1B5u, 0x1B4C6A88u, 0xB8C12C1Fu, 0x7F466551u,
+    0x049D5EEAu, 0x5D018C35u, 0x73FA8774u, 0x2EFB0B41u, 0x5AB3671Du, 0x5292DBD2u, 0x33E91056u, 0x136DD647u,
+    0x8C9AD761u, 0x7A37A10Cu, 0x8E59F814u, 0x89EB133Cu, 0xEECEA927u, 0x35B761C9u, 0xEDE11CE5u, 0x3C7A47B1u,
+    0x599CD2DFu, 0x3F55F273u, 0x791814CEu, 0xBF73C737u, 0xEA53F7CDu, 0x5B5FFDAAu, 0x14DF3D6Fu, 0x867844DBu,
+    0x81CAAFF3u, 0x3EB968C4u, 0x2C382434u, 0x5FC2A340u, 0x72161DC3u, 0x0CBCE225u, 0x8B283C49u, 0x41FF0D95u,
+    0x7139A801u, 0xDE080CB3u, 0x9CD8B4E4u, 0x906456C1u, 0x617BCB84u, 0x70D532B6u, 0x74486C5Cu, 0x42D0B857u
+};
+
+static const uint32_t aes_td2[256u] =
+{
+    0xA75051F4u, 0x65537E41u, 0xA4C31A17u, 0x5E963A27u, 0x6BCB3BABu, 0x45F11F9Du, 0x58ABACFAu, 0x03934BE3u,
+    0xFA552030u, 0x6DF6AD76u, 0x769188CCu, 0x4C25F502u, 0xD7FC4FE5u, 0xCBD7C52Au, 0x44802635u, 0xA38FB562u,
+    0x5A49DEB1u, 0x1B6725BAu, 0x0E9845EAu, 0xC0E15DFEu, 0x7502C32Fu, 0xF012814Cu, 0x97A38D46u, 0xF9C66BD3u,
+    0x5FE7038Fu, 0x9C951592u, 0x7AEBBF6Du, 0x59DA9552u, 0x832DD4BEu, 0x21D35874u, 0x692949E0u, 0xC8448EC9u,
+    0x896A75C2u, 0x7978F48Eu, 0x3E6B9958u, 0x71DD27B9u, 0x4FB6BEE1u, 0xAD17F088u, 0xAC66C920u, 0x3AB47DCEu,
+    0x4A1863DFu, 0x3182E51Au, 0x33609751u, 0x7F456253u, 0x77E0B164u, 0xAE84BB6Bu, 0xA01CFE81u, 0x2B94F908u,
+    0x68587048u, 0xFD198F45u, 0x6C8794DEu, 0xF8B7527Bu, 0xD323AB73u, 0x02E2724Bu, 0x8F57E31Fu, 0xAB2A6655u,
+    0x2807B2EBu, 0xC2032FB5u, 0x7B9A86C5u, 0x08A5D337u, 0x87F23028u, 0xA5B223BFu, 0x6ABA0203u, 0x825CED16u,
+    0x1C2B8ACFu, 0xB492A779u, 0xF2F0F307u, 0xE2A14E69u, 0xF4CD65DAu, 0xBED50605u, 0x621FD134u, 0xFE8AC4A6u,
+    0x539D342Eu, 0x55A0A2F3u, 0xE132058Au, 0xEB75A4F6u, 0xEC390B83u, 0xEFAA4060u, 0x9F065E71u, 0x1051BD6Eu,
+    0x8AF93E21u, 0x063D96DDu, 0x05AEDD3Eu, 0xBD464DE6u, 0x8DB59154u, 0x5D0571C4u, 0xD46F0406u, 0x15FF6050u,
+    0xFB241998u, 0xE997D6BDu, 0x43CC8940u, 0x9E7767D9u, 0x42BDB0E8u, 0x8B880789u, 0x5B38E719u, 0xEEDB79C8u,
+    0x0A47A17Cu, 0x0FE97C42u, 0x1EC9F884u, 0x00000000u, 0x86830980u, 0xED48322Bu, 0x70AC1E11u, 0x724E6C5Au,
+    0xFFFBFD0Eu, 0x38560F85u, 0xD51E3DAEu, 0x3927362Du, 0xD9640A0Fu, 0xA621685Cu, 0x54D19B5Bu, 0x2E3A2436u,
+    0x67B10C0Au, 0xE70F9357u, 0x96D2B4EEu, 0x919E1B9Bu, 0xC54F80C0u, 0x20A261DCu, 0x4B695A77u, 0x1A161C12u,
+    0xBA0AE293u, 0x2AE5C0A0u, 0xE0433C22u, 0x171D121Bu, 0x0D0B0E09u, 0xC7ADF28Bu, 0xA8B92DB6u, 0xA9C8141Eu,
+    0x198557F1u, 0x074CAF75u, 0xDDBBEE99u, 0x60FDA37Fu, 0x269FF701u, 0xF5BC5C72u, 0x3BC54466u, 0x7E345BFBu,
+    0x29768B43u, 0xC6DCCB23u, 0xFC68B6EDu, 0xF163B8E4u, 0xDCCAD731u, 0x85104263u, 0x22401397u, 0x112084C6u,
+    0x247D854Au, 0x3DF8D2BBu, 0x3211AEF9u, 0xA16DC729u, 0x2F4B1D9Eu, 0x30F3DCB2u, 0x52EC0D86u, 0xE3D077C1u,
+    0x166C2BB3u, 0xB999A970u, 0x48FA1194u, 0x642247E9u, 0x8CC4A8FCu, 0x3F1AA0F0u, 0x2CD8567Du, 0x90EF2233u,
+    0x4EC78749u, 0xD1C1D938u, 0xA2FE8CCAu, 0x0B3698D4u, 0x81CFA6F5u, 0xDE28A57Au, 0x8E26DAB7u, 0xBFA43FADu,
+    0x9DE42C3Au, 0x920D5078u, 0xCC9B6A5Fu, 0x4662547Eu, 0x13C2F68Du, 0xB8E890D8u, 0xF75E2E39u, 0xAFF582C3u,
+    0x80BE9F5Du, 0x937C69D0u, 0x2DA96FD5u, 0x12B3CF25u, 0x993BC8ACu, 0x7DA71018u, 0x636EE89Cu, 0xBB7BDB3Bu,
+    0x7809CD26u, 0x18F46E59u, 0xB701EC9Au, 0x9AA8834Fu, 0x6E65E695u, 0xE67EAAFFu, 0xCF0821BCu, 0xE8E6EF15u,
+    0x9BD9BAE7u, 0x36CE4A6Fu, 0x09D4EA9Fu, 0x7CD629B0u, 0xB2AF31A4u, 0x23312A3Fu, 0x9430C6A5u, 0x66C035A2u,
+    0xBC37744Eu, 0xCAA6FC82u, 0xD0B0E090u, 0xD81533A7u, 0x984AF104u, 0xDAF741ECu, 0x500E7FCDu, 0xF62F1791u,
+    0xD68D764Du, 0xB04D43EFu, 0x4D54CCAAu, 0x04DFE496u, 0xB5E39ED1u, 0x881B4C6Au, 0x1FB8C12Cu, 0x517F4665u,
+    0xEA049D5Eu, 0x355D018Cu, 0x7473FA87u, 0x412EFB0Bu, 0x1D5AB367u, 0xD25292DBu, 0x5633E910u, 0x47136DD6u,
+    0x618C9AD7u, 0x0C7A37A1u, 0x148E59F8u, 0x3C89EB13u, 0x27EECEA9u, 0xC935B761u, 0xE5EDE11Cu, 0xB13C7A47u,
+    0xDF599CD2u, 0x733F55F2u, 0xCE791814u, 0x37BF73C7u, 0xCDEA53F7u, 0xAA5B5FFDu, 0x6F14DF3Du, 0xDB867844u,
+    0xF381CAAFu, 0xC43EB968u, 0x342C3824u, 0x405FC2A3u, 0xC372161Du, 0x250CBCE2u, 0x498B283Cu, 0x9541FF0Du,
+    0x017139A8u, 0xB3DE080Cu, 0xE49CD8B4u, 0xC1906456u, 0x84617BCBu, 0xB670D532u, 0x5C74486Cu, 0x5742D0B8u
+};
+
+static const uint32_t aes_td3[256u] =
+{
+    0xF4A75051u, 0x4165537Eu, 0x17A4C31Au, 0x275E963Au, 0xAB6BCB3Bu, 0x9D45F11Fu, 0xFA58ABACu, 0xE303934Bu,
+    0x30FA5520u, 0x766DF6ADu, 0xCC769188u, 0x024C25F5u, 0xE5D7FC4Fu, 0x2ACBD7C5u, 0x35448026u, 0x62A38FB5u,
+    0xB15A49DEu, 0xBA1B6725u, 0xEA0E9845u, 0xFEC0E15Du, 0x2F7502C3u, 0x4CF01281u, 0x4697A38Du, 0xD3F9C66Bu,
+    0x8F5FE703u, 0x929C9515u, 0x6D7AEBBFu, 0x5259DA95u, 0xBE832DD4u, 0x7421D358u, 0xE0692949u, 0xC9C8448Eu,
+    0xC2896A75u, 0x8E7978F4u, 0x583E6B99u, 0xB971DD27u, 0xE14FB6BEu, 0x88AD17F0u, 0x20AC66C9u, 0xCE3AB47Du,
+    0xDF4A1863u, 0x1A3182E5u, 0x51336097u, 0x537F4562u, 0x6477E0B1u, 0x6BAE84BBu, 0x81A01CFEu, 0x082B94F9u,
+    0x48685870u, 0x45FD198Fu, 0xDE6C8794u, 0x7BF8B752u, 0x73D323ABu, 0x4B02E272u, 0x1F8F57E3u, 0x55AB2A66u,
+    0xEB2807B2u, 0xB5C2032Fu, 0xC57B9A86u, 0x3708A5D3u, 0x2887F230u, 0xBFA5B223u, 0x036ABA02u, 0x16825CEDu,
+    0xCF1C2B8Au, 0x79B492A7u, 0x07F2F0F3u, 0x69E2A14Eu, 0xDAF4CD65u, 0x05BED506u, 0x34621FD1u, 0xA6FE8AC4u,
+    0x2E539D34u, 0xF355A0A2u, 0x8AE13205u, 0xF6EB75A4u, 0x83EC390Bu, 0x60EFAA40u, 0x719F065Eu, 0x6E1051BDu,
+    0x218AF93Eu, 0xDD063D96u, 0x3E05AEDDu, 0xE6BD464Du, 0x548DB591u, 0xC45D0571u, 0x06D46F04u, 0x5015FF60u,
+    0x98FB2419u, 0xBDE997D6u, 0x4043CC89u, 0xD99E7767u, 0xE842BDB0u, 0x898B8807u, 0x195B38E7u, 0xC8EEDB79u,
+    0x7C0A47A1u, 0x420FE97Cu, 0x841EC9F8u, 0x00000000u, 0x80868309u, 0x2BED4832u, 0x1170AC1Eu, 0x5A724E6Cu,
+    0x0EFFFBFDu, 0x8538560Fu, 0xAED51E3Du, 0x2D392736u, 0x0FD9640Au, 0x5CA62168u, 0x5B54D19Bu, 0x362E3A24u,
+    0x0A67B10Cu, 0x57E70F93u, 0xEE96D2B4u, 0x9B919E1Bu, 0xC0C54F80u, 0xDC20A261u, 0x774B695Au, 0x121A161Cu,
+    0x93BA0AE2u, 0xA02AE5C0u, 0x22E0433Cu, 0x1B171D12u, 0x090D0B0Eu, 0x8BC7ADF2u, 0xB6A8B92Du, 0x1EA9C814u,
+    0xF1198557u, 0x75074CAFu, 0x99DDBBEEu, 0x7F60FDA3u, 0x01269FF7u, 0x72F5BC5Cu, 0x663BC544u, 0xFB7E345Bu,
+    0x4329768Bu, 0x23C6DCCBu, 0xEDFC68B6u, 0xE4F163B8u, 0x31DCCAD7u, 0x63851042u, 0x97224013u, 0xC6112084u,
+    0x4A247D85u, 0xBB3DF8D2u, 0xF93211AEu, 0x29A16DC7u, 0x9E2F4B1Du, 0xB230F3DCu, 0x8652EC0Du, 0xC1E3D077u,
+    0xB3166C2Bu, 0x70B999A9u, 0x9448FA11u, 0xE9642247u, 0xFC8CC4A8u, 0xF03F1AA0u, 0x7D2CD856u, 0x3390EF22u,
+    0x494EC787u, 0x38D1C1D9u, 0xCAA2FE8Cu, 0xD40B3698u, 0xF581CFA6u, 0x7ADE28A5u, 0xB78E26DAu, 0xADBFA43Fu,
+    0x3A9DE42Cu, 0x78920D50u, 0x5FCC9B6Au, 0x7E466254u, 0x8D13C2F6u, 0xD8B8E890u, 0x39F75E2Eu, 0xC3AFF582u,
+    0x5D80BE9Fu, 0xD0937C69u, 0xD52DA96Fu, 0x2512B3CFu, 0xAC993BC8u, 0x187DA710u, 0x9C636EE8u, 0x3BBB7BDBu,
+    0x267809CDu, 0x5918F46Eu, 0x9AB701ECu, 0x4F9AA883u, 0x956E65E6u, 0xFFE67EAAu, 0xBCCF0821u, 0x15E8E6EFu,
+    0xE79BD9BAu, 0x6F36CE4Au, 0x9F09D4EAu, 0xB07CD629u, 0xA4B2AF31u, 0x3F23312Au, 0xA59430C6u, 0xA266C035u,
+    0x4EBC3774u, 0x82CAA6FCu, 0x90D0B0E0u, 0xA7D81533u, 0x04984AF1u, 0xECDAF741u, 0xCD500E7Fu, 0x91F62F17u,
+    0x4DD68D76u, 0xEFB04D43u, 0xAA4D54CCu, 0x9604DFE4u, 0xD1B5E39Eu, 0x6A881B4Cu, 0x2C1FB8C1u, 0x65517F46u,
+    0x5EEA049Du, 0x8C355D01u, 0x877473FAu, 0x0B412EFBu, 0x671D5AB3u, 0xDBD25292u, 0x105633E9u, 0xD647136Du,
+    0xD7618C9Au, 0xA10C7A37u, 0xF8148E59u, 0x133C89EBu, 0xA927EECEu, 0x61C935B7u, 0x1CE5EDE1u, 0x47B13C7Au,
+    0xD2DF599Cu, 0xF2733F55u, 0x14CE7918u, 0xC737BF73u, 0xF7CDEA53u, 0xFDAA5B5Fu, 0x3D6F14DFu, 0x44DB8678u,
+    0xAFF381CAu, 0x68C43EB9u, 0x24342C38u, 0xA3405FC2u, 0x1DC37216u, 0xE2250CBCu, 0x3C498B28u, 0x0D9541FFu,
+    0xA8017139u, 0x0CB3DE08u, 0xB4E49CD8u, 0x56C19064u, 0xCB84617Bu, 0x32B670D5u, 0x6C5C7448u, 0xB85742D0u
+};
+
+static const uint8_t aes_td4[256u] =
+{
+    0x52, 0x09, 0x6A, 0xD5, 0x30, 0x36, 0xA5, 0x38, 0xBF, 0x40, 0xA3, 0x9E, 0x81, 0xF3, 0xD7, 0xFB,
+    0x7C, 0xE3, 0x39, 0x82, 0x9B, 0x2F, 0xFF, 0x87, 0x34, 0x8E, 0x43, 0x44, 0xC4, 0xDE, 0xE9, 0xCB,
+    0x54, 0x7B, 0x94, 0x32, 0xA6, 0xC2, 0x23, 0x3D, 0xEE, 0x4C, 0x95, 0x0B, 0x42, 0xFA, 0xC3, 0x4E,
+    0x08, 0x2E, 0xA1, 0x66, 0x28, 0xD9, 0x24, 0xB2, 0x76, 0x5B, 0xA2, 0x49, 0x6D, 0x8B, 0xD1, 0x25,
+    0x72, 0xF8, 0xF6, 0x64, 0x86, 0x68, 0x98, 0x16, 0xD4, 0xA4, 0x5C, 0xCC, 0x5D, 0x65, 0xB6, 0x92,
+    0x6C, 0x70, 0x48, 0x50, 0xFD, 0xED, 0xB9, 0xDA, 0x5E, 0x15, 0x46, 0x57, 0xA7, 0x8D, 0x9D, 0x84,
+    0x90, 0xD8, 0xAB, 0x00, 0x8C, 0xBC, 0xD3, 0x0A, 0xF7, 0xE4, 0x58, 0x05, 0xB8, 0xB3, 0x45, 0x06,
+    0xD0, 0x2C, 0x1E, 0x8F, 0xCA, 0x3F, 0x0F, 0x02, 0xC1, 0xAF, 0xBD, 0x03, 0x01, 0x13, 0x8A, 0x6B,
+    0x3A, 0x91, 0x11, 0x41, 0x4F, 0x67, 0xDC, 0xEA, 0x97, 0xF2, 0xCF, 0xCE, 0xF0, 0xB4, 0xE6, 0x73,
+    0x96, 0xAC, 0x74, 0x22, 0xE7, 0xAD, 0x35, 0x85, 0xE2, 0xF9, 0x37, 0xE8, 0x1C, 0x75, 0xDF, 0x6E,
+    0x47, 0xF1, 0x1A, 0x71, 0x1D, 0x29, 0xC5, 0x89, 0x6F, 0xB7, 0x62, 0x0E, 0xAA, 0x18, 0xBE, 0x1B,
+    0xFC, 0x56, 0x3E, 0x4B, 0xC6, 0xD2, 0x79, 0x20, 0x9A, 0xDB, 0xC0, 0xFE, 0x78, 0xCD, 0x5A, 0xF4,
+    0x1F, 0xDD, 0xA8, 0x33, 0x88, 0x07, 0xC7, 0x31, 0xB1, 0x12, 0x10, 0x59, 0x27, 0x80, 0xEC, 0x5F,
+    0x60, 0x51, 0x7F, 0xA9, 0x19, 0xB5, 0x4A, 0x0D, 0x2D, 0xE5, 0x7A, 0x9F, 0x93, 0xC9, 0x9C, 0xEF,
+    0xA0, 0xE0, 0x3B, 0x4D, 0xAE, 0x2A, 0xF5, 0xB0, 0xC8, 0xEB, 0xBB, 0x3C, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2B, 0x04, 0x7E, 0xBA, 0x77, 0xD6, 0x26, 0xE1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0C, 0x7D
+};
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+static inline uint32_t aes_ttable_load_column(const uint8_t * p)
+{
+    return ((uint32_t)p[0] << 24u) | ((uint32_t)p[1] << 16u) | ((uint32_t)p[2] << 8u) | p[3];
+}
+
+static inline void aes_ttable_store_column(uint8_t * p, uint32_t w)
+{
+    p[0] = w >> 24u;
+    p[1] = w >> 16u;
+    p[2] = w >> 8u;
+    p[3] = w;
+}
+
+/* S-box value is the middle byte of the first encryption table, so a separate
+ * S-box table is not needed for the final round. */
+static inline uint32_t aes_ttable_sbox(uint_fast8_t a)
+{
+    return (aes_te0[a] >> 8u) & 0xFFu;
+}
+
+/* InvMixColumns of a column of a standard key schedule. Needed to use the
+ * decryption T-tables with the standard (encryption) key schedule. */
+static inline uint32_t aes_ttable_mix_columns_inv(uint32_t w)
+{
+    return aes_td0[aes_ttable_sbox(w >> 24u)] ^
+           aes_td1[aes_ttable_sbox((w >> 16u) & 0xFFu)] ^
+           aes_td2[aes_ttable_sbox((w >> 8u) & 0xFFu)] ^
+           aes_td3[aes_ttable_sbox(w & 0xFFu)];
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/* AES-128 encryption, T-table implementation.
+ *
+ * Same interface as aes128_encrypt(), with num_rounds for the key size
+ * (10, 12 or 14), using the same key schedule calculated by
+ * aes128_key_schedule(), aes192_key_schedule() or aes256_key_schedule().
+ */
+void aes_ttable_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    const uint8_t * p_round_key = p_key_schedule;
+    uint32_t        s0, s1, s2, s3;
+    uint32_t        t0, t1, t2, t3;
+
+    s0 = aes_ttable_load_column(p_block +  0) ^ aes_ttable_load_column(p_round_key +  0);
+    s1 = aes_ttable_load_column(p_block +  4) ^ aes_ttable_load_column(p_round_key +  4);
+    s2 = aes_ttable_load_column(p_block +  8) ^ aes_ttable_load_column(p_round_key +  8);
+    s3 = aes_ttable_load_column(p_block + 12) ^ aes_ttable_load_column(p_round_key + 12);
+
+    for (round = 1; round < num_rounds; ++round)
+    {
+        p_round_key += AES_BLOCK_SIZE;
+        t0 = aes_te0[s0 >> 24u] ^ aes_te1[(s1 >> 16u) & 0xFFu] ^ aes_te2[(s2 >> 8u) & 0xFFu] ^ aes_te3[s3 & 0xFFu] ^ aes_ttable_load_column(p_round_key +  0);
+        t1 = aes_te0[s1 >> 24u] ^ aes_te1[(s2 >> 16u) & 0xFFu] ^ aes_te2[(s3 >> 8u) & 0xFFu] ^ aes_te3[s0 & 0xFFu] ^ aes_ttable_load_column(p_round_key +  4);
+        t2 = aes_te0[s2 >> 24u] ^ aes_te1[(s3 >> 16u) & 0xFFu] ^ aes_te2[(s0 >> 8u) & 0xFFu] ^ aes_te3[s1 & 0xFFu] ^ aes_ttable_load_column(p_round_key +  8);
+        t3 = aes_te0[s3 >> 24u] ^ aes_te1[(s0 >> 16u) & 0xFFu] ^ aes_te2[(s1 >> 8u) & 0xFFu] ^ aes_te3[s2 & 0xFFu] ^ aes_ttable_load_column(p_round_key + 12);
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* Final round has no MixColumns. */
+    p_round_key += AES_BLOCK_SIZE;
+    t0 = (aes_ttable_sbox(s0 >> 24u) << 24u) ^ (aes_ttable_sbox((s1 >> 16u) & 0xFFu) << 16u) ^ (aes_ttable_sbox((s2 >> 8u) & 0xFFu) << 8u) ^ aes_ttable_sbox(s3 & 0xFFu);
+    t1 = (aes_ttable_sbox(s1 >> 24u) << 24u) ^ (aes_ttable_sbox((s2 >> 16u) & 0xFFu) << 16u) ^ (aes_ttable_sbox((s3 >> 8u) & 0xFFu) << 8u) ^ aes_ttable_sbox(s0 & 0xFFu);
+    t2 = (aes_ttable_sbox(s2 >> 24u) << 24u) ^ (aes_ttable_sbox((s3 >> 16u) & 0xFFu) << 16u) ^ (aes_ttable_sbox((s0 >> 8u) & 0xFFu) << 8u) ^ aes_ttable_sbox(s1 & 0xFFu);
+    t3 = (aes_ttable_sbox(s3 >> 24u) << 24u) ^ (aes_ttable_sbox((s0 >> 16u) & 0xFFu) << 16u) ^ (aes_ttable_sbox((s1 >> 8u) & 0xFFu) << 8u) ^ aes_ttable_sbox(s2 & 0xFFu);
+    aes_ttable_store_column(p_block +  0, t0 ^ aes_ttable_load_column(p_round_key +  0));
+    aes_ttable_store_column(p_block +  4, t1 ^ aes_ttable_load_column(p_round_key +  4));
+    aes_ttable_store_column(p_block +  8, t2 ^ aes_ttable_load_column(p_round_key +  8));
+    aes_ttable_store_column(p_block + 12, t3 ^ aes_ttable_load_column(p_round_key + 12));
+}
+
+/* Encryption of several independent blocks, T-table implementation, one
+ * block at a time. */
+void aes_ttable_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    while (num_blocks)
+    {
+        aes_ttable_encrypt(p_blocks, p_key_schedule, num_rounds);
+        p_blocks += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+}
+
+/* Encryption of several independent blocks with different keys, T-table
+ * implementation, one block at a time. */
+void aes_ttable_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds)
+{
+    while (num_blocks)
+    {
+        aes_ttable_encrypt(*p_blocks++, *p_key_schedules++, num_rounds);
+        num_blocks--;
+    }
+}
+
+/* AES-128 decryption, T-table implementation.
+ *
+ * Same interface as aes128_decrypt(), with num_rounds for the key size
+ * (10, 12 or 14), using the same key schedule calculated by
+ * aes128_key_schedule(), aes192_key_schedule() or aes256_key_schedule().
+ *
+ * The decryption tables implement the equivalent inverse cipher, which needs
+ * InvMixColumns applied to the round keys of rounds 1 to 9. Since the standard
+ * key schedule is used, that is done on-the-fly here.
+ */
+void aes_ttable_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    const uint8_t * p_round_key = p_key_schedule + num_rounds * AES_BLOCK_SIZE;
+    uint32_t        s0, s1, s2, s3;
+    uint32_t        t0, t1, t2, t3;
+
+    s0 = aes_ttable_load_column(p_block +  0) ^ aes_ttable_load_column(p_round_key +  0);
+    s1 = aes_ttable_load_column(p_block +  4) ^ aes_ttable_load_column(p_round_key +  4);
+    s2 = aes_ttable_load_column(p_block +  8) ^ aes_ttable_load_column(p_round_key +  8);
+    s3 = aes_ttable_load_column(p_block + 12) ^ aes_ttable_load_column(p_round_key + 12);
+
+    for (round = 1; round < num_rounds; ++round)
+    {
+        p_round_key -= AES_BLOCK_SIZE;
+        t0 = aes_td0[s0 >> 24u] ^ aes_td1[(s3 >> 16u) & 0xFFu] ^ aes_td2[(s2 >> 8u) & 0xFFu] ^ aes_td3[s1 & 0xFFu] ^ aes_ttable_mix_columns_inv(aes_ttable_load_column(p_round_key +  0));
+        t1 = aes_td0[s1 >> 24u] ^ aes_td1[(s0 >> 16u) & 0xFFu] ^ aes_td2[(s3 >> 8u) & 0xFFu] ^ aes_td3[s2 & 0xFFu] ^ aes_ttable_mix_columns_inv(aes_ttable_load_column(p_round_key +  4));
+        t2 = aes_td0[s2 >> 24u] ^ aes_td1[(s1 >> 16u) & 0xFFu] ^ aes_td2[(s0 >> 8u) & 0xFFu] ^ aes_td3[s3 & 0xFFu] ^ aes_ttable_mix_columns_inv(aes_ttable_load_column(p_round_key +  8));
+        t3 = aes_td0[s3 >> 24u] ^ aes_td1[(s2 >> 16u) & 0xFFu] ^ aes_td2[(s1 >> 8u) & 0xFFu] ^ aes_td3[s0 & 0xFFu] ^ aes_ttable_mix_columns_inv(aes_ttable_load_column(p_round_key + 12));
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* Final round has no InvMixColumns. */
+    p_round_key -= AES_BLOCK_SIZE;
+    t0 = ((uint32_t)aes_td4[s0 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s3 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s2 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s1 & 0xFFu];
+    t1 = ((uint32_t)aes_td4[s1 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s0 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s3 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s2 & 0xFFu];
+    t2 = ((uint32_t)aes_td4[s2 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s1 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s0 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s3 & 0xFFu];
+    t3 = ((uint32_t)aes_td4[s3 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s2 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s1 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s0 & 0xFFu];
+    aes_ttable_store_column(p_block +  0, t0 ^ aes_ttable_load_column(p_round_key +  0));
+    aes_ttable_store_column(p_block +  4, t1 ^ aes_ttable_load_column(p_round_key +  4));
+    aes_ttable_store_column(p_block +  8, t2 ^ aes_ttable_load_column(p_round_key +  8));
+    aes_ttable_store_column(p_block + 12, t3 ^ aes_ttable_load_column(p_round_key + 12));
+}
+
+/* AES decryption by the equivalent inverse cipher, T-table implementation.
+ *
+ * Same interface as aes128_decrypt_eqinv(), with num_rounds for the key size
+ * (10, 12 or 14). The round keys are already in decryption order with
+ * InvMixColumns applied, so unlike aes_ttable_decrypt(), each round is only
+ * the table look-ups and XORs.
+ */
+void aes_ttable_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    uint_fast8_t    round;
+    const uint8_t * p_round_key = p_decrypt_key_schedule;
+    uint32_t        s0, s1, s2, s3;
+    uint32_t        t0, t1, t2, t3;
+
+    s0 = aes_ttable_load_column(p_block +  0) ^ aes_ttable_load_column(p_round_key +  0);
+    s1 = aes_ttable_load_column(p_block +  4) ^ aes_ttable_load_column(p_round_key +  4);
+    s2 = aes_ttable_load_column(p_block +  8) ^ aes_ttable_load_column(p_round_key +  8);
+    s3 = aes_ttable_load_column(p_block + 12) ^ aes_ttable_load_column(p_round_key + 12);
+
+    for (round = 1; round < num_rounds; ++round)
+    {
+        p_round_key += AES_BLOCK_SIZE;
+        t0 = aes_td0[s0 >> 24u] ^ aes_td1[(s3 >> 16u) & 0xFFu] ^ aes_td2[(s2 >> 8u) & 0xFFu] ^ aes_td3[s1 & 0xFFu] ^ aes_ttable_load_column(p_round_key +  0);
+        t1 = aes_td0[s1 >> 24u] ^ aes_td1[(s0 >> 16u) & 0xFFu] ^ aes_td2[(s3 >> 8u) & 0xFFu] ^ aes_td3[s2 & 0xFFu] ^ aes_ttable_load_column(p_round_key +  4);
+        t2 = aes_td0[s2 >> 24u] ^ aes_td1[(s1 >> 16u) & 0xFFu] ^ aes_td2[(s0 >> 8u) & 0xFFu] ^ aes_td3[s3 & 0xFFu] ^ aes_ttable_load_column(p_round_key +  8);
+        t3 = aes_td0[s3 >> 24u] ^ aes_td1[(s2 >> 16u) & 0xFFu] ^ aes_td2[(s1 >> 8u) & 0xFFu] ^ aes_td3[s0 & 0xFFu] ^ aes_ttable_load_column(p_round_key + 12);
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    /* Final round has no InvMixColumns. */
+    p_round_key += AES_BLOCK_SIZE;
+    t0 = ((uint32_t)aes_td4[s0 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s3 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s2 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s1 & 0xFFu];
+    t1 = ((uint32_t)aes_td4[s1 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s0 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s3 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s2 & 0xFFu];
+    t2 = ((uint32_t)aes_td4[s2 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s1 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s0 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s3 & 0xFFu];
+    t3 = ((uint32_t)aes_td4[s3 >> 24u] << 24u) ^ ((uint32_t)aes_td4[(s2 >> 16u) & 0xFFu] << 16u) ^ ((uint32_t)aes_td4[(s1 >> 8u) & 0xFFu] << 8u) ^ aes_td4[s0 & 0xFFu];
+    aes_ttable_store_column(p_block +  0, t0 ^ aes_ttable_load_column(p_round_key +  0));
+    aes_ttable_store_column(p_block +  4, t1 ^ aes_ttable_load_column(p_round_key +  4));
+    aes_ttable_store_column(p_block +  8, t2 ^ aes_ttable_load_column(p_round_key +  8));
+    aes_ttable_store_column(p_block + 12, t3 ^ aes_ttable_load_column(p_round_key + 12));
+}
+
+/* Decryption of several independent blocks by the equivalent inverse cipher,
+ * T-table implementation, one block at a time. */
+void aes_ttable_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds)
+{
+    while (num_blocks)
+    {
+        aes_ttable_decrypt_eqinv(p_blocks, p_decrypt_key_schedule, num_rounds);
+        p_blocks += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+}
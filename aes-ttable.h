@@ -0,0 +1,29 @@
+/*****************************************************************************
+ * aes-ttable.h
+ *
+ * 32-bit T-table AES implementation, for throughput-bound hosts.
+ * This is used internally by aes-min.c when ENABLE_AES_TTABLE is defined.
+ ****************************************************************************/
+
+#ifndef AES_TTABLE_H
+#define AES_TTABLE_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes_ttable_encrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_ttable_encrypt_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_ttable_encrypt_multi(uint8_t * const p_blocks[], const uint8_t * const p_key_schedules[], size_t num_blocks, uint_fast8_t num_rounds);
+void aes_ttable_decrypt(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_key_schedule, uint_fast8_t num_rounds);
+void aes_ttable_decrypt_eqinv(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+void aes_ttable_decrypt_eqinv_blocks(uint8_t * p_blocks, size_t num_blocks, const uint8_t * p_decrypt_key_schedule, uint_fast8_t num_rounds);
+
+
+#endif /* !defined(AES_TTABLE_H) */
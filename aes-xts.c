@@ -0,0 +1,346 @@
+/*****************************************************************************
+ * aes-xts.c
+ *
+ * XTS-AES-128 mode encryption/decryption (IEEE 1619, NIST SP 800-38E).
+ *
+ * Each sector (data unit) is encrypted with tweak T = E_K2(sector number),
+ * and block j of it as C = E_K1(P ^ T_j) ^ T_j, where T_j is T multiplied by
+ * x^j in GF(2^128). Since the blocks are independent, the tweaked blocks of a
+ * sector are encrypted several at a time with aes128_encrypt_blocks() (or
+ * decrypted with aes128_decrypt_eqinv_blocks()).
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-xts.h"
+#include "aes-internal.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* x^128 = x^7 + x^2 + x + 1 in the XTS field. */
+#define AES_XTS_REDUCE_BYTE         0x87u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/* A tweak, as two 64-bit words, least significant first. XTS treats the
+ * 16-byte tweak as a little-endian 128-bit value. */
+typedef struct
+{
+    uint64_t            lo;
+    uint64_t            hi;
+} aes_xts_tweak_t;
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void aes_xts_sector(const aes128_xts_key_t * p_key, const uint8_t p_encrypted_tweak[AES_BLOCK_SIZE],
+                           const uint8_t * p_in, uint8_t * p_out, size_t len, bool is_decrypt);
+static bool aes_xts_sectors(const aes128_xts_key_t * p_key, uint64_t first_sector,
+                            const uint8_t * p_in, uint8_t * p_out, size_t sector_size, size_t num_sectors,
+                            bool is_decrypt);
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+#ifdef AES_NATIVE_LE
+
+static inline uint64_t aes_xts_load_le64(const uint8_t * p)
+{
+    uint64_t            a;
+
+    memcpy(&a, p, sizeof(a));
+    return a;
+}
+
+static inline void aes_xts_store_le64(uint8_t * p, uint64_t a)
+{
+    memcpy(p, &a, sizeof(a));
+}
+
+#else
+
+static inline uint64_t aes_xts_load_le64(const uint8_t * p)
+{
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8u) | ((uint64_t)p[2] << 16u) | ((uint64_t)p[3] << 24u)
+         | ((uint64_t)p[4] << 32u) | ((uint64_t)p[5] << 40u) | ((uint64_t)p[6] << 48u) | ((uint64_t)p[7] << 56u);
+}
+
+static inline void aes_xts_store_le64(uint8_t * p, uint64_t a)
+{
+    uint_fast8_t        i;
+
+    for (i = 0; i < 8u; i++)
+    {
+        p[i] = a >> (8u * i);
+    }
+}
+
+#endif
+
+static inline void aes_xts_tweak_load(aes_xts_tweak_t * p_tweak, const uint8_t p_block[AES_BLOCK_SIZE])
+{
+    p_tweak->lo = aes_xts_load_le64(p_block);
+    p_tweak->hi = aes_xts_load_le64(p_block + 8u);
+}
+
+/*
+ * Multiply the tweak by x. This is the doubling of uint128_struct_mul2() in
+ * gcm-mul.c, but in the XTS bit order: the tweak is little-endian and bit 0
+ * of byte 0 is the lowest power of x, so this is a left shift, with the
+ * reduction folded into the low byte.
+ */
+static inline void aes_xts_tweak_mul2(aes_xts_tweak_t * p_tweak)
+{
+    uint64_t            carry = p_tweak->hi >> 63u;
+
+    p_tweak->hi = (p_tweak->hi << 1u) | (p_tweak->lo >> 63u);
+    p_tweak->lo = (p_tweak->lo << 1u) ^ (carry * AES_XTS_REDUCE_BYTE);
+}
+
+/*
+ * XOR the tweak into a block from p_in, writing it to p_out, which may be
+ * the same. The tweak is used as two words, rather than stored as a block
+ * first, and the block is written whole where possible, since reading back
+ * a block just stored in two halves stalls.
+ */
+static inline void aes_xts_tweak_xor(uint8_t p_out[AES_BLOCK_SIZE], const uint8_t p_in[AES_BLOCK_SIZE],
+                                     const aes_xts_tweak_t * p_tweak)
+{
+#ifdef AES_NATIVE_LE
+    uint64_t            block[2];
+
+    memcpy(block, p_in, AES_BLOCK_SIZE);
+    block[0] ^= p_tweak->lo;
+    block[1] ^= p_tweak->hi;
+    memcpy(p_out, block, AES_BLOCK_SIZE);
+#else
+    uint64_t            lo = aes_xts_load_le64(p_in) ^ p_tweak->lo;
+    uint64_t            hi = aes_xts_load_le64(p_in + 8u) ^ p_tweak->hi;
+
+    aes_xts_store_le64(p_out, lo);
+    aes_xts_store_le64(p_out + 8u, hi);
+#endif
+}
+
+/* Encrypt or decrypt one block with its tweak, in-place. */
+static inline void aes_xts_block(const aes128_xts_key_t * p_key, uint8_t p_block[AES_BLOCK_SIZE],
+                                 const aes_xts_tweak_t * p_tweak, bool is_decrypt)
+{
+    aes_xts_tweak_xor(p_block, p_block, p_tweak);
+    if (is_decrypt)
+    {
+        aes128_decrypt_eqinv(p_block, p_key->data_decrypt_key_schedule);
+    }
+    else
+    {
+        aes128_encrypt(p_block, p_key->data_key_schedule);
+    }
+    aes_xts_tweak_xor(p_block, p_block, p_tweak);
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Calculate the key schedules for an XTS-AES-128 key.
+ *
+ * p_xts_key is the 32-byte XTS key: the 16-byte data key followed by the
+ * 16-byte tweak key. IEEE 1619 requires the two halves to differ.
+ */
+void aes128_xts_init(aes128_xts_key_t * p_key, const uint8_t p_xts_key[AES128_XTS_KEY_SIZE])
+{
+    aes128_key_schedule(p_key->data_key_schedule, p_xts_key);
+    aes128_key_schedule_decrypt(p_key->data_decrypt_key_schedule, p_xts_key);
+    aes128_key_schedule(p_key->tweak_key_schedule, p_xts_key + AES128_KEY_SIZE);
+}
+
+/*
+ * XTS-AES-128 encryption of one sector.
+ *
+ * sector is the data unit sequence number, used as the little-endian tweak.
+ * len bytes are encrypted from p_in to p_out, which may point to the same
+ * buffer for in-place operation. len must be at least 16; if it isn't a
+ * multiple of 16, ciphertext stealing is used for the last partial block.
+ *
+ * Returns false, without output, if len is less than 16.
+ */
+bool aes128_xts_encrypt_sector(const aes128_xts_key_t * p_key, uint64_t sector,
+                               const uint8_t * p_in, uint8_t * p_out, size_t len)
+{
+    return aes128_xts_encrypt_sectors(p_key, sector, p_in, p_out, len, 1u);
+}
+
+/*
+ * XTS-AES-128 decryption of one sector, with the same parameters as
+ * aes128_xts_encrypt_sector().
+ */
+bool aes128_xts_decrypt_sector(const aes128_xts_key_t * p_key, uint64_t sector,
+                               const uint8_t * p_in, uint8_t * p_out, size_t len)
+{
+    return aes128_xts_decrypt_sectors(p_key, sector, p_in, p_out, len, 1u);
+}
+
+/*
+ * XTS-AES-128 encryption of num_sectors consecutive sectors of sector_size
+ * bytes each, numbered from first_sector.
+ *
+ * This gives the same result as aes128_xts_encrypt_sector() for each sector,
+ * but the tweaks of several sectors are encrypted at once, which matters for
+ * small sectors.
+ *
+ * Returns false, without output, if sector_size is less than 16.
+ */
+bool aes128_xts_encrypt_sectors(const aes128_xts_key_t * p_key, uint64_t first_sector,
+                                const uint8_t * p_in, uint8_t * p_out, size_t sector_size, size_t num_sectors)
+{
+    return aes_xts_sectors(p_key, first_sector, p_in, p_out, sector_size, num_sectors, false);
+}
+
+/*
+ * XTS-AES-128 decryption of num_sectors consecutive sectors, with the same
+ * parameters as aes128_xts_encrypt_sectors().
+ */
+bool aes128_xts_decrypt_sectors(const aes128_xts_key_t * p_key, uint64_t first_sector,
+                                const uint8_t * p_in, uint8_t * p_out, size_t sector_size, size_t num_sectors)
+{
+    return aes_xts_sectors(p_key, first_sector, p_in, p_out, sector_size, num_sectors, true);
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * Encrypt the tweaks of up to AES_PARALLEL_BLOCKS sectors at a time, then
+ * process each sector. Returns false, without output, if sector_size is less
+ * than a block.
+ */
+static bool aes_xts_sectors(const aes128_xts_key_t * p_key, uint64_t first_sector,
+                            const uint8_t * p_in, uint8_t * p_out, size_t sector_size, size_t num_sectors,
+                            bool is_decrypt)
+{
+    uint8_t             tweaks[AES_PARALLEL_BLOCKS * AES_BLOCK_SIZE];
+    size_t              batch_sectors;
+    size_t              i;
+
+    if (sector_size < AES_BLOCK_SIZE)
+    {
+        return false;
+    }
+    while (num_sectors)
+    {
+        batch_sectors = (num_sectors < AES_PARALLEL_BLOCKS) ? num_sectors : AES_PARALLEL_BLOCKS;
+        memset(tweaks, 0, batch_sectors * AES_BLOCK_SIZE);
+        for (i = 0; i < batch_sectors; i++)
+        {
+            aes_xts_store_le64(&tweaks[i * AES_BLOCK_SIZE], first_sector + i);
+        }
+        aes128_encrypt_blocks(tweaks, batch_sectors, p_key->tweak_key_schedule);
+
+        for (i = 0; i < batch_sectors; i++)
+        {
+            aes_xts_sector(p_key, &tweaks[i * AES_BLOCK_SIZE], p_in, p_out, sector_size, is_decrypt);
+            p_in += sector_size;
+            p_out += sector_size;
+        }
+        first_sector += batch_sectors;
+        num_sectors -= batch_sectors;
+    }
+    return true;
+}
+
+/*
+ * Encrypt or decrypt one sector of at least one block, starting with its
+ * encrypted tweak. The current tweak is kept in a local variable so it stays
+ * in registers.
+ *
+ * The full blocks are processed AES_PARALLEL_BLOCKS at a time: the tweaks of
+ * the batch are kept while the tweaked blocks are encrypted together in
+ * p_out. With ciphertext stealing, the last full block and the partial block
+ * are processed separately.
+ */
+static void aes_xts_sector(const aes128_xts_key_t * p_key, const uint8_t p_encrypted_tweak[AES_BLOCK_SIZE],
+                           const uint8_t * p_in, uint8_t * p_out, size_t len, bool is_decrypt)
+{
+    const aes_engine_t * p_engine = aes_engine_current();
+    aes_xts_tweak_t     tweak;
+    aes_xts_tweak_t     tweaks[AES_PARALLEL_BLOCKS];
+    aes_xts_tweak_t     last_tweak;
+    uint8_t             block[AES_BLOCK_SIZE];
+    size_t              num_blocks;
+    size_t              batch_blocks;
+    size_t              partial_len;
+    size_t              i;
+    uint8_t             in_byte;
+
+    num_blocks = len / AES_BLOCK_SIZE;
+    partial_len = len % AES_BLOCK_SIZE;
+    if (partial_len)
+    {
+        /* The last full block is stolen from below. */
+        num_blocks--;
+    }
+    aes_xts_tweak_load(&tweak, p_encrypted_tweak);
+
+    while (num_blocks)
+    {
+        batch_blocks = (num_blocks < AES_PARALLEL_BLOCKS) ? num_blocks : AES_PARALLEL_BLOCKS;
+        for (i = 0; i < batch_blocks; i++)
+        {
+            aes_xts_tweak_xor(p_out + i * AES_BLOCK_SIZE, p_in + i * AES_BLOCK_SIZE, &tweak);
+            /* Copied by word: as a struct copy, the tweak is stored and
+             * reloaded, which stalls. */
+            tweaks[i].lo = tweak.lo;
+            tweaks[i].hi = tweak.hi;
+            aes_xts_tweak_mul2(&tweak);
+        }
+        if (is_decrypt)
+        {
+            p_engine->decrypt_eqinv_blocks(p_out, batch_blocks, p_key->data_decrypt_key_schedule, AES128_NUM_ROUNDS);
+        }
+        else
+        {
+            p_engine->encrypt_blocks(p_out, batch_blocks, p_key->data_key_schedule, AES128_NUM_ROUNDS);
+        }
+        for (i = 0; i < batch_blocks; i++)
+        {
+            aes_xts_tweak_xor(p_out + i * AES_BLOCK_SIZE, p_out + i * AES_BLOCK_SIZE, &tweaks[i]);
+        }
+        p_in += batch_blocks * AES_BLOCK_SIZE;
+        p_out += batch_blocks * AES_BLOCK_SIZE;
+        num_blocks -= batch_blocks;
+    }
+
+    if (partial_len)
+    {
+        /* Ciphertext stealing. The last full block uses tweak m - 1 and the
+         * partial block tweak m when encrypting; decryption must undo the
+         * second one first, so uses them in the opposite order. */
+        last_tweak = tweak;
+        aes_xts_tweak_mul2(&last_tweak);
+        memcpy(block, p_in, AES_BLOCK_SIZE);
+        aes_xts_block(p_key, block, is_decrypt ? &last_tweak : &tweak, is_decrypt);
+
+        /* The partial block takes the head of that result, and the head of
+         * the last full block is replaced by the partial input. */
+        for (i = 0; i < partial_len; i++)
+        {
+            in_byte = p_in[AES_BLOCK_SIZE + i];
+            p_out[AES_BLOCK_SIZE + i] = block[i];
+            block[i] = in_byte;
+        }
+        aes_xts_block(p_key, block, is_decrypt ? &tweak : &last_tweak, is_decrypt);
+        memcpy(p_out, block, AES_BLOCK_SIZE);
+    }
+}
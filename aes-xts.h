@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * aes-xts.h
+ *
+ * XTS-AES-128 mode encryption/decryption (IEEE 1619, NIST SP 800-38E), for
+ * block devices and disk images.
+ ****************************************************************************/
+
+#ifndef AES_XTS_H
+#define AES_XTS_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* The XTS key is the data key followed by the tweak key. */
+#define AES128_XTS_KEY_SIZE         (2u * AES128_KEY_SIZE)
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Key schedules for XTS-AES-128, calculated once by aes128_xts_init(): the
+ * data key's schedules for encryption and for the equivalent inverse cipher,
+ * and the tweak key's schedule, which is only used to encrypt.
+ */
+typedef struct
+{
+    uint8_t             data_key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t             data_decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t             tweak_key_schedule[AES128_KEY_SCHEDULE_SIZE];
+} aes128_xts_key_t;
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes128_xts_init(aes128_xts_key_t * p_key, const uint8_t p_xts_key[AES128_XTS_KEY_SIZE]);
+
+bool aes128_xts_encrypt_sector(const aes128_xts_key_t * p_key, uint64_t sector,
+                               const uint8_t * p_in, uint8_t * p_out, size_t len);
+bool aes128_xts_decrypt_sector(const aes128_xts_key_t * p_key, uint64_t sector,
+                               const uint8_t * p_in, uint8_t * p_out, size_t len);
+
+bool aes128_xts_encrypt_sectors(const aes128_xts_key_t * p_key, uint64_t first_sector,
+                                const uint8_t * p_in, uint8_t * p_out, size_t sector_size, size_t num_sectors);
+bool aes128_xts_decrypt_sectors(const aes128_xts_key_t * p_key, uint64_t first_sector,
+                                const uint8_t * p_in, uint8_t * p_out, size_t sector_size, size_t num_sectors);
+
+
+#endif /* !defined(AES_XTS_H) */
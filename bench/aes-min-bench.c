@@ -0,0 +1,791 @@
+/*****************************************************************************
+ * aes-min-bench.c
+ *
+ * Micro-benchmarks for the AES and GCM primitives, with CSV output so results
+ * can be compared across configurations and releases.
+ *
+ * Usage: aes-min-bench [min-time-ms]
+ *
+ * Each benchmark is repeated with a doubling number of operations until it
+ * runs for at least min-time-ms (default 200). Compile-time options, such as
+ * the S-box implementation and GCM element size, are reported in the config
+ * column, so runs from differently configured builds can be combined.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+#include "aes-ctr.h"
+#include "aes-cbc.h"
+#include "aes-xts.h"
+#include "aes-cmac.h"
+#include "aes-ccm.h"
+#include "gcm-mul.h"
+#include "gcm-mul-ops.h"
+#include "gcm.h"
+#include "gcm-siv.h"
+#include "cpu-features.h"
+#ifdef ENABLE_THREADS
+#include "aes-parallel.h"
+#include "gcm-key-cache.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC
+#endif
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define BENCH_DEFAULT_MIN_TIME_MS   200u
+#define BENCH_BULK_SIZE             4096u
+#define BENCH_PARALLEL_SIZE         (4u * 1024u * 1024u)
+#define BENCH_MULTI_BLOCKS          8u
+#define BENCH_XTS_SECTOR_SIZE       512u
+#define BENCH_MAC_MSG_SIZE          64u
+#define BENCH_MAC_NUM_MSGS          (BENCH_BULK_SIZE / BENCH_MAC_MSG_SIZE)
+#define BENCH_CCM_NONCE_SIZE        13u
+#define BENCH_CCM_TAG_SIZE          8u
+#define BENCH_KEY_CACHE_KEYS        1024u
+
+#ifndef dimof
+#define dimof(array)    (sizeof(array) / sizeof(array[0]))
+#endif
+
+#ifdef ENABLE_SBOX_SMALL
+#define BENCH_CFG_SBOX              "small"
+#else
+#define BENCH_CFG_SBOX              "table"
+#endif
+
+#ifdef ENABLE_AESNI
+#define BENCH_CFG_AESNI_BUILT       1
+#else
+#define BENCH_CFG_AESNI_BUILT       0
+#endif
+
+#if defined(ENABLE_AES_TTABLE)
+#define BENCH_CFG_AES               "ttable"
+#elif defined(ENABLE_AES_BITSLICE)
+#define BENCH_CFG_AES               "bitslice"
+#elif defined(ENABLE_AES_WORD32)
+#define BENCH_CFG_AES               "word32"
+#else
+#define BENCH_CFG_AES               "byte"
+#endif
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/* Run the operation num_ops times. */
+typedef void (*bench_func_t)(size_t num_ops);
+
+typedef struct
+{
+    const char    * p_name;
+    bench_func_t    func;
+    size_t          bytes_per_op;   /* 0 for key set-up */
+} bench_t;
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+static uint8_t              bench_key[AES256_KEY_SIZE];
+static uint8_t              bench_block[AES_BLOCK_SIZE];
+static uint8_t              bench_key_schedule[AES256_KEY_SCHEDULE_SIZE];
+static uint8_t              bench_otfks_key[AES256_KEY_SIZE];
+static uint8_t              bench_buffer[BENCH_BULK_SIZE];
+static uint8_t              bench_tag[AES128_GCM_TAG_SIZE];
+static aes128_gcm_key_t     bench_gcm_key;
+static aes128_xts_key_t     bench_xts_key;
+static aes128_cmac_key_t    bench_cmac_key;
+static aes128_gcm_siv_key_t bench_gcm_siv_key;
+static const uint8_t      * bench_mac_msgs[BENCH_MAC_NUM_MSGS];
+static size_t               bench_mac_msg_lens[BENCH_MAC_NUM_MSGS];
+static uint8_t              bench_mac_ivs[BENCH_MAC_NUM_MSGS * AES128_GCM_IV_SIZE];
+static uint8_t              bench_mac_tags[BENCH_MAC_NUM_MSGS * AES_BLOCK_SIZE];
+static uint8_t            * bench_mac_outs[BENCH_MAC_NUM_MSGS];
+static uint8_t              bench_ccm_out[BENCH_BULK_SIZE];
+#ifdef ENABLE_THREADS
+static uint8_t              bench_parallel_buffer[BENCH_PARALLEL_SIZE];
+#endif
+
+#ifdef GCM_MUL_TABLE_8
+static gcm_mul_table8_t     bench_table8;
+static gcm_mul_table8_lazy_t bench_table8_lazy;
+#endif
+#ifdef GCM_MUL_TABLE_4
+static gcm_mul_table4_t     bench_table4;
+#endif
+#ifdef GCM_MUL_TABLE_4_SHOUP
+static gcm_mul_table4_shoup_t bench_table4_shoup;
+#endif
+static gcm_mul_ops_ctx_t    bench_mul_ops_ctx;
+#ifdef GCM_MUL_CLMUL
+static gcm_mul_clmul_t      bench_clmul;
+static gcm_ghash_key_t      bench_ghash_key;
+#endif
+
+/* Sink for results, so the compiler can't discard the work. */
+volatile uint8_t            bench_sink;
+
+/*****************************************************************************
+ * Benchmark functions
+ ****************************************************************************/
+
+static void bench_aes128_key_schedule(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        aes128_key_schedule(bench_key_schedule, bench_key);
+        bench_key[0] ^= bench_key_schedule[AES128_KEY_SCHEDULE_SIZE - 1u];
+    }
+}
+
+static void bench_aes128_encrypt(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_encrypt(bench_block, bench_key_schedule);
+}
+
+static void bench_aes128_key_schedule_decrypt(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        aes128_key_schedule_decrypt(bench_key_schedule, bench_key);
+        bench_key[0] ^= bench_key_schedule[AES128_KEY_SCHEDULE_SIZE - 1u];
+    }
+}
+
+static void bench_aes128_decrypt_eqinv(size_t num_ops)
+{
+    aes128_key_schedule_decrypt(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_decrypt_eqinv(bench_block, bench_key_schedule);
+}
+
+static void bench_aes128_decrypt(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_decrypt(bench_block, bench_key_schedule);
+}
+
+static void bench_aes128_encrypt_blocks(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_encrypt_blocks(bench_buffer, BENCH_BULK_SIZE / AES_BLOCK_SIZE, bench_key_schedule);
+}
+
+static void bench_aes128_encrypt_multi(size_t num_ops)
+{
+    static uint8_t  key_schedules[BENCH_MULTI_BLOCKS][AES128_KEY_SCHEDULE_SIZE];
+    uint8_t *       p_blocks[BENCH_MULTI_BLOCKS];
+    const uint8_t * p_key_schedules[BENCH_MULTI_BLOCKS];
+    size_t          i;
+
+    for (i = 0; i < BENCH_MULTI_BLOCKS; ++i)
+    {
+        bench_key[0] = i;
+        aes128_key_schedule(key_schedules[i], bench_key);
+        p_blocks[i] = bench_buffer + i * AES_BLOCK_SIZE;
+        p_key_schedules[i] = key_schedules[i];
+    }
+    while (num_ops--)
+        aes128_encrypt_multi(p_blocks, p_key_schedules, BENCH_MULTI_BLOCKS);
+}
+
+static void bench_aes128_otfks_encrypt(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        memcpy(bench_otfks_key, bench_key, AES128_KEY_SIZE);
+        aes128_otfks_encrypt(bench_block, bench_otfks_key);
+    }
+}
+
+static void bench_aes128_otfks_decrypt_start_key(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        memcpy(bench_otfks_key, bench_key, AES128_KEY_SIZE);
+        aes128_otfks_decrypt_start_key(bench_otfks_key);
+        bench_key[0] ^= bench_otfks_key[0];
+    }
+}
+
+static void bench_aes128_otfks_decrypt(size_t num_ops)
+{
+    uint8_t start_key[AES128_KEY_SIZE];
+
+    memcpy(start_key, bench_key, AES128_KEY_SIZE);
+    aes128_otfks_decrypt_start_key(start_key);
+    while (num_ops--)
+    {
+        memcpy(bench_otfks_key, start_key, AES128_KEY_SIZE);
+        aes128_otfks_decrypt(bench_block, bench_otfks_key);
+    }
+}
+
+static void bench_aes192_encrypt(size_t num_ops)
+{
+    aes192_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes192_encrypt(bench_block, bench_key_schedule);
+}
+
+static void bench_aes256_encrypt(size_t num_ops)
+{
+    aes256_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes256_encrypt(bench_block, bench_key_schedule);
+}
+
+static void bench_aes128_ctr_xcrypt(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_ctr_xcrypt(bench_key_schedule, bench_key, 0, bench_buffer, bench_buffer, BENCH_BULK_SIZE);
+}
+
+static void bench_aes128_decrypt_blocks(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_decrypt_blocks(bench_buffer, BENCH_BULK_SIZE / AES_BLOCK_SIZE, bench_key_schedule);
+}
+
+static void bench_aes128_cbc_encrypt(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_cbc_encrypt(bench_key_schedule, bench_block, bench_buffer, bench_buffer, BENCH_BULK_SIZE / AES_BLOCK_SIZE);
+}
+
+static void bench_aes128_cbc_decrypt(size_t num_ops)
+{
+    aes128_key_schedule_decrypt(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_cbc_decrypt(bench_key_schedule, bench_block, bench_buffer, bench_buffer, BENCH_BULK_SIZE / AES_BLOCK_SIZE);
+}
+
+static void bench_aes128_xts_encrypt_sector(size_t num_ops)
+{
+    aes128_xts_init(&bench_xts_key, bench_key);
+    while (num_ops--)
+        aes128_xts_encrypt_sector(&bench_xts_key, num_ops, bench_buffer, bench_buffer, BENCH_BULK_SIZE);
+}
+
+static void bench_aes128_xts_decrypt_sector(size_t num_ops)
+{
+    aes128_xts_init(&bench_xts_key, bench_key);
+    while (num_ops--)
+        aes128_xts_decrypt_sector(&bench_xts_key, num_ops, bench_buffer, bench_buffer, BENCH_BULK_SIZE);
+}
+
+/* 512-byte sectors, whose tweaks are encrypted together. */
+static void bench_aes128_xts_encrypt_sectors(size_t num_ops)
+{
+    aes128_xts_init(&bench_xts_key, bench_key);
+    while (num_ops--)
+        aes128_xts_encrypt_sectors(&bench_xts_key, num_ops, bench_buffer, bench_buffer,
+                                   BENCH_XTS_SECTOR_SIZE, BENCH_BULK_SIZE / BENCH_XTS_SECTOR_SIZE);
+}
+
+#ifdef GCM_MUL_BIT_BY_BIT
+static void bench_gcm_mul(size_t num_ops)
+{
+    while (num_ops--)
+        gcm_mul(bench_block, bench_key);
+}
+#endif
+
+#ifdef GCM_MUL_TABLE_8
+static void bench_gcm_mul_prepare_table8(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        gcm_mul_prepare_table8(&bench_table8, bench_key);
+        bench_key[0] ^= bench_table8.key_data[1].bytes[0];
+    }
+}
+
+static void bench_gcm_mul_table8(size_t num_ops)
+{
+    gcm_mul_prepare_table8(&bench_table8, bench_key);
+    while (num_ops--)
+        gcm_mul_table8(bench_block, &bench_table8);
+}
+
+static void bench_gcm_mul_prepare_table8_lazy(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        gcm_mul_prepare_table8_lazy(&bench_table8_lazy, bench_key);
+        bench_key[0] ^= bench_table8_lazy.table.key_data[1].bytes[0];
+    }
+}
+
+/* A short message with a new key: prepare, then GHASH 4 blocks. */
+static void bench_gcm_mul_table8_lazy_short(size_t num_ops)
+{
+    uint_fast8_t    i;
+
+    while (num_ops--)
+    {
+        gcm_mul_prepare_table8_lazy(&bench_table8_lazy, bench_key);
+        for (i = 0; i < 4u; i++)
+        {
+            aes_block_xor(bench_block, bench_buffer + i * AES_BLOCK_SIZE);
+            gcm_mul_table8_lazy(bench_block, &bench_table8_lazy);
+        }
+        bench_key[0] ^= bench_block[0];
+    }
+}
+
+static void bench_gcm_mul_table8_short(size_t num_ops)
+{
+    uint_fast8_t    i;
+
+    while (num_ops--)
+    {
+        gcm_mul_prepare_table8(&bench_table8, bench_key);
+        for (i = 0; i < 4u; i++)
+        {
+            aes_block_xor(bench_block, bench_buffer + i * AES_BLOCK_SIZE);
+            gcm_mul_table8(bench_block, &bench_table8);
+        }
+        bench_key[0] ^= bench_block[0];
+    }
+}
+#endif
+
+#ifdef GCM_MUL_TABLE_4
+static void bench_gcm_mul_prepare_table4(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        gcm_mul_prepare_table4(&bench_table4, bench_key);
+        bench_key[0] ^= bench_table4.key_data_hi[1].bytes[0];
+    }
+}
+
+static void bench_gcm_mul_table4(size_t num_ops)
+{
+    gcm_mul_prepare_table4(&bench_table4, bench_key);
+    while (num_ops--)
+        gcm_mul_table4(bench_block, &bench_table4);
+}
+#endif
+
+#ifdef GCM_MUL_TABLE_4_SHOUP
+static void bench_gcm_mul_prepare_table4_shoup(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        gcm_mul_prepare_table4_shoup(&bench_table4_shoup, bench_key);
+        bench_key[0] ^= bench_table4_shoup.key_data[1].bytes[0];
+    }
+}
+
+static void bench_gcm_mul_table4_shoup(size_t num_ops)
+{
+    gcm_mul_prepare_table4_shoup(&bench_table4_shoup, bench_key);
+    while (num_ops--)
+        gcm_mul_table4_shoup(bench_block, &bench_table4_shoup);
+}
+#endif
+
+static void bench_gcm_mul_ops_select(size_t num_ops)
+{
+    const gcm_mul_ops_t * p_ops = gcm_mul_ops_select();
+
+    p_ops->prepare(&bench_mul_ops_ctx, bench_key);
+    while (num_ops--)
+        p_ops->mul_blocks(bench_block, bench_buffer, BENCH_BULK_SIZE / AES_BLOCK_SIZE, &bench_mul_ops_ctx);
+}
+
+#ifdef GCM_MUL_CLMUL
+static void bench_gcm_mul_clmul(size_t num_ops)
+{
+    gcm_mul_prepare_clmul(&bench_clmul, bench_key);
+    while (num_ops--)
+        gcm_mul_clmul(bench_block, &bench_clmul);
+}
+
+static void bench_gcm_ghash_prepare(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        gcm_ghash_prepare(&bench_ghash_key, bench_key);
+        bench_key[0] ^= bench_ghash_key.key_powers[GCM_GHASH_NUM_POWERS - 1u][0] & 0xFFu;
+    }
+}
+
+static void bench_gcm_ghash_blocks(size_t num_ops)
+{
+    gcm_ghash_prepare(&bench_ghash_key, bench_key);
+    while (num_ops--)
+        gcm_ghash_blocks(bench_block, bench_buffer, BENCH_BULK_SIZE / AES_BLOCK_SIZE, &bench_ghash_key);
+}
+#endif
+
+static void bench_aes128_gcm_init(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        aes128_gcm_init(&bench_gcm_key, bench_key);
+        bench_key[0] ^= bench_gcm_key.key_schedule[AES128_KEY_SCHEDULE_SIZE - 1u];
+    }
+}
+
+static void bench_aes128_gcm_seal(size_t num_ops)
+{
+    aes128_gcm_init(&bench_gcm_key, bench_key);
+    while (num_ops--)
+    {
+        aes128_gcm_seal(&bench_gcm_key, bench_key, AES128_GCM_IV_SIZE, NULL, 0,
+                        bench_buffer, bench_buffer, BENCH_BULK_SIZE, bench_tag, sizeof(bench_tag));
+    }
+}
+
+static void bench_aes128_ccm_seal(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+    {
+        aes128_ccm_seal(bench_key_schedule, bench_key, BENCH_CCM_NONCE_SIZE, NULL, 0,
+                        bench_buffer, bench_buffer, BENCH_BULK_SIZE, bench_tag, BENCH_CCM_TAG_SIZE);
+    }
+}
+
+/* Open into a separate buffer, so the tag stays correct. */
+static void bench_aes128_ccm_open(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    aes128_ccm_seal(bench_key_schedule, bench_key, BENCH_CCM_NONCE_SIZE, NULL, 0,
+                    bench_buffer, bench_buffer, BENCH_BULK_SIZE, bench_tag, BENCH_CCM_TAG_SIZE);
+    while (num_ops--)
+    {
+        aes128_ccm_open(bench_key_schedule, bench_key, BENCH_CCM_NONCE_SIZE, NULL, 0,
+                        bench_ccm_out, bench_buffer, BENCH_BULK_SIZE, bench_tag, BENCH_CCM_TAG_SIZE);
+    }
+}
+
+static void bench_aes128_otfks_ccm_seal(size_t num_ops)
+{
+    while (num_ops--)
+    {
+        aes128_otfks_ccm_seal(bench_key, bench_key, BENCH_CCM_NONCE_SIZE, NULL, 0,
+                              bench_buffer, bench_buffer, BENCH_BULK_SIZE, bench_tag, BENCH_CCM_TAG_SIZE);
+    }
+}
+
+/* Split the bulk buffer into short records, each with its own IV. */
+static void bench_mac_msgs_init(void)
+{
+    size_t          i;
+
+    for (i = 0; i < BENCH_MAC_NUM_MSGS; i++)
+    {
+        bench_mac_msgs[i] = &bench_buffer[i * BENCH_MAC_MSG_SIZE];
+        bench_mac_msg_lens[i] = BENCH_MAC_MSG_SIZE;
+        bench_mac_outs[i] = &bench_ccm_out[i * BENCH_MAC_MSG_SIZE];
+        memset(&bench_mac_ivs[i * AES128_GCM_IV_SIZE], (int)i, AES128_GCM_IV_SIZE);
+    }
+}
+
+static void bench_aes128_cmac(size_t num_ops)
+{
+    size_t          i;
+
+    aes128_cmac_init(&bench_cmac_key, bench_key);
+    bench_mac_msgs_init();
+    while (num_ops--)
+    {
+        for (i = 0; i < BENCH_MAC_NUM_MSGS; i++)
+            aes128_cmac(&bench_cmac_key, bench_mac_msgs[i], BENCH_MAC_MSG_SIZE, &bench_mac_tags[i * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+    }
+}
+
+static void bench_aes128_cmac_batch(size_t num_ops)
+{
+    aes128_cmac_init(&bench_cmac_key, bench_key);
+    bench_mac_msgs_init();
+    while (num_ops--)
+        aes128_cmac_batch(&bench_cmac_key, bench_mac_msgs, bench_mac_msg_lens, bench_mac_tags, BENCH_MAC_NUM_MSGS);
+}
+
+static void bench_aes128_gmac(size_t num_ops)
+{
+    size_t          i;
+
+    aes128_gcm_init(&bench_gcm_key, bench_key);
+    bench_mac_msgs_init();
+    while (num_ops--)
+    {
+        for (i = 0; i < BENCH_MAC_NUM_MSGS; i++)
+            aes128_gmac(&bench_gcm_key, &bench_mac_ivs[i * AES128_GCM_IV_SIZE], AES128_GCM_IV_SIZE,
+                        bench_mac_msgs[i], BENCH_MAC_MSG_SIZE, &bench_mac_tags[i * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+    }
+}
+
+static void bench_aes128_gmac_batch(size_t num_ops)
+{
+    aes128_gcm_init(&bench_gcm_key, bench_key);
+    bench_mac_msgs_init();
+    while (num_ops--)
+        aes128_gmac_batch(&bench_gcm_key, bench_mac_ivs, bench_mac_msgs, bench_mac_msg_lens, bench_mac_tags, BENCH_MAC_NUM_MSGS);
+}
+
+static void bench_aes128_gcm_siv_seal(size_t num_ops)
+{
+    aes128_gcm_siv_init(&bench_gcm_siv_key, bench_key);
+    while (num_ops--)
+    {
+        aes128_gcm_siv_seal(&bench_gcm_siv_key, bench_key, NULL, 0,
+                            bench_buffer, bench_buffer, BENCH_BULK_SIZE, bench_tag);
+    }
+}
+
+static void bench_aes128_gcm_siv_seal_msgs(size_t num_ops)
+{
+    size_t          i;
+
+    aes128_gcm_siv_init(&bench_gcm_siv_key, bench_key);
+    bench_mac_msgs_init();
+    while (num_ops--)
+    {
+        for (i = 0; i < BENCH_MAC_NUM_MSGS; i++)
+            aes128_gcm_siv_seal(&bench_gcm_siv_key, &bench_mac_ivs[i * AES128_GCM_SIV_NONCE_SIZE], NULL, 0,
+                                bench_mac_outs[i], bench_mac_msgs[i], BENCH_MAC_MSG_SIZE, &bench_mac_tags[i * AES_BLOCK_SIZE]);
+    }
+}
+
+static void bench_aes128_gcm_siv_seal_batch(size_t num_ops)
+{
+    aes128_gcm_siv_init(&bench_gcm_siv_key, bench_key);
+    bench_mac_msgs_init();
+    while (num_ops--)
+        aes128_gcm_siv_seal_batch(&bench_gcm_siv_key, bench_mac_ivs, NULL, NULL, bench_mac_outs, bench_mac_msgs,
+                                  bench_mac_msg_lens, bench_mac_tags, BENCH_MAC_NUM_MSGS);
+}
+
+#ifdef ENABLE_THREADS
+static void bench_aes128_ctr_xcrypt_parallel(size_t num_ops)
+{
+    aes128_key_schedule(bench_key_schedule, bench_key);
+    while (num_ops--)
+        aes128_ctr_xcrypt_parallel(NULL, bench_key_schedule, bench_key, 0, bench_parallel_buffer, bench_parallel_buffer, BENCH_PARALLEL_SIZE);
+}
+
+static void bench_aes128_gcm_seal_parallel(size_t num_ops)
+{
+    aes128_gcm_init(&bench_gcm_key, bench_key);
+    while (num_ops--)
+    {
+        aes128_gcm_seal_parallel(NULL, &bench_gcm_key, bench_key, AES128_GCM_IV_SIZE, NULL, 0,
+                                 bench_parallel_buffer, bench_parallel_buffer, BENCH_PARALLEL_SIZE, bench_tag, sizeof(bench_tag));
+    }
+}
+
+/* Look-ups of keys which are all in the cache. */
+static void bench_aes128_gcm_key_cache_acquire(size_t num_ops)
+{
+    static aes128_gcm_key_cache_t * p_cache;
+    uint64_t        key_id = 0;
+
+    if (p_cache == NULL)
+    {
+        p_cache = aes128_gcm_key_cache_create(BENCH_KEY_CACHE_KEYS * aes128_gcm_key_cache_entry_size(), 0);
+    }
+    while (num_ops--)
+    {
+        aes128_gcm_key_cache_release(p_cache, aes128_gcm_key_cache_acquire(p_cache, key_id, bench_key));
+        key_id = (key_id + 1u) % (BENCH_KEY_CACHE_KEYS / 4u);
+    }
+}
+#endif
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+static const bench_t benchmarks[] =
+{
+    { "aes128_key_schedule",            bench_aes128_key_schedule,              0 },
+    { "aes128_key_schedule_decrypt",    bench_aes128_key_schedule_decrypt,      0 },
+    { "aes128_encrypt",                 bench_aes128_encrypt,                   AES_BLOCK_SIZE },
+    { "aes128_decrypt",                 bench_aes128_decrypt,                   AES_BLOCK_SIZE },
+    { "aes128_decrypt_eqinv",           bench_aes128_decrypt_eqinv,             AES_BLOCK_SIZE },
+    { "aes128_encrypt_blocks",          bench_aes128_encrypt_blocks,            BENCH_BULK_SIZE },
+    { "aes128_decrypt_blocks",          bench_aes128_decrypt_blocks,            BENCH_BULK_SIZE },
+    { "aes128_encrypt_multi",           bench_aes128_encrypt_multi,             BENCH_MULTI_BLOCKS * AES_BLOCK_SIZE },
+    { "aes128_otfks_encrypt",           bench_aes128_otfks_encrypt,             AES_BLOCK_SIZE },
+    { "aes128_otfks_decrypt_start_key", bench_aes128_otfks_decrypt_start_key,   0 },
+    { "aes128_otfks_decrypt",           bench_aes128_otfks_decrypt,             AES_BLOCK_SIZE },
+    { "aes192_encrypt",                 bench_aes192_encrypt,                   AES_BLOCK_SIZE },
+    { "aes256_encrypt",                 bench_aes256_encrypt,                   AES_BLOCK_SIZE },
+    { "aes128_ctr_xcrypt",              bench_aes128_ctr_xcrypt,                BENCH_BULK_SIZE },
+    { "aes128_cbc_encrypt",             bench_aes128_cbc_encrypt,               BENCH_BULK_SIZE },
+    { "aes128_cbc_decrypt",             bench_aes128_cbc_decrypt,               BENCH_BULK_SIZE },
+    { "aes128_xts_encrypt_sector",      bench_aes128_xts_encrypt_sector,        BENCH_BULK_SIZE },
+    { "aes128_xts_decrypt_sector",      bench_aes128_xts_decrypt_sector,        BENCH_BULK_SIZE },
+    { "aes128_xts_encrypt_sectors",     bench_aes128_xts_encrypt_sectors,       BENCH_BULK_SIZE },
+#ifdef GCM_MUL_BIT_BY_BIT
+    { "gcm_mul",                        bench_gcm_mul,                          AES_BLOCK_SIZE },
+#endif
+#ifdef GCM_MUL_TABLE_8
+    { "gcm_mul_prepare_table8",         bench_gcm_mul_prepare_table8,           0 },
+    { "gcm_mul_table8",                 bench_gcm_mul_table8,                   AES_BLOCK_SIZE },
+    { "gcm_mul_table8_short",           bench_gcm_mul_table8_short,             4u * AES_BLOCK_SIZE },
+    { "gcm_mul_prepare_table8_lazy",    bench_gcm_mul_prepare_table8_lazy,      0 },
+    { "gcm_mul_table8_lazy_short",      bench_gcm_mul_table8_lazy_short,        4u * AES_BLOCK_SIZE },
+#endif
+#ifdef GCM_MUL_TABLE_4
+    { "gcm_mul_prepare_table4",         bench_gcm_mul_prepare_table4,           0 },
+    { "gcm_mul_table4",                 bench_gcm_mul_table4,                   AES_BLOCK_SIZE },
+#endif
+#ifdef GCM_MUL_TABLE_4_SHOUP
+    { "gcm_mul_prepare_table4_shoup",   bench_gcm_mul_prepare_table4_shoup,     0 },
+    { "gcm_mul_table4_shoup",           bench_gcm_mul_table4_shoup,             AES_BLOCK_SIZE },
+#endif
+#ifdef GCM_MUL_CLMUL
+    { "gcm_mul_clmul",                  bench_gcm_mul_clmul,                    AES_BLOCK_SIZE },
+    { "gcm_ghash_prepare",              bench_gcm_ghash_prepare,                0 },
+    { "gcm_ghash_blocks",               bench_gcm_ghash_blocks,                 BENCH_BULK_SIZE },
+#endif
+    { "gcm_mul_ops_select",             bench_gcm_mul_ops_select,               BENCH_BULK_SIZE },
+    { "aes128_gcm_init",                bench_aes128_gcm_init,                  0 },
+    { "aes128_gcm_seal",                bench_aes128_gcm_seal,                  BENCH_BULK_SIZE },
+    { "aes128_ccm_seal",                bench_aes128_ccm_seal,                  BENCH_BULK_SIZE },
+    { "aes128_ccm_open",                bench_aes128_ccm_open,                  BENCH_BULK_SIZE },
+    { "aes128_otfks_ccm_seal",          bench_aes128_otfks_ccm_seal,            BENCH_BULK_SIZE },
+    { "aes128_cmac_64",                 bench_aes128_cmac,                      BENCH_BULK_SIZE },
+    { "aes128_cmac_batch_64",           bench_aes128_cmac_batch,                BENCH_BULK_SIZE },
+    { "aes128_gmac_64",                 bench_aes128_gmac,                      BENCH_BULK_SIZE },
+    { "aes128_gmac_batch_64",           bench_aes128_gmac_batch,                BENCH_BULK_SIZE },
+    { "aes128_gcm_siv_seal",            bench_aes128_gcm_siv_seal,              BENCH_BULK_SIZE },
+    { "aes128_gcm_siv_seal_64",         bench_aes128_gcm_siv_seal_msgs,         BENCH_BULK_SIZE },
+    { "aes128_gcm_siv_seal_batch_64",   bench_aes128_gcm_siv_seal_batch,        BENCH_BULK_SIZE },
+#ifdef ENABLE_THREADS
+    { "aes128_ctr_xcrypt_parallel",     bench_aes128_ctr_xcrypt_parallel,       BENCH_PARALLEL_SIZE },
+    { "aes128_gcm_seal_parallel",       bench_aes128_gcm_seal_parallel,         BENCH_PARALLEL_SIZE },
+    { "aes128_gcm_key_cache_acquire",   bench_aes128_gcm_key_cache_acquire,     0 },
+#endif
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static uint64_t bench_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t bench_cycles(void)
+{
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static void bench_run(const bench_t * p_bench, const char * p_config, uint64_t min_time_ns)
+{
+    size_t          num_ops = 1u;
+    uint64_t        start_ns;
+    uint64_t        elapsed_ns;
+    uint64_t        start_cycles;
+    uint64_t        elapsed_cycles;
+    double          ns_per_op;
+
+    /* Warm up caches and branch predictors. */
+    p_bench->func(1u);
+
+    for (;;)
+    {
+        start_cycles = bench_cycles();
+        start_ns = bench_time_ns();
+        p_bench->func(num_ops);
+        elapsed_ns = bench_time_ns() - start_ns;
+        elapsed_cycles = bench_cycles() - start_cycles;
+        if (elapsed_ns >= min_time_ns)
+            break;
+        num_ops *= 2u;
+    }
+
+    ns_per_op = (double)elapsed_ns / num_ops;
+    printf("%s,%s,%zu,%zu,%.2f,", p_bench->p_name, p_config, p_bench->bytes_per_op, num_ops, ns_per_op);
+    if (p_bench->bytes_per_op)
+        printf("%.3f", ns_per_op / p_bench->bytes_per_op);
+    printf(",");
+#ifdef BENCH_HAVE_TSC
+    if (p_bench->bytes_per_op)
+        printf("%.3f", (double)elapsed_cycles / num_ops / p_bench->bytes_per_op);
+    else
+        printf("%.1f", (double)elapsed_cycles / num_ops);
+#else
+    (void)elapsed_cycles;
+#endif
+    printf("\n");
+    fflush(stdout);
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    size_t      i;
+    uint64_t    min_time_ms = BENCH_DEFAULT_MIN_TIME_MS;
+    char        config[160];
+
+    if (argc > 1)
+        min_time_ms = strtoul(argv[1], NULL, 0);
+
+    for (i = 0; i < sizeof(bench_key); i++)
+        bench_key[i] = i * 0x11u + 1u;
+
+    snprintf(config, sizeof(config), "sbox=%s;aes=%s;engine=%s;aesni=%s;pclmul=%s;gcm_element_size=%u;gcm_mul=%s;threads=%zu",
+             BENCH_CFG_SBOX, BENCH_CFG_AES, aes_engine_current()->name,
+             (BENCH_CFG_AESNI_BUILT && aes_cpu_has_aesni()) ? "yes" : "no",
+             aes_cpu_has_pclmul() ? "yes" : "no",
+             (unsigned)GCM_U128_ELEMENT_SIZE,
+             gcm_mul_ops_select()->name,
+#ifdef ENABLE_THREADS
+             aes_thread_pool_num_threads(aes_thread_pool_default())
+#else
+             (size_t)1u
+#endif
+             );
+
+    /* cycles is TSC ticks per byte, or per operation for key set-up. */
+    printf("benchmark,config,bytes_per_op,ops,ns_per_op,ns_per_byte,cycles\n");
+    for (i = 0; i < dimof(benchmarks); i++)
+    {
+        bench_run(&benchmarks[i], config, min_time_ms * 1000000u);
+    }
+
+    bench_sink = bench_block[0] ^ bench_buffer[0] ^ bench_tag[0];
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * cpu-features.c
+ *
+ * Run-time detection of CPU instruction set extensions, used to select
+ * accelerated implementations where available.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "cpu-features.h"
+
+#include <stdint.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_FEATURES_X86
+#include <cpuid.h>
+#endif
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define CPU_FEATURES_ECX_PCLMUL     (1u << 1u)
+#define CPU_FEATURES_ECX_SSSE3      (1u << 9u)
+#define CPU_FEATURES_ECX_AES        (1u << 25u)
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static uint32_t cpu_features_ecx(void);
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Check whether the CPU supports the AES-NI instructions (AESENC, AESDEC,
+ * AESKEYGENASSIST, AESIMC etc).
+ */
+bool aes_cpu_has_aesni(void)
+{
+    return (cpu_features_ecx() & CPU_FEATURES_ECX_AES) != 0;
+}
+
+/*
+ * Check whether the CPU supports the PCLMULQDQ carry-less multiply
+ * instruction. SSSE3 is also required, for the PSHUFB byte shuffle used to
+ * byte-reverse GHASH blocks.
+ */
+bool aes_cpu_has_pclmul(void)
+{
+    const uint32_t  mask = CPU_FEATURES_ECX_PCLMUL | CPU_FEATURES_ECX_SSSE3;
+
+    return (cpu_features_ecx() & mask) == mask;
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * Get ECX of CPUID leaf 1, which has the feature flags we're interested in.
+ *
+ * The result is cached after the first call. If several threads race on the
+ * first call, they all store the same value, so no locking is needed.
+ */
+static uint32_t cpu_features_ecx(void)
+{
+    static volatile uint32_t    cached_ecx;
+    static volatile bool        is_cached;
+    uint32_t                    ecx = 0;
+
+    if (is_cached)
+    {
+        return cached_ecx;
+    }
+#ifdef CPU_FEATURES_X86
+    {
+        unsigned int    eax;
+        unsigned int    ebx;
+        unsigned int    ecx_tmp;
+        unsigned int    edx;
+
+        if (__get_cpuid(1u, &eax, &ebx, &ecx_tmp, &edx))
+        {
+            ecx = ecx_tmp;
+        }
+    }
+#endif
+    cached_ecx = ecx;
+    is_cached = true;
+    return ecx;
+}
@@ -0,0 +1,25 @@
+/*****************************************************************************
+ * cpu-features.h
+ *
+ * Run-time detection of CPU instruction set extensions, used to select
+ * accelerated implementations where available.
+ ****************************************************************************/
+
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include <stdbool.h>
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+bool aes_cpu_has_aesni(void);
+bool aes_cpu_has_pclmul(void);
+
+
+#endif /* !defined(CPU_FEATURES_H) */
@@ -0,0 +1,476 @@
+/*****************************************************************************
+ * gcm-key-cache.c
+ *
+ * Thread-safe cache of prepared AES-128-GCM keys, with a fixed memory budget
+ * and LRU eviction.
+ *
+ * All entries are allocated when the cache is created. They are divided
+ * between lock stripes, selected by a hash of the key ID. Each stripe has a
+ * chained hash table of its entries, a free list, and an LRU list of the
+ * entries that are not in use. An entry is in use from
+ * aes128_gcm_key_cache_acquire() until the matching
+ * aes128_gcm_key_cache_release(), and only entries that are not in use are
+ * evicted, so a key is never changed while it is being used.
+ *
+ * A new key is prepared by aes128_gcm_init() with the stripe unlocked, so
+ * other keys of the stripe can be looked up meanwhile. Other threads that
+ * want the same key wait for it to be ready.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm-key-cache.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Stripes are aligned to this, so threads using different stripes don't
+ * share cache lines. */
+#define AES128_GCM_KEY_CACHE_LINE_SIZE  64u
+
+#define AES128_GCM_KEY_CACHE_HASH_MUL   0x9E3779B97F4A7C15u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+typedef struct aes128_gcm_key_cache_entry_s aes128_gcm_key_cache_entry_t;
+
+struct aes128_gcm_key_cache_entry_s
+{
+    aes128_gcm_key_t                key;
+    uint64_t                        key_id;
+    aes128_gcm_key_cache_entry_t  * p_hash_next;
+    aes128_gcm_key_cache_entry_t  * p_lru_prev;
+    aes128_gcm_key_cache_entry_t  * p_lru_next;    /* Also the free list link */
+    size_t                          refs;
+    size_t                          stripe_index;
+    size_t                          bucket;
+    bool                            ready;          /* aes128_gcm_init() is done */
+    bool                            detached;       /* Removed from the hash table while in use */
+};
+
+typedef struct
+{
+    pthread_mutex_t                 mutex;          /* Protects the stripe and its entries */
+    pthread_cond_t                  ready_cond;
+    aes128_gcm_key_cache_entry_t ** p_buckets;
+    size_t                          bucket_mask;
+    aes128_gcm_key_cache_entry_t  * p_lru_head;     /* Most recently used */
+    aes128_gcm_key_cache_entry_t  * p_lru_tail;     /* Least recently used */
+    aes128_gcm_key_cache_entry_t  * p_free;
+    aes128_gcm_key_cache_entry_t  * p_entries;
+    size_t                          num_entries;
+    uint64_t                        hits;
+    uint64_t                        misses;
+    uint64_t                        evictions;
+} __attribute__((aligned(AES128_GCM_KEY_CACHE_LINE_SIZE))) aes128_gcm_key_cache_stripe_t;
+
+struct aes128_gcm_key_cache_s
+{
+    size_t                          num_stripes;
+    aes128_gcm_key_cache_stripe_t * p_stripes;
+};
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static size_t aes128_gcm_key_cache_hash(uint64_t key_id);
+static aes128_gcm_key_cache_entry_t * aes128_gcm_key_cache_find(aes128_gcm_key_cache_stripe_t * p_stripe, uint64_t key_id, size_t hash);
+static void aes128_gcm_key_cache_hash_remove(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry);
+static void aes128_gcm_key_cache_lru_remove(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry);
+static void aes128_gcm_key_cache_put(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry);
+static void aes128_gcm_key_cache_detach(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry);
+static bool aes128_gcm_key_cache_key_matches(const aes128_gcm_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE]);
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Get the memory used per cache entry, including its share of the hash table,
+ * for sizing the memory budget passed to aes128_gcm_key_cache_create().
+ */
+size_t aes128_gcm_key_cache_entry_size(void)
+{
+    return sizeof(aes128_gcm_key_cache_entry_t) + sizeof(aes128_gcm_key_cache_entry_t *);
+}
+
+/*
+ * Create a key cache using at most about memory_budget bytes for its entries,
+ * divided between num_stripes lock stripes. If num_stripes is 0,
+ * AES128_GCM_KEY_CACHE_DEFAULT_STRIPES is used. The number of stripes is
+ * reduced if the budget doesn't allow at least one entry per stripe.
+ *
+ * Returns NULL on failure, or if the budget is less than one entry.
+ */
+aes128_gcm_key_cache_t * aes128_gcm_key_cache_create(size_t memory_budget, size_t num_stripes)
+{
+    aes128_gcm_key_cache_t        * p_cache;
+    aes128_gcm_key_cache_stripe_t * p_stripe;
+    size_t                          num_entries;
+    size_t                          stripe_entries;
+    size_t                          num_buckets;
+    size_t                          i;
+    size_t                          j;
+    void                          * p_stripes;
+
+    num_entries = memory_budget / aes128_gcm_key_cache_entry_size();
+    if (num_stripes == 0)
+    {
+        num_stripes = AES128_GCM_KEY_CACHE_DEFAULT_STRIPES;
+    }
+    if (num_stripes > num_entries)
+    {
+        num_stripes = num_entries;
+    }
+    if (num_stripes == 0)
+    {
+        return NULL;
+    }
+
+    p_cache = calloc(1u, sizeof(*p_cache));
+    if (p_cache == NULL)
+    {
+        return NULL;
+    }
+    if (posix_memalign(&p_stripes, AES128_GCM_KEY_CACHE_LINE_SIZE, num_stripes * sizeof(aes128_gcm_key_cache_stripe_t)) != 0)
+    {
+        free(p_cache);
+        return NULL;
+    }
+    p_cache->p_stripes = p_stripes;
+
+    for (i = 0; i < num_stripes; i++)
+    {
+        p_stripe = &p_cache->p_stripes[i];
+        stripe_entries = num_entries / num_stripes + ((i < num_entries % num_stripes) ? 1u : 0);
+        for (num_buckets = 1u; num_buckets < stripe_entries; num_buckets <<= 1u)
+            ;
+        p_stripe->p_buckets = calloc(num_buckets, sizeof(*p_stripe->p_buckets));
+        p_stripe->bucket_mask = num_buckets - 1u;
+        p_stripe->p_entries = calloc(stripe_entries, sizeof(*p_stripe->p_entries));
+        p_stripe->num_entries = stripe_entries;
+        p_stripe->p_lru_head = NULL;
+        p_stripe->p_lru_tail = NULL;
+        p_stripe->p_free = NULL;
+        p_stripe->hits = 0;
+        p_stripe->misses = 0;
+        p_stripe->evictions = 0;
+        pthread_mutex_init(&p_stripe->mutex, NULL);
+        pthread_cond_init(&p_stripe->ready_cond, NULL);
+        p_cache->num_stripes = i + 1u;
+        if (p_stripe->p_buckets == NULL || p_stripe->p_entries == NULL)
+        {
+            aes128_gcm_key_cache_destroy(p_cache);
+            return NULL;
+        }
+        for (j = stripe_entries; j-- > 0; )
+        {
+            p_stripe->p_entries[j].stripe_index = i;
+            p_stripe->p_entries[j].p_lru_next = p_stripe->p_free;
+            p_stripe->p_free = &p_stripe->p_entries[j];
+        }
+    }
+    return p_cache;
+}
+
+/*
+ * Free a key cache created by aes128_gcm_key_cache_create(). No keys may be
+ * in use.
+ */
+void aes128_gcm_key_cache_destroy(aes128_gcm_key_cache_t * p_cache)
+{
+    aes128_gcm_key_cache_stripe_t * p_stripe;
+    size_t                          i;
+
+    if (p_cache == NULL)
+    {
+        return;
+    }
+    for (i = 0; i < p_cache->num_stripes; i++)
+    {
+        p_stripe = &p_cache->p_stripes[i];
+        pthread_cond_destroy(&p_stripe->ready_cond);
+        pthread_mutex_destroy(&p_stripe->mutex);
+        free(p_stripe->p_entries);
+        free(p_stripe->p_buckets);
+    }
+    free(p_cache->p_stripes);
+    free(p_cache);
+}
+
+/*
+ * Get the prepared key for key_id, preparing it from the AES key p_aes_key if
+ * it isn't in the cache, evicting the least recently used key of the stripe
+ * if necessary.
+ *
+ * The key must be released by aes128_gcm_key_cache_release() when the caller
+ * has finished using it. It may be used by several threads at once.
+ *
+ * If key_id is found with a different AES key, the old key is removed, so a
+ * key ID may be re-used after a key change. The comparison of the AES key
+ * takes constant time.
+ *
+ * Returns NULL if every entry of the key's stripe is in use.
+ */
+const aes128_gcm_key_t * aes128_gcm_key_cache_acquire(aes128_gcm_key_cache_t * p_cache, uint64_t key_id,
+                                                      const uint8_t p_aes_key[AES128_KEY_SIZE])
+{
+    aes128_gcm_key_cache_stripe_t * p_stripe;
+    aes128_gcm_key_cache_entry_t  * p_entry;
+    size_t                          hash;
+    size_t                          bucket;
+
+    hash = aes128_gcm_key_cache_hash(key_id);
+    p_stripe = &p_cache->p_stripes[hash % p_cache->num_stripes];
+    hash /= p_cache->num_stripes;
+
+    pthread_mutex_lock(&p_stripe->mutex);
+    while ((p_entry = aes128_gcm_key_cache_find(p_stripe, key_id, hash)) != NULL)
+    {
+        if (p_entry->refs++ == 0)
+        {
+            aes128_gcm_key_cache_lru_remove(p_stripe, p_entry);
+        }
+        while (!p_entry->ready)
+        {
+            pthread_cond_wait(&p_stripe->ready_cond, &p_stripe->mutex);
+        }
+        if (aes128_gcm_key_cache_key_matches(&p_entry->key, p_aes_key))
+        {
+            p_stripe->hits++;
+            pthread_mutex_unlock(&p_stripe->mutex);
+            return &p_entry->key;
+        }
+        /* The key has changed, so drop the old one. */
+        aes128_gcm_key_cache_detach(p_stripe, p_entry);
+        aes128_gcm_key_cache_put(p_stripe, p_entry);
+    }
+
+    p_stripe->misses++;
+    p_entry = p_stripe->p_free;
+    if (p_entry != NULL)
+    {
+        p_stripe->p_free = p_entry->p_lru_next;
+    }
+    else
+    {
+        p_entry = p_stripe->p_lru_tail;
+        if (p_entry == NULL)
+        {
+            pthread_mutex_unlock(&p_stripe->mutex);
+            return NULL;
+        }
+        aes128_gcm_key_cache_lru_remove(p_stripe, p_entry);
+        aes128_gcm_key_cache_hash_remove(p_stripe, p_entry);
+        p_stripe->evictions++;
+    }
+    p_entry->key_id = key_id;
+    p_entry->refs = 1u;
+    p_entry->ready = false;
+    p_entry->detached = false;
+    bucket = hash & p_stripe->bucket_mask;
+    p_entry->bucket = bucket;
+    p_entry->p_hash_next = p_stripe->p_buckets[bucket];
+    p_stripe->p_buckets[bucket] = p_entry;
+    pthread_mutex_unlock(&p_stripe->mutex);
+
+    aes128_gcm_init(&p_entry->key, p_aes_key);
+
+    pthread_mutex_lock(&p_stripe->mutex);
+    p_entry->ready = true;
+    pthread_cond_broadcast(&p_stripe->ready_cond);
+    pthread_mutex_unlock(&p_stripe->mutex);
+    return &p_entry->key;
+}
+
+/*
+ * Release a key returned by aes128_gcm_key_cache_acquire(). Once released by
+ * all its users, it becomes the most recently used key of its stripe.
+ */
+void aes128_gcm_key_cache_release(aes128_gcm_key_cache_t * p_cache, const aes128_gcm_key_t * p_key)
+{
+    aes128_gcm_key_cache_entry_t  * p_entry = (aes128_gcm_key_cache_entry_t *)p_key;
+    aes128_gcm_key_cache_stripe_t * p_stripe = &p_cache->p_stripes[p_entry->stripe_index];
+
+    pthread_mutex_lock(&p_stripe->mutex);
+    aes128_gcm_key_cache_put(p_stripe, p_entry);
+    pthread_mutex_unlock(&p_stripe->mutex);
+}
+
+/*
+ * Remove the key for key_id from the cache, if present. If it is in use, it
+ * remains valid for its current users, and is freed when they release it.
+ */
+void aes128_gcm_key_cache_remove(aes128_gcm_key_cache_t * p_cache, uint64_t key_id)
+{
+    aes128_gcm_key_cache_stripe_t * p_stripe;
+    aes128_gcm_key_cache_entry_t  * p_entry;
+    size_t                          hash;
+
+    hash = aes128_gcm_key_cache_hash(key_id);
+    p_stripe = &p_cache->p_stripes[hash % p_cache->num_stripes];
+    hash /= p_cache->num_stripes;
+
+    pthread_mutex_lock(&p_stripe->mutex);
+    p_entry = aes128_gcm_key_cache_find(p_stripe, key_id, hash);
+    if (p_entry != NULL)
+    {
+        aes128_gcm_key_cache_detach(p_stripe, p_entry);
+    }
+    pthread_mutex_unlock(&p_stripe->mutex);
+}
+
+/*
+ * Get the hit, miss and eviction counts of a cache, totalled over all
+ * stripes, and its size.
+ */
+void aes128_gcm_key_cache_stats(aes128_gcm_key_cache_t * p_cache, aes128_gcm_key_cache_stats_t * p_stats)
+{
+    aes128_gcm_key_cache_stripe_t * p_stripe;
+    size_t                          i;
+
+    p_stats->hits = 0;
+    p_stats->misses = 0;
+    p_stats->evictions = 0;
+    p_stats->capacity = 0;
+    p_stats->num_stripes = p_cache->num_stripes;
+    for (i = 0; i < p_cache->num_stripes; i++)
+    {
+        p_stripe = &p_cache->p_stripes[i];
+        pthread_mutex_lock(&p_stripe->mutex);
+        p_stats->hits += p_stripe->hits;
+        p_stats->misses += p_stripe->misses;
+        p_stats->evictions += p_stripe->evictions;
+        p_stats->capacity += p_stripe->num_entries;
+        pthread_mutex_unlock(&p_stripe->mutex);
+    }
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Hash of the key ID, which selects the stripe and then the bucket. */
+static size_t aes128_gcm_key_cache_hash(uint64_t key_id)
+{
+    uint64_t                        hash;
+
+    hash = key_id * AES128_GCM_KEY_CACHE_HASH_MUL;
+    hash ^= hash >> 32u;
+    return (size_t)hash;
+}
+
+/* Find a key in the stripe's hash table. The stripe must be locked. */
+static aes128_gcm_key_cache_entry_t * aes128_gcm_key_cache_find(aes128_gcm_key_cache_stripe_t * p_stripe, uint64_t key_id, size_t hash)
+{
+    aes128_gcm_key_cache_entry_t  * p_entry;
+
+    for (p_entry = p_stripe->p_buckets[hash & p_stripe->bucket_mask]; p_entry != NULL; p_entry = p_entry->p_hash_next)
+    {
+        if (p_entry->key_id == key_id)
+        {
+            break;
+        }
+    }
+    return p_entry;
+}
+
+/* Remove a key from the stripe's hash table. The stripe must be locked. */
+static void aes128_gcm_key_cache_hash_remove(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry)
+{
+    aes128_gcm_key_cache_entry_t ** pp_link;
+
+    for (pp_link = &p_stripe->p_buckets[p_entry->bucket]; *pp_link != p_entry; pp_link = &(*pp_link)->p_hash_next)
+        ;
+    *pp_link = p_entry->p_hash_next;
+    p_entry->p_hash_next = NULL;
+}
+
+/* Remove a key from the stripe's LRU list. The stripe must be locked. */
+static void aes128_gcm_key_cache_lru_remove(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry)
+{
+    if (p_entry->p_lru_prev != NULL)
+        p_entry->p_lru_prev->p_lru_next = p_entry->p_lru_next;
+    else
+        p_stripe->p_lru_head = p_entry->p_lru_next;
+    if (p_entry->p_lru_next != NULL)
+        p_entry->p_lru_next->p_lru_prev = p_entry->p_lru_prev;
+    else
+        p_stripe->p_lru_tail = p_entry->p_lru_prev;
+    p_entry->p_lru_prev = NULL;
+    p_entry->p_lru_next = NULL;
+}
+
+/*
+ * Drop one reference to a key. When it is no longer in use, it goes to the
+ * head of the LRU list, or to the free list if it was detached. The stripe
+ * must be locked.
+ */
+static void aes128_gcm_key_cache_put(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry)
+{
+    if (--p_entry->refs != 0)
+    {
+        return;
+    }
+    if (p_entry->detached)
+    {
+        p_entry->p_lru_next = p_stripe->p_free;
+        p_stripe->p_free = p_entry;
+    }
+    else
+    {
+        p_entry->p_lru_prev = NULL;
+        p_entry->p_lru_next = p_stripe->p_lru_head;
+        if (p_stripe->p_lru_head != NULL)
+            p_stripe->p_lru_head->p_lru_prev = p_entry;
+        else
+            p_stripe->p_lru_tail = p_entry;
+        p_stripe->p_lru_head = p_entry;
+    }
+}
+
+/*
+ * Remove a key from the stripe's hash table, so it is no longer found. If it
+ * is not in use it is freed, otherwise that is done by the last
+ * aes128_gcm_key_cache_put(). The stripe must be locked.
+ */
+static void aes128_gcm_key_cache_detach(aes128_gcm_key_cache_stripe_t * p_stripe, aes128_gcm_key_cache_entry_t * p_entry)
+{
+    aes128_gcm_key_cache_hash_remove(p_stripe, p_entry);
+    if (p_entry->refs == 0)
+    {
+        aes128_gcm_key_cache_lru_remove(p_stripe, p_entry);
+        p_entry->p_lru_next = p_stripe->p_free;
+        p_stripe->p_free = p_entry;
+    }
+    else
+    {
+        p_entry->detached = true;
+    }
+}
+
+/*
+ * Check whether a prepared key is for the AES key p_aes_key, which is the
+ * first round key of its key schedule. This takes constant time.
+ */
+static bool aes128_gcm_key_cache_key_matches(const aes128_gcm_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE])
+{
+    uint_fast8_t                    i;
+    uint8_t                         diff = 0;
+
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+    {
+        diff |= p_key->key_schedule[i] ^ p_aes_key[i];
+    }
+    return diff == 0;
+}
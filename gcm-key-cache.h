@@ -0,0 +1,71 @@
+/*****************************************************************************
+ * gcm-key-cache.h
+ *
+ * Thread-safe cache of prepared AES-128-GCM keys, for applications which use
+ * many keys, each for a few short messages.
+ *
+ * aes128_gcm_init() calculates the AES key schedule and the GHASH key data,
+ * which for the table implementations is much more work than sealing a short
+ * message. This cache maps a caller-chosen 64-bit key ID to a prepared
+ * aes128_gcm_key_t, so that is done once per key rather than once per
+ * message.
+ ****************************************************************************/
+
+#ifndef GCM_KEY_CACHE_H
+#define GCM_KEY_CACHE_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Number of independently locked stripes if 0 is passed to
+ * aes128_gcm_key_cache_create(). */
+#define AES128_GCM_KEY_CACHE_DEFAULT_STRIPES    16u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * A key cache. The entries are divided between stripes by a hash of the key
+ * ID, each with its own lock, hash table and LRU list, so threads using keys
+ * in different stripes don't contend.
+ */
+typedef struct aes128_gcm_key_cache_s aes128_gcm_key_cache_t;
+
+typedef struct
+{
+    uint64_t            hits;
+    uint64_t            misses;
+    uint64_t            evictions;
+    size_t              capacity;       /* Total number of entries */
+    size_t              num_stripes;
+} aes128_gcm_key_cache_stats_t;
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+size_t aes128_gcm_key_cache_entry_size(void);
+
+aes128_gcm_key_cache_t * aes128_gcm_key_cache_create(size_t memory_budget, size_t num_stripes);
+void aes128_gcm_key_cache_destroy(aes128_gcm_key_cache_t * p_cache);
+
+const aes128_gcm_key_t * aes128_gcm_key_cache_acquire(aes128_gcm_key_cache_t * p_cache, uint64_t key_id,
+                                                      const uint8_t p_aes_key[AES128_KEY_SIZE]);
+void aes128_gcm_key_cache_release(aes128_gcm_key_cache_t * p_cache, const aes128_gcm_key_t * p_key);
+void aes128_gcm_key_cache_remove(aes128_gcm_key_cache_t * p_cache, uint64_t key_id);
+
+void aes128_gcm_key_cache_stats(aes128_gcm_key_cache_t * p_cache, aes128_gcm_key_cache_stats_t * p_stats);
+
+
+#endif /* !defined(GCM_KEY_CACHE_H) */
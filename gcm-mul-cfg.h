@@ -16,8 +16,11 @@
  * Same size as platform's unsigned int is probably a good value.
  * But for 8-bit platforms, 1 may be better. For 64-bit platforms, 8 is probably good.
  * If 1 is used, gcm_u128_struct_from_bytes() etc could simply be
- * replaced by memcpy(). */
+ * replaced by memcpy().
+ * It can also be set by ./configure --with-gcm-element-size=N. */
+#ifndef GCM_U128_ELEMENT_SIZE
 #define GCM_U128_ELEMENT_SIZE               4
+#endif
 
 // Select little-endian optimisation
 #undef GCM_MUL_LITTLE_ENDIAN
@@ -26,7 +29,16 @@
 
 #define GCM_MUL_BIT_BY_BIT
 #define GCM_MUL_TABLE_4
+#define GCM_MUL_TABLE_4_SHOUP
 #define GCM_MUL_TABLE_8
 
+/* Carry-less multiply implementation, with no per-key table. On x86 with a
+ * GCC-compatible compiler, it uses the PCLMULQDQ instruction if the CPU
+ * supports it at run-time. Otherwise it falls back to a portable software
+ * carry-less multiply on 64-bit integers.
+ * This also enables gcm_ghash_blocks(), which aggregates multiple blocks per
+ * reduction using pre-calculated powers of the key. */
+#define GCM_MUL_CLMUL
+
 
 #endif /* !defined( GCM_MUL_CFG_H ) */
@@ -0,0 +1,280 @@
+/*****************************************************************************
+ * gcm-mul-ops.c
+ *
+ * Run-time selection of the GCM Galois multiply implementation.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm-mul-ops.h"
+
+#include <string.h>
+#include <time.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Amount of data timed for each implementation by gcm_mul_ops_select(), and
+ * the number of times it is timed, taking the fastest. */
+#define GCM_MUL_OPS_SELECT_BLOCKS   64u
+#define GCM_MUL_OPS_SELECT_RUNS     3u
+
+/* Each timing repeats mul_blocks() until at least this time has passed, so
+ * a coarse clock still resolves it, but gives up after the maximum number of
+ * passes if the clock doesn't advance. */
+#define GCM_MUL_OPS_SELECT_MIN_NS       50000u
+#define GCM_MUL_OPS_SELECT_MAX_PASSES   4096u
+
+/*
+ * Define the context wrappers of an implementation which has a table or
+ * other key data type, prepare and multiply functions. The mul_blocks()
+ * wrapper does one multiply per block.
+ */
+#define GCM_MUL_OPS_WRAPPERS(NAME, TYPE, PREPARE, MUL)                                              \
+    static void gcm_mul_ops_prepare_##NAME(void * p_ctx, const uint8_t p_key[AES_BLOCK_SIZE])     \
+    {                                                                                               \
+        PREPARE((TYPE *)p_ctx, p_key);                                                              \
+    }                                                                                               \
+    static void gcm_mul_ops_mul_##NAME(uint8_t p_block[AES_BLOCK_SIZE], const void * p_ctx)       \
+    {                                                                                               \
+        MUL(p_block, (const TYPE *)p_ctx);                                                          \
+    }                                                                                               \
+    static void gcm_mul_ops_mul_blocks_##NAME(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, \
+                                              size_t num_blocks, const void * p_ctx)                \
+    {                                                                                               \
+        while (num_blocks--)                                                                        \
+        {                                                                                           \
+            aes_block_xor(p_state, p_data);                                                         \
+            MUL(p_state, (const TYPE *)p_ctx);                                                      \
+            p_data += AES_BLOCK_SIZE;                                                               \
+        }                                                                                           \
+    }
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static uint64_t gcm_mul_ops_time_ns(void);
+static uint64_t gcm_mul_ops_measure(const gcm_mul_ops_t * p_ops);
+
+/*****************************************************************************
+ * Implementation wrappers
+ ****************************************************************************/
+
+#ifdef GCM_MUL_BIT_BY_BIT
+/* The bit-by-bit implementation uses the key itself. */
+static void gcm_mul_bit_by_bit_prepare(uint8_t p_ctx[AES_BLOCK_SIZE], const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    memcpy(p_ctx, p_key, AES_BLOCK_SIZE);
+}
+GCM_MUL_OPS_WRAPPERS(bit_by_bit, uint8_t, gcm_mul_bit_by_bit_prepare, gcm_mul)
+#endif
+
+#ifdef GCM_MUL_TABLE_4
+GCM_MUL_OPS_WRAPPERS(table4, gcm_mul_table4_t, gcm_mul_prepare_table4, gcm_mul_table4)
+#endif
+
+#ifdef GCM_MUL_TABLE_4_SHOUP
+GCM_MUL_OPS_WRAPPERS(table4_shoup, gcm_mul_table4_shoup_t, gcm_mul_prepare_table4_shoup, gcm_mul_table4_shoup)
+#endif
+
+#ifdef GCM_MUL_TABLE_8
+GCM_MUL_OPS_WRAPPERS(table8, gcm_mul_table8_t, gcm_mul_prepare_table8, gcm_mul_table8)
+#endif
+
+#ifdef GCM_MUL_CLMUL
+GCM_MUL_OPS_WRAPPERS(clmul, gcm_mul_clmul_t, gcm_mul_prepare_clmul, gcm_mul_clmul)
+
+/* gcm_ghash_blocks(), which aggregates up to 8 blocks per reduction. */
+static void gcm_mul_ops_prepare_ghash(void * p_ctx, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    gcm_ghash_prepare(p_ctx, p_key);
+}
+
+static void gcm_mul_ops_mul_ghash(uint8_t p_block[AES_BLOCK_SIZE], const void * p_ctx)
+{
+    uint8_t             state[AES_BLOCK_SIZE] = { 0 };
+
+    gcm_ghash_blocks(state, p_block, 1u, p_ctx);
+    memcpy(p_block, state, AES_BLOCK_SIZE);
+}
+
+static void gcm_mul_ops_mul_blocks_ghash(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks, const void * p_ctx)
+{
+    gcm_ghash_blocks(p_state, p_data, num_blocks, p_ctx);
+}
+#endif
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* The compiled-in implementations, slowest first. */
+static const gcm_mul_ops_t gcm_mul_ops_all[] =
+{
+#ifdef GCM_MUL_BIT_BY_BIT
+    { "bit_by_bit",     AES_BLOCK_SIZE,                 gcm_mul_ops_prepare_bit_by_bit,     gcm_mul_ops_mul_bit_by_bit,     gcm_mul_ops_mul_blocks_bit_by_bit },
+#endif
+#ifdef GCM_MUL_TABLE_4
+    { "table4",         sizeof(gcm_mul_table4_t),       gcm_mul_ops_prepare_table4,         gcm_mul_ops_mul_table4,         gcm_mul_ops_mul_blocks_table4 },
+#endif
+#ifdef GCM_MUL_TABLE_4_SHOUP
+    { "table4_shoup",   sizeof(gcm_mul_table4_shoup_t), gcm_mul_ops_prepare_table4_shoup,   gcm_mul_ops_mul_table4_shoup,   gcm_mul_ops_mul_blocks_table4_shoup },
+#endif
+#ifdef GCM_MUL_TABLE_8
+    { "table8",         sizeof(gcm_mul_table8_t),       gcm_mul_ops_prepare_table8,         gcm_mul_ops_mul_table8,         gcm_mul_ops_mul_blocks_table8 },
+#endif
+#ifdef GCM_MUL_CLMUL
+    { "clmul",          sizeof(gcm_mul_clmul_t),        gcm_mul_ops_prepare_clmul,          gcm_mul_ops_mul_clmul,          gcm_mul_ops_mul_blocks_clmul },
+    { "ghash",          sizeof(gcm_ghash_key_t),        gcm_mul_ops_prepare_ghash,          gcm_mul_ops_mul_ghash,          gcm_mul_ops_mul_blocks_ghash },
+#endif
+};
+
+#define GCM_MUL_OPS_NUM             (sizeof(gcm_mul_ops_all) / sizeof(gcm_mul_ops_all[0]))
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Get the compiled-in implementation with the given index, counting from 0,
+ * or NULL if index is past the last one.
+ */
+const gcm_mul_ops_t * gcm_mul_ops_get(size_t index)
+{
+    return (index < GCM_MUL_OPS_NUM) ? &gcm_mul_ops_all[index] : NULL;
+}
+
+/*
+ * Get a compiled-in implementation by name, or NULL if there is none with
+ * that name.
+ */
+const gcm_mul_ops_t * gcm_mul_ops_find(const char * p_name)
+{
+    size_t              i;
+
+    for (i = 0; i < GCM_MUL_OPS_NUM; i++)
+    {
+        if (strcmp(gcm_mul_ops_all[i].name, p_name) == 0)
+        {
+            return &gcm_mul_ops_all[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Get the compiled-in implementation with the fastest mul_blocks() on this
+ * CPU.
+ *
+ * On the first call, each implementation is timed on a few blocks of data;
+ * the result is cached for later calls. If several threads race on the first
+ * call, each stores a valid implementation, so no locking is needed.
+ * The key set-up time isn't counted, so this is the best choice for long
+ * messages.
+ * Implementations are timed in the fixed order of preference carry-less
+ * multiply, 8-bit table, Shoup's 4-bit table, 4-bit table, and on a tie the
+ * earlier one is chosen. If the clock can't time an implementation, the
+ * rest aren't timed either, and the fastest of those already timed is chosen,
+ * or the most preferred if none was.
+ */
+const gcm_mul_ops_t * gcm_mul_ops_select(void)
+{
+    static const gcm_mul_ops_t * volatile p_selected;
+    const gcm_mul_ops_t   * p_best;
+    uint64_t                best_ns = UINT64_MAX;
+    uint64_t                ns;
+    size_t                  i;
+
+    if (p_selected != NULL)
+    {
+        return p_selected;
+    }
+    /* Most preferred first, so a clock which doesn't advance is found on
+     * the fastest implementation. */
+    p_best = &gcm_mul_ops_all[GCM_MUL_OPS_NUM - 1u];
+    for (i = GCM_MUL_OPS_NUM; i-- != 0; )
+    {
+        ns = gcm_mul_ops_measure(&gcm_mul_ops_all[i]);
+        if (ns == 0)
+        {
+            /* Unresolved: keep the best so far, rather than spending
+             * GCM_MUL_OPS_SELECT_MAX_PASSES passes on each remaining one. */
+            break;
+        }
+        if (ns < best_ns)
+        {
+            best_ns = ns;
+            p_best = &gcm_mul_ops_all[i];
+        }
+    }
+    p_selected = p_best;
+    return p_best;
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static uint64_t gcm_mul_ops_time_ns(void)
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#else
+    return (uint64_t)clock() * (1000000000u / CLOCKS_PER_SEC);
+#endif
+}
+
+/*
+ * Time mul_blocks() of an implementation, on pseudo-random data so the table
+ * implementations don't only use a few table entries.
+ *
+ * Returns the time per pass over the data, or 0 if the clock didn't advance
+ * within GCM_MUL_OPS_SELECT_MAX_PASSES passes.
+ */
+static uint64_t gcm_mul_ops_measure(const gcm_mul_ops_t * p_ops)
+{
+    gcm_mul_ops_ctx_t   ctx;
+    uint8_t             data[GCM_MUL_OPS_SELECT_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t             state[AES_BLOCK_SIZE] = { 0 };
+    uint32_t            random = 0x12345678u;
+    uint64_t            best_ns = UINT64_MAX;
+    uint64_t            start_ns;
+    uint64_t            ns;
+    size_t              passes;
+    size_t              i;
+
+    for (i = 0; i < sizeof(data); i++)
+    {
+        random = random * 1103515245u + 12345u;
+        data[i] = random >> 24u;
+    }
+    p_ops->prepare(&ctx, data);
+    for (i = 0; i < GCM_MUL_OPS_SELECT_RUNS; i++)
+    {
+        passes = 0;
+        start_ns = gcm_mul_ops_time_ns();
+        do
+        {
+            p_ops->mul_blocks(state, data, GCM_MUL_OPS_SELECT_BLOCKS, &ctx);
+            passes++;
+            ns = gcm_mul_ops_time_ns() - start_ns;
+        } while (ns < GCM_MUL_OPS_SELECT_MIN_NS && passes < GCM_MUL_OPS_SELECT_MAX_PASSES);
+        if (ns == 0)
+        {
+            return 0;
+        }
+        ns = (ns + passes - 1u) / passes;
+        if (ns < best_ns)
+        {
+            best_ns = ns;
+        }
+    }
+    return best_ns;
+}
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * gcm-mul-ops.h
+ *
+ * Run-time selection of the GCM Galois multiply implementation.
+ *
+ * Each implementation compiled in by gcm-mul-cfg.h is described by a
+ * gcm_mul_ops_t, so callers can choose one at run-time, by name or by
+ * measuring which is fastest on the CPU it is running on, rather than only
+ * at compile time.
+ ****************************************************************************/
+
+#ifndef GCM_MUL_OPS_H
+#define GCM_MUL_OPS_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm-mul.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Operations of one GCM multiply implementation. The key data is kept in a
+ * context of ctx_size bytes, which is prepared from the key by prepare().
+ *
+ * mul() multiplies p_block by the key, in place.
+ * mul_blocks() does the GHASH update for num_blocks blocks of p_data: for
+ * each block, XOR it into p_state, then multiply p_state by the key.
+ */
+typedef struct
+{
+    const char        * name;
+    size_t              ctx_size;
+    void             (* prepare)(void * p_ctx, const uint8_t p_key[AES_BLOCK_SIZE]);
+    void             (* mul)(uint8_t p_block[AES_BLOCK_SIZE], const void * p_ctx);
+    void             (* mul_blocks)(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks, const void * p_ctx);
+} gcm_mul_ops_t;
+
+/*
+ * A context big enough for any of the compiled-in implementations.
+ */
+typedef union
+{
+    uint8_t             key[AES_BLOCK_SIZE];
+#ifdef GCM_MUL_TABLE_8
+    gcm_mul_table8_t    table8;
+#endif
+#ifdef GCM_MUL_TABLE_4
+    gcm_mul_table4_t    table4;
+#endif
+#ifdef GCM_MUL_TABLE_4_SHOUP
+    gcm_mul_table4_shoup_t table4_shoup;
+#endif
+#ifdef GCM_MUL_CLMUL
+    gcm_mul_clmul_t     clmul;
+    gcm_ghash_key_t     ghash;
+#endif
+} gcm_mul_ops_ctx_t;
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+const gcm_mul_ops_t * gcm_mul_ops_get(size_t index);
+const gcm_mul_ops_t * gcm_mul_ops_find(const char * p_name);
+const gcm_mul_ops_t * gcm_mul_ops_select(void);
+
+
+#endif /* !defined(GCM_MUL_OPS_H) */
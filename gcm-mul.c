@@ -12,6 +12,14 @@
 
 #include <string.h>
 
+#if defined(GCM_MUL_CLMUL) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GCM_MUL_CLMUL_X86
+#include "cpu-features.h"
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 /*****************************************************************************
  * Defines
  ****************************************************************************/
@@ -20,6 +28,26 @@
 
 #define GCM_U128_STRUCT_INIT_0      { { 0 } }
 
+/* With 64-bit elements and a GCC-compatible compiler, convert between bytes
+ * and elements by loading each half and byte-swapping it if necessary. */
+#if GCM_U128_ELEMENT_SIZE == 8 && defined(__GNUC__) && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define GCM_U128_ELEMENT_FROM_BE(x) __builtin_bswap64(x)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define GCM_U128_ELEMENT_FROM_BE(x) (x)
+#endif
+#endif
+
+/* The 8-bit and 4-bit table implementations normally keep their table
+ * entries and result in the byte order of a block, which block_mul256()
+ * shifts as bytes. With 64-bit elements they keep them in the element form
+ * instead, so block_mul256() is a shift of two 64-bit values. */
+#if GCM_U128_ELEMENT_SIZE == 8 && !defined(GCM_MUL_LITTLE_ENDIAN)
+#define GCM_MUL_TABLE_ELEMENT_FORM
+#endif
+
+#define GCM_MUL_CLMUL_X86_TARGET    __attribute__((target("pclmul,ssse3,sse2")))
+
 /*****************************************************************************
  * Local function prototypes
  ****************************************************************************/
@@ -28,6 +56,20 @@ static void gcm_u128_struct_from_bytes(gcm_u128_struct_t * restrict p_dst, const
 static void gcm_u128_struct_to_bytes(uint8_t p_dst[AES_BLOCK_SIZE], const gcm_u128_struct_t * p_src);
 static void uint128_struct_mul2(gcm_u128_struct_t * restrict p);
 static void block_mul256(gcm_u128_struct_t * restrict p);
+#ifdef GCM_MUL_TABLE_8
+static void gcm_mul_table8_prepare_bits(gcm_u128_struct_t p_key_data[255], const uint8_t p_key[AES_BLOCK_SIZE]);
+static void gcm_mul_table8_lazy_entry(gcm_mul_table8_lazy_t * p_table, uint_fast8_t value);
+#endif
+#ifdef GCM_MUL_CLMUL
+static void gcm_clmul64(uint64_t p_result[2], uint64_t a, uint64_t b);
+static void gcm_clmul128(uint64_t p_product[4], const uint64_t a[2], const uint64_t b[2]);
+static void gcm_clmul_reduce(uint64_t p_result[2], const uint64_t p_product[4]);
+#endif
+#ifdef GCM_MUL_CLMUL_X86
+static void gcm_mul_clmul_x86(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_clmul_t * p_ctx);
+static void gcm_ghash_prepare_x86(gcm_ghash_key_t * restrict p_ctx, const uint8_t p_key[AES_BLOCK_SIZE]);
+static void gcm_ghash_blocks_x86(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks, const gcm_ghash_key_t * p_ctx);
+#endif
 
 /*****************************************************************************
  * Local inline functions
@@ -48,6 +90,143 @@ static inline void uint128_struct_xor(gcm_u128_struct_t * p_dst, const gcm_u128_
     }
 }
 
+#if defined(GCM_MUL_TABLE_8) || defined(GCM_MUL_TABLE_4)
+
+/*
+ * Conversions to the form of the table entries and result of
+ * gcm_mul_table8() and gcm_mul_table4(), from a block and from the form used
+ * for bit-by-bit calculation, and back to a block.
+ */
+static inline void gcm_table_entry_from_bytes(gcm_u128_struct_t * restrict p_dst, const uint8_t p_src[AES_BLOCK_SIZE])
+{
+#ifdef GCM_MUL_TABLE_ELEMENT_FORM
+    gcm_u128_struct_from_bytes(p_dst, p_src);
+#else
+    memcpy(p_dst->bytes, p_src, AES_BLOCK_SIZE);
+#endif
+}
+
+static inline void gcm_table_entry_from_struct(gcm_u128_struct_t * restrict p_dst, const gcm_u128_struct_t * p_src)
+{
+#ifdef GCM_MUL_TABLE_ELEMENT_FORM
+    *p_dst = *p_src;
+#else
+    gcm_u128_struct_to_bytes(p_dst->bytes, p_src);
+#endif
+}
+
+static inline void gcm_table_entry_to_bytes(uint8_t p_dst[AES_BLOCK_SIZE], const gcm_u128_struct_t * p_src)
+{
+#ifdef GCM_MUL_TABLE_ELEMENT_FORM
+    gcm_u128_struct_to_bytes(p_dst, p_src);
+#else
+    memcpy(p_dst, p_src->bytes, AES_BLOCK_SIZE);
+#endif
+}
+
+#endif // defined(GCM_MUL_TABLE_8) || defined(GCM_MUL_TABLE_4)
+
+#ifdef GCM_MUL_TABLE_4_SHOUP
+
+/*
+ * Galois 128-bit multiply by 2^4, then XOR p_src into the result.
+ *
+ * Multiply is done in-place on the gcm_u128_struct_t operand, by shifting it
+ * right 4 bits and reducing the 4 bits shifted out with a 16-entry table.
+ * The XOR is done element by element in the same pass, rather than by
+ * uint128_struct_xor(), which the compiler may vectorise into a whole-block
+ * load that stalls waiting for the element stores just before it.
+ */
+static inline void uint128_struct_mul16_xor(gcm_u128_struct_t * restrict p, const gcm_u128_struct_t * p_src)
+{
+    static const uint16_t reduce_table[16] =
+    {
+        0x0000u, 0x1C20u, 0x3840u, 0x2460u, 0x7080u, 0x6CA0u, 0x48C0u, 0x54E0u,
+        0xE100u, 0xFD20u, 0xD940u, 0xC560u, 0x9180u, 0x8DA0u, 0xA9C0u, 0xB5E0u,
+    };
+    uint_fast8_t        i;
+    uint_fast16_t       reduce;
+
+    reduce = reduce_table[p->element[GCM_U128_NUM_ELEMENTS - 1u] & 0xFu];
+    for (i = GCM_U128_NUM_ELEMENTS - 1u; i != 0; i--)
+    {
+        p->element[i] = ((p->element[i] >> 4u) | (p->element[i - 1u] << (GCM_U128_ELEMENT_SIZE_BITS - 4u))) ^ p_src->element[i];
+    }
+#if GCM_U128_ELEMENT_SIZE == 1
+    p->element[0] = (p->element[0] >> 4u) ^ (reduce >> 8u) ^ p_src->element[0];
+    p->element[1] ^= reduce;
+#else
+    p->element[0] = (p->element[0] >> 4u) ^ ((gcm_u128_element_t)reduce << (GCM_U128_ELEMENT_SIZE_BITS - 16u)) ^ p_src->element[0];
+#endif
+}
+
+#endif // defined(GCM_MUL_TABLE_4_SHOUP)
+
+#ifdef GCM_MUL_CLMUL
+
+static inline uint64_t gcm_load_be64(const uint8_t * p)
+{
+    return ((uint64_t)p[0] << 56u) | ((uint64_t)p[1] << 48u) | ((uint64_t)p[2] << 40u) | ((uint64_t)p[3] << 32u) |
+           ((uint64_t)p[4] << 24u) | ((uint64_t)p[5] << 16u) | ((uint64_t)p[6] << 8u) | p[7];
+}
+
+static inline void gcm_store_be64(uint8_t * p, uint64_t a)
+{
+    uint_fast8_t        i;
+
+    for (i = 8u; i != 0; i--)
+    {
+        p[i - 1u] = a;
+        a >>= 8u;
+    }
+}
+
+/*
+ * Carry-less multiply of two 64-bit values, returning the low 64 bits of the
+ * result.
+ *
+ * Integer multiplies are done on operands with "holes" of 3 zero bits between
+ * each data bit, so that carries never reach the data bits of interest. This
+ * is timing invariant on CPUs with constant-time integer multiply.
+ */
+static inline uint64_t gcm_bmul64(uint64_t x, uint64_t y)
+{
+    uint64_t            x0, x1, x2, x3;
+    uint64_t            y0, y1, y2, y3;
+    uint64_t            z0, z1, z2, z3;
+
+    x0 = x & UINT64_C(0x1111111111111111);
+    x1 = x & UINT64_C(0x2222222222222222);
+    x2 = x & UINT64_C(0x4444444444444444);
+    x3 = x & UINT64_C(0x8888888888888888);
+    y0 = y & UINT64_C(0x1111111111111111);
+    y1 = y & UINT64_C(0x2222222222222222);
+    y2 = y & UINT64_C(0x4444444444444444);
+    y3 = y & UINT64_C(0x8888888888888888);
+    z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+    z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+    z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+    z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+    z0 &= UINT64_C(0x1111111111111111);
+    z1 &= UINT64_C(0x2222222222222222);
+    z2 &= UINT64_C(0x4444444444444444);
+    z3 &= UINT64_C(0x8888888888888888);
+    return z0 | z1 | z2 | z3;
+}
+
+/* Reverse the order of the bits of a 64-bit value. */
+static inline uint64_t gcm_rev64(uint64_t x)
+{
+    x = ((x & UINT64_C(0x5555555555555555)) << 1u) | ((x >> 1u) & UINT64_C(0x5555555555555555));
+    x = ((x & UINT64_C(0x3333333333333333)) << 2u) | ((x >> 2u) & UINT64_C(0x3333333333333333));
+    x = ((x & UINT64_C(0x0F0F0F0F0F0F0F0F)) << 4u) | ((x >> 4u) & UINT64_C(0x0F0F0F0F0F0F0F0F));
+    x = ((x & UINT64_C(0x00FF00FF00FF00FF)) << 8u) | ((x >> 8u) & UINT64_C(0x00FF00FF00FF00FF));
+    x = ((x & UINT64_C(0x0000FFFF0000FFFF)) << 16u) | ((x >> 16u) & UINT64_C(0x0000FFFF0000FFFF));
+    return (x << 32u) | (x >> 32u);
+}
+
+#endif // defined(GCM_MUL_CLMUL)
+
 /*****************************************************************************
  * Functions
  ****************************************************************************/
@@ -102,32 +281,51 @@ start:
 /*
  * Given a key, pre-calculate the large table that is needed for
  * gcm_mul_table(), the 8-bit table-driven implementation of GCM multiplication.
+ *
+ * Only the entries for single bits are calculated by multiplication, by
+ * repeatedly doubling the key. Multiplication is linear, so every other entry
+ * is the XOR of two entries already calculated: that for its top bit, and
+ * that for its remaining bits. So the whole table takes 7 doublings and 247
+ * XORs.
  */
 void gcm_mul_prepare_table8(gcm_mul_table8_t * restrict p_table, const uint8_t p_key[AES_BLOCK_SIZE])
 {
-    gcm_u128_struct_t   a;
-    gcm_u128_struct_t   block;
-    uint_fast8_t        i_bit = 0x80u;
+    uint_fast8_t        i_bit = 2u;
     uint_fast8_t        j;
 
-    memset(p_table, 0u, sizeof(*p_table));
-    gcm_u128_struct_from_bytes(&a, p_key);
-    memcpy(block.bytes, p_key, AES_BLOCK_SIZE);
-
+    gcm_mul_table8_prepare_bits(p_table->key_data, p_key);
     for (;;)
     {
-        for (j = 255u; j != 0u; j--)
+        for (j = 1u; j < i_bit; j++)
         {
-            if (j & i_bit)
-            {
-                uint128_struct_xor(&p_table->key_data[j - 1u], &block);
-            }
+            p_table->key_data[i_bit + j - 1u] = p_table->key_data[i_bit - 1u];
+            uint128_struct_xor(&p_table->key_data[i_bit + j - 1u], &p_table->key_data[j - 1u]);
         }
-        i_bit >>= 1u;
-        if (i_bit == 0u)
+        if (i_bit == 0x80u)
             break;
-        uint128_struct_mul2(&a);
-        gcm_u128_struct_to_bytes(block.bytes, &a);
+        i_bit <<= 1u;
+    }
+}
+
+/*
+ * Given a key, prepare a table for gcm_mul_table8_lazy(). Only the 8 entries
+ * for single bits are calculated. Other entries are calculated the first time
+ * they are needed, so a key that is used for only a few multiplies doesn't
+ * pay for the whole table.
+ */
+void gcm_mul_prepare_table8_lazy(gcm_mul_table8_lazy_t * restrict p_table, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    uint_fast8_t        bit;
+    uint_fast8_t        i_bit;
+
+    memset(p_table->valid, 0u, sizeof(p_table->valid));
+    /* Byte value 0 has no table entry. */
+    p_table->valid[0] = 1u;
+    gcm_mul_table8_prepare_bits(p_table->table.key_data, p_key);
+    for (bit = 0; bit < 8u; bit++)
+    {
+        i_bit = 1u << bit;
+        p_table->valid[i_bit / 8u] |= 1u << (i_bit % 8u);
     }
 }
 
@@ -163,7 +361,33 @@ start:
         }
         i--;
     }
-    memcpy(p_block, result.bytes, AES_BLOCK_SIZE);
+    gcm_table_entry_to_bytes(p_block, &result);
+}
+
+/*
+ * Galois 128-bit multiply, as gcm_mul_table8(), with a table prepared by
+ * gcm_mul_prepare_table8_lazy().
+ *
+ * Any table entries needed for the bytes of p_block which have not been used
+ * before are calculated first.
+ * The table is modified, so it must not be used by several threads at once.
+ * Note that the time taken depends on which byte values have been seen
+ * before, as well as the table look-ups being indexed by data.
+ */
+void gcm_mul_table8_lazy(uint8_t p_block[AES_BLOCK_SIZE], gcm_mul_table8_lazy_t * p_table)
+{
+    uint_fast8_t        i;
+    uint8_t             block_byte;
+
+    for (i = 0; i < AES_BLOCK_SIZE; i++)
+    {
+        block_byte = p_block[i];
+        if ((p_table->valid[block_byte / 8u] & (1u << (block_byte % 8u))) == 0)
+        {
+            gcm_mul_table8_lazy_entry(p_table, block_byte);
+        }
+    }
+    gcm_mul_table8(p_block, &p_table->table);
 }
 
 #endif // defined(GCM_MUL_TABLE_8)
@@ -184,7 +408,7 @@ void gcm_mul_prepare_table4(gcm_mul_table4_t * restrict p_table, const uint8_t p
 
     memset(p_table, 0u, sizeof(*p_table));
     gcm_u128_struct_from_bytes(&a, p_key);
-    memcpy(block.bytes, p_key, AES_BLOCK_SIZE);
+    gcm_table_entry_from_bytes(&block, p_key);
 
     for (;;)
     {
@@ -213,7 +437,7 @@ void gcm_mul_prepare_table4(gcm_mul_table4_t * restrict p_table, const uint8_t p
         if (i_bit == 0u)
             break;
         uint128_struct_mul2(&a);
-        gcm_u128_struct_to_bytes(block.bytes, &a);
+        gcm_table_entry_from_struct(&block, &a);
     }
 }
 
@@ -259,22 +483,282 @@ start:
         }
         i--;
     }
-    memcpy(p_block, result.bytes, AES_BLOCK_SIZE);
+    gcm_table_entry_to_bytes(p_block, &result);
 }
 
 #endif // defined(GCM_MUL_TABLE_4)
 
 
+#ifdef GCM_MUL_TABLE_4_SHOUP
+
+/*
+ * Given a key, pre-calculate the small table that is needed for
+ * gcm_mul_table4_shoup().
+ *
+ * The entries for single bits are calculated by doubling the key, and each
+ * other entry is the XOR of two entries already calculated.
+ */
+void gcm_mul_prepare_table4_shoup(gcm_mul_table4_shoup_t * restrict p_table, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    uint_fast8_t        i_bit;
+    uint_fast8_t        j;
+
+    memset(&p_table->key_data[0], 0u, sizeof(p_table->key_data[0]));
+    gcm_u128_struct_from_bytes(&p_table->key_data[8], p_key);
+    for (i_bit = 4u; i_bit != 0u; i_bit >>= 1u)
+    {
+        p_table->key_data[i_bit] = p_table->key_data[i_bit * 2u];
+        uint128_struct_mul2(&p_table->key_data[i_bit]);
+    }
+    for (i_bit = 2u; i_bit <= 8u; i_bit <<= 1u)
+    {
+        for (j = 1u; j < i_bit; j++)
+        {
+            p_table->key_data[i_bit + j] = p_table->key_data[i_bit];
+            uint128_struct_xor(&p_table->key_data[i_bit + j], &p_table->key_data[j]);
+        }
+    }
+}
+
+/*
+ * Galois 128-bit multiply for GCM mode of encryption.
+ *
+ * This implementation uses Shoup's 4-bit table look-up. The result is
+ * accumulated in the form used for calculation, and multiplied by 2^4
+ * between nibbles by a shift and a reduction from a small constant table,
+ * so the per-key table is only 16 entries (256 bytes).
+ * The table look-ups are indexed by data, so the timing may depend on the
+ * data via cache effects.
+ */
+void gcm_mul_table4_shoup(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_table4_shoup_t * p_table)
+{
+    uint8_t             block_byte;
+    gcm_u128_struct_t   result;
+    uint_fast8_t        i = AES_BLOCK_SIZE - 1u;
+
+    /* Start with the low nibble of the last byte, with no multiply by 2^4
+     * which is unnecessary when result is initially zero. */
+    block_byte = p_block[i];
+    result = p_table->key_data[block_byte & 0xFu];
+    goto start;
+
+    for (;;)
+    {
+        block_byte = p_block[i];
+        /* Low nibble */
+        uint128_struct_mul16_xor(&result, &p_table->key_data[block_byte & 0xFu]);
+start:
+        /* High nibble */
+        uint128_struct_mul16_xor(&result, &p_table->key_data[block_byte >> 4u]);
+        if (i == 0u)
+        {
+            break;
+        }
+        i--;
+    }
+    gcm_u128_struct_to_bytes(p_block, &result);
+}
+
+#endif // defined(GCM_MUL_TABLE_4_SHOUP)
+
+
+#ifdef GCM_MUL_CLMUL
+
+/*
+ * Given a key, prepare the key data that is needed for gcm_mul_clmul(), the
+ * carry-less multiply implementation of GCM multiplication.
+ */
+void gcm_mul_prepare_clmul(gcm_mul_clmul_t * restrict p_ctx, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    p_ctx->key_data[0] = gcm_load_be64(p_key + 8u);
+    p_ctx->key_data[1] = gcm_load_be64(p_key);
+}
+
+/*
+ * Galois 128-bit multiply for GCM mode of encryption.
+ *
+ * This implementation uses a 128-bit carry-less multiply, done as three
+ * 64-bit carry-less multiplies (Karatsuba), followed by a reduction. It uses
+ * the x86 PCLMULQDQ instruction if the CPU supports it, which makes it the
+ * fastest implementation, and it needs no table pre-calculated from the key.
+ * Otherwise, a software carry-less multiply is used.
+ *
+ * The GCM bit order is reflected, i.e. the coefficient of x^0 is the most-
+ * significant bit of the first byte. Byte-reversing the block gives a 128-bit
+ * integer in which the coefficient of x^i is bit (127 - i). The carry-less
+ * product of two such integers then has the coefficient of x^i in bit
+ * (254 - i), so it is shifted left by 1 bit before reduction.
+ */
+void gcm_mul_clmul(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_clmul_t * p_ctx)
+{
+    uint64_t            a[2];
+    uint64_t            product[4];
+
+#ifdef GCM_MUL_CLMUL_X86
+    if (aes_cpu_has_pclmul())
+    {
+        gcm_mul_clmul_x86(p_block, p_ctx);
+        return;
+    }
+#endif
+
+    a[0] = gcm_load_be64(p_block + 8u);
+    a[1] = gcm_load_be64(p_block);
+    gcm_clmul128(product, a, p_ctx->key_data);
+    gcm_clmul_reduce(a, product);
+    gcm_store_be64(p_block, a[1]);
+    gcm_store_be64(p_block + 8u, a[0]);
+}
+
+/*
+ * Given a key, pre-calculate the powers of the key H^1 to H^8 that are needed
+ * for gcm_ghash_blocks().
+ */
+void gcm_ghash_prepare(gcm_ghash_key_t * restrict p_ctx, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    uint_fast8_t        i;
+    uint64_t            product[4];
+
+#ifdef GCM_MUL_CLMUL_X86
+    if (aes_cpu_has_pclmul())
+    {
+        gcm_ghash_prepare_x86(p_ctx, p_key);
+        return;
+    }
+#endif
+
+    p_ctx->key_powers[0][0] = gcm_load_be64(p_key + 8u);
+    p_ctx->key_powers[0][1] = gcm_load_be64(p_key);
+    for (i = 1u; i < GCM_GHASH_NUM_POWERS; i++)
+    {
+        gcm_clmul128(product, p_ctx->key_powers[i - 1u], p_ctx->key_powers[0]);
+        gcm_clmul_reduce(p_ctx->key_powers[i], product);
+    }
+}
+
+/*
+ * GHASH of a number of whole blocks.
+ *
+ * This is equivalent to doing, for each block of data:
+ *     aes_block_xor(p_state, p_data);
+ *     gcm_mul_clmul(p_state, <key>);
+ * but it is faster, because groups of up to 8 blocks are multiplied
+ * independently by H^8 ... H^1, and the sum of the products is reduced only
+ * once per group:
+ *     state' = (state ^ X1).H^8 ^ X2.H^7 ^ ... ^ X8.H
+ *
+ * p_state is the 16-byte GHASH state, updated in-place.
+ * p_data points to num_blocks * 16 bytes of data.
+ * p_ctx is the key data calculated by gcm_ghash_prepare().
+ */
+void gcm_ghash_blocks(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks, const gcm_ghash_key_t * p_ctx)
+{
+    uint64_t            state[2];
+    uint64_t            block[2];
+    uint64_t            product[4];
+    uint64_t            sum[4];
+    uint_fast8_t        group_len;
+    uint_fast8_t        i;
+    uint_fast8_t        j;
+
+#ifdef GCM_MUL_CLMUL_X86
+    if (aes_cpu_has_pclmul())
+    {
+        gcm_ghash_blocks_x86(p_state, p_data, num_blocks, p_ctx);
+        return;
+    }
+#endif
+
+    state[0] = gcm_load_be64(p_state + 8u);
+    state[1] = gcm_load_be64(p_state);
+    while (num_blocks)
+    {
+        group_len = (num_blocks < GCM_GHASH_NUM_POWERS) ? num_blocks : GCM_GHASH_NUM_POWERS;
+        memset(sum, 0, sizeof(sum));
+
+        for (i = 0; i < group_len; i++)
+        {
+            block[0] = gcm_load_be64(p_data + 8u);
+            block[1] = gcm_load_be64(p_data);
+            if (i == 0)
+            {
+                block[0] ^= state[0];
+                block[1] ^= state[1];
+            }
+            gcm_clmul128(product, block, p_ctx->key_powers[group_len - 1u - i]);
+            for (j = 0; j < 4u; j++)
+            {
+                sum[j] ^= product[j];
+            }
+            p_data += AES_BLOCK_SIZE;
+        }
+        gcm_clmul_reduce(state, sum);
+        num_blocks -= group_len;
+    }
+    gcm_store_be64(p_state, state[1]);
+    gcm_store_be64(p_state + 8u, state[0]);
+}
+
+#endif // defined(GCM_MUL_CLMUL)
+
+
 /*****************************************************************************
  * Local functions
  ****************************************************************************/
 
+#ifdef GCM_MUL_TABLE_8
+
+/*
+ * Calculate the entries of an 8-bit table for the single-bit byte values
+ * 0x80 (the key itself) down to 0x01 (the key multiplied by x^7), by
+ * repeated doubling.
+ */
+static void gcm_mul_table8_prepare_bits(gcm_u128_struct_t p_key_data[255], const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    gcm_u128_struct_t   a;
+    uint_fast8_t        i_bit;
+
+    gcm_u128_struct_from_bytes(&a, p_key);
+    gcm_table_entry_from_bytes(&p_key_data[0x80u - 1u], p_key);
+    for (i_bit = 0x40u; i_bit != 0u; i_bit >>= 1u)
+    {
+        uint128_struct_mul2(&a);
+        gcm_table_entry_from_struct(&p_key_data[i_bit - 1u], &a);
+    }
+}
+
+/*
+ * Calculate the entry of a lazy 8-bit table for a byte value which has more
+ * than one bit set, as the XOR of the entry for its lowest bit and the entry
+ * for its other bits, which is calculated first if it isn't valid yet.
+ */
+static void gcm_mul_table8_lazy_entry(gcm_mul_table8_lazy_t * p_table, uint_fast8_t value)
+{
+    uint_fast8_t        low_bit = value & (uint_fast8_t)-value;
+    uint_fast8_t        rest = value ^ low_bit;
+
+    if ((p_table->valid[rest / 8u] & (1u << (rest % 8u))) == 0)
+    {
+        gcm_mul_table8_lazy_entry(p_table, rest);
+    }
+    p_table->table.key_data[value - 1u] = p_table->table.key_data[rest - 1u];
+    uint128_struct_xor(&p_table->table.key_data[value - 1u], &p_table->table.key_data[low_bit - 1u]);
+    p_table->valid[value / 8u] |= 1u << (value % 8u);
+}
+
+#endif // defined(GCM_MUL_TABLE_8)
+
 /*
  * Convert a multiplicand for GCM Galois 128-bit multiply into a form that can
  * be more efficiently manipulated for bit-by-bit calculation of the multiply.
  */
 static void gcm_u128_struct_from_bytes(gcm_u128_struct_t * restrict p_dst, const uint8_t p_src[AES_BLOCK_SIZE])
 {
+#ifdef GCM_U128_ELEMENT_FROM_BE
+    memcpy(p_dst->element, p_src, AES_BLOCK_SIZE);
+    p_dst->element[0] = GCM_U128_ELEMENT_FROM_BE(p_dst->element[0]);
+    p_dst->element[1] = GCM_U128_ELEMENT_FROM_BE(p_dst->element[1]);
+#else
     uint_fast8_t        i;
     uint_fast8_t        j;
     const uint8_t *     p_src_tmp;
@@ -290,6 +774,7 @@ static void gcm_u128_struct_from_bytes(gcm_u128_struct_t * restrict p_dst, const
         }
         p_dst->element[i] = temp;
     }
+#endif
 }
 
 /*
@@ -298,6 +783,13 @@ static void gcm_u128_struct_from_bytes(gcm_u128_struct_t * restrict p_dst, const
  */
 static void gcm_u128_struct_to_bytes(uint8_t p_dst[AES_BLOCK_SIZE], const gcm_u128_struct_t * p_src)
 {
+#ifdef GCM_U128_ELEMENT_FROM_BE
+    gcm_u128_element_t  temp[GCM_U128_NUM_ELEMENTS];
+
+    temp[0] = GCM_U128_ELEMENT_FROM_BE(p_src->element[0]);
+    temp[1] = GCM_U128_ELEMENT_FROM_BE(p_src->element[1]);
+    memcpy(p_dst, temp, AES_BLOCK_SIZE);
+#else
     uint_fast8_t        i;
     uint_fast8_t        j;
     uint8_t *           p_dst_tmp;
@@ -313,6 +805,7 @@ static void gcm_u128_struct_to_bytes(uint8_t p_dst[AES_BLOCK_SIZE], const gcm_u1
             temp <<= 8;
         }
     }
+#endif
 }
 
 /*
@@ -322,9 +815,11 @@ static void gcm_u128_struct_to_bytes(uint8_t p_dst[AES_BLOCK_SIZE], const gcm_u1
  */
 static void uint128_struct_mul2(gcm_u128_struct_t * restrict p)
 {
-    uint_fast8_t        i = 0;
     gcm_u128_element_t  carry;
+#if GCM_U128_ELEMENT_SIZE != 8
+    uint_fast8_t        i = 0;
     gcm_u128_element_t  next_carry;
+#endif
 
     /*
      * This expression is intended to be timing invariant to prevent a timing
@@ -341,6 +836,11 @@ static void uint128_struct_mul2(gcm_u128_struct_t * restrict p)
      */
     carry = ((gcm_u128_element_t)0xE1u << (GCM_U128_ELEMENT_SIZE_BITS - 8u)) & (-(p->element[GCM_U128_NUM_ELEMENTS - 1u] & 1u));
 
+#if GCM_U128_ELEMENT_SIZE == 8
+    /* Two elements, so shift them directly, with no loop. */
+    p->element[1] = (p->element[1] >> 1u) | (p->element[0] << 63u);
+    p->element[0] = (p->element[0] >> 1u) ^ carry;
+#else
     goto start;
     for (i = 0; i < GCM_U128_NUM_ELEMENTS - 1u; i++)
     {
@@ -350,6 +850,7 @@ start:
         p->element[i] = (p->element[i] >> 1u) ^ carry;
     }
     p->element[i] = (p->element[i] >> 1u) ^ next_carry;
+#endif
 }
 
 #if defined(GCM_MUL_LITTLE_ENDIAN) && GCM_U128_ELEMENT_SIZE != 1
@@ -410,6 +911,10 @@ start:
  *
  * Generic implementation that should work for either big- or little-endian,
  * albeit not necessarily as fast.
+ *
+ * With 64-bit elements, the operand is in the element form rather than a
+ * byte array (see GCM_MUL_TABLE_ELEMENT_FORM), and is shifted as two 64-bit
+ * values.
  */
 static void block_mul256(gcm_u128_struct_t * restrict p)
 {
@@ -437,6 +942,11 @@ static void block_mul256(gcm_u128_struct_t * restrict p)
 #endif
     uint_fast16_t       reduce;
 
+#ifdef GCM_MUL_TABLE_ELEMENT_FORM
+    reduce = reduce_table[p->element[1] & 0xFFu];
+    p->element[1] = (p->element[1] >> 8u) | (p->element[0] << 56u);
+    p->element[0] = (p->element[0] >> 8u) ^ ((gcm_u128_element_t)reduce << 48u);
+#else
     reduce = reduce_table[p->bytes[AES_BLOCK_SIZE - 1u]];
 #if 0
     for (i = AES_BLOCK_SIZE - 1u; i != 0; i--)
@@ -448,6 +958,219 @@ static void block_mul256(gcm_u128_struct_t * restrict p)
 #endif
     p->bytes[0] = reduce >> 8;
     p->bytes[1] ^= reduce;
+#endif
 }
 
 #endif // !defined(GCM_MUL_LITTLE_ENDIAN)
+
+
+#ifdef GCM_MUL_CLMUL
+
+/*
+ * Carry-less multiply of two 64-bit values, giving a 128-bit result in
+ * p_result[], least-significant half first.
+ *
+ * gcm_bmul64() only gives the low half of the result. The high half is
+ * obtained from the low half of the product of the bit-reversed operands.
+ */
+static void gcm_clmul64(uint64_t p_result[2], uint64_t a, uint64_t b)
+{
+    p_result[0] = gcm_bmul64(a, b);
+    p_result[1] = gcm_rev64(gcm_bmul64(gcm_rev64(a), gcm_rev64(b))) >> 1u;
+}
+
+/*
+ * Carry-less multiply of two 128-bit values, giving an unreduced 256-bit
+ * result in p_product[], least-significant quarter first.
+ *
+ * Karatsuba multiplication is used, so only three 64-bit multiplies are
+ * needed rather than four.
+ */
+static void gcm_clmul128(uint64_t p_product[4], const uint64_t a[2], const uint64_t b[2])
+{
+    uint64_t            lo[2];
+    uint64_t            hi[2];
+    uint64_t            mid[2];
+
+    gcm_clmul64(lo, a[0], b[0]);
+    gcm_clmul64(hi, a[1], b[1]);
+    gcm_clmul64(mid, a[0] ^ a[1], b[0] ^ b[1]);
+    mid[0] ^= lo[0] ^ hi[0];
+    mid[1] ^= lo[1] ^ hi[1];
+
+    p_product[0] = lo[0];
+    p_product[1] = lo[1] ^ mid[0];
+    p_product[2] = hi[0] ^ mid[1];
+    p_product[3] = hi[1];
+}
+
+/*
+ * Reduce a 256-bit carry-less product modulo the GCM polynomial
+ * x^128 + x^7 + x^2 + x + 1, in the bit-reflected representation.
+ *
+ * The product is first shifted left by 1 bit (see gcm_mul_clmul()). Then the
+ * low 128 bits, which hold the coefficients of x^128 and above, are folded
+ * into the high 128 bits with shifts and XORs. This is done in two phases:
+ * first the bits that would be shifted out of the bottom are folded back into
+ * the low 128 bits, then the low 128 bits are folded into the high 128 bits.
+ */
+static void gcm_clmul_reduce(uint64_t p_result[2], const uint64_t p_product[4])
+{
+    uint64_t            x0, x1, x2, x3;
+
+    x3 = (p_product[3] << 1u) | (p_product[2] >> 63u);
+    x2 = (p_product[2] << 1u) | (p_product[1] >> 63u);
+    x1 = (p_product[1] << 1u) | (p_product[0] >> 63u);
+    x0 = (p_product[0] << 1u);
+
+    x1 ^= (x0 << 63u) ^ (x0 << 62u) ^ (x0 << 57u);
+
+    p_result[0] = x2 ^ x0 ^ ((x0 >> 1u) | (x1 << 63u)) ^ ((x0 >> 2u) | (x1 << 62u)) ^ ((x0 >> 7u) | (x1 << 57u));
+    p_result[1] = x3 ^ x1 ^ (x1 >> 1u) ^ (x1 >> 2u) ^ (x1 >> 7u);
+}
+
+#endif // defined(GCM_MUL_CLMUL)
+
+
+#ifdef GCM_MUL_CLMUL_X86
+
+static inline GCM_MUL_CLMUL_X86_TARGET __m128i gcm_clmul_x86_byte_reverse(__m128i a)
+{
+    return _mm_shuffle_epi8(a, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+/* 128-bit right shift by num_bits, 0 < num_bits < 64. */
+static inline GCM_MUL_CLMUL_X86_TARGET __m128i gcm_clmul_x86_srli128(__m128i a, int num_bits)
+{
+    return _mm_or_si128(_mm_srli_epi64(a, num_bits), _mm_srli_si128(_mm_slli_epi64(a, 64 - num_bits), 8));
+}
+
+/*
+ * Same as gcm_clmul128(), using PCLMULQDQ. The 256-bit product is XORed into
+ * *p_lo and *p_hi, so that products of several blocks can be accumulated
+ * before a single reduction.
+ */
+static inline GCM_MUL_CLMUL_X86_TARGET void gcm_clmul_x86_mul_acc(__m128i * p_lo, __m128i * p_hi, __m128i a, __m128i b)
+{
+    __m128i             lo;
+    __m128i             hi;
+    __m128i             mid;
+
+    lo = _mm_clmulepi64_si128(a, b, 0x00);
+    hi = _mm_clmulepi64_si128(a, b, 0x11);
+    mid = _mm_clmulepi64_si128(_mm_xor_si128(a, _mm_shuffle_epi32(a, 0x4E)),
+                               _mm_xor_si128(b, _mm_shuffle_epi32(b, 0x4E)), 0x00);
+    mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+    *p_lo = _mm_xor_si128(*p_lo, _mm_xor_si128(lo, _mm_slli_si128(mid, 8)));
+    *p_hi = _mm_xor_si128(*p_hi, _mm_xor_si128(hi, _mm_srli_si128(mid, 8)));
+}
+
+/*
+ * Same as gcm_clmul_reduce(), using SSE2.
+ */
+static inline GCM_MUL_CLMUL_X86_TARGET __m128i gcm_clmul_x86_reduce(__m128i lo, __m128i hi)
+{
+    __m128i             carry_lo;
+    __m128i             carry_hi;
+    __m128i             t;
+
+    /* Shift left by 1 bit */
+    carry_lo = _mm_srli_epi64(lo, 63);
+    carry_hi = _mm_srli_epi64(hi, 63);
+    lo = _mm_or_si128(_mm_slli_epi64(lo, 1), _mm_slli_si128(carry_lo, 8));
+    hi = _mm_or_si128(_mm_slli_epi64(hi, 1), _mm_or_si128(_mm_slli_si128(carry_hi, 8), _mm_srli_si128(carry_lo, 8)));
+
+    /* Reduce, first phase */
+    t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi64(lo, 63), _mm_slli_epi64(lo, 62)), _mm_slli_epi64(lo, 57));
+    lo = _mm_xor_si128(lo, _mm_slli_si128(t, 8));
+
+    /* Reduce, second phase */
+    t = _mm_xor_si128(_mm_xor_si128(lo, gcm_clmul_x86_srli128(lo, 1)),
+                      _mm_xor_si128(gcm_clmul_x86_srli128(lo, 2), gcm_clmul_x86_srli128(lo, 7)));
+    return _mm_xor_si128(hi, t);
+}
+
+static GCM_MUL_CLMUL_X86_TARGET void gcm_mul_clmul_x86(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_clmul_t * p_ctx)
+{
+    __m128i             a;
+    __m128i             lo = _mm_setzero_si128();
+    __m128i             hi = _mm_setzero_si128();
+
+    a = gcm_clmul_x86_byte_reverse(_mm_loadu_si128((const __m128i *)p_block));
+    gcm_clmul_x86_mul_acc(&lo, &hi, a, _mm_loadu_si128((const __m128i *)p_ctx->key_data));
+    a = gcm_clmul_x86_reduce(lo, hi);
+    _mm_storeu_si128((__m128i *)p_block, gcm_clmul_x86_byte_reverse(a));
+}
+
+/*
+ * Same as gcm_ghash_prepare(), using PCLMULQDQ.
+ *
+ * Each power H^(i+1) is calculated as H^a * H^(i+1-a), where a is the
+ * largest power of 2 not above i, so H^3 and H^4 only depend on H^2, and
+ * H^5 to H^8 only on H^1 to H^4. The multiplies of each step are independent,
+ * which is faster than a chain of 7 multiplies by H when keys change often.
+ */
+static GCM_MUL_CLMUL_X86_TARGET void gcm_ghash_prepare_x86(gcm_ghash_key_t * restrict p_ctx, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    __m128i             powers[GCM_GHASH_NUM_POWERS];
+    __m128i             lo;
+    __m128i             hi;
+    uint_fast8_t        a = 1u;
+    uint_fast8_t        i;
+
+    powers[0] = gcm_clmul_x86_byte_reverse(_mm_loadu_si128((const __m128i *)p_key));
+    for (i = 1u; i < GCM_GHASH_NUM_POWERS; i++)
+    {
+        if ((i & (i - 1u)) == 0)
+        {
+            a = i;
+        }
+        lo = _mm_setzero_si128();
+        hi = _mm_setzero_si128();
+        gcm_clmul_x86_mul_acc(&lo, &hi, powers[a - 1u], powers[i - a]);
+        powers[i] = gcm_clmul_x86_reduce(lo, hi);
+    }
+    for (i = 0; i < GCM_GHASH_NUM_POWERS; i++)
+    {
+        _mm_storeu_si128((__m128i *)p_ctx->key_powers[i], powers[i]);
+    }
+}
+
+/*
+ * Same as gcm_ghash_blocks(), using PCLMULQDQ.
+ */
+static GCM_MUL_CLMUL_X86_TARGET void gcm_ghash_blocks_x86(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks, const gcm_ghash_key_t * p_ctx)
+{
+    __m128i             state;
+    __m128i             lo;
+    __m128i             hi;
+    uint_fast8_t        group_len;
+    uint_fast8_t        i;
+
+    state = gcm_clmul_x86_byte_reverse(_mm_loadu_si128((const __m128i *)p_state));
+    while (num_blocks)
+    {
+        group_len = (num_blocks < GCM_GHASH_NUM_POWERS) ? num_blocks : GCM_GHASH_NUM_POWERS;
+        lo = _mm_setzero_si128();
+        hi = _mm_setzero_si128();
+
+        /* Independent multiplies. The current state is XORed into the first
+         * block. Reduce once for the whole group. */
+        for (i = 0; i < group_len; i++)
+        {
+            __m128i     block = gcm_clmul_x86_byte_reverse(_mm_loadu_si128((const __m128i *)p_data));
+
+            if (i == 0)
+            {
+                block = _mm_xor_si128(block, state);
+            }
+            gcm_clmul_x86_mul_acc(&lo, &hi, block, _mm_loadu_si128((const __m128i *)p_ctx->key_powers[group_len - 1u - i]));
+            p_data += AES_BLOCK_SIZE;
+        }
+        state = gcm_clmul_x86_reduce(lo, hi);
+        num_blocks -= group_len;
+    }
+    _mm_storeu_si128((__m128i *)p_state, gcm_clmul_x86_byte_reverse(state));
+}
+
+#endif // defined(GCM_MUL_CLMUL_X86)
@@ -15,6 +15,8 @@
 
 #include "gcm-mul-cfg.h"
 
+#include <stddef.h>
+
 
 /*****************************************************************************
  * Defines
@@ -26,6 +28,10 @@
 
 #define GCM_U128_NUM_ELEMENTS               (AES_BLOCK_SIZE / GCM_U128_ELEMENT_SIZE)
 
+/* Number of powers of the key pre-calculated for gcm_ghash_blocks(), which is
+ * also the number of blocks that are aggregated per reduction. */
+#define GCM_GHASH_NUM_POWERS                8u
+
 /*****************************************************************************
  * Types
  ****************************************************************************/
@@ -60,12 +66,51 @@ typedef struct
     gcm_u128_struct_t   key_data[255];
 } gcm_mul_table8_t;
 
+/*
+ * Table for gcm_mul_table8_lazy(), with a bit for each byte value that is set
+ * once its entry has been calculated.
+ */
+typedef struct
+{
+    gcm_mul_table8_t    table;
+    uint8_t             valid[256u / 8u];
+} gcm_mul_table8_lazy_t;
+
 typedef struct
 {
     gcm_u128_struct_t   key_data_hi[15];
     gcm_u128_struct_t   key_data_lo[15];
 } gcm_mul_table4_t;
 
+/*
+ * Table for gcm_mul_table4_shoup(): the key multiplied by each 4-bit value,
+ * in the form used for calculation. Entry 0 is zero, so look-ups need no
+ * test for a zero nibble.
+ */
+typedef struct
+{
+    gcm_u128_struct_t   key_data[16];
+} gcm_mul_table4_shoup_t;
+
+/*
+ * Key data for gcm_mul_clmul(). The key is stored as a 128-bit big-endian
+ * integer, as two 64-bit halves, least-significant half first. This matches
+ * the layout of a byte-reversed block in an x86 SSE register.
+ */
+typedef struct
+{
+    uint64_t            key_data[2];
+} gcm_mul_clmul_t;
+
+/*
+ * Key data for gcm_ghash_blocks(): the powers of the key H^1 to H^8, in the
+ * same layout as gcm_mul_clmul_t.
+ */
+typedef struct
+{
+    uint64_t            key_powers[GCM_GHASH_NUM_POWERS][2];
+} gcm_ghash_key_t;
+
 /*****************************************************************************
  * Functions
  ****************************************************************************/
@@ -82,6 +127,9 @@ void gcm_mul(uint8_t p_block[AES_BLOCK_SIZE], const uint8_t p_key[AES_BLOCK_SIZE
 void gcm_mul_prepare_table8(gcm_mul_table8_t * restrict p_table, const uint8_t p_key[AES_BLOCK_SIZE]);
 void gcm_mul_table8(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_table8_t * p_table);
 
+void gcm_mul_prepare_table8_lazy(gcm_mul_table8_lazy_t * restrict p_table, const uint8_t p_key[AES_BLOCK_SIZE]);
+void gcm_mul_table8_lazy(uint8_t p_block[AES_BLOCK_SIZE], gcm_mul_table8_lazy_t * p_table);
+
 #endif
 
 
@@ -93,4 +141,23 @@ void gcm_mul_table4(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_table4_t * p_
 #endif
 
 
+#ifdef GCM_MUL_TABLE_4_SHOUP
+
+void gcm_mul_prepare_table4_shoup(gcm_mul_table4_shoup_t * restrict p_table, const uint8_t p_key[AES_BLOCK_SIZE]);
+void gcm_mul_table4_shoup(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_table4_shoup_t * p_table);
+
+#endif
+
+
+#ifdef GCM_MUL_CLMUL
+
+void gcm_mul_prepare_clmul(gcm_mul_clmul_t * restrict p_ctx, const uint8_t p_key[AES_BLOCK_SIZE]);
+void gcm_mul_clmul(uint8_t p_block[AES_BLOCK_SIZE], const gcm_mul_clmul_t * p_ctx);
+
+void gcm_ghash_prepare(gcm_ghash_key_t * restrict p_ctx, const uint8_t p_key[AES_BLOCK_SIZE]);
+void gcm_ghash_blocks(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks, const gcm_ghash_key_t * p_ctx);
+
+#endif
+
+
 #endif /* !defined(GCM_MUL_H) */
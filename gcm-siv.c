@@ -0,0 +1,689 @@
+/*****************************************************************************
+ * gcm-siv.c
+ *
+ * AES-128-GCM-SIV nonce misuse-resistant authenticated encryption
+ * (RFC 8452), and its POLYVAL universal hash.
+ *
+ * POLYVAL is calculated with the GHASH implementation chosen at run-time, as
+ * for aes128_gcm_key_t, using the identity of RFC 8452 appendix A:
+ *   POLYVAL(H, X_1, ..., X_n) =
+ *     ByteReverse(GHASH(mulX_GHASH(ByteReverse(H)),
+ *                       ByteReverse(X_1), ..., ByteReverse(X_n)))
+ * so the state is kept byte-reversed, and data is byte-reversed a chunk at a
+ * time into a local buffer and passed to GHASH.
+ *
+ * Each message needs four AES blocks to derive its keys, a key schedule, a
+ * POLYVAL key and one AES block for the tag, on top of the hashing and
+ * encryption. The batch functions derive the keys of several messages with one
+ * aes128_encrypt_blocks() call, and encrypt their tags, each under a
+ * different key, with one aes128_encrypt_multi() call, as are the counter
+ * blocks of short messages.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm-siv.h"
+#include "aes-internal.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Blocks encrypted with the key-generating key for each message: 8 bytes of
+ * each make the authentication key then the encryption key. */
+#define AES128_GCM_SIV_DERIVE_BLOCKS 4u
+#define AES128_GCM_SIV_DERIVE_HALF  8u
+
+/* Number of counter blocks encrypted per call of aes128_encrypt_blocks(), as
+ * in aes-ctr.c. */
+#define AES128_GCM_SIV_CTR_BLOCKS   32u
+
+/* Messages of up to this many blocks have their counter blocks encrypted
+ * together with those of the other short messages of a batch. */
+#define AES128_GCM_SIV_SHORT_BLOCKS 8u
+
+/* The top bit of the last byte of the tag is set in the counter block, and
+ * clear in the block encrypted to make the tag. */
+#define AES128_GCM_SIV_MSB          0x80u
+
+/* Number of blocks byte-reversed into a local buffer per GHASH call. */
+#define GCM_POLYVAL_CHUNK_BLOCKS    (4u * GCM_GHASH_NUM_POWERS)
+
+/* x^128 = x^7 + x^2 + x + 1 in GHASH's reflected bit order, for mulX_GHASH. */
+#define GCM_POLYVAL_REDUCE_BYTE     0xE1u
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void gcm_polyval_ghash(const gcm_polyval_key_t * p_key, uint8_t p_state[AES_BLOCK_SIZE],
+                              const uint8_t * p_data, size_t num_blocks);
+static void gcm_polyval_absorb(const gcm_polyval_key_t * p_key, uint8_t p_state[AES_BLOCK_SIZE],
+                               const uint8_t * p_data, size_t len);
+static void aes128_gcm_siv_derive_keys(const aes_engine_t * p_engine, const aes128_gcm_siv_key_t * p_key,
+                                       uint8_t * p_blocks, const uint8_t * p_nonces, size_t num_msgs);
+static void aes128_gcm_siv_auth_key(gcm_polyval_key_t * p_auth_key, const uint8_t * p_derived);
+static void aes128_gcm_siv_enc_key(const aes_engine_t * p_engine, uint8_t p_enc_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                                   const uint8_t * p_derived);
+static void aes128_gcm_siv_tag_input(const gcm_polyval_key_t * p_auth_key, uint8_t p_block[AES_BLOCK_SIZE],
+                                     const uint8_t * p_nonce, const uint8_t * p_aad, size_t aad_len,
+                                     const uint8_t * p_data, size_t len);
+static void aes128_gcm_siv_ctr(const aes_engine_t * p_engine, const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                               const uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE],
+                               uint8_t * p_out, const uint8_t * p_in, size_t len);
+static void aes128_gcm_siv_ctr_group(const aes_engine_t * p_engine, const uint8_t * const p_key_schedules[],
+                                     uint8_t * const p_tag_blocks[],
+                                     uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                                     size_t num_msgs);
+static void aes128_gcm_siv_seal_group(const aes_engine_t * p_engine, const aes128_gcm_siv_key_t * p_key,
+                                      const uint8_t * p_nonces,
+                                      const uint8_t * const p_aads[], const size_t aad_lens[],
+                                      uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                                      uint8_t * p_tags, size_t num_msgs);
+static bool aes128_gcm_siv_open_group(const aes_engine_t * p_engine, const aes128_gcm_siv_key_t * p_key,
+                                      const uint8_t * p_nonces,
+                                      const uint8_t * const p_aads[], const size_t aad_lens[],
+                                      uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                                      const uint8_t * p_tags, bool p_valid[], size_t num_msgs);
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+/* Reverse the order of the bytes of a block, as two byte-swapped 64-bit
+ * words where they are native little-endian. p_out must not be p_in. */
+static inline void gcm_polyval_block_reverse(uint8_t p_out[AES_BLOCK_SIZE], const uint8_t p_in[AES_BLOCK_SIZE])
+{
+#ifdef AES_NATIVE_LE
+    uint64_t            in[2];
+    uint64_t            out[2];
+
+    memcpy(in, p_in, AES_BLOCK_SIZE);
+    out[0] = __builtin_bswap64(in[1]);
+    out[1] = __builtin_bswap64(in[0]);
+    memcpy(p_out, out, AES_BLOCK_SIZE);
+#else
+    uint_fast8_t        i;
+
+    for (i = 0; i < AES_BLOCK_SIZE; i++)
+    {
+        p_out[i] = p_in[AES_BLOCK_SIZE - 1u - i];
+    }
+#endif
+}
+
+static inline uint32_t aes128_gcm_siv_load_le32(const uint8_t * p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8u) | ((uint32_t)p[2] << 16u) | ((uint32_t)p[3] << 24u);
+}
+
+static inline void aes128_gcm_siv_store_le32(uint8_t * p, uint32_t a)
+{
+    p[0] = a;
+    p[1] = a >> 8u;
+    p[2] = a >> 16u;
+    p[3] = a >> 24u;
+}
+
+static inline void aes128_gcm_siv_store_be64(uint8_t * p, uint64_t a)
+{
+    uint_fast8_t        i;
+
+    for (i = 8u; i != 0; )
+    {
+        i--;
+        p[i] = (uint8_t)a;
+        a >>= 8u;
+    }
+}
+
+/*
+ * Make the initial counter block from the tag, and return its counter.
+ */
+static inline uint32_t aes128_gcm_siv_counter_start(uint8_t p_counter_block[AES_BLOCK_SIZE],
+                                                    const uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE])
+{
+    memcpy(p_counter_block, p_tag, AES_BLOCK_SIZE);
+    p_counter_block[AES_BLOCK_SIZE - 1u] |= AES128_GCM_SIV_MSB;
+    return aes128_gcm_siv_load_le32(p_counter_block);
+}
+
+/*
+ * Write num_blocks counter blocks, starting with counter value counter, and
+ * return the next counter value.
+ */
+static inline uint32_t aes128_gcm_siv_counter_fill(uint8_t * p_blocks, const uint8_t p_counter_block[AES_BLOCK_SIZE],
+                                                   uint32_t counter, size_t num_blocks)
+{
+    while (num_blocks--)
+    {
+        memcpy(p_blocks, p_counter_block, AES_BLOCK_SIZE);
+        aes128_gcm_siv_store_le32(p_blocks, counter++);
+        p_blocks += AES_BLOCK_SIZE;
+    }
+    return counter;
+}
+
+/*
+ * XOR len bytes of data with the key stream, which is modified.
+ */
+static inline void aes128_gcm_siv_keystream_xor(uint8_t * p_out, const uint8_t * p_in, uint8_t * p_keystream, size_t len)
+{
+    size_t              i;
+
+    for (i = 0; i + AES_BLOCK_SIZE <= len; i += AES_BLOCK_SIZE)
+    {
+        aes_block_xor64(&p_keystream[i], &p_in[i]);
+    }
+    for ( ; i < len; i++)
+    {
+        p_keystream[i] ^= p_in[i];
+    }
+    if (len)
+    {
+        memcpy(p_out, p_keystream, len);
+    }
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Prepare POLYVAL key data for key p_h, for the GHASH implementation which
+ * is fastest on this CPU.
+ */
+void gcm_polyval_prepare(gcm_polyval_key_t * p_key, const uint8_t p_h[AES_BLOCK_SIZE])
+{
+    uint8_t             ghash_key[AES_BLOCK_SIZE];
+    uint8_t             carry;
+    uint_fast8_t        i;
+
+    /* mulX_GHASH(ByteReverse(H)): in GHASH's bit order, multiplying by x is
+     * a right shift, with the reduction into the first byte. The carry is
+     * turned into a mask rather than tested, as the key is secret. */
+    gcm_polyval_block_reverse(ghash_key, p_h);
+    carry = ghash_key[AES_BLOCK_SIZE - 1u] & 1u;
+    for (i = AES_BLOCK_SIZE - 1u; i != 0; i--)
+    {
+        ghash_key[i] = (ghash_key[i] >> 1u) | (ghash_key[i - 1u] << 7u);
+    }
+    ghash_key[0] = (ghash_key[0] >> 1u) ^ (GCM_POLYVAL_REDUCE_BYTE & -carry);
+
+    p_key->p_ghash_ops = gcm_mul_ops_select();
+    p_key->p_ghash_ops->prepare(&p_key->ghash_key, ghash_key);
+}
+
+/*
+ * POLYVAL whole blocks into p_state: for each block X, state = (state ^ X) * H
+ * in POLYVAL's field. p_state starts as zero, and can be continued with
+ * further calls.
+ */
+void gcm_polyval_blocks(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks,
+                        const gcm_polyval_key_t * p_key)
+{
+    uint8_t             state[AES_BLOCK_SIZE];
+
+    gcm_polyval_block_reverse(state, p_state);
+    gcm_polyval_absorb(p_key, state, p_data, num_blocks * AES_BLOCK_SIZE);
+    gcm_polyval_block_reverse(p_state, state);
+}
+
+/*
+ * Prepare AES-128-GCM-SIV key data from the 16-byte key-generating key.
+ */
+void aes128_gcm_siv_init(aes128_gcm_siv_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE])
+{
+    aes128_key_schedule(p_key->key_schedule, p_aes_key);
+}
+
+/*
+ * AES-128-GCM-SIV encryption.
+ *
+ * Encrypts len bytes from p_in to p_out, which may be the same buffer, and
+ * outputs the 16-byte tag, which authenticates the nonce, the aad_len bytes of
+ * associated data at p_aad, and the message. The plain text is read twice,
+ * once to calculate the tag and once to encrypt it with the tag as the
+ * counter block.
+ * RFC 8452 limits the message and the associated data to 2^36 bytes each.
+ */
+void aes128_gcm_siv_seal(const aes128_gcm_siv_key_t * p_key,
+                         const uint8_t p_nonce[AES128_GCM_SIV_NONCE_SIZE],
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE])
+{
+    aes128_gcm_siv_seal_group(aes_engine_current(), p_key, p_nonce, &p_aad, &aad_len,
+                              &p_out, &p_in, &len, p_tag, 1u);
+}
+
+/*
+ * AES-128-GCM-SIV decryption.
+ *
+ * Decrypts len bytes from p_in to p_out, which may be the same buffer, and
+ * checks the tag in constant time. Parameters are as for
+ * aes128_gcm_siv_seal().
+ *
+ * Returns true if the tag is correct. If not, it returns false and the output
+ * is cleared.
+ */
+bool aes128_gcm_siv_open(const aes128_gcm_siv_key_t * p_key,
+                         const uint8_t p_nonce[AES128_GCM_SIV_NONCE_SIZE],
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         const uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE])
+{
+    return aes128_gcm_siv_open_group(aes_engine_current(), p_key, p_nonce, &p_aad, &aad_len,
+                                     &p_out, &p_in, &len, p_tag, NULL, 1u);
+}
+
+/*
+ * AES-128-GCM-SIV encryption of num_msgs independent messages under one key.
+ *
+ * Message i has the 12-byte nonce at p_nonces + i * AES128_GCM_SIV_NONCE_SIZE,
+ * aad_lens[i] bytes of associated data at p_aads[i], and lens[i] bytes of
+ * plain text at p_ins[i], encrypted to p_outs[i]. Its tag is written at
+ * p_tags + i * AES128_GCM_SIV_TAG_SIZE. p_aads and aad_lens may be NULL if no
+ * message has associated data.
+ *
+ * AES_PARALLEL_BLOCKS messages at a time have their keys derived together
+ * and their tags encrypted together, which is much faster than
+ * aes128_gcm_siv_seal() for each message where the messages are short and the
+ * AES implementation interleaves blocks, such as AES-NI.
+ */
+void aes128_gcm_siv_seal_batch(const aes128_gcm_siv_key_t * p_key, const uint8_t * p_nonces,
+                               const uint8_t * const p_aads[], const size_t aad_lens[],
+                               uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                               uint8_t * p_tags, size_t num_msgs)
+{
+    const aes_engine_t * p_engine = aes_engine_current();
+    size_t              group_msgs;
+    size_t              i;
+
+    for (i = 0; i < num_msgs; i += group_msgs)
+    {
+        group_msgs = num_msgs - i;
+        if (group_msgs > AES_PARALLEL_BLOCKS)
+        {
+            group_msgs = AES_PARALLEL_BLOCKS;
+        }
+        aes128_gcm_siv_seal_group(p_engine, p_key, p_nonces + i * AES128_GCM_SIV_NONCE_SIZE,
+                                  (p_aads != NULL) ? p_aads + i : NULL, (aad_lens != NULL) ? aad_lens + i : NULL,
+                                  p_outs + i, p_ins + i, lens + i,
+                                  p_tags + i * AES128_GCM_SIV_TAG_SIZE, group_msgs);
+    }
+}
+
+/*
+ * AES-128-GCM-SIV decryption of num_msgs independent messages under one key.
+ *
+ * Parameters are as for aes128_gcm_siv_seal_batch(), with the tags to check
+ * at p_tags. If p_valid is not NULL, p_valid[i] is set to whether the tag of
+ * message i is correct. The output of each message with an incorrect tag is
+ * cleared.
+ *
+ * Returns true if all the tags are correct.
+ */
+bool aes128_gcm_siv_open_batch(const aes128_gcm_siv_key_t * p_key, const uint8_t * p_nonces,
+                               const uint8_t * const p_aads[], const size_t aad_lens[],
+                               uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                               const uint8_t * p_tags, bool p_valid[], size_t num_msgs)
+{
+    const aes_engine_t * p_engine = aes_engine_current();
+    size_t              group_msgs;
+    size_t              i;
+    bool                is_all_valid = true;
+
+    for (i = 0; i < num_msgs; i += group_msgs)
+    {
+        group_msgs = num_msgs - i;
+        if (group_msgs > AES_PARALLEL_BLOCKS)
+        {
+            group_msgs = AES_PARALLEL_BLOCKS;
+        }
+        if (!aes128_gcm_siv_open_group(p_engine, p_key, p_nonces + i * AES128_GCM_SIV_NONCE_SIZE,
+                                       (p_aads != NULL) ? p_aads + i : NULL, (aad_lens != NULL) ? aad_lens + i : NULL,
+                                       p_outs + i, p_ins + i, lens + i,
+                                       p_tags + i * AES128_GCM_SIV_TAG_SIZE,
+                                       (p_valid != NULL) ? p_valid + i : NULL, group_msgs))
+        {
+            is_all_valid = false;
+        }
+    }
+    return is_all_valid;
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * GHASH whole byte-reversed blocks into p_state, with the key's GHASH
+ * implementation, as aes128_gcm_ghash() in gcm.c.
+ */
+static void gcm_polyval_ghash(const gcm_polyval_key_t * p_key, uint8_t p_state[AES_BLOCK_SIZE],
+                              const uint8_t * p_data, size_t num_blocks)
+{
+    p_key->p_ghash_ops->mul_blocks(p_state, p_data, num_blocks, &p_key->ghash_key);
+}
+
+/*
+ * POLYVAL len bytes of data into the byte-reversed state p_state, zero-padding
+ * a partial last block.
+ */
+static void gcm_polyval_absorb(const gcm_polyval_key_t * p_key, uint8_t p_state[AES_BLOCK_SIZE],
+                               const uint8_t * p_data, size_t len)
+{
+    uint8_t             chunk[GCM_POLYVAL_CHUNK_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t             block[AES_BLOCK_SIZE];
+    size_t              num_blocks;
+    size_t              i;
+
+    while (len >= AES_BLOCK_SIZE)
+    {
+        num_blocks = len / AES_BLOCK_SIZE;
+        if (num_blocks > GCM_POLYVAL_CHUNK_BLOCKS)
+        {
+            num_blocks = GCM_POLYVAL_CHUNK_BLOCKS;
+        }
+        for (i = 0; i < num_blocks; i++)
+        {
+            gcm_polyval_block_reverse(&chunk[i * AES_BLOCK_SIZE], &p_data[i * AES_BLOCK_SIZE]);
+        }
+        gcm_polyval_ghash(p_key, p_state, chunk, num_blocks);
+        p_data += num_blocks * AES_BLOCK_SIZE;
+        len -= num_blocks * AES_BLOCK_SIZE;
+    }
+    if (len)
+    {
+        memcpy(block, p_data, len);
+        memset(block + len, 0, AES_BLOCK_SIZE - len);
+        gcm_polyval_block_reverse(chunk, block);
+        gcm_polyval_ghash(p_key, p_state, chunk, 1u);
+    }
+}
+
+/*
+ * Encrypt the key derivation blocks of num_msgs messages, each the block
+ * index as a 32-bit little-endian value followed by the nonce, with one
+ * aes128_encrypt_blocks() call.
+ */
+static void aes128_gcm_siv_derive_keys(const aes_engine_t * p_engine, const aes128_gcm_siv_key_t * p_key,
+                                       uint8_t * p_blocks, const uint8_t * p_nonces, size_t num_msgs)
+{
+    uint8_t           * p_block = p_blocks;
+    size_t              msg;
+    uint_fast8_t        i;
+
+    for (msg = 0; msg < num_msgs; msg++)
+    {
+        for (i = 0; i < AES128_GCM_SIV_DERIVE_BLOCKS; i++)
+        {
+            aes128_gcm_siv_store_le32(p_block, i);
+            memcpy(p_block + 4u, p_nonces + msg * AES128_GCM_SIV_NONCE_SIZE, AES128_GCM_SIV_NONCE_SIZE);
+            p_block += AES_BLOCK_SIZE;
+        }
+    }
+    p_engine->encrypt_blocks(p_blocks, num_msgs * AES128_GCM_SIV_DERIVE_BLOCKS, p_key->key_schedule, AES128_NUM_ROUNDS);
+}
+
+/*
+ * Make a message's POLYVAL authentication key data from the first two of its
+ * encrypted key derivation blocks.
+ */
+static void aes128_gcm_siv_auth_key(gcm_polyval_key_t * p_auth_key, const uint8_t * p_derived)
+{
+    uint8_t             key[AES_BLOCK_SIZE];
+
+    memcpy(key, p_derived, AES128_GCM_SIV_DERIVE_HALF);
+    memcpy(key + AES128_GCM_SIV_DERIVE_HALF, p_derived + AES_BLOCK_SIZE, AES128_GCM_SIV_DERIVE_HALF);
+    gcm_polyval_prepare(p_auth_key, key);
+}
+
+/*
+ * Make a message's encryption key schedule from the last two of its
+ * encrypted key derivation blocks.
+ */
+static void aes128_gcm_siv_enc_key(const aes_engine_t * p_engine, uint8_t p_enc_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                                   const uint8_t * p_derived)
+{
+    uint8_t             key[AES_BLOCK_SIZE];
+
+    memcpy(key, p_derived + 2u * AES_BLOCK_SIZE, AES128_GCM_SIV_DERIVE_HALF);
+    memcpy(key + AES128_GCM_SIV_DERIVE_HALF, p_derived + 3u * AES_BLOCK_SIZE, AES128_GCM_SIV_DERIVE_HALF);
+    p_engine->key_schedule(p_enc_key_schedule, key, AES128_KEY_SIZE);
+}
+
+/*
+ * Calculate the block which is encrypted to make the tag: the POLYVAL of the
+ * zero-padded associated data and plain text and their bit lengths, XORed
+ * with the nonce, with the top bit cleared.
+ */
+static void aes128_gcm_siv_tag_input(const gcm_polyval_key_t * p_auth_key, uint8_t p_block[AES_BLOCK_SIZE],
+                                     const uint8_t * p_nonce, const uint8_t * p_aad, size_t aad_len,
+                                     const uint8_t * p_data, size_t len)
+{
+    uint8_t             state[AES_BLOCK_SIZE];
+    uint8_t             lengths_block[AES_BLOCK_SIZE];
+    uint_fast8_t        i;
+
+    memset(state, 0, sizeof(state));
+    gcm_polyval_absorb(p_auth_key, state, p_aad, aad_len);
+    gcm_polyval_absorb(p_auth_key, state, p_data, len);
+
+    /* The lengths block is two little-endian 64-bit values, so byte-reversed
+     * it is the plain text length then the associated data length, each
+     * big-endian. */
+    aes128_gcm_siv_store_be64(lengths_block, (uint64_t)len * 8u);
+    aes128_gcm_siv_store_be64(lengths_block + 8u, (uint64_t)aad_len * 8u);
+    gcm_polyval_ghash(p_auth_key, state, lengths_block, 1u);
+
+    gcm_polyval_block_reverse(p_block, state);
+    for (i = 0; i < AES128_GCM_SIV_NONCE_SIZE; i++)
+    {
+        p_block[i] ^= p_nonce[i];
+    }
+    p_block[AES_BLOCK_SIZE - 1u] &= (uint8_t)~AES128_GCM_SIV_MSB;
+}
+
+/*
+ * CTR mode encryption or decryption of a message. The initial counter block
+ * is the tag with the top bit set, and the counter is its first 4 bytes as a
+ * 32-bit little-endian value, incremented modulo 2^32.
+ */
+static void aes128_gcm_siv_ctr(const aes_engine_t * p_engine, const uint8_t p_key_schedule[AES128_KEY_SCHEDULE_SIZE],
+                               const uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE],
+                               uint8_t * p_out, const uint8_t * p_in, size_t len)
+{
+    uint8_t             keystream[AES128_GCM_SIV_CTR_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t             counter_block[AES_BLOCK_SIZE];
+    uint32_t            counter;
+    size_t              num_blocks;
+    size_t              batch_len;
+
+    counter = aes128_gcm_siv_counter_start(counter_block, p_tag);
+    while (len)
+    {
+        num_blocks = (len + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE;
+        if (num_blocks > AES128_GCM_SIV_CTR_BLOCKS)
+        {
+            num_blocks = AES128_GCM_SIV_CTR_BLOCKS;
+        }
+        counter = aes128_gcm_siv_counter_fill(keystream, counter_block, counter, num_blocks);
+        p_engine->encrypt_blocks(keystream, num_blocks, p_key_schedule, AES128_NUM_ROUNDS);
+
+        batch_len = num_blocks * AES_BLOCK_SIZE;
+        if (batch_len > len)
+        {
+            batch_len = len;
+        }
+        aes128_gcm_siv_keystream_xor(p_out, p_in, keystream, batch_len);
+        p_in += batch_len;
+        p_out += batch_len;
+        len -= batch_len;
+    }
+}
+
+/*
+ * CTR mode encryption or decryption of up to AES_PARALLEL_BLOCKS
+ * messages, message i with the key schedule p_key_schedules[i] and the
+ * initial counter block made from p_tag_blocks[i].
+ *
+ * The counter blocks of all the messages of up to AES128_GCM_SIV_SHORT_BLOCKS
+ * blocks are encrypted with one aes128_encrypt_multi() call, so short
+ * messages don't each need an aes128_encrypt_blocks() call of their own.
+ * Longer messages use aes128_gcm_siv_ctr().
+ */
+static void aes128_gcm_siv_ctr_group(const aes_engine_t * p_engine, const uint8_t * const p_key_schedules[],
+                                     uint8_t * const p_tag_blocks[],
+                                     uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                                     size_t num_msgs)
+{
+    uint8_t             keystream[AES_PARALLEL_BLOCKS * AES128_GCM_SIV_SHORT_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t           * p_keystream_blocks[AES_PARALLEL_BLOCKS * AES128_GCM_SIV_SHORT_BLOCKS];
+    const uint8_t     * p_keystream_keys[AES_PARALLEL_BLOCKS * AES128_GCM_SIV_SHORT_BLOCKS];
+    uint8_t             counter_block[AES_BLOCK_SIZE];
+    uint32_t            counter;
+    size_t              num_blocks = 0;
+    size_t              msg_blocks;
+    size_t              i;
+    size_t              j;
+
+    for (i = 0; i < num_msgs; i++)
+    {
+        if (lens[i] > AES128_GCM_SIV_SHORT_BLOCKS * AES_BLOCK_SIZE)
+        {
+            aes128_gcm_siv_ctr(p_engine, p_key_schedules[i], p_tag_blocks[i], p_outs[i], p_ins[i], lens[i]);
+            continue;
+        }
+        msg_blocks = (lens[i] + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE;
+        counter = aes128_gcm_siv_counter_start(counter_block, p_tag_blocks[i]);
+        aes128_gcm_siv_counter_fill(&keystream[num_blocks * AES_BLOCK_SIZE], counter_block, counter, msg_blocks);
+        for (j = 0; j < msg_blocks; j++)
+        {
+            p_keystream_blocks[num_blocks] = &keystream[num_blocks * AES_BLOCK_SIZE];
+            p_keystream_keys[num_blocks] = p_key_schedules[i];
+            num_blocks++;
+        }
+    }
+    if (num_blocks == 0)
+    {
+        return;
+    }
+    p_engine->encrypt_multi(p_keystream_blocks, p_keystream_keys, num_blocks, AES128_NUM_ROUNDS);
+
+    num_blocks = 0;
+    for (i = 0; i < num_msgs; i++)
+    {
+        if (lens[i] <= AES128_GCM_SIV_SHORT_BLOCKS * AES_BLOCK_SIZE)
+        {
+            aes128_gcm_siv_keystream_xor(p_outs[i], p_ins[i], &keystream[num_blocks * AES_BLOCK_SIZE], lens[i]);
+            num_blocks += (lens[i] + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE;
+        }
+    }
+}
+
+/*
+ * Encrypt up to AES_PARALLEL_BLOCKS messages. Each message's tag is
+ * calculated from its plain text before it is encrypted, so they may be
+ * in-place.
+ */
+static void aes128_gcm_siv_seal_group(const aes_engine_t * p_engine, const aes128_gcm_siv_key_t * p_key,
+                                      const uint8_t * p_nonces,
+                                      const uint8_t * const p_aads[], const size_t aad_lens[],
+                                      uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                                      uint8_t * p_tags, size_t num_msgs)
+{
+    uint8_t             derived[AES_PARALLEL_BLOCKS * AES128_GCM_SIV_DERIVE_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t             enc_key_schedules[AES_PARALLEL_BLOCKS][AES128_KEY_SCHEDULE_SIZE];
+    uint8_t           * p_tag_blocks[AES_PARALLEL_BLOCKS];
+    const uint8_t     * p_key_schedules[AES_PARALLEL_BLOCKS];
+    const uint8_t     * p_derived;
+    gcm_polyval_key_t   auth_key;
+    size_t              i;
+
+    aes128_gcm_siv_derive_keys(p_engine, p_key, derived, p_nonces, num_msgs);
+    for (i = 0; i < num_msgs; i++)
+    {
+        p_derived = &derived[i * AES128_GCM_SIV_DERIVE_BLOCKS * AES_BLOCK_SIZE];
+        aes128_gcm_siv_enc_key(p_engine, enc_key_schedules[i], p_derived);
+        aes128_gcm_siv_auth_key(&auth_key, p_derived);
+        p_tag_blocks[i] = p_tags + i * AES128_GCM_SIV_TAG_SIZE;
+        p_key_schedules[i] = enc_key_schedules[i];
+        aes128_gcm_siv_tag_input(&auth_key, p_tag_blocks[i], p_nonces + i * AES128_GCM_SIV_NONCE_SIZE,
+                                 (p_aads != NULL) ? p_aads[i] : NULL, (aad_lens != NULL) ? aad_lens[i] : 0,
+                                 p_ins[i], lens[i]);
+    }
+    p_engine->encrypt_multi(p_tag_blocks, p_key_schedules, num_msgs, AES128_NUM_ROUNDS);
+
+    aes128_gcm_siv_ctr_group(p_engine, p_key_schedules, p_tag_blocks, p_outs, p_ins, lens, num_msgs);
+}
+
+/*
+ * Decrypt up to AES_PARALLEL_BLOCKS messages, and check their tags.
+ * Returns true if all are correct.
+ */
+static bool aes128_gcm_siv_open_group(const aes_engine_t * p_engine, const aes128_gcm_siv_key_t * p_key,
+                                      const uint8_t * p_nonces,
+                                      const uint8_t * const p_aads[], const size_t aad_lens[],
+                                      uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                                      const uint8_t * p_tags, bool p_valid[], size_t num_msgs)
+{
+    uint8_t             derived[AES_PARALLEL_BLOCKS * AES128_GCM_SIV_DERIVE_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t             enc_key_schedules[AES_PARALLEL_BLOCKS][AES128_KEY_SCHEDULE_SIZE];
+    uint8_t             tags[AES_PARALLEL_BLOCKS][AES128_GCM_SIV_TAG_SIZE];
+    uint8_t             received_tags[AES_PARALLEL_BLOCKS][AES128_GCM_SIV_TAG_SIZE];
+    uint8_t           * p_tag_blocks[AES_PARALLEL_BLOCKS];
+    const uint8_t     * p_key_schedules[AES_PARALLEL_BLOCKS];
+    gcm_polyval_key_t   auth_key;
+    size_t              i;
+    uint_fast8_t        j;
+    uint8_t             diff;
+    bool                is_all_valid = true;
+
+    aes128_gcm_siv_derive_keys(p_engine, p_key, derived, p_nonces, num_msgs);
+    for (i = 0; i < num_msgs; i++)
+    {
+        aes128_gcm_siv_enc_key(p_engine, enc_key_schedules[i], &derived[i * AES128_GCM_SIV_DERIVE_BLOCKS * AES_BLOCK_SIZE]);
+        memcpy(received_tags[i], p_tags + i * AES128_GCM_SIV_TAG_SIZE, AES128_GCM_SIV_TAG_SIZE);
+        p_tag_blocks[i] = received_tags[i];
+        p_key_schedules[i] = enc_key_schedules[i];
+    }
+    aes128_gcm_siv_ctr_group(p_engine, p_key_schedules, p_tag_blocks, p_outs, p_ins, lens, num_msgs);
+
+    for (i = 0; i < num_msgs; i++)
+    {
+        aes128_gcm_siv_auth_key(&auth_key, &derived[i * AES128_GCM_SIV_DERIVE_BLOCKS * AES_BLOCK_SIZE]);
+        p_tag_blocks[i] = tags[i];
+        aes128_gcm_siv_tag_input(&auth_key, tags[i], p_nonces + i * AES128_GCM_SIV_NONCE_SIZE,
+                                 (p_aads != NULL) ? p_aads[i] : NULL, (aad_lens != NULL) ? aad_lens[i] : 0,
+                                 p_outs[i], lens[i]);
+    }
+    p_engine->encrypt_multi(p_tag_blocks, p_key_schedules, num_msgs, AES128_NUM_ROUNDS);
+
+    for (i = 0; i < num_msgs; i++)
+    {
+        diff = 0;
+        for (j = 0; j < AES128_GCM_SIV_TAG_SIZE; j++)
+        {
+            diff |= tags[i][j] ^ received_tags[i][j];
+        }
+        if (diff != 0)
+        {
+            if (lens[i])
+            {
+                memset(p_outs[i], 0, lens[i]);
+            }
+            is_all_valid = false;
+        }
+        if (p_valid != NULL)
+        {
+            p_valid[i] = (diff == 0);
+        }
+    }
+    return is_all_valid;
+}
@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * gcm-siv.h
+ *
+ * AES-128-GCM-SIV nonce misuse-resistant authenticated encryption
+ * (RFC 8452), and its POLYVAL universal hash.
+ *
+ * Each message's authentication and encryption keys are derived from the
+ * key-generating key and the nonce. The tag is calculated from the POLYVAL
+ * hash of the associated data and plain text, and is also the initial counter
+ * block, so repeating a nonce only reveals whether the same message was
+ * repeated.
+ * One-shot aes128_gcm_siv_seal() and aes128_gcm_siv_open() are provided, and
+ * aes128_gcm_siv_seal_batch() and aes128_gcm_siv_open_batch() for many
+ * independent messages under one key.
+ ****************************************************************************/
+
+#ifndef GCM_SIV_H
+#define GCM_SIV_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+#include "gcm.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AES128_GCM_SIV_NONCE_SIZE   12u
+#define AES128_GCM_SIV_TAG_SIZE     AES_BLOCK_SIZE
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Key data for POLYVAL with key H. POLYVAL is GHASH with the bytes of each
+ * block reversed and the key multiplied by x (RFC 8452 appendix A), so this
+ * is GHASH key data for key mulX_GHASH(ByteReverse(H)), prepared for the
+ * GHASH implementation chosen at run-time as for aes128_gcm_key_t.
+ */
+typedef struct
+{
+    const gcm_mul_ops_t * p_ghash_ops;
+    gcm_mul_ops_ctx_t   ghash_key;
+} gcm_polyval_key_t;
+
+/*
+ * Key data for AES-128-GCM-SIV: the key schedule of the key-generating key,
+ * calculated once per key by aes128_gcm_siv_init(). It is not modified by
+ * use.
+ */
+typedef struct
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+} aes128_gcm_siv_key_t;
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void gcm_polyval_prepare(gcm_polyval_key_t * p_key, const uint8_t p_h[AES_BLOCK_SIZE]);
+void gcm_polyval_blocks(uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks,
+                        const gcm_polyval_key_t * p_key);
+
+void aes128_gcm_siv_init(aes128_gcm_siv_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE]);
+
+void aes128_gcm_siv_seal(const aes128_gcm_siv_key_t * p_key,
+                         const uint8_t p_nonce[AES128_GCM_SIV_NONCE_SIZE],
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE]);
+bool aes128_gcm_siv_open(const aes128_gcm_siv_key_t * p_key,
+                         const uint8_t p_nonce[AES128_GCM_SIV_NONCE_SIZE],
+                         const uint8_t * p_aad, size_t aad_len,
+                         uint8_t * p_out, const uint8_t * p_in, size_t len,
+                         const uint8_t p_tag[AES128_GCM_SIV_TAG_SIZE]);
+
+void aes128_gcm_siv_seal_batch(const aes128_gcm_siv_key_t * p_key, const uint8_t * p_nonces,
+                               const uint8_t * const p_aads[], const size_t aad_lens[],
+                               uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                               uint8_t * p_tags, size_t num_msgs);
+bool aes128_gcm_siv_open_batch(const aes128_gcm_siv_key_t * p_key, const uint8_t * p_nonces,
+                               const uint8_t * const p_aads[], const size_t aad_lens[],
+                               uint8_t * const p_outs[], const uint8_t * const p_ins[], const size_t lens[],
+                               const uint8_t * p_tags, bool p_valid[], size_t num_msgs);
+
+
+#endif /* !defined(GCM_SIV_H) */
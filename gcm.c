@@ -0,0 +1,794 @@
+/*****************************************************************************
+ * gcm.c
+ *
+ * AES-128-GCM authenticated encryption.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm.h"
+#include "aes-ctr.h"
+
+#ifdef ENABLE_THREADS
+#include "aes-parallel.h"
+#endif
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Number of blocks encrypted and hashed per pass of the fused CTR + GHASH
+ * loop. This is small enough for the chunk to stay in L1 cache between the two
+ * steps. */
+#define AES128_GCM_CHUNK_BLOCKS     (4u * GCM_GHASH_NUM_POWERS)
+
+#define AES128_GCM_COUNTER_SIZE     4u
+
+/* Number of blocks at the end of each message, including the lengths block,
+ * that aes128_gmac_batch() hashes from a local copy. This is the number of
+ * blocks the carry-less multiply GHASH aggregates per reduction. */
+#define AES128_GMAC_TAIL_BLOCKS     8u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+#ifdef ENABLE_THREADS
+
+/*
+ * Work shared by the tasks of aes128_gcm_crypt_parallel(). Each task
+ * encrypts or decrypts one chunk, and calculates the GHASH of its ciphertext
+ * starting from zero.
+ */
+typedef struct
+{
+    const aes128_gcm_key_t * p_key;
+    const uint8_t     * p_counter;
+    const uint8_t     * p_in;
+    uint8_t           * p_out;
+    size_t              len;
+    size_t              chunk_blocks;
+    bool                is_decrypt;
+    uint8_t          (* p_chunk_ghash)[AES_BLOCK_SIZE];
+} aes128_gcm_parallel_job_t;
+
+#endif
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void aes128_gcm_ghash(const aes128_gcm_key_t * p_key, uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks);
+static void aes128_gcm_ghash_absorb(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_data, size_t len);
+static void aes128_gcm_ghash_flush(aes128_gcm_ctx_t * p_ctx);
+static void aes128_gcm_keystream(aes128_gcm_ctx_t * p_ctx, uint8_t * p_keystream, size_t num_blocks);
+static void aes128_gcm_crypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len, bool is_decrypt);
+#ifdef ENABLE_THREADS
+static void aes128_gcm_crypt_parallel(aes_thread_pool_t * p_pool, aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len, bool is_decrypt);
+static void aes128_gcm_parallel_task(void * p_arg, size_t task_index);
+static void aes128_gcm_key_power(uint8_t p_result[AES_BLOCK_SIZE], const aes128_gcm_key_t * p_key, size_t exponent);
+#endif
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+/*
+ * Increment the 32-bit big-endian counter in the last 4 bytes of the counter
+ * block, modulo 2^32, as GCM specifies.
+ */
+static inline void aes128_gcm_counter_inc(uint8_t p_counter[AES_BLOCK_SIZE])
+{
+    uint_fast8_t        i;
+
+    for (i = AES_BLOCK_SIZE; i > AES_BLOCK_SIZE - AES128_GCM_COUNTER_SIZE; )
+    {
+        i--;
+        if (++p_counter[i] != 0)
+        {
+            break;
+        }
+    }
+}
+
+static inline uint32_t aes128_gcm_load_be32(const uint8_t * p)
+{
+    return ((uint32_t)p[0] << 24u) | ((uint32_t)p[1] << 16u) | ((uint32_t)p[2] << 8u) | p[3];
+}
+
+static inline void aes128_gcm_store_be32(uint8_t * p, uint32_t a)
+{
+    p[0] = a >> 24u;
+    p[1] = a >> 16u;
+    p[2] = a >> 8u;
+    p[3] = a;
+}
+
+static inline void aes128_gcm_store_be64(uint8_t * p, uint64_t a)
+{
+    uint_fast8_t        i;
+
+    for (i = 8u; i != 0; i--)
+    {
+        p[i - 1u] = a;
+        a >>= 8u;
+    }
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+/*
+ * Prepare AES-128-GCM key data.
+ *
+ * Calculates the AES-128 key schedule, and the GHASH key H = E(K, 0^128)
+ * prepared for the GHASH implementation which is fastest on this CPU.
+ */
+void aes128_gcm_init(aes128_gcm_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE])
+{
+    uint8_t             ghash_key[AES_BLOCK_SIZE];
+
+    aes128_key_schedule(p_key->key_schedule, p_aes_key);
+    memset(ghash_key, 0, sizeof(ghash_key));
+    aes128_encrypt(ghash_key, p_key->key_schedule);
+    p_key->p_ghash_ops = gcm_mul_ops_select();
+    p_key->p_ghash_ops->prepare(&p_key->ghash_key, ghash_key);
+}
+
+/*
+ * Start an AES-128-GCM encryption or decryption operation.
+ *
+ * p_key is the key data calculated by aes128_gcm_init(). It must remain valid
+ * until the operation is finished.
+ * p_iv is the IV (nonce). A 12-byte IV is recommended, but other lengths are
+ * supported as specified for GCM.
+ */
+void aes128_gcm_start(aes128_gcm_ctx_t * p_ctx, const aes128_gcm_key_t * p_key, const uint8_t * p_iv, size_t iv_len)
+{
+    uint8_t             lengths_block[AES_BLOCK_SIZE];
+
+    p_ctx->p_key = p_key;
+    memset(p_ctx->ghash, 0, AES_BLOCK_SIZE);
+    memset(p_ctx->ghash_block, 0, AES_BLOCK_SIZE);
+    p_ctx->aad_len = 0;
+    p_ctx->data_len = 0;
+    p_ctx->block_pos = 0;
+
+    /* Calculate the initial counter block J0. */
+    if (iv_len == AES128_GCM_IV_SIZE)
+    {
+        memcpy(p_ctx->counter, p_iv, AES128_GCM_IV_SIZE);
+        memset(p_ctx->counter + AES128_GCM_IV_SIZE, 0, AES128_GCM_COUNTER_SIZE - 1u);
+        p_ctx->counter[AES_BLOCK_SIZE - 1u] = 1u;
+    }
+    else
+    {
+        /* J0 = GHASH(IV || padding || 0^64 || [len(IV)]_64) */
+        aes128_gcm_ghash_absorb(p_ctx, p_iv, iv_len);
+        aes128_gcm_ghash_flush(p_ctx);
+        memset(lengths_block, 0, AES_BLOCK_SIZE / 2u);
+        aes128_gcm_store_be64(lengths_block + AES_BLOCK_SIZE / 2u, (uint64_t)iv_len * 8u);
+        aes128_gcm_ghash(p_key, p_ctx->ghash, lengths_block, 1u);
+        memcpy(p_ctx->counter, p_ctx->ghash, AES_BLOCK_SIZE);
+        memset(p_ctx->ghash, 0, AES_BLOCK_SIZE);
+    }
+
+    /* E(K, J0) is XORed with the final GHASH value to make the tag. */
+    memcpy(p_ctx->tag_mask, p_ctx->counter, AES_BLOCK_SIZE);
+    aes128_encrypt(p_ctx->tag_mask, p_key->key_schedule);
+    aes128_gcm_counter_inc(p_ctx->counter);
+}
+
+/*
+ * Add additional authenticated data (AAD).
+ *
+ * This can be called several times, but all AAD must be added before any
+ * data is encrypted or decrypted.
+ */
+void aes128_gcm_aad(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_aad, size_t aad_len)
+{
+    p_ctx->aad_len += aad_len;
+    aes128_gcm_ghash_absorb(p_ctx, p_aad, aad_len);
+}
+
+/*
+ * Encrypt data. This can be called several times, with any lengths.
+ *
+ * p_out and p_in may point to the same buffer, for in-place encryption.
+ */
+void aes128_gcm_encrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len)
+{
+    aes128_gcm_crypt_update(p_ctx, p_out, p_in, len, false);
+}
+
+/*
+ * Decrypt data. This can be called several times, with any lengths.
+ *
+ * p_out and p_in may point to the same buffer, for in-place decryption.
+ * Decrypted data must not be used until the tag has been verified by
+ * aes128_gcm_verify().
+ */
+void aes128_gcm_decrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len)
+{
+    aes128_gcm_crypt_update(p_ctx, p_out, p_in, len, true);
+}
+
+/*
+ * Finish an AES-128-GCM operation, and get the authentication tag.
+ *
+ * tag_len is the length of the tag to output, up to AES128_GCM_TAG_SIZE bytes.
+ */
+void aes128_gcm_finish(aes128_gcm_ctx_t * p_ctx, uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             lengths_block[AES_BLOCK_SIZE];
+
+    aes128_gcm_ghash_flush(p_ctx);
+    aes128_gcm_store_be64(lengths_block, p_ctx->aad_len * 8u);
+    aes128_gcm_store_be64(lengths_block + AES_BLOCK_SIZE / 2u, p_ctx->data_len * 8u);
+    aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, lengths_block, 1u);
+    aes_block_xor(p_ctx->ghash, p_ctx->tag_mask);
+
+    if (tag_len > AES128_GCM_TAG_SIZE)
+    {
+        tag_len = AES128_GCM_TAG_SIZE;
+    }
+    memcpy(p_tag, p_ctx->ghash, tag_len);
+}
+
+/*
+ * Finish an AES-128-GCM decryption operation, and check the authentication
+ * tag. The comparison is done in constant time.
+ *
+ * Returns true if the tag is correct.
+ */
+bool aes128_gcm_verify(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    uint8_t             diff = 0;
+    size_t              i;
+
+    if (tag_len == 0 || tag_len > AES128_GCM_TAG_SIZE)
+    {
+        return false;
+    }
+    aes128_gcm_finish(p_ctx, tag, tag_len);
+    for (i = 0; i < tag_len; i++)
+    {
+        diff |= tag[i] ^ p_tag[i];
+    }
+    return (diff == 0);
+}
+
+/*
+ * One-shot AES-128-GCM authenticated encryption.
+ */
+void aes128_gcm_seal(const aes128_gcm_key_t * p_key,
+                     const uint8_t * p_iv, size_t iv_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     uint8_t * p_tag, size_t tag_len)
+{
+    aes128_gcm_ctx_t    ctx;
+
+    aes128_gcm_start(&ctx, p_key, p_iv, iv_len);
+    aes128_gcm_aad(&ctx, p_aad, aad_len);
+    aes128_gcm_encrypt_update(&ctx, p_out, p_in, len);
+    aes128_gcm_finish(&ctx, p_tag, tag_len);
+}
+
+/*
+ * One-shot AES-128-GCM authenticated decryption.
+ *
+ * Returns true if the tag is correct. Otherwise, returns false and the
+ * output buffer is cleared.
+ */
+bool aes128_gcm_open(const aes128_gcm_key_t * p_key,
+                     const uint8_t * p_iv, size_t iv_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     const uint8_t * p_tag, size_t tag_len)
+{
+    aes128_gcm_ctx_t    ctx;
+
+    aes128_gcm_start(&ctx, p_key, p_iv, iv_len);
+    aes128_gcm_aad(&ctx, p_aad, aad_len);
+    aes128_gcm_decrypt_update(&ctx, p_out, p_in, len);
+    if (!aes128_gcm_verify(&ctx, p_tag, tag_len))
+    {
+        memset(p_out, 0, len);
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Start a GMAC calculation: GCM authentication of data, with nothing
+ * encrypted. The parameters are as for aes128_gcm_start().
+ */
+void aes128_gmac_start(aes128_gcm_ctx_t * p_ctx, const aes128_gcm_key_t * p_key, const uint8_t * p_iv, size_t iv_len)
+{
+    aes128_gcm_start(p_ctx, p_key, p_iv, iv_len);
+}
+
+/*
+ * Add data to be authenticated. This can be called several times, with any
+ * lengths. It is hashed as GCM AAD.
+ */
+void aes128_gmac_update(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_data, size_t len)
+{
+    aes128_gcm_aad(p_ctx, p_data, len);
+}
+
+/*
+ * Finish a GMAC calculation, and get the tag.
+ *
+ * tag_len is the length of the tag to output, up to AES128_GCM_TAG_SIZE bytes.
+ */
+void aes128_gmac_finish(aes128_gcm_ctx_t * p_ctx, uint8_t * p_tag, size_t tag_len)
+{
+    aes128_gcm_finish(p_ctx, p_tag, tag_len);
+}
+
+/*
+ * Finish a GMAC calculation, and check the tag in constant time.
+ *
+ * Returns true if the tag is correct.
+ */
+bool aes128_gmac_verify(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len)
+{
+    return aes128_gcm_verify(p_ctx, p_tag, tag_len);
+}
+
+/*
+ * One-shot GMAC.
+ */
+void aes128_gmac(const aes128_gcm_key_t * p_key,
+                 const uint8_t * p_iv, size_t iv_len,
+                 const uint8_t * p_data, size_t len,
+                 uint8_t * p_tag, size_t tag_len)
+{
+    aes128_gcm_ctx_t    ctx;
+
+    aes128_gcm_start(&ctx, p_key, p_iv, iv_len);
+    aes128_gcm_aad(&ctx, p_data, len);
+    aes128_gcm_finish(&ctx, p_tag, tag_len);
+}
+
+/*
+ * GMAC of num_msgs independent messages under one key.
+ *
+ * Message i is msg_lens[i] bytes at p_msgs[i], with the 12-byte IV at
+ * p_ivs + i * AES128_GCM_IV_SIZE, and its full AES128_GCM_TAG_SIZE-byte tag
+ * is written at p_tags + i * AES128_GCM_TAG_SIZE.
+ *
+ * The tag masks E(K, J0) of AES_PARALLEL_BLOCKS messages are encrypted
+ * together by the AES engine's encrypt_blocks(), rather than one at a time,
+ * then each message is hashed.
+ */
+void aes128_gmac_batch(const aes128_gcm_key_t * p_key, const uint8_t * p_ivs,
+                       const uint8_t * const p_msgs[], const size_t msg_lens[],
+                       uint8_t * p_tags, size_t num_msgs)
+{
+    const aes_engine_t * p_engine = aes_engine_current();
+    uint8_t             tag_masks[AES_PARALLEL_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t             tail[AES128_GMAC_TAIL_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t           * p_tag;
+    size_t              tail_blocks;
+    size_t              tail_len;
+    size_t              batch_msgs;
+    size_t              num_blocks;
+    size_t              partial_len;
+    size_t              i;
+
+    while (num_msgs)
+    {
+        batch_msgs = (num_msgs < AES_PARALLEL_BLOCKS) ? num_msgs : AES_PARALLEL_BLOCKS;
+        for (i = 0; i < batch_msgs; i++)
+        {
+            memcpy(&tag_masks[i * AES_BLOCK_SIZE], p_ivs + i * AES128_GCM_IV_SIZE, AES128_GCM_IV_SIZE);
+            memset(&tag_masks[i * AES_BLOCK_SIZE + AES128_GCM_IV_SIZE], 0, AES128_GCM_COUNTER_SIZE - 1u);
+            tag_masks[i * AES_BLOCK_SIZE + AES_BLOCK_SIZE - 1u] = 1u;
+        }
+        p_engine->encrypt_blocks(tag_masks, batch_msgs, p_key->key_schedule, AES128_NUM_ROUNDS);
+
+        for (i = 0; i < batch_msgs; i++)
+        {
+            /* The GHASH state is kept in the tag output. */
+            p_tag = p_tags + i * AES128_GCM_TAG_SIZE;
+            memset(p_tag, 0, AES128_GCM_TAG_SIZE);
+            num_blocks = msg_lens[i] / AES_BLOCK_SIZE;
+            partial_len = msg_lens[i] % AES_BLOCK_SIZE;
+
+            /* Copy the last few blocks, padded, and the lengths block, so a
+             * short message is hashed in one call. */
+            tail_blocks = (num_blocks < AES128_GMAC_TAIL_BLOCKS - 2u) ? num_blocks : AES128_GMAC_TAIL_BLOCKS - 2u;
+            num_blocks -= tail_blocks;
+            if (num_blocks)
+            {
+                aes128_gcm_ghash(p_key, p_tag, p_msgs[i], num_blocks);
+            }
+            tail_len = tail_blocks * AES_BLOCK_SIZE + partial_len;
+            if (tail_len)
+            {
+                memcpy(tail, p_msgs[i] + num_blocks * AES_BLOCK_SIZE, tail_len);
+            }
+            if (partial_len)
+            {
+                tail_blocks++;
+            }
+            memset(tail + tail_len, 0, (tail_blocks + 1u) * AES_BLOCK_SIZE - tail_len);
+            aes128_gcm_store_be64(&tail[tail_blocks * AES_BLOCK_SIZE], (uint64_t)msg_lens[i] * 8u);
+            tail_blocks++;
+            aes128_gcm_ghash(p_key, p_tag, tail, tail_blocks);
+            aes_block_xor(p_tag, &tag_masks[i * AES_BLOCK_SIZE]);
+        }
+        p_ivs += batch_msgs * AES128_GCM_IV_SIZE;
+        p_msgs += batch_msgs;
+        msg_lens += batch_msgs;
+        p_tags += batch_msgs * AES128_GCM_TAG_SIZE;
+        num_msgs -= batch_msgs;
+    }
+}
+
+#ifdef ENABLE_THREADS
+
+/*
+ * Multi-threaded one-shot AES-128-GCM authenticated encryption.
+ *
+ * Same as aes128_gcm_seal(), with the data split into chunks which are
+ * encrypted and hashed by the threads of p_pool, or of the built-in pool if
+ * p_pool is NULL. The GHASH values of the chunks are combined by multiplying
+ * by the power of H for the number of blocks that follow each chunk.
+ */
+void aes128_gcm_seal_parallel(aes_thread_pool_t * p_pool,
+                              const aes128_gcm_key_t * p_key,
+                              const uint8_t * p_iv, size_t iv_len,
+                              const uint8_t * p_aad, size_t aad_len,
+                              uint8_t * p_out, const uint8_t * p_in, size_t len,
+                              uint8_t * p_tag, size_t tag_len)
+{
+    aes128_gcm_ctx_t    ctx;
+
+    aes128_gcm_start(&ctx, p_key, p_iv, iv_len);
+    aes128_gcm_aad(&ctx, p_aad, aad_len);
+    aes128_gcm_crypt_parallel(p_pool, &ctx, p_out, p_in, len, false);
+    aes128_gcm_finish(&ctx, p_tag, tag_len);
+}
+
+/*
+ * Multi-threaded one-shot AES-128-GCM authenticated decryption.
+ *
+ * Same as aes128_gcm_open(), processed in parallel as for
+ * aes128_gcm_seal_parallel().
+ */
+bool aes128_gcm_open_parallel(aes_thread_pool_t * p_pool,
+                              const aes128_gcm_key_t * p_key,
+                              const uint8_t * p_iv, size_t iv_len,
+                              const uint8_t * p_aad, size_t aad_len,
+                              uint8_t * p_out, const uint8_t * p_in, size_t len,
+                              const uint8_t * p_tag, size_t tag_len)
+{
+    aes128_gcm_ctx_t    ctx;
+
+    aes128_gcm_start(&ctx, p_key, p_iv, iv_len);
+    aes128_gcm_aad(&ctx, p_aad, aad_len);
+    aes128_gcm_crypt_parallel(p_pool, &ctx, p_out, p_in, len, true);
+    if (!aes128_gcm_verify(&ctx, p_tag, tag_len))
+    {
+        memset(p_out, 0, len);
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * GHASH whole blocks into p_state, with the key's GHASH implementation.
+ */
+static void aes128_gcm_ghash(const aes128_gcm_key_t * p_key, uint8_t p_state[AES_BLOCK_SIZE], const uint8_t * p_data, size_t num_blocks)
+{
+    p_key->p_ghash_ops->mul_blocks(p_state, p_data, num_blocks, &p_key->ghash_key);
+}
+
+/*
+ * GHASH data of any length, buffering any partial block in ghash_block[].
+ */
+static void aes128_gcm_ghash_absorb(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_data, size_t len)
+{
+    size_t              num_blocks;
+
+    while (len && p_ctx->block_pos)
+    {
+        p_ctx->ghash_block[p_ctx->block_pos++] = *p_data++;
+        len--;
+        if (p_ctx->block_pos == AES_BLOCK_SIZE)
+        {
+            aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, p_ctx->ghash_block, 1u);
+            p_ctx->block_pos = 0;
+        }
+    }
+    num_blocks = len / AES_BLOCK_SIZE;
+    if (num_blocks)
+    {
+        aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, p_data, num_blocks);
+        p_data += num_blocks * AES_BLOCK_SIZE;
+        len -= num_blocks * AES_BLOCK_SIZE;
+    }
+    if (len)
+    {
+        memcpy(p_ctx->ghash_block, p_data, len);
+        p_ctx->block_pos = len;
+    }
+}
+
+/*
+ * GHASH any buffered partial block, padded with zeros.
+ */
+static void aes128_gcm_ghash_flush(aes128_gcm_ctx_t * p_ctx)
+{
+    if (p_ctx->block_pos)
+    {
+        memset(p_ctx->ghash_block + p_ctx->block_pos, 0, AES_BLOCK_SIZE - p_ctx->block_pos);
+        aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, p_ctx->ghash_block, 1u);
+        p_ctx->block_pos = 0;
+    }
+}
+
+/*
+ * Generate num_blocks blocks of CTR mode keystream.
+ */
+static void aes128_gcm_keystream(aes128_gcm_ctx_t * p_ctx, uint8_t * p_keystream, size_t num_blocks)
+{
+    while (num_blocks)
+    {
+        memcpy(p_keystream, p_ctx->counter, AES_BLOCK_SIZE);
+        aes128_encrypt(p_keystream, p_ctx->p_key->key_schedule);
+        aes128_gcm_counter_inc(p_ctx->counter);
+        p_keystream += AES_BLOCK_SIZE;
+        num_blocks--;
+    }
+}
+
+/*
+ * Encrypt or decrypt, and GHASH the ciphertext.
+ *
+ * Whole blocks are processed in chunks, in a single fused pass: CTR mode
+ * encrypt the chunk with aes128_ctr_xcrypt(), and GHASH the ciphertext while
+ * it is still in cache. For decryption, the ciphertext is hashed
+ * before it is decrypted, so in-place operation works.
+ */
+static void aes128_gcm_crypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len, bool is_decrypt)
+{
+    uint8_t             in_byte;
+    uint8_t             out_byte;
+    size_t              num_blocks;
+    uint32_t            counter;
+
+    /* AAD is padded to a whole block before the data. */
+    if (p_ctx->data_len == 0)
+    {
+        aes128_gcm_ghash_flush(p_ctx);
+    }
+    p_ctx->data_len += len;
+
+    for (;;)
+    {
+        /* Continue a partial block, from a previous call or the end of this
+         * one. */
+        while (len && p_ctx->block_pos)
+        {
+            in_byte = *p_in++;
+            out_byte = in_byte ^ p_ctx->keystream[p_ctx->block_pos];
+            *p_out++ = out_byte;
+            p_ctx->ghash_block[p_ctx->block_pos++] = is_decrypt ? in_byte : out_byte;
+            len--;
+            if (p_ctx->block_pos == AES_BLOCK_SIZE)
+            {
+                aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, p_ctx->ghash_block, 1u);
+                p_ctx->block_pos = 0;
+            }
+        }
+        if (len < AES_BLOCK_SIZE)
+        {
+            break;
+        }
+
+        /* Whole blocks */
+        num_blocks = len / AES_BLOCK_SIZE;
+        if (num_blocks > AES128_GCM_CHUNK_BLOCKS)
+        {
+            num_blocks = AES128_GCM_CHUNK_BLOCKS;
+        }
+        if (is_decrypt)
+        {
+            aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, p_in, num_blocks);
+        }
+        counter = aes128_ctr_xcrypt(p_ctx->p_key->key_schedule, p_ctx->counter,
+                                    aes128_gcm_load_be32(p_ctx->counter + AES128_GCM_IV_SIZE),
+                                    p_in, p_out, num_blocks * AES_BLOCK_SIZE);
+        aes128_gcm_store_be32(p_ctx->counter + AES128_GCM_IV_SIZE, counter);
+        if (!is_decrypt)
+        {
+            aes128_gcm_ghash(p_ctx->p_key, p_ctx->ghash, p_out, num_blocks);
+        }
+        p_in += num_blocks * AES_BLOCK_SIZE;
+        p_out += num_blocks * AES_BLOCK_SIZE;
+        len -= num_blocks * AES_BLOCK_SIZE;
+    }
+
+    /* Start a final partial block. */
+    if (len)
+    {
+        aes128_gcm_keystream(p_ctx, p_ctx->keystream, 1u);
+        while (len)
+        {
+            in_byte = *p_in++;
+            out_byte = in_byte ^ p_ctx->keystream[p_ctx->block_pos];
+            *p_out++ = out_byte;
+            p_ctx->ghash_block[p_ctx->block_pos++] = is_decrypt ? in_byte : out_byte;
+            len--;
+        }
+    }
+}
+
+#ifdef ENABLE_THREADS
+
+/*
+ * Encrypt or decrypt all the data of a GCM operation in parallel, and GHASH
+ * the ciphertext. All AAD must have been added. On return, p_ctx is ready for
+ * aes128_gcm_finish() or aes128_gcm_verify().
+ *
+ * With chunk GHASH values Y_i, each calculated from zero, and n_i blocks in
+ * chunk i, the GHASH state X is updated for each chunk in order by
+ *     X = X * H^n_i + Y_i
+ * All chunks but the last have the same number of blocks, so only two powers
+ * of H are needed.
+ */
+static void aes128_gcm_crypt_parallel(aes_thread_pool_t * p_pool, aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len, bool is_decrypt)
+{
+    uint8_t             chunk_ghash[AES_PARALLEL_MAX_CHUNKS][AES_BLOCK_SIZE];
+    uint8_t             power[AES_BLOCK_SIZE];
+    gcm_mul_ops_ctx_t   factor;
+    aes128_gcm_parallel_job_t job;
+    size_t              num_blocks;
+    size_t              num_chunks;
+    size_t              last_chunk_blocks;
+    size_t              i;
+
+    num_blocks = (len + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE;
+    if (num_blocks <= AES_PARALLEL_MIN_CHUNK_BLOCKS)
+    {
+        aes128_gcm_crypt_update(p_ctx, p_out, p_in, len, is_decrypt);
+        return;
+    }
+    if (p_pool == NULL)
+    {
+        p_pool = aes_thread_pool_default();
+    }
+
+    /* AAD is padded to a whole block before the data. */
+    aes128_gcm_ghash_flush(p_ctx);
+    p_ctx->data_len = len;
+
+    job.p_key = p_ctx->p_key;
+    job.p_counter = p_ctx->counter;
+    job.p_in = p_in;
+    job.p_out = p_out;
+    job.len = len;
+    job.chunk_blocks = aes_thread_pool_chunk_blocks(p_pool, num_blocks);
+    job.is_decrypt = is_decrypt;
+    job.p_chunk_ghash = chunk_ghash;
+    num_chunks = (num_blocks + job.chunk_blocks - 1u) / job.chunk_blocks;
+    aes_thread_pool_run(p_pool, aes128_gcm_parallel_task, &job, num_chunks);
+
+    /* Combine the chunk GHASH values. */
+    aes128_gcm_key_power(power, p_ctx->p_key, job.chunk_blocks);
+    p_ctx->p_key->p_ghash_ops->prepare(&factor, power);
+    for (i = 0; i < num_chunks - 1u; i++)
+    {
+        p_ctx->p_key->p_ghash_ops->mul(p_ctx->ghash, &factor);
+        aes_block_xor(p_ctx->ghash, chunk_ghash[i]);
+    }
+    last_chunk_blocks = num_blocks - (num_chunks - 1u) * job.chunk_blocks;
+    if (last_chunk_blocks != job.chunk_blocks)
+    {
+        aes128_gcm_key_power(power, p_ctx->p_key, last_chunk_blocks);
+        p_ctx->p_key->p_ghash_ops->prepare(&factor, power);
+    }
+    p_ctx->p_key->p_ghash_ops->mul(p_ctx->ghash, &factor);
+    aes_block_xor(p_ctx->ghash, chunk_ghash[num_chunks - 1u]);
+}
+
+/*
+ * Encrypt or decrypt one chunk, and calculate the GHASH of its ciphertext,
+ * with the final partial block of the last chunk padded with zeros.
+ */
+static void aes128_gcm_parallel_task(void * p_arg, size_t task_index)
+{
+    const aes128_gcm_parallel_job_t * p_job = p_arg;
+    aes128_gcm_ctx_t    ctx;
+    size_t              offset;
+    size_t              len;
+    uint32_t            counter;
+
+    offset = task_index * p_job->chunk_blocks * AES_BLOCK_SIZE;
+    len = p_job->len - offset;
+    if (len > p_job->chunk_blocks * AES_BLOCK_SIZE)
+    {
+        len = p_job->chunk_blocks * AES_BLOCK_SIZE;
+    }
+
+    ctx.p_key = p_job->p_key;
+    memcpy(ctx.counter, p_job->p_counter, AES_BLOCK_SIZE);
+    counter = aes128_gcm_load_be32(ctx.counter + AES128_GCM_IV_SIZE);
+    aes128_gcm_store_be32(ctx.counter + AES128_GCM_IV_SIZE, counter + (uint32_t)(task_index * p_job->chunk_blocks));
+    memset(ctx.ghash, 0, AES_BLOCK_SIZE);
+    ctx.aad_len = 0;
+    ctx.data_len = 0;
+    ctx.block_pos = 0;
+
+    aes128_gcm_crypt_update(&ctx, p_job->p_out + offset, p_job->p_in + offset, len, p_job->is_decrypt);
+    aes128_gcm_ghash_flush(&ctx);
+    memcpy(p_job->p_chunk_ghash[task_index], ctx.ghash, AES_BLOCK_SIZE);
+}
+
+/*
+ * Calculate H^exponent by square-and-multiply. H^0 is 1, which is the
+ * block 0x80, 0, ..., 0 in GCM bit order.
+ *
+ * The multiplies by H use the GHASH key data already prepared in p_key.
+ * The squares use a multiply which needs no table prepared from the value,
+ * if one is compiled in.
+ */
+static void aes128_gcm_key_power(uint8_t p_result[AES_BLOCK_SIZE], const aes128_gcm_key_t * p_key, size_t exponent)
+{
+#if defined(GCM_MUL_CLMUL)
+    gcm_mul_clmul_t     square;
+#elif defined(GCM_MUL_BIT_BY_BIT)
+    uint8_t             square[AES_BLOCK_SIZE];
+#else
+    gcm_mul_ops_ctx_t   square;
+#endif
+    size_t              bit;
+
+    memset(p_result, 0, AES_BLOCK_SIZE);
+    p_result[0] = 0x80u;
+    if (exponent == 0)
+    {
+        return;
+    }
+
+    for (bit = (size_t)1u << (sizeof(size_t) * 8u - 1u); (bit & exponent) == 0; bit >>= 1u)
+    {
+    }
+    p_key->p_ghash_ops->mul(p_result, &p_key->ghash_key);
+    for (bit >>= 1u; bit != 0; bit >>= 1u)
+    {
+#if defined(GCM_MUL_CLMUL)
+        gcm_mul_prepare_clmul(&square, p_result);
+        gcm_mul_clmul(p_result, &square);
+#elif defined(GCM_MUL_BIT_BY_BIT)
+        memcpy(square, p_result, AES_BLOCK_SIZE);
+        gcm_mul(p_result, square);
+#else
+        p_key->p_ghash_ops->prepare(&square, p_result);
+        p_key->p_ghash_ops->mul(p_result, &square);
+#endif
+        if (exponent & bit)
+        {
+            p_key->p_ghash_ops->mul(p_result, &p_key->ghash_key);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*****************************************************************************
+ * gcm.h
+ *
+ * AES-128-GCM authenticated encryption.
+ *
+ * Galois/Counter Mode combines CTR mode encryption with GHASH authentication.
+ * This provides a streaming interface (aes128_gcm_start(), aes128_gcm_aad(),
+ * aes128_gcm_encrypt_update() or aes128_gcm_decrypt_update(), then
+ * aes128_gcm_finish()) and one-shot aes128_gcm_seal() and aes128_gcm_open().
+ *
+ * GMAC, GCM authentication of data with nothing encrypted, is provided with
+ * the same shape (aes128_gmac_start(), aes128_gmac_update(),
+ * aes128_gmac_finish()), one-shot aes128_gmac(), and aes128_gmac_batch() for
+ * many independent messages under one key.
+ ****************************************************************************/
+
+#ifndef GCM_H
+#define GCM_H
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "aes-min.h"
+#include "gcm-mul-ops.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define AES128_GCM_IV_SIZE          12u
+#define AES128_GCM_TAG_SIZE         AES_BLOCK_SIZE
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Key data for AES-128-GCM: the expanded AES key schedule, the GHASH
+ * implementation chosen at run-time by gcm_mul_ops_select(), and the GHASH
+ * key data prepared for it.
+ * This is calculated once per key by aes128_gcm_init(), and is not modified
+ * by encryption or decryption, so it can be shared by several concurrent
+ * aes128_gcm_ctx_t.
+ */
+typedef struct
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    const gcm_mul_ops_t * p_ghash_ops;
+    gcm_mul_ops_ctx_t   ghash_key;
+} aes128_gcm_key_t;
+
+/*
+ * State of one AES-128-GCM encryption or decryption operation.
+ */
+typedef struct
+{
+    const aes128_gcm_key_t * p_key;
+    uint8_t             counter[AES_BLOCK_SIZE];
+    uint8_t             tag_mask[AES_BLOCK_SIZE];
+    uint8_t             ghash[AES_BLOCK_SIZE];
+    uint8_t             ghash_block[AES_BLOCK_SIZE];
+    uint8_t             keystream[AES_BLOCK_SIZE];
+    uint64_t            aad_len;
+    uint64_t            data_len;
+    uint_fast8_t        block_pos;
+} aes128_gcm_ctx_t;
+
+/*****************************************************************************
+ * Function prototypes
+ ****************************************************************************/
+
+void aes128_gcm_init(aes128_gcm_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE]);
+
+void aes128_gcm_start(aes128_gcm_ctx_t * p_ctx, const aes128_gcm_key_t * p_key, const uint8_t * p_iv, size_t iv_len);
+void aes128_gcm_aad(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_aad, size_t aad_len);
+void aes128_gcm_encrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len);
+void aes128_gcm_decrypt_update(aes128_gcm_ctx_t * p_ctx, uint8_t * p_out, const uint8_t * p_in, size_t len);
+void aes128_gcm_finish(aes128_gcm_ctx_t * p_ctx, uint8_t * p_tag, size_t tag_len);
+bool aes128_gcm_verify(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len);
+
+void aes128_gcm_seal(const aes128_gcm_key_t * p_key,
+                     const uint8_t * p_iv, size_t iv_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     uint8_t * p_tag, size_t tag_len);
+bool aes128_gcm_open(const aes128_gcm_key_t * p_key,
+                     const uint8_t * p_iv, size_t iv_len,
+                     const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len,
+                     const uint8_t * p_tag, size_t tag_len);
+
+void aes128_gmac_start(aes128_gcm_ctx_t * p_ctx, const aes128_gcm_key_t * p_key, const uint8_t * p_iv, size_t iv_len);
+void aes128_gmac_update(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_data, size_t len);
+void aes128_gmac_finish(aes128_gcm_ctx_t * p_ctx, uint8_t * p_tag, size_t tag_len);
+bool aes128_gmac_verify(aes128_gcm_ctx_t * p_ctx, const uint8_t * p_tag, size_t tag_len);
+
+void aes128_gmac(const aes128_gcm_key_t * p_key,
+                 const uint8_t * p_iv, size_t iv_len,
+                 const uint8_t * p_data, size_t len,
+                 uint8_t * p_tag, size_t tag_len);
+void aes128_gmac_batch(const aes128_gcm_key_t * p_key, const uint8_t * p_ivs,
+                       const uint8_t * const p_msgs[], const size_t msg_lens[],
+                       uint8_t * p_tags, size_t num_msgs);
+
+
+#endif /* !defined(GCM_H) */
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""
+Generate the 32-bit T-tables used by aes-ttable.c.
+
+Each table entry combines SubBytes and MixColumns (or InvSubBytes and
+InvMixColumns) for one byte position of a column. Words are big-endian, i.e.
+row 0 of the column is in the most-significant byte.
+"""
+
+def gmul(a, b):
+    result = 0
+    while a:
+        if a & 1:
+            result ^= b
+        a >>= 1
+        b <<= 1
+        if b & 0x100:
+            b ^= 0x11B
+    return result
+
+def ginv(a):
+    if a == 0:
+        return 0
+    for b in range(1, 256):
+        if gmul(a, b) == 1:
+            return b
+
+def rotl8(a, n):
+    return ((a << n) | (a >> (8 - n))) & 0xFF
+
+def sbox(a):
+    x = ginv(a)
+    return x ^ rotl8(x, 1) ^ rotl8(x, 2) ^ rotl8(x, 3) ^ rotl8(x, 4) ^ 0x63
+
+SBOX = [sbox(a) for a in range(256)]
+SBOX_INV = [0] * 256
+for a in range(256):
+    SBOX_INV[SBOX[a]] = a
+
+def ror32(a, n):
+    return ((a >> n) | (a << (32 - n))) & 0xFFFFFFFF
+
+def column_word(s, coefs):
+    result = 0
+    for c in coefs:
+        result = (result << 8) | gmul(c, s)
+    return result
+
+def print_table(name, values, fmt, per_line):
+    print('static const {} {}[256u] ='.format('uint32_t' if fmt == 8 else 'uint8_t', name))
+    print('{')
+    for i in range(0, 256, per_line):
+        suffix = 'u' if fmt == 8 else ''
+        line = ', '.join('0x{:0{}X}{}'.format(v, fmt, suffix) for v in values[i:i + per_line])
+        print('    ' + line + (',' if i + per_line < 256 else ''))
+    print('};')
+    print()
+
+te0 = [column_word(SBOX[a], (2, 1, 1, 3)) for a in range(256)]
+td0 = [column_word(SBOX_INV[a], (14, 9, 13, 11)) for a in range(256)]
+
+for i in range(4):
+    print_table('aes_te{}'.format(i), [ror32(v, 8 * i) for v in te0], 8, 8)
+for i in range(4):
+    print_table('aes_td{}'.format(i), [ror32(v, 8 * i) for v in td0], 8, 8)
+print_table('aes_td4', SBOX_INV, 2, 16)
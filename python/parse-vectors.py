@@ -62,7 +62,13 @@ def main():
     import os.path
     import sys
 
+    # Optional prefix for the generated C names, so that headers for several
+    # key sizes can be included in the same test program.
+    name_prefix = ''
     filenames = sys.argv[1:]
+    if filenames and filenames[0].startswith('--prefix='):
+        name_prefix = filenames[0][len('--prefix='):]
+        filenames = filenames[1:]
     vectors_list = []
     set_names = list(filenames)
     #set_names = [ '"', '\\', 'abc']
@@ -79,7 +85,7 @@ It is used by tests/aes-vectors-test.c.
 """.format(os.path.basename(sys.argv[0]), " ".join(sys.argv)))
     for test_data in files_vectors_iter(filenames):
         #pprint(test_data)
-        vector_prefix = "set{}count{}".format(test_data['set'], test_data['count'])
+        vector_prefix = "{}set{}count{}".format(name_prefix, test_data['set'], test_data['count'])
         for key in ('key', 'plain', 'cipher'):
             if key in test_data:
                 array_data = byte_string_to_c_array_init(test_data[key])
@@ -96,12 +102,12 @@ It is used by tests/aes-vectors-test.c.
         print("};\n")
         vectors_list.append(vector_prefix)
 
-    print("const vector_data_t * const test_vectors[] = {")
+    print("const vector_data_t * const {}test_vectors[] = {{".format(name_prefix))
     for vector_name in vectors_list:
         print("    &{},".format(vector_name))
     print("};\n")
 
-    print("const char * const set_names[] = {")
+    print("const char * const {}set_names[] = {{".format(name_prefix))
     for set_name in set_names:
         print('    {},'.format(c_escaped_string(set_name)))
     print("};\n")
@@ -0,0 +1,227 @@
+
+#include "aes-cbc.h"
+#include "aes-print-block.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define SP800_38A_NUM_BLOCKS    4u
+
+/* Enough for several batches of decrypted blocks plus a partial batch. */
+#define MAX_TEST_BLOCKS         37u
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* NIST SP 800-38A F.2.1 CBC-AES128.Encrypt */
+static const uint8_t sp800_38a_key[AES128_KEY_SIZE] =
+{
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t sp800_38a_iv[AES128_CBC_IV_SIZE] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t sp800_38a_plain[SP800_38A_NUM_BLOCKS * AES_BLOCK_SIZE] =
+{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t sp800_38a_cipher[SP800_38A_NUM_BLOCKS * AES_BLOCK_SIZE] =
+{
+    0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+    0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+    0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+    0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09, 0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static int sp800_38a_test(void)
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     data[SP800_38A_NUM_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t     iv[AES128_CBC_IV_SIZE];
+
+    aes128_key_schedule(key_schedule, sp800_38a_key);
+    aes128_key_schedule_decrypt(decrypt_key_schedule, sp800_38a_key);
+    memcpy(iv, sp800_38a_iv, sizeof(iv));
+    aes128_cbc_encrypt(key_schedule, iv, sp800_38a_plain, data, SP800_38A_NUM_BLOCKS);
+    if (memcmp(data, sp800_38a_cipher, sizeof(data)) != 0)
+    {
+        printf("CBC SP 800-38A encrypt failed\n");
+        print_block_hex(data, sizeof(data));
+        return 1;
+    }
+    if (memcmp(iv, &sp800_38a_cipher[sizeof(data) - AES_BLOCK_SIZE], sizeof(iv)) != 0)
+    {
+        printf("CBC SP 800-38A encrypt returned wrong IV\n");
+        return 1;
+    }
+
+    /* NIST SP 800-38A F.2.2 CBC-AES128.Decrypt, in-place. */
+    memcpy(iv, sp800_38a_iv, sizeof(iv));
+    aes128_cbc_decrypt(decrypt_key_schedule, iv, data, data, SP800_38A_NUM_BLOCKS);
+    if (memcmp(data, sp800_38a_plain, sizeof(data)) != 0)
+    {
+        printf("CBC SP 800-38A decrypt failed\n");
+        print_block_hex(data, sizeof(data));
+        return 1;
+    }
+    if (memcmp(iv, &sp800_38a_cipher[sizeof(data) - AES_BLOCK_SIZE], sizeof(iv)) != 0)
+    {
+        printf("CBC SP 800-38A decrypt returned wrong IV\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Compare aes128_decrypt_blocks() and aes128_decrypt_eqinv_blocks() with
+ * aes128_decrypt(), and aes128_cbc_encrypt() and aes128_cbc_decrypt() with
+ * CBC mode done one block at a time, for all lengths up to MAX_TEST_BLOCKS,
+ * in-place and not, and split into two calls.
+ */
+static int cbc_reference_test(void)
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     decrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     plain[MAX_TEST_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t     reference[MAX_TEST_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t     data[MAX_TEST_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t     out[MAX_TEST_BLOCKS * AES_BLOCK_SIZE];
+    uint8_t     block[AES_BLOCK_SIZE];
+    uint8_t     iv[AES128_CBC_IV_SIZE];
+    size_t      num_blocks;
+    size_t      split;
+    size_t      i;
+
+    aes128_key_schedule(key_schedule, sp800_38a_key);
+    aes128_key_schedule_decrypt(decrypt_key_schedule, sp800_38a_key);
+    for (i = 0; i < sizeof(plain); i++)
+    {
+        plain[i] = i * 13u + 5u;
+    }
+    memcpy(block, sp800_38a_iv, AES_BLOCK_SIZE);
+    for (i = 0; i < MAX_TEST_BLOCKS; i++)
+    {
+        aes_block_xor(block, &plain[i * AES_BLOCK_SIZE]);
+        aes128_encrypt(block, key_schedule);
+        memcpy(&reference[i * AES_BLOCK_SIZE], block, AES_BLOCK_SIZE);
+    }
+    /* Check the reference decrypts with aes128_decrypt(), block by block. */
+    memcpy(data, reference, sizeof(data));
+    for (i = MAX_TEST_BLOCKS; i-- > 0; )
+    {
+        aes128_decrypt(&data[i * AES_BLOCK_SIZE], key_schedule);
+        aes_block_xor(&data[i * AES_BLOCK_SIZE], (i == 0) ? sp800_38a_iv : &reference[(i - 1u) * AES_BLOCK_SIZE]);
+    }
+    if (memcmp(data, plain, sizeof(data)) != 0)
+    {
+        printf("CBC reference decrypt failed\n");
+        return 1;
+    }
+
+    /* The multi-block decryptions, for all numbers of blocks. */
+    for (num_blocks = 0; num_blocks <= MAX_TEST_BLOCKS; num_blocks++)
+    {
+        memcpy(data, reference, sizeof(data));
+        aes128_decrypt_blocks(data, num_blocks, key_schedule);
+        memcpy(out, reference, sizeof(out));
+        aes128_decrypt_eqinv_blocks(out, num_blocks, decrypt_key_schedule);
+        for (i = 0; i < num_blocks; i++)
+        {
+            memcpy(block, &reference[i * AES_BLOCK_SIZE], AES_BLOCK_SIZE);
+            aes128_decrypt(block, key_schedule);
+            if (memcmp(block, &data[i * AES_BLOCK_SIZE], AES_BLOCK_SIZE) != 0
+                || memcmp(block, &out[i * AES_BLOCK_SIZE], AES_BLOCK_SIZE) != 0)
+            {
+                printf("Multi-block decrypt failed, block %zu of %zu\n", i, num_blocks);
+                return 1;
+            }
+        }
+        if (memcmp(&data[num_blocks * AES_BLOCK_SIZE], &reference[num_blocks * AES_BLOCK_SIZE], sizeof(data) - num_blocks * AES_BLOCK_SIZE) != 0
+            || memcmp(&out[num_blocks * AES_BLOCK_SIZE], &reference[num_blocks * AES_BLOCK_SIZE], sizeof(out) - num_blocks * AES_BLOCK_SIZE) != 0)
+        {
+            printf("Multi-block decrypt of %zu blocks changed following data\n", num_blocks);
+            return 1;
+        }
+    }
+
+    for (num_blocks = 0; num_blocks <= MAX_TEST_BLOCKS; num_blocks++)
+    {
+        for (split = 0; split <= num_blocks; split += (num_blocks / 3u) + 1u)
+        {
+            memcpy(iv, sp800_38a_iv, sizeof(iv));
+            aes128_cbc_encrypt(key_schedule, iv, plain, out, split);
+            aes128_cbc_encrypt(key_schedule, iv, plain + split * AES_BLOCK_SIZE, out + split * AES_BLOCK_SIZE, num_blocks - split);
+            if (memcmp(out, reference, num_blocks * AES_BLOCK_SIZE) != 0)
+            {
+                printf("CBC encrypt failed, %zu blocks split at %zu\n", num_blocks, split);
+                print_block_hex(out, num_blocks * AES_BLOCK_SIZE);
+                return 1;
+            }
+
+            memcpy(iv, sp800_38a_iv, sizeof(iv));
+            aes128_cbc_decrypt(decrypt_key_schedule, iv, reference, out, split);
+            aes128_cbc_decrypt(decrypt_key_schedule, iv, reference + split * AES_BLOCK_SIZE, out + split * AES_BLOCK_SIZE, num_blocks - split);
+            if (memcmp(out, plain, num_blocks * AES_BLOCK_SIZE) != 0)
+            {
+                printf("CBC decrypt failed, %zu blocks split at %zu\n", num_blocks, split);
+                print_block_hex(out, num_blocks * AES_BLOCK_SIZE);
+                return 1;
+            }
+
+            memcpy(iv, sp800_38a_iv, sizeof(iv));
+            memcpy(data, reference, sizeof(data));
+            aes128_cbc_decrypt(decrypt_key_schedule, iv, data, data, split);
+            aes128_cbc_decrypt(decrypt_key_schedule, iv, data + split * AES_BLOCK_SIZE, data + split * AES_BLOCK_SIZE, num_blocks - split);
+            if (memcmp(data, plain, num_blocks * AES_BLOCK_SIZE) != 0
+                || (num_blocks > 0 && memcmp(iv, &reference[(num_blocks - 1u) * AES_BLOCK_SIZE], sizeof(iv)) != 0))
+            {
+                printf("CBC in-place decrypt failed, %zu blocks split at %zu\n", num_blocks, split);
+                print_block_hex(data, num_blocks * AES_BLOCK_SIZE);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    const aes_engine_t * p_engine;
+    size_t      engine;
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    for (engine = 0; (p_engine = aes_engine_get(engine)) != NULL; engine++)
+    {
+        aes_engine_set(p_engine);
+
+        result = sp800_38a_test();
+        if (result == 0)
+            result = cbc_reference_test();
+        if (result)
+        {
+            printf("Failed with AES engine %s\n", p_engine->name);
+            return result;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,777 @@
+#include "aes-ccm.h"
+#include "aes-print-block.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define MAX_MSG_SIZE            48u
+#define MAX_AAD_SIZE            20u
+
+/* Associated data of NIST SP 800-38C example 4: bytes 0x00 to 0xFF
+ * repeated. It is long enough for the 0xFF 0xFE length encoding. */
+#define LONG_AAD_SIZE           65536u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+typedef struct
+{
+    uint8_t             key[AES128_KEY_SIZE];
+    size_t              nonce_len;
+    uint8_t             nonce[AES128_CCM_NONCE_MAX_SIZE];
+    size_t              aad_len;
+    uint8_t             aad[MAX_AAD_SIZE];
+    size_t              len;
+    uint8_t             plain[MAX_MSG_SIZE];
+    uint8_t             cipher[MAX_MSG_SIZE];
+    size_t              tag_len;
+    uint8_t             tag[AES128_CCM_TAG_MAX_SIZE];
+} ccm_vector_t;
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+static const ccm_vector_t ccm_vectors[] =
+{
+    /* RFC 3610 packet vector #1 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        23u,
+        {
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e
+        },
+        {
+            0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80,
+            0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84
+        },
+        8u,
+        {
+            0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0
+        }
+    },
+    /* RFC 3610 packet vector #2 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x04, 0x03, 0x02, 0x01, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        24u,
+        {
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+        },
+        {
+            0x72, 0xc9, 0x1a, 0x36, 0xe1, 0x35, 0xf8, 0xcf, 0x29, 0x1c, 0xa8, 0x94, 0x08, 0x5c, 0x87, 0xe3,
+            0xcc, 0x15, 0xc4, 0x39, 0xc9, 0xe4, 0x3a, 0x3b
+        },
+        8u,
+        {
+            0xa0, 0x91, 0xd5, 0x6e, 0x10, 0x40, 0x09, 0x16
+        }
+    },
+    /* RFC 3610 packet vector #3 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x05, 0x04, 0x03, 0x02, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        25u,
+        {
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20
+        },
+        {
+            0x51, 0xb1, 0xe5, 0xf4, 0x4a, 0x19, 0x7d, 0x1d, 0xa4, 0x6b, 0x0f, 0x8e, 0x2d, 0x28, 0x2a, 0xe8,
+            0x71, 0xe8, 0x38, 0xbb, 0x64, 0xda, 0x85, 0x96, 0x57
+        },
+        8u,
+        {
+            0x4a, 0xda, 0xa7, 0x6f, 0xbd, 0x9f, 0xb0, 0xc5
+        }
+    },
+    /* RFC 3610 packet vector #4 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x06, 0x05, 0x04, 0x03, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        12u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b
+        },
+        19u,
+        {
+            0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+            0x1c, 0x1d, 0x1e
+        },
+        {
+            0xa2, 0x8c, 0x68, 0x65, 0x93, 0x9a, 0x9a, 0x79, 0xfa, 0xaa, 0x5c, 0x4c, 0x2a, 0x9d, 0x4a, 0x91,
+            0xcd, 0xac, 0x8c
+        },
+        8u,
+        {
+            0x96, 0xc8, 0x61, 0xb9, 0xc9, 0xe6, 0x1e, 0xf1
+        }
+    },
+    /* RFC 3610 packet vector #5 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x07, 0x06, 0x05, 0x04, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        12u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b
+        },
+        20u,
+        {
+            0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+            0x1c, 0x1d, 0x1e, 0x1f
+        },
+        {
+            0xdc, 0xf1, 0xfb, 0x7b, 0x5d, 0x9e, 0x23, 0xfb, 0x9d, 0x4e, 0x13, 0x12, 0x53, 0x65, 0x8a, 0xd8,
+            0x6e, 0xbd, 0xca, 0x3e
+        },
+        8u,
+        {
+            0x51, 0xe8, 0x3f, 0x07, 0x7d, 0x9c, 0x2d, 0x93
+        }
+    },
+    /* RFC 3610 packet vector #6 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x08, 0x07, 0x06, 0x05, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        12u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b
+        },
+        21u,
+        {
+            0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+            0x1c, 0x1d, 0x1e, 0x1f, 0x20
+        },
+        {
+            0x6f, 0xc1, 0xb0, 0x11, 0xf0, 0x06, 0x56, 0x8b, 0x51, 0x71, 0xa4, 0x2d, 0x95, 0x3d, 0x46, 0x9b,
+            0x25, 0x70, 0xa4, 0xbd, 0x87
+        },
+        8u,
+        {
+            0x40, 0x5a, 0x04, 0x43, 0xac, 0x91, 0xcb, 0x94
+        }
+    },
+    /* RFC 3610 packet vector #7 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x09, 0x08, 0x07, 0x06, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        23u,
+        {
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e
+        },
+        {
+            0x01, 0x35, 0xd1, 0xb2, 0xc9, 0x5f, 0x41, 0xd5, 0xd1, 0xd4, 0xfe, 0xc1, 0x85, 0xd1, 0x66, 0xb8,
+            0x09, 0x4e, 0x99, 0x9d, 0xfe, 0xd9, 0x6c
+        },
+        10u,
+        {
+            0x04, 0x8c, 0x56, 0x60, 0x2c, 0x97, 0xac, 0xbb, 0x74, 0x90
+        }
+    },
+    /* RFC 3610 packet vector #8 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x0a, 0x09, 0x08, 0x07, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        24u,
+        {
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+        },
+        {
+            0x7b, 0x75, 0x39, 0x9a, 0xc0, 0x83, 0x1d, 0xd2, 0xf0, 0xbb, 0xd7, 0x58, 0x79, 0xa2, 0xfd, 0x8f,
+            0x6c, 0xae, 0x6b, 0x6c, 0xd9, 0xb7, 0xdb, 0x24
+        },
+        10u,
+        {
+            0xc1, 0x7b, 0x44, 0x33, 0xf4, 0x34, 0x96, 0x3f, 0x34, 0xb4
+        }
+    },
+    /* RFC 3610 packet vector #9 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x0b, 0x0a, 0x09, 0x08, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        25u,
+        {
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+            0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20
+        },
+        {
+            0x82, 0x53, 0x1a, 0x60, 0xcc, 0x24, 0x94, 0x5a, 0x4b, 0x82, 0x79, 0x18, 0x1a, 0xb5, 0xc8, 0x4d,
+            0xf2, 0x1c, 0xe7, 0xf9, 0xb7, 0x3f, 0x42, 0xe1, 0x97
+        },
+        10u,
+        {
+            0xea, 0x9c, 0x07, 0xe5, 0x6b, 0x5e, 0xb1, 0x7e, 0x5f, 0x4e
+        }
+    },
+    /* RFC 3610 packet vector #10 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x0c, 0x0b, 0x0a, 0x09, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        12u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b
+        },
+        19u,
+        {
+            0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+            0x1c, 0x1d, 0x1e
+        },
+        {
+            0x07, 0x34, 0x25, 0x94, 0x15, 0x77, 0x85, 0x15, 0x2b, 0x07, 0x40, 0x98, 0x33, 0x0a, 0xbb, 0x14,
+            0x1b, 0x94, 0x7b
+        },
+        10u,
+        {
+            0x56, 0x6a, 0xa9, 0x40, 0x6b, 0x4d, 0x99, 0x99, 0x88, 0xdd
+        }
+    },
+    /* RFC 3610 packet vector #11 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x0d, 0x0c, 0x0b, 0x0a, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        12u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b
+        },
+        20u,
+        {
+            0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+            0x1c, 0x1d, 0x1e, 0x1f
+        },
+        {
+            0x67, 0x6b, 0xb2, 0x03, 0x80, 0xb0, 0xe3, 0x01, 0xe8, 0xab, 0x79, 0x59, 0x0a, 0x39, 0x6d, 0xa7,
+            0x8b, 0x83, 0x49, 0x34
+        },
+        10u,
+        {
+            0xf5, 0x3a, 0xa2, 0xe9, 0x10, 0x7a, 0x8b, 0x6c, 0x02, 0x2c
+        }
+    },
+    /* RFC 3610 packet vector #12 */
+    {
+        {
+            0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf
+        },
+        13u,
+        {
+            0x00, 0x00, 0x00, 0x0e, 0x0d, 0x0c, 0x0b, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+        },
+        12u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b
+        },
+        21u,
+        {
+            0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+            0x1c, 0x1d, 0x1e, 0x1f, 0x20
+        },
+        {
+            0xc0, 0xff, 0xa0, 0xd6, 0xf0, 0x5b, 0xdb, 0x67, 0xf2, 0x4d, 0x43, 0xa4, 0x33, 0x8d, 0x2a, 0xa4,
+            0xbe, 0xd7, 0xb2, 0x0e, 0x43
+        },
+        10u,
+        {
+            0xcd, 0x1a, 0xa3, 0x16, 0x62, 0xe7, 0xad, 0x65, 0xd6, 0xdb
+        }
+    },
+    /* NIST SP 800-38C example 1 */
+    {
+        {
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f
+        },
+        7u,
+        {
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16
+        },
+        8u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07
+        },
+        4u,
+        {
+            0x20, 0x21, 0x22, 0x23
+        },
+        {
+            0x71, 0x62, 0x01, 0x5b
+        },
+        4u,
+        {
+            0x4d, 0xac, 0x25, 0x5d
+        }
+    },
+    /* NIST SP 800-38C example 2 */
+    {
+        {
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f
+        },
+        8u,
+        {
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17
+        },
+        16u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        },
+        16u,
+        {
+            0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f
+        },
+        {
+            0xd2, 0xa1, 0xf0, 0xe0, 0x51, 0xea, 0x5f, 0x62, 0x08, 0x1a, 0x77, 0x92, 0x07, 0x3d, 0x59, 0x3d
+        },
+        6u,
+        {
+            0x1f, 0xc6, 0x4f, 0xbf, 0xac, 0xcd
+        }
+    },
+    /* NIST SP 800-38C example 3 */
+    {
+        {
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f
+        },
+        12u,
+        {
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b
+        },
+        20u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x10, 0x11, 0x12, 0x13
+        },
+        24u,
+        {
+            0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37
+        },
+        {
+            0xe3, 0xb2, 0x01, 0xa9, 0xf5, 0xb7, 0x1a, 0x7a, 0x9b, 0x1c, 0xea, 0xec, 0xcd, 0x97, 0xe7, 0x0b,
+            0x61, 0x76, 0xaa, 0xd9, 0xa4, 0x42, 0x8a, 0xa5
+        },
+        8u,
+        {
+            0x48, 0x43, 0x92, 0xfb, 0xc1, 0xb0, 0x99, 0x51
+        }
+    },
+    /* NIST SP 800-38C example 4 */
+    {
+        {
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f
+        },
+        13u,
+        {
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c
+        },
+        65536u,
+        { 0 },                      /* In ccm_long_aad[] */
+        32u,
+        {
+            0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f
+        },
+        {
+            0x69, 0x91, 0x5d, 0xad, 0x1e, 0x84, 0xc6, 0x37, 0x6a, 0x68, 0xc2, 0x96, 0x7e, 0x4d, 0xab, 0x61,
+            0x5a, 0xe0, 0xfd, 0x1f, 0xae, 0xc4, 0x4c, 0xc4, 0x84, 0x82, 0x85, 0x29, 0x46, 0x3c, 0xcf, 0x72
+        },
+        14u,
+        {
+            0xb4, 0xac, 0x6b, 0xec, 0x93, 0xe8, 0x59, 0x8e, 0x7f, 0x0d, 0xad, 0xbc, 0xea, 0x5b
+        }
+    },
+    /* Generated with OpenSSL: no payload, and a 16-byte tag. */
+    {
+        {
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f
+        },
+        13u,
+        {
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c
+        },
+        0u,
+        { 0 },
+        0u,
+        { 0 },
+        { 0 },
+        16u,
+        {
+            0x32, 0xd6, 0xf8, 0x24, 0x3a, 0x26, 0xd0, 0xbd, 0x98, 0xd0, 0x1b, 0x0f, 0x44, 0x8e, 0x77, 0x73
+        }
+    },
+    /* Generated with OpenSSL: 11-byte nonce, 1 byte of associated data. */
+    {
+        {
+            0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f
+        },
+        11u,
+        {
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a
+        },
+        1u,
+        {
+            0x00
+        },
+        17u,
+        {
+            0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+            0x30
+        },
+        {
+            0xd6, 0xd2, 0x8b, 0x1b, 0x24, 0xb8, 0x5b, 0x4f, 0xfb, 0xe0, 0x99, 0x88, 0x09, 0xda, 0xb6, 0x2e,
+            0x35
+        },
+        4u,
+        {
+            0xcb, 0x5c, 0x47, 0xdd
+        }
+    }
+};
+
+/*****************************************************************************
+ * Local variables
+ ****************************************************************************/
+
+static uint8_t ccm_long_aad[LONG_AAD_SIZE];
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Key, nonce and plain text for the tests which aren't from vectors, as in
+ * the NIST SP 800-38C examples. */
+static void test_data_init(uint8_t p_key[AES128_KEY_SIZE], uint8_t p_nonce[AES128_CCM_NONCE_MAX_SIZE],
+                           uint8_t p_pt[MAX_MSG_SIZE])
+{
+    size_t              i;
+
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+    {
+        p_key[i] = 0x40u + i;
+    }
+    for (i = 0; i < AES128_CCM_NONCE_MAX_SIZE; i++)
+    {
+        p_nonce[i] = 0x10u + i;
+    }
+    for (i = 0; i < MAX_MSG_SIZE; i++)
+    {
+        p_pt[i] = 0x20u + i;
+    }
+}
+
+/* Seal with the key schedule form, or the on-the-fly key schedule form. */
+static bool ccm_seal(bool is_otfks, const uint8_t p_key[AES128_KEY_SIZE],
+                     const uint8_t * p_nonce, size_t nonce_len, const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len, uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+
+    if (is_otfks)
+    {
+        return aes128_otfks_ccm_seal(p_key, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+    }
+    aes128_key_schedule(key_schedule, p_key);
+    return aes128_ccm_seal(key_schedule, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+}
+
+static bool ccm_open(bool is_otfks, const uint8_t p_key[AES128_KEY_SIZE],
+                     const uint8_t * p_nonce, size_t nonce_len, const uint8_t * p_aad, size_t aad_len,
+                     uint8_t * p_out, const uint8_t * p_in, size_t len, const uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+
+    if (is_otfks)
+    {
+        return aes128_otfks_ccm_open(p_key, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+    }
+    aes128_key_schedule(key_schedule, p_key);
+    return aes128_ccm_open(key_schedule, p_nonce, nonce_len, p_aad, aad_len, p_out, p_in, len, p_tag, tag_len);
+}
+
+/*
+ * Seal and open a vector, in-place and not, and check that a wrong tag is
+ * rejected with the output cleared.
+ */
+static int vector_check(const char * p_name, bool is_otfks, const uint8_t p_key[AES128_KEY_SIZE],
+                        const uint8_t * p_nonce, size_t nonce_len, const uint8_t * p_aad, size_t aad_len,
+                        const uint8_t * p_pt, const uint8_t * p_ct, size_t len,
+                        const uint8_t * p_tag, size_t tag_len)
+{
+    uint8_t             out[MAX_MSG_SIZE];
+    uint8_t             tag[AES128_CCM_TAG_MAX_SIZE];
+    uint8_t             zero[MAX_MSG_SIZE] = { 0 };
+
+    memset(tag, 0, sizeof(tag));
+    if (!ccm_seal(is_otfks, p_key, p_nonce, nonce_len, p_aad, aad_len, out, p_pt, len, tag, tag_len)
+        || (len && memcmp(out, p_ct, len) != 0) || memcmp(tag, p_tag, tag_len) != 0)
+    {
+        printf("CCM %s seal failed%s\n", p_name, is_otfks ? " (OTFKS)" : "");
+        print_block_hex(out, len);
+        print_block_hex(tag, tag_len);
+        return 1;
+    }
+
+    memcpy(out, p_pt, len);
+    if (!ccm_seal(is_otfks, p_key, p_nonce, nonce_len, p_aad, aad_len, out, out, len, tag, tag_len)
+        || (len && memcmp(out, p_ct, len) != 0))
+    {
+        printf("CCM %s in-place seal failed%s\n", p_name, is_otfks ? " (OTFKS)" : "");
+        return 1;
+    }
+    if (!ccm_open(is_otfks, p_key, p_nonce, nonce_len, p_aad, aad_len, out, out, len, p_tag, tag_len)
+        || (len && memcmp(out, p_pt, len) != 0))
+    {
+        printf("CCM %s open failed%s\n", p_name, is_otfks ? " (OTFKS)" : "");
+        print_block_hex(out, len);
+        return 1;
+    }
+
+    memcpy(tag, p_tag, tag_len);
+    tag[tag_len - 1u] ^= 0x80u;
+    memset(out, 0xAAu, sizeof(out));
+    if (ccm_open(is_otfks, p_key, p_nonce, nonce_len, p_aad, aad_len, out, p_ct, len, tag, tag_len)
+        || memcmp(out, zero, len) != 0)
+    {
+        printf("CCM %s open accepted a wrong tag%s\n", p_name, is_otfks ? " (OTFKS)" : "");
+        return 1;
+    }
+    return 0;
+}
+
+static int vectors_test(bool is_otfks)
+{
+    const ccm_vector_t * p_vector;
+    const uint8_t     * p_aad;
+    char                name[32];
+    size_t              i;
+    int                 result;
+
+    for (i = 0; i < sizeof(ccm_vectors) / sizeof(ccm_vectors[0]); i++)
+    {
+        p_vector = &ccm_vectors[i];
+        p_aad = (p_vector->aad_len > MAX_AAD_SIZE) ? ccm_long_aad : p_vector->aad;
+        snprintf(name, sizeof(name), "vector %zu", i);
+        result = vector_check(name, is_otfks, p_vector->key, p_vector->nonce, p_vector->nonce_len,
+                              p_aad, p_vector->aad_len, p_vector->plain, p_vector->cipher, p_vector->len,
+                              p_vector->tag, p_vector->tag_len);
+        if (result)
+        {
+            return result;
+        }
+    }
+    return 0;
+}
+
+/*
+ * The two forms agree for all lengths around the block size, and CCM* with
+ * no tag gives the same cipher text as with a tag, since only B0 differs.
+ */
+static int lengths_test(void)
+{
+    uint8_t             key[AES128_KEY_SIZE];
+    uint8_t             nonce[AES128_CCM_NONCE_MAX_SIZE];
+    uint8_t             pt[MAX_MSG_SIZE];
+    uint8_t             out[MAX_MSG_SIZE];
+    uint8_t             out_otfks[MAX_MSG_SIZE];
+    uint8_t             tag[AES128_CCM_TAG_MAX_SIZE];
+    uint8_t             tag_otfks[AES128_CCM_TAG_MAX_SIZE];
+    size_t              len;
+    size_t              aad_len;
+
+    test_data_init(key, nonce, pt);
+    for (len = 0; len <= MAX_MSG_SIZE; len++)
+    {
+        for (aad_len = 0; aad_len <= 40u; aad_len += 5u)
+        {
+            ccm_seal(false, key, nonce, 10u, ccm_long_aad, aad_len, out, pt, len, tag, 12u);
+            ccm_seal(true, key, nonce, 10u, ccm_long_aad, aad_len, out_otfks, pt, len, tag_otfks, 12u);
+            if (memcmp(out, out_otfks, len) != 0 || memcmp(tag, tag_otfks, 12u) != 0)
+            {
+                printf("CCM length %zu, AAD %zu: forms differ\n", len, aad_len);
+                return 1;
+            }
+            if (!ccm_seal(false, key, nonce, 10u, ccm_long_aad, aad_len, out_otfks, pt, len, NULL, 0)
+                || memcmp(out, out_otfks, len) != 0
+                || !ccm_open(true, key, nonce, 10u, ccm_long_aad, aad_len, out_otfks, out_otfks, len, NULL, 0)
+                || memcmp(out_otfks, pt, len) != 0)
+            {
+                printf("CCM* length %zu, AAD %zu failed\n", len, aad_len);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Invalid nonce and tag sizes, and a message too long for its length field. */
+static int params_test(void)
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t             key[AES128_KEY_SIZE];
+    uint8_t             nonce[AES128_CCM_NONCE_MAX_SIZE + 1u];
+    uint8_t             pt[MAX_MSG_SIZE];
+    uint8_t           * p_big;
+    uint8_t             tag[AES128_CCM_TAG_MAX_SIZE + 2u];
+    size_t              big_len = 0x10000u;
+    bool                is_ok;
+
+    test_data_init(key, nonce, pt);
+    aes128_key_schedule(key_schedule, key);
+    if (aes128_ccm_seal(key_schedule, nonce, 6u, NULL, 0, pt, pt, 16u, tag, 8u)
+        || aes128_ccm_seal(key_schedule, nonce, 14u, NULL, 0, pt, pt, 16u, tag, 8u)
+        || aes128_ccm_seal(key_schedule, nonce, 13u, NULL, 0, pt, pt, 16u, tag, 2u)
+        || aes128_ccm_seal(key_schedule, nonce, 13u, NULL, 0, pt, pt, 16u, tag, 5u)
+        || aes128_ccm_seal(key_schedule, nonce, 13u, NULL, 0, pt, pt, 16u, tag, 18u)
+        || aes128_otfks_ccm_open(key, nonce, 14u, NULL, 0, pt, pt, 16u, tag, 8u))
+    {
+        printf("CCM invalid sizes accepted\n");
+        return 1;
+    }
+
+    p_big = calloc(big_len, 1u);
+    if (p_big == NULL)
+    {
+        return 1;
+    }
+    /* 65536 bytes don't fit in 2 bytes with a 13-byte nonce, but do in 3. */
+    is_ok = !aes128_ccm_seal(key_schedule, nonce, 13u, NULL, 0, p_big, p_big, big_len, tag, 8u)
+            && aes128_ccm_seal(key_schedule, nonce, 12u, NULL, 0, p_big, p_big, big_len, tag, 8u)
+            && aes128_ccm_open(key_schedule, nonce, 12u, NULL, 0, p_big, p_big, big_len, tag, 8u)
+            && p_big[0] == 0 && p_big[big_len - 1u] == 0;
+    free(p_big);
+    if (!is_ok)
+    {
+        printf("CCM message length limit failed\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    const aes_engine_t * p_engine;
+    size_t      engine;
+    size_t      i;
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    for (i = 0; i < LONG_AAD_SIZE; i++)
+    {
+        ccm_long_aad[i] = (uint8_t)i;
+    }
+
+    result = vectors_test(true);
+    if (result == 0)
+        result = params_test();
+    if (result)
+    {
+        return result;
+    }
+
+    for (engine = 0; (p_engine = aes_engine_get(engine)) != NULL; engine++)
+    {
+        aes_engine_set(p_engine);
+
+        result = vectors_test(false);
+        if (result == 0)
+            result = lengths_test();
+        if (result)
+        {
+            printf("Failed with AES engine %s\n", p_engine->name);
+            return result;
+        }
+    }
+    return 0;
+}
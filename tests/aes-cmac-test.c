@@ -0,0 +1,204 @@
+
+#include "aes-cmac.h"
+#include "aes-print-block.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define MAX_MSG_SIZE            64u
+
+#define BATCH_NUM_MSGS          75u
+#define BATCH_DATA_SIZE         (BATCH_NUM_MSGS + 40u)
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+typedef struct
+{
+    size_t              len;
+    uint8_t             tag[AES128_CMAC_TAG_SIZE];
+} cmac_vector_t;
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* RFC 4493 section 4 */
+static const uint8_t cmac_key[AES128_KEY_SIZE] =
+{
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t cmac_k1[AES_BLOCK_SIZE] =
+{
+    0xfb, 0xee, 0xd6, 0x18, 0x35, 0x71, 0x33, 0x66, 0x7c, 0x85, 0xe0, 0x8f, 0x72, 0x36, 0xa8, 0xde
+};
+
+static const uint8_t cmac_k2[AES_BLOCK_SIZE] =
+{
+    0xf7, 0xdd, 0xac, 0x30, 0x6a, 0xe2, 0x66, 0xcc, 0xf9, 0x0b, 0xc1, 0x1e, 0xe4, 0x6d, 0x51, 0x3b
+};
+
+static const uint8_t cmac_msg[MAX_MSG_SIZE] =
+{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+
+static const cmac_vector_t cmac_vectors[] =
+{
+    { 0u,  { 0xbb, 0x1d, 0x69, 0x29, 0xe9, 0x59, 0x37, 0x28, 0x7f, 0xa3, 0x7d, 0x12, 0x9b, 0x75, 0x67, 0x46 } },
+    { 16u, { 0x07, 0x0a, 0x16, 0xb4, 0x6b, 0x4d, 0x41, 0x44, 0xf7, 0x9b, 0xdd, 0x9d, 0xd0, 0x4a, 0x28, 0x7c } },
+    { 40u, { 0xdf, 0xa6, 0x67, 0x47, 0xde, 0x9a, 0xe6, 0x30, 0x30, 0xca, 0x32, 0x61, 0x14, 0x97, 0xc8, 0x27 } },
+    { 64u, { 0x51, 0xf0, 0xbe, 0xbf, 0x7e, 0x3b, 0x9d, 0x92, 0xfc, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3c, 0xfe } },
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * The RFC 4493 vectors: subkeys, one-shot, every split into two updates,
+ * byte-by-byte updates, and verification.
+ */
+static int vectors_test(void)
+{
+    aes128_cmac_key_t   key;
+    aes128_cmac_ctx_t   ctx;
+    uint8_t             tag[AES128_CMAC_TAG_SIZE];
+    size_t              i;
+    size_t              split;
+    size_t              j;
+
+    aes128_cmac_init(&key, cmac_key);
+    if (memcmp(key.k1, cmac_k1, AES_BLOCK_SIZE) != 0 || memcmp(key.k2, cmac_k2, AES_BLOCK_SIZE) != 0)
+    {
+        printf("CMAC subkeys failed\n");
+        print_block_hex(key.k1, AES_BLOCK_SIZE);
+        print_block_hex(key.k2, AES_BLOCK_SIZE);
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(cmac_vectors) / sizeof(cmac_vectors[0]); i++)
+    {
+        aes128_cmac(&key, cmac_msg, cmac_vectors[i].len, tag, sizeof(tag));
+        if (memcmp(tag, cmac_vectors[i].tag, AES128_CMAC_TAG_SIZE) != 0)
+        {
+            printf("CMAC vector %zu failed\n", i);
+            print_block_hex(tag, sizeof(tag));
+            return 1;
+        }
+
+        for (split = 0; split <= cmac_vectors[i].len; split++)
+        {
+            aes128_cmac_start(&ctx, &key);
+            aes128_cmac_update(&ctx, cmac_msg, split);
+            aes128_cmac_update(&ctx, cmac_msg + split, cmac_vectors[i].len - split);
+            aes128_cmac_finish(&ctx, tag, sizeof(tag));
+            if (memcmp(tag, cmac_vectors[i].tag, AES128_CMAC_TAG_SIZE) != 0)
+            {
+                printf("CMAC vector %zu split at %zu failed\n", i, split);
+                return 1;
+            }
+        }
+
+        aes128_cmac_start(&ctx, &key);
+        for (j = 0; j < cmac_vectors[i].len; j++)
+        {
+            aes128_cmac_update(&ctx, &cmac_msg[j], 1u);
+        }
+        if (!aes128_cmac_verify(&ctx, cmac_vectors[i].tag, 8u))
+        {
+            printf("CMAC vector %zu verify failed\n", i);
+            return 1;
+        }
+        tag[0] ^= 1u;
+        aes128_cmac_start(&ctx, &key);
+        aes128_cmac_update(&ctx, cmac_msg, cmac_vectors[i].len);
+        if (aes128_cmac_verify(&ctx, tag, sizeof(tag)))
+        {
+            printf("CMAC vector %zu verify accepted a wrong tag\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Batches of messages of mixed lengths, compared with aes128_cmac() of each.
+ */
+static int batch_test(void)
+{
+    aes128_cmac_key_t   key;
+    uint8_t             data[BATCH_DATA_SIZE];
+    const uint8_t     * p_msgs[BATCH_NUM_MSGS];
+    size_t              msg_lens[BATCH_NUM_MSGS];
+    uint8_t             tags[BATCH_NUM_MSGS * AES128_CMAC_TAG_SIZE];
+    uint8_t             tag[AES128_CMAC_TAG_SIZE];
+    size_t              num_msgs;
+    size_t              i;
+
+    aes128_cmac_init(&key, cmac_key);
+    for (i = 0; i < sizeof(data); i++)
+    {
+        data[i] = i * 29u + 7u;
+    }
+    for (i = 0; i < BATCH_NUM_MSGS; i++)
+    {
+        /* Lengths 0 to 40, out of order, from different offsets. */
+        p_msgs[i] = &data[i];
+        msg_lens[i] = (i * 17u) % 41u;
+    }
+
+    for (num_msgs = 0; num_msgs <= BATCH_NUM_MSGS; num_msgs += 5u)
+    {
+        memset(tags, 0, sizeof(tags));
+        aes128_cmac_batch(&key, p_msgs, msg_lens, tags, num_msgs);
+        for (i = 0; i < num_msgs; i++)
+        {
+            aes128_cmac(&key, p_msgs[i], msg_lens[i], tag, sizeof(tag));
+            if (memcmp(&tags[i * AES128_CMAC_TAG_SIZE], tag, AES128_CMAC_TAG_SIZE) != 0)
+            {
+                printf("CMAC batch of %zu, message %zu of %zu bytes failed\n", num_msgs, i, msg_lens[i]);
+                print_block_hex(&tags[i * AES128_CMAC_TAG_SIZE], AES128_CMAC_TAG_SIZE);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    const aes_engine_t * p_engine;
+    size_t      engine;
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    for (engine = 0; (p_engine = aes_engine_get(engine)) != NULL; engine++)
+    {
+        aes_engine_set(p_engine);
+
+        result = vectors_test();
+        if (result == 0)
+            result = batch_test();
+        if (result)
+        {
+            printf("Failed with AES engine %s\n", p_engine->name);
+            return result;
+        }
+    }
+    return 0;
+}
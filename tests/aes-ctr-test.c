@@ -0,0 +1,161 @@
+
+#include "aes-ctr.h"
+#include "aes-print-block.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define SP800_38A_NUM_BLOCKS    4u
+
+/* Long enough for several batches of counter blocks plus a partial block. */
+#define MAX_TEST_LEN            300u
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* NIST SP 800-38A F.5.1 CTR-AES128.Encrypt */
+static const uint8_t sp800_38a_key[AES128_KEY_SIZE] =
+{
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t sp800_38a_iv[AES128_CTR_IV_SIZE] =
+{
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb
+};
+#define SP800_38A_COUNTER       0xfcfdfeffu
+static const uint8_t sp800_38a_plain[SP800_38A_NUM_BLOCKS * AES_BLOCK_SIZE] =
+{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const uint8_t sp800_38a_cipher[SP800_38A_NUM_BLOCKS * AES_BLOCK_SIZE] =
+{
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+/* Starting counters, including some that wrap around during the test. */
+static const uint32_t start_counters[] = { 0u, 1u, 0xFFFFFFFCu, 0xFFFFFFFFu };
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static int sp800_38a_test(void)
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     data[SP800_38A_NUM_BLOCKS * AES_BLOCK_SIZE];
+    uint32_t    counter;
+
+    aes128_key_schedule(key_schedule, sp800_38a_key);
+    counter = aes128_ctr_xcrypt(key_schedule, sp800_38a_iv, SP800_38A_COUNTER, sp800_38a_plain, data, sizeof(data));
+    if (memcmp(data, sp800_38a_cipher, sizeof(data)) != 0)
+    {
+        printf("CTR SP 800-38A encrypt failed\n");
+        print_block_hex(data, sizeof(data));
+        return 1;
+    }
+    if (counter != SP800_38A_COUNTER + SP800_38A_NUM_BLOCKS)
+    {
+        printf("CTR SP 800-38A returned counter %08X\n", (unsigned)counter);
+        return 1;
+    }
+
+    /* Decrypt in-place. */
+    aes128_ctr_xcrypt(key_schedule, sp800_38a_iv, SP800_38A_COUNTER, data, data, sizeof(data));
+    if (memcmp(data, sp800_38a_plain, sizeof(data)) != 0)
+    {
+        printf("CTR SP 800-38A decrypt failed\n");
+        print_block_hex(data, sizeof(data));
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Compare aes128_ctr_xcrypt() against CTR mode done one block at a time with
+ * aes128_encrypt(), for all lengths up to MAX_TEST_LEN, with the 32-bit
+ * counter wrapping to zero.
+ */
+static int ctr_reference_test(void)
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     plain[MAX_TEST_LEN];
+    uint8_t     cipher[MAX_TEST_LEN];
+    uint8_t     reference[MAX_TEST_LEN];
+    uint8_t     counter_block[AES_BLOCK_SIZE];
+    uint32_t    counter;
+    uint32_t    result_counter;
+    size_t      len;
+    size_t      i;
+    size_t      c;
+
+    aes128_key_schedule(key_schedule, sp800_38a_key);
+    for (i = 0; i < MAX_TEST_LEN; i++)
+    {
+        plain[i] = i * 13u + 5u;
+    }
+    for (c = 0; c < sizeof(start_counters) / sizeof(start_counters[0]); c++)
+    {
+        for (len = 0; len <= MAX_TEST_LEN; len++)
+        {
+            counter = start_counters[c];
+            for (i = 0; i < len; i++)
+            {
+                if ((i % AES_BLOCK_SIZE) == 0)
+                {
+                    memcpy(counter_block, sp800_38a_iv, AES128_CTR_IV_SIZE);
+                    counter_block[12] = counter >> 24u;
+                    counter_block[13] = counter >> 16u;
+                    counter_block[14] = counter >> 8u;
+                    counter_block[15] = counter;
+                    aes128_encrypt(counter_block, key_schedule);
+                    counter++;
+                }
+                reference[i] = plain[i] ^ counter_block[i % AES_BLOCK_SIZE];
+            }
+
+            result_counter = aes128_ctr_xcrypt(key_schedule, sp800_38a_iv, start_counters[c], plain, cipher, len);
+            if (memcmp(cipher, reference, len) != 0 || result_counter != counter)
+            {
+                printf("CTR reference test failed, counter %08X, length %zu\n", (unsigned)start_counters[c], len);
+                printf("Result:\n");
+                print_block_hex(cipher, len);
+                printf("Expected:\n");
+                print_block_hex(reference, len);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    result = sp800_38a_test();
+    if (result)
+        return result;
+
+    result = ctr_reference_test();
+    if (result)
+        return result;
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#!/bin/sh
+#
+# Round trips through aes-min-crypt with mapped files and pipes, and checks
+# that corrupted, reordered, truncated, extended or wrongly keyed input is
+# rejected.
+
+CRYPT=${CRYPT:-./aes-min-crypt}
+TMP=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMP"' EXIT
+
+fail()
+{
+    echo "aes-min-crypt-test: $1"
+    exit 1
+}
+
+printf '000102030405060708090a0b0c0d0e0f\n' > "$TMP/key"
+printf '0f0e0d0c0b0a09080706050403020100' > "$TMP/key2"
+
+# Sizes around the chunk size of 1000 bytes, and several chunks.
+for size in 0 1 999 1000 1001 3000 12345; do
+    head -c $size /dev/urandom > "$TMP/plain" || fail "can't create data"
+
+    "$CRYPT" -e -k "$TMP/key" -c 1000 -i "$TMP/plain" -o "$TMP/enc" || fail "encrypt file $size"
+    "$CRYPT" -d -k "$TMP/key" -i "$TMP/enc" -o "$TMP/dec" || fail "decrypt file $size"
+    cmp -s "$TMP/plain" "$TMP/dec" || fail "file round trip $size"
+
+    cat "$TMP/plain" | "$CRYPT" -e -k "$TMP/key" -c 1000 | cat > "$TMP/enc2" || fail "encrypt pipe $size"
+    cat "$TMP/enc2" | "$CRYPT" -d -k "$TMP/key" > "$TMP/dec" || fail "decrypt pipe $size"
+    cmp -s "$TMP/plain" "$TMP/dec" || fail "pipe round trip $size"
+
+    # Same length whichever way it is read, but a different nonce.
+    [ $(wc -c < "$TMP/enc") -eq $(wc -c < "$TMP/enc2") ] || fail "encrypted size $size"
+    cmp -s "$TMP/enc" "$TMP/enc2" && fail "nonce reused $size"
+done
+
+# The default chunk size, with a raw key file.
+head -c 16 /dev/urandom > "$TMP/rawkey"
+head -c 3000000 /dev/urandom > "$TMP/plain"
+"$CRYPT" -e -k "$TMP/rawkey" < "$TMP/plain" > "$TMP/enc" || fail "encrypt default"
+"$CRYPT" -d -k "$TMP/rawkey" < "$TMP/enc" | cmp -s - "$TMP/plain" || fail "default round trip"
+
+head -c 12345 /dev/urandom > "$TMP/plain"
+"$CRYPT" -e -k "$TMP/key" -c 1000 -i "$TMP/plain" -o "$TMP/enc" || fail "encrypt"
+size=$(wc -c < "$TMP/enc")
+
+"$CRYPT" -d -k "$TMP/key2" -i "$TMP/enc" -o "$TMP/dec" 2>/dev/null && fail "wrong key accepted"
+
+# Flip one byte in the header, a length field, ciphertext and a tag.
+for offset in 10 20 500 1039 $((size - 1)); do
+    cp "$TMP/enc" "$TMP/bad"
+    printf '\377' | dd of="$TMP/bad" bs=1 seek=$offset conv=notrunc 2>/dev/null
+    cmp -s "$TMP/enc" "$TMP/bad" || {
+        "$CRYPT" -d -k "$TMP/key" -i "$TMP/bad" -o "$TMP/dec" 2>/dev/null && fail "corruption at $offset accepted"
+        cat "$TMP/bad" | "$CRYPT" -d -k "$TMP/key" > "$TMP/dec" 2>/dev/null && fail "corruption at $offset in pipe accepted"
+    }
+done
+
+# The first two chunks (20-byte header, then 4 + 1000 + 16 bytes each)
+# swapped.
+head -c 20 "$TMP/enc" > "$TMP/bad"
+tail -c +1041 "$TMP/enc" | head -c 1020 >> "$TMP/bad"
+tail -c +21 "$TMP/enc" | head -c 1020 >> "$TMP/bad"
+tail -c +2061 "$TMP/enc" >> "$TMP/bad"
+[ $(wc -c < "$TMP/bad") -eq $size ] || fail "can't swap chunks"
+"$CRYPT" -d -k "$TMP/key" -i "$TMP/bad" -o "$TMP/dec" 2>/dev/null && fail "swapped chunks accepted"
+cat "$TMP/bad" | "$CRYPT" -d -k "$TMP/key" > "$TMP/dec" 2>/dev/null && fail "swapped chunks in pipe accepted"
+
+# Truncation, at and between chunk boundaries, and trailing data.
+for len in 0 19 20 1040 2060 $((size - 1)); do
+    head -c $len "$TMP/enc" > "$TMP/bad"
+    "$CRYPT" -d -k "$TMP/key" -i "$TMP/bad" -o "$TMP/dec" 2>/dev/null && fail "truncation to $len accepted"
+    cat "$TMP/bad" | "$CRYPT" -d -k "$TMP/key" > "$TMP/dec" 2>/dev/null && fail "truncated pipe $len accepted"
+done
+cp "$TMP/enc" "$TMP/bad"
+printf 'x' >> "$TMP/bad"
+"$CRYPT" -d -k "$TMP/key" -i "$TMP/bad" -o "$TMP/dec" 2>/dev/null && fail "trailing data accepted"
+cat "$TMP/bad" | "$CRYPT" -d -k "$TMP/key" > "$TMP/dec" 2>/dev/null && fail "trailing data in pipe accepted"
+
+exit 0
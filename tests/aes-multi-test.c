@@ -0,0 +1,159 @@
+
+#include "aes-min.h"
+#include "aes-print-block.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Enough for several batches of the interleaved implementations plus a
+ * partial batch. */
+#define MAX_TEST_BLOCKS         21u
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* FIPS-197 Appendix C.1 AES-128 */
+static const uint8_t fips197_key[AES128_KEY_SIZE] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t fips197_plain[AES_BLOCK_SIZE] =
+{
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const uint8_t fips197_cipher[AES_BLOCK_SIZE] =
+{
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/*
+ * Compare aes128_encrypt_multi() against aes128_encrypt() of each block, for
+ * all counts up to MAX_TEST_BLOCKS. Each block has a different key, except
+ * when shared_key is set, when all blocks use the same key schedule. Blocks
+ * beyond the count must be left unchanged.
+ */
+static int multi_reference_test(int shared_key)
+{
+    uint8_t         key_schedules[MAX_TEST_BLOCKS][AES128_KEY_SCHEDULE_SIZE];
+    uint8_t         key[AES128_KEY_SIZE];
+    uint8_t         blocks[MAX_TEST_BLOCKS][AES_BLOCK_SIZE];
+    uint8_t         reference[MAX_TEST_BLOCKS][AES_BLOCK_SIZE];
+    uint8_t *       p_blocks[MAX_TEST_BLOCKS];
+    const uint8_t * p_key_schedules[MAX_TEST_BLOCKS];
+    size_t          num_blocks;
+    size_t          i;
+    size_t          j;
+
+    for (i = 0; i < MAX_TEST_BLOCKS; i++)
+    {
+        for (j = 0; j < AES128_KEY_SIZE; j++)
+        {
+            key[j] = i * 29u + j * 7u + 1u;
+        }
+        aes128_key_schedule(key_schedules[i], key);
+    }
+    for (num_blocks = 0; num_blocks <= MAX_TEST_BLOCKS; num_blocks++)
+    {
+        for (i = 0; i < MAX_TEST_BLOCKS; i++)
+        {
+            for (j = 0; j < AES_BLOCK_SIZE; j++)
+            {
+                blocks[i][j] = num_blocks * 3u + i * 17u + j;
+            }
+            memcpy(reference[i], blocks[i], AES_BLOCK_SIZE);
+            p_key_schedules[i] = shared_key ? key_schedules[0] : key_schedules[i];
+            if (i < num_blocks)
+            {
+                aes128_encrypt(reference[i], p_key_schedules[i]);
+            }
+        }
+        /* Pass the blocks in reverse order, so they are not contiguous. */
+        for (i = 0; i < num_blocks; i++)
+        {
+            p_blocks[i] = blocks[num_blocks - 1u - i];
+            p_key_schedules[i] = shared_key ? key_schedules[0] : key_schedules[num_blocks - 1u - i];
+        }
+
+        aes128_encrypt_multi(p_blocks, p_key_schedules, num_blocks);
+        if (memcmp(blocks, reference, sizeof(blocks)) != 0)
+        {
+            printf("Multi-key encrypt failed, %zu blocks%s\n", num_blocks, shared_key ? ", shared key" : "");
+            printf("Result:\n");
+            print_block_hex(&blocks[0][0], sizeof(blocks));
+            printf("Expected:\n");
+            print_block_hex(&reference[0][0], sizeof(reference));
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Check a known answer in every position of a full batch, with the other
+ * blocks using different keys.
+ */
+static int multi_fips197_test(void)
+{
+    uint8_t         key_schedules[2][AES128_KEY_SCHEDULE_SIZE];
+    uint8_t         other_key[AES128_KEY_SIZE];
+    uint8_t         blocks[MAX_TEST_BLOCKS][AES_BLOCK_SIZE];
+    uint8_t *       p_blocks[MAX_TEST_BLOCKS];
+    const uint8_t * p_key_schedules[MAX_TEST_BLOCKS];
+    size_t          pos;
+    size_t          i;
+
+    aes128_key_schedule(key_schedules[0], fips197_key);
+    memset(other_key, 0xA5, sizeof(other_key));
+    aes128_key_schedule(key_schedules[1], other_key);
+    for (pos = 0; pos < MAX_TEST_BLOCKS; pos++)
+    {
+        for (i = 0; i < MAX_TEST_BLOCKS; i++)
+        {
+            memcpy(blocks[i], fips197_plain, AES_BLOCK_SIZE);
+            p_blocks[i] = blocks[i];
+            p_key_schedules[i] = key_schedules[(i == pos) ? 0 : 1];
+        }
+        aes128_encrypt_multi(p_blocks, p_key_schedules, MAX_TEST_BLOCKS);
+        if (memcmp(blocks[pos], fips197_cipher, AES_BLOCK_SIZE) != 0)
+        {
+            printf("Multi-key FIPS-197 test failed, position %zu\n", pos);
+            print_block_hex(blocks[pos], AES_BLOCK_SIZE);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    result = multi_fips197_test();
+    if (result)
+        return result;
+
+    result = multi_reference_test(0);
+    if (result)
+        return result;
+
+    result = multi_reference_test(1);
+    if (result)
+        return result;
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+
+#include "aes-parallel.h"
+#include "aes-print-block.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define CHUNK_SIZE              (AES_PARALLEL_MIN_CHUNK_BLOCKS * AES_BLOCK_SIZE)
+
+/* Long enough for several chunks, plus a partial block. */
+#define MAX_TEST_LEN            (20u * CHUNK_SIZE + 7u)
+
+#define TEST_AAD_SIZE           13u
+#define TEST_IV_MAX_SIZE        AES128_GCM_IV_SIZE
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* Data lengths around the boundaries of chunks and blocks. */
+static const size_t test_lens[] =
+{
+    0u, 17u, CHUNK_SIZE, CHUNK_SIZE + 1u, 5u * CHUNK_SIZE + 33u, MAX_TEST_LEN,
+};
+
+/* Thread counts for pools. 0 means the built-in pool, by passing NULL. */
+static const size_t test_num_threads[] = { 0u, 1u, 3u, 4u };
+
+/* IV lengths, including one for which J0 is calculated by GHASH. */
+static const size_t test_iv_lens[] = { AES128_GCM_IV_SIZE, 8u };
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static int check_result(const char * p_name, size_t len, size_t num_threads, const uint8_t * p_result, const uint8_t * p_expected, size_t result_len)
+{
+    size_t      i;
+
+    if (memcmp(p_result, p_expected, result_len) != 0)
+    {
+        for (i = 0; p_result[i] == p_expected[i]; i++)
+        {
+        }
+        printf("%s failed for length %zu, %zu threads, at offset %zu\n", p_name, len, num_threads, i);
+        return 1;
+    }
+    return 0;
+}
+
+static int ctr_parallel_test(aes_thread_pool_t * p_pool, size_t num_threads,
+                             const uint8_t * p_plain, uint8_t * p_expected, uint8_t * p_result)
+{
+    uint8_t     key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t     key[AES128_KEY_SIZE];
+    uint8_t     iv[AES128_CTR_IV_SIZE];
+    uint32_t    counter;
+    uint32_t    expected_counter;
+    size_t      i;
+    size_t      len;
+    int         result;
+
+    for (i = 0; i < sizeof(key); i++)
+        key[i] = 0x40u + i;
+    for (i = 0; i < sizeof(iv); i++)
+        iv[i] = 0xC0u ^ i;
+    aes128_key_schedule(key_schedule, key);
+
+    for (i = 0; i < sizeof(test_lens) / sizeof(test_lens[0]); i++)
+    {
+        len = test_lens[i];
+
+        /* Start near the top, so the counter wraps in the middle of a chunk. */
+        expected_counter = aes128_ctr_xcrypt(key_schedule, iv, 0xFFFFFF00u, p_plain, p_expected, len);
+        counter = aes128_ctr_xcrypt_parallel(p_pool, key_schedule, iv, 0xFFFFFF00u, p_plain, p_result, len);
+        result = check_result("aes128_ctr_xcrypt_parallel()", len, num_threads, p_result, p_expected, len);
+        if (result)
+            return result;
+        if (counter != expected_counter)
+        {
+            printf("aes128_ctr_xcrypt_parallel() returned counter 0x%08X, expected 0x%08X\n",
+                   (unsigned)counter, (unsigned)expected_counter);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int gcm_parallel_test(aes_thread_pool_t * p_pool, size_t num_threads,
+                             const uint8_t * p_plain, uint8_t * p_expected, uint8_t * p_result)
+{
+    aes128_gcm_key_t gcm_key;
+    uint8_t     key[AES128_KEY_SIZE];
+    uint8_t     iv[TEST_IV_MAX_SIZE];
+    uint8_t     aad[TEST_AAD_SIZE];
+    uint8_t     expected_tag[AES128_GCM_TAG_SIZE];
+    uint8_t     tag[AES128_GCM_TAG_SIZE];
+    size_t      i;
+    size_t      j;
+    size_t      len;
+    size_t      iv_len;
+    size_t      aad_len;
+    int         result;
+
+    for (i = 0; i < sizeof(key); i++)
+        key[i] = 0x11u * i;
+    for (i = 0; i < sizeof(iv); i++)
+        iv[i] = 0xA0u + i;
+    for (i = 0; i < sizeof(aad); i++)
+        aad[i] = i;
+    aes128_gcm_init(&gcm_key, key);
+
+    for (i = 0; i < sizeof(test_lens) / sizeof(test_lens[0]); i++)
+    {
+        len = test_lens[i];
+        for (j = 0; j < sizeof(test_iv_lens) / sizeof(test_iv_lens[0]); j++)
+        {
+            iv_len = test_iv_lens[j];
+            aad_len = j ? 0 : sizeof(aad);
+
+            aes128_gcm_seal(&gcm_key, iv, iv_len, aad, aad_len, p_expected, p_plain, len, expected_tag, sizeof(expected_tag));
+            aes128_gcm_seal_parallel(p_pool, &gcm_key, iv, iv_len, aad, aad_len, p_result, p_plain, len, tag, sizeof(tag));
+            result = check_result("aes128_gcm_seal_parallel() ciphertext", len, num_threads, p_result, p_expected, len);
+            if (result)
+                return result;
+            result = check_result("aes128_gcm_seal_parallel() tag", len, num_threads, tag, expected_tag, sizeof(tag));
+            if (result)
+                return result;
+
+            /* In-place decryption */
+            if (!aes128_gcm_open_parallel(p_pool, &gcm_key, iv, iv_len, aad, aad_len, p_result, p_result, len, tag, sizeof(tag)))
+            {
+                printf("aes128_gcm_open_parallel() failed to verify for length %zu, %zu threads\n", len, num_threads);
+                return 1;
+            }
+            result = check_result("aes128_gcm_open_parallel() plaintext", len, num_threads, p_result, p_plain, len);
+            if (result)
+                return result;
+
+            tag[AES128_GCM_TAG_SIZE - 1u] ^= 0x80u;
+            if (aes128_gcm_open_parallel(p_pool, &gcm_key, iv, iv_len, aad, aad_len, p_result, p_expected, len, tag, sizeof(tag)))
+            {
+                printf("aes128_gcm_open_parallel() accepted a bad tag for length %zu, %zu threads\n", len, num_threads);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    aes_thread_pool_t * p_pool;
+    uint8_t   * p_plain;
+    uint8_t   * p_expected;
+    uint8_t   * p_result;
+    size_t      i;
+    int         result = 0;
+
+    (void)argc;
+    (void)argv;
+
+    p_plain = malloc(MAX_TEST_LEN);
+    p_expected = malloc(MAX_TEST_LEN);
+    p_result = malloc(MAX_TEST_LEN);
+    if (p_plain == NULL || p_expected == NULL || p_result == NULL)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+    for (i = 0; i < MAX_TEST_LEN; i++)
+        p_plain[i] = i * 7u + (i >> 11u);
+
+    for (i = 0; result == 0 && i < sizeof(test_num_threads) / sizeof(test_num_threads[0]); i++)
+    {
+        p_pool = NULL;
+        if (test_num_threads[i])
+        {
+            p_pool = aes_thread_pool_create(test_num_threads[i]);
+            if (p_pool == NULL)
+            {
+                printf("aes_thread_pool_create(%zu) failed\n", test_num_threads[i]);
+                return 1;
+            }
+            if (aes_thread_pool_num_threads(p_pool) != test_num_threads[i])
+            {
+                printf("aes_thread_pool_num_threads() incorrect\n");
+                return 1;
+            }
+        }
+
+        result = ctr_parallel_test(p_pool, test_num_threads[i], p_plain, p_expected, p_result);
+        if (result == 0)
+            result = gcm_parallel_test(p_pool, test_num_threads[i], p_plain, p_expected, p_result);
+
+        aes_thread_pool_destroy(p_pool);
+    }
+
+    free(p_plain);
+    free(p_expected);
+    free(p_result);
+    return result;
+}
@@ -38,37 +38,140 @@ typedef struct
     const uint8_t * cipher;
 } vector_data_t;
 
+/* Test vectors for one key size, from one generated header. */
+typedef struct
+{
+    size_t key_size;
+    const vector_data_t * const * p_vectors;
+    size_t num_vectors;
+} vector_set_t;
+
 /*****************************************************************************
  * Include generated code
  ****************************************************************************/
 
 #include "aes-test-vectors.h"    /* Generated by Python parse-vectors.py */
+#include "aes192-test-vectors.h" /* Generated by Python parse-vectors.py --prefix=aes192_ */
+#include "aes256-test-vectors.h" /* Generated by Python parse-vectors.py --prefix=aes256_ */
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+static const vector_set_t vector_sets[] =
+{
+    { AES128_KEY_SIZE, test_vectors, dimof(test_vectors) },
+    { AES192_KEY_SIZE, aes192_test_vectors, dimof(aes192_test_vectors) },
+    { AES256_KEY_SIZE, aes256_test_vectors, dimof(aes256_test_vectors) },
+};
 
 /*****************************************************************************
  * Functions
  ****************************************************************************/
 
-static bool test_aes(const vector_data_t * p_vector_data, bool do_otfks)
+static void key_schedule(uint8_t * p_key_schedule, const uint8_t * p_key, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_key_schedule(p_key_schedule, p_key); break;
+        case AES192_KEY_SIZE:   aes192_key_schedule(p_key_schedule, p_key); break;
+        default:                aes256_key_schedule(p_key_schedule, p_key); break;
+    }
+}
+
+static void encrypt(uint8_t * p_block, const uint8_t * p_key_schedule, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_encrypt(p_block, p_key_schedule); break;
+        case AES192_KEY_SIZE:   aes192_encrypt(p_block, p_key_schedule); break;
+        default:                aes256_encrypt(p_block, p_key_schedule); break;
+    }
+}
+
+static void decrypt(uint8_t * p_block, const uint8_t * p_key_schedule, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_decrypt(p_block, p_key_schedule); break;
+        case AES192_KEY_SIZE:   aes192_decrypt(p_block, p_key_schedule); break;
+        default:                aes256_decrypt(p_block, p_key_schedule); break;
+    }
+}
+
+static void key_schedule_decrypt(uint8_t * p_decrypt_key_schedule, const uint8_t * p_key, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_key_schedule_decrypt(p_decrypt_key_schedule, p_key); break;
+        case AES192_KEY_SIZE:   aes192_key_schedule_decrypt(p_decrypt_key_schedule, p_key); break;
+        default:                aes256_key_schedule_decrypt(p_decrypt_key_schedule, p_key); break;
+    }
+}
+
+static void decrypt_eqinv(uint8_t * p_block, const uint8_t * p_decrypt_key_schedule, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_decrypt_eqinv(p_block, p_decrypt_key_schedule); break;
+        case AES192_KEY_SIZE:   aes192_decrypt_eqinv(p_block, p_decrypt_key_schedule); break;
+        default:                aes256_decrypt_eqinv(p_block, p_decrypt_key_schedule); break;
+    }
+}
+
+static void otfks_decrypt_start_key(uint8_t * p_key, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_otfks_decrypt_start_key(p_key); break;
+        case AES192_KEY_SIZE:   aes192_otfks_decrypt_start_key(p_key); break;
+        default:                aes256_otfks_decrypt_start_key(p_key); break;
+    }
+}
+
+static void otfks_encrypt(uint8_t * p_block, uint8_t * p_key, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_otfks_encrypt(p_block, p_key); break;
+        case AES192_KEY_SIZE:   aes192_otfks_encrypt(p_block, p_key); break;
+        default:                aes256_otfks_encrypt(p_block, p_key); break;
+    }
+}
+
+static void otfks_decrypt(uint8_t * p_block, uint8_t * p_key, size_t key_size)
+{
+    switch (key_size)
+    {
+        case AES128_KEY_SIZE:   aes128_otfks_decrypt(p_block, p_key); break;
+        case AES192_KEY_SIZE:   aes192_otfks_decrypt(p_block, p_key); break;
+        default:                aes256_otfks_decrypt(p_block, p_key); break;
+    }
+}
+
+static bool test_aes(const vector_data_t * p_vector_data, size_t key_size, bool do_otfks)
 {
-    uint8_t encrypt_key_schedule[AES128_KEY_SCHEDULE_SIZE] = {};
-    uint8_t otfks_encrypt_key_start[AES128_KEY_SIZE] = {};
-    uint8_t otfks_decrypt_key_start[AES128_KEY_SIZE] = {};
-    uint8_t otfks_key_work[AES128_KEY_SIZE] = {};
+    uint8_t encrypt_key_schedule[AES256_KEY_SCHEDULE_SIZE] = {};
+    uint8_t decrypt_key_schedule[AES256_KEY_SCHEDULE_SIZE] = {};
+    uint8_t otfks_encrypt_key_start[AES256_KEY_SIZE] = {};
+    uint8_t otfks_decrypt_key_start[AES256_KEY_SIZE] = {};
+    uint8_t otfks_key_work[AES256_KEY_SIZE] = {};
     uint8_t crypt_block[AES_BLOCK_SIZE] = {};
 
     if (do_otfks)
     {
         /* Start key for encrypt */
-        memcpy(otfks_encrypt_key_start, p_vector_data->key, AES128_KEY_SIZE);
-        //aes128_otfks_encrypt_start_key(otfks_encrypt_key_start);
+        memcpy(otfks_encrypt_key_start, p_vector_data->key, key_size);
         /* Start key for decrypt */
-        memcpy(otfks_decrypt_key_start, p_vector_data->key, AES128_KEY_SIZE);
-        aes128_otfks_decrypt_start_key(otfks_decrypt_key_start);
+        memcpy(otfks_decrypt_key_start, p_vector_data->key, key_size);
+        otfks_decrypt_start_key(otfks_decrypt_key_start, key_size);
     }
     else
     {
         /* Encrypt key schedule */
-        aes128_key_schedule(encrypt_key_schedule, p_vector_data->key);
+        key_schedule(encrypt_key_schedule, p_vector_data->key, key_size);
+        /* Decrypt key schedule, for the equivalent inverse cipher */
+        key_schedule_decrypt(decrypt_key_schedule, p_vector_data->key, key_size);
     }
 
     memcpy(crypt_block, p_vector_data->plain, AES_BLOCK_SIZE);
@@ -76,19 +179,19 @@ static bool test_aes(const vector_data_t * p_vector_data, bool do_otfks)
     /* Encrypt 1 */
     if (do_otfks)
     {
-        memcpy(otfks_key_work, otfks_encrypt_key_start, AES128_KEY_SIZE);
-        aes128_otfks_encrypt(crypt_block, otfks_key_work);
+        memcpy(otfks_key_work, otfks_encrypt_key_start, key_size);
+        otfks_encrypt(crypt_block, otfks_key_work, key_size);
     }
     else
     {
-        aes128_encrypt(crypt_block, encrypt_key_schedule);
+        encrypt(crypt_block, encrypt_key_schedule, key_size);
     }
 
     /* Check encryption */
     if (p_vector_data->cipher &&
         memcmp(crypt_block, p_vector_data->cipher, AES_BLOCK_SIZE) != 0)
     {
-        printf("set %u vector %u encrypt error\n",
+        printf("AES-%zu set %u vector %u encrypt error\n", key_size * 8u,
                 p_vector_data->set_num, p_vector_data->count);
         return false;
     }
@@ -96,58 +199,94 @@ static bool test_aes(const vector_data_t * p_vector_data, bool do_otfks)
     /* Decrypt back to plain text */
     if (do_otfks)
     {
-        memcpy(otfks_key_work, otfks_decrypt_key_start, AES128_KEY_SIZE);
-        aes128_otfks_decrypt(crypt_block, otfks_key_work);
+        memcpy(otfks_key_work, otfks_decrypt_key_start, key_size);
+        otfks_decrypt(crypt_block, otfks_key_work, key_size);
     }
     else
     {
-        aes128_decrypt(crypt_block, encrypt_key_schedule);
+        decrypt(crypt_block, encrypt_key_schedule, key_size);
     }
 
     /* Check decryption */
     if (memcmp(crypt_block, p_vector_data->plain, AES_BLOCK_SIZE) != 0)
     {
-        printf("set %u vector %u decrypt error\n",
+        printf("AES-%zu set %u vector %u decrypt error\n", key_size * 8u,
                 p_vector_data->set_num, p_vector_data->count);
         return false;
     }
 
+    /* Decrypt again by the equivalent inverse cipher */
+    if (!do_otfks)
+    {
+        encrypt(crypt_block, encrypt_key_schedule, key_size);
+        decrypt_eqinv(crypt_block, decrypt_key_schedule, key_size);
+        if (memcmp(crypt_block, p_vector_data->plain, AES_BLOCK_SIZE) != 0)
+        {
+            printf("AES-%zu set %u vector %u equivalent inverse decrypt error\n", key_size * 8u,
+                    p_vector_data->set_num, p_vector_data->count);
+            return false;
+        }
+    }
+
     return true;
 }
 
 int main(int argc, char **argv)
 {
+    size_t  set;
     size_t  i;
+    size_t  engine;
     bool    is_okay;
     bool    do_otfks;
+    const vector_set_t * p_set;
+    const aes_engine_t * p_engine;
 
     (void)argc;
     (void)argv;
 
-    for (i = 0; i < dimof(test_vectors); ++i)
+    if (aes_engine_set(NULL) || aes_engine_find("no-such-engine") != NULL)
     {
-        /* Do each test twice, once with pre-calculated key schedule, then
-         * again with on-the-fly key schedule calculation. */
-        do_otfks = false;
-        for (;;)
+        printf("AES engine set to invalid engine\n");
+        return 1;
+    }
+
+    /* Run the vectors with each engine the CPU supports. */
+    for (engine = 0; (p_engine = aes_engine_get(engine)) != NULL; ++engine)
+    {
+        if (!aes_engine_set(p_engine) || aes_engine_current() != p_engine || aes_engine_find(p_engine->name) != p_engine)
         {
-            /* Using pre-calculated key schedule */
-            is_okay = test_aes(test_vectors[i], do_otfks);
-            if (is_okay == false)
-            {
-                printf("set %u vector %u %s%s\n",
-                        test_vectors[i]->set_num, test_vectors[i]->count,
-                        do_otfks ? "(OTFKS) " : "",
-                        is_okay ? "succeeded" : "failed");
-            }
-            if (!is_okay)
+            printf("AES engine %s can't be selected\n", p_engine->name);
+            return 1;
+        }
+        for (set = 0; set < dimof(vector_sets); ++set)
+        {
+            p_set = &vector_sets[set];
+            for (i = 0; i < p_set->num_vectors; ++i)
             {
-                return 1;
+                /* Do each test twice, once with pre-calculated key schedule, then
+                 * again with on-the-fly key schedule calculation. */
+                do_otfks = false;
+                for (;;)
+                {
+                    /* Using pre-calculated key schedule */
+                    is_okay = test_aes(p_set->p_vectors[i], p_set->key_size, do_otfks);
+                    if (is_okay == false)
+                    {
+                        printf("AES-%zu (%s) set %u vector %u %s%s\n", p_set->key_size * 8u, p_engine->name,
+                                p_set->p_vectors[i]->set_num, p_set->p_vectors[i]->count,
+                                do_otfks ? "(OTFKS) " : "",
+                                is_okay ? "succeeded" : "failed");
+                    }
+                    if (!is_okay)
+                    {
+                        return 1;
+                    }
+                    if (do_otfks == false)
+                        do_otfks = true;
+                    else
+                        break;
+                }
             }
-            if (do_otfks == false)
-                do_otfks = true;
-            else
-                break;
         }
     }
     return 0;
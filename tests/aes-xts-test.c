@@ -0,0 +1,318 @@
+
+#include "aes-xts.h"
+#include "aes-print-block.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define MAX_TEST_LEN            (21u * AES_BLOCK_SIZE + 15u)
+#define TEST_SECTOR_SIZE        80u
+#define TEST_NUM_SECTORS        19u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+typedef struct
+{
+    uint8_t             key[AES128_XTS_KEY_SIZE];
+    uint64_t            sector;
+    size_t              len;
+    uint8_t             plain[32];
+    uint8_t             cipher[32];
+} xts_vector_t;
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+static const xts_vector_t xts_vectors[] =
+{
+    /* IEEE 1619-2007 XTS-AES-128 vector 1 */
+    {
+        { 0 },
+        0u, 32u,
+        { 0 },
+        {
+            0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec, 0x9b, 0x9f, 0xe9, 0xa3, 0xea, 0xdd, 0xa6, 0x92,
+            0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98, 0xed, 0x85, 0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e
+        }
+    },
+    /* IEEE 1619-2007 XTS-AES-128 vector 2 */
+    {
+        {
+            0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22
+        },
+        0x3333333333u, 32u,
+        {
+            0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+            0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44
+        },
+        {
+            0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e, 0x39, 0x33, 0x40, 0x38, 0xac, 0xef, 0x83, 0x8b,
+            0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80, 0xad, 0xc4, 0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0
+        }
+    },
+    /* Ciphertext stealing, 17 and 20 bytes, generated with OpenSSL's
+     * XTS-AES-128. */
+    {
+        {
+            0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6, 0xf5, 0xf4, 0xf3, 0xf2, 0xf1, 0xf0,
+            0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xba, 0xb9, 0xb8, 0xb7, 0xb6, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb0
+        },
+        0x9a78563412u, 17u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x10
+        },
+        {
+            0x64, 0x16, 0x10, 0x67, 0x9d, 0xcb, 0xf9, 0x2e, 0x50, 0x5c, 0x41, 0x33, 0x3f, 0xb0, 0x6c, 0x2a,
+            0x95
+        }
+    },
+    {
+        {
+            0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6, 0xf5, 0xf4, 0xf3, 0xf2, 0xf1, 0xf0,
+            0xbf, 0xbe, 0xbd, 0xbc, 0xbb, 0xba, 0xb9, 0xb8, 0xb7, 0xb6, 0xb5, 0xb4, 0xb3, 0xb2, 0xb1, 0xb0
+        },
+        0x9a78563412u, 20u,
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x10, 0x11, 0x12, 0x13
+        },
+        {
+            0xa8, 0xba, 0x00, 0x48, 0xd7, 0x50, 0x84, 0x60, 0x3e, 0xb8, 0x42, 0x3a, 0x09, 0xb7, 0xbf, 0x75,
+            0x95, 0xc8, 0x71, 0xf6
+        }
+    },
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static int vectors_test(void)
+{
+    aes128_xts_key_t    key;
+    uint8_t             data[32];
+    size_t              i;
+
+    for (i = 0; i < sizeof(xts_vectors) / sizeof(xts_vectors[0]); i++)
+    {
+        aes128_xts_init(&key, xts_vectors[i].key);
+        if (!aes128_xts_encrypt_sector(&key, xts_vectors[i].sector, xts_vectors[i].plain, data, xts_vectors[i].len)
+            || memcmp(data, xts_vectors[i].cipher, xts_vectors[i].len) != 0)
+        {
+            printf("XTS vector %zu encrypt failed\n", i);
+            print_block_hex(data, xts_vectors[i].len);
+            return 1;
+        }
+        if (!aes128_xts_decrypt_sector(&key, xts_vectors[i].sector, data, data, xts_vectors[i].len)
+            || memcmp(data, xts_vectors[i].plain, xts_vectors[i].len) != 0)
+        {
+            printf("XTS vector %zu decrypt failed\n", i);
+            print_block_hex(data, xts_vectors[i].len);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* XTS encryption of whole blocks, one block at a time, doubling the tweak
+ * byte by byte. */
+static void xts_reference_encrypt(const uint8_t p_xts_key[AES128_XTS_KEY_SIZE], uint64_t sector,
+                                  const uint8_t * p_in, uint8_t * p_out, size_t num_blocks)
+{
+    uint8_t             key_schedule[AES128_KEY_SCHEDULE_SIZE];
+    uint8_t             tweak[AES_BLOCK_SIZE] = { 0 };
+    uint8_t             carry;
+    size_t              i;
+    size_t              j;
+
+    for (i = 0; i < 8u; i++)
+    {
+        tweak[i] = sector >> (8u * i);
+    }
+    aes128_key_schedule(key_schedule, p_xts_key + AES128_KEY_SIZE);
+    aes128_encrypt(tweak, key_schedule);
+    aes128_key_schedule(key_schedule, p_xts_key);
+    for (i = 0; i < num_blocks; i++)
+    {
+        memcpy(p_out, p_in, AES_BLOCK_SIZE);
+        aes_block_xor(p_out, tweak);
+        aes128_encrypt(p_out, key_schedule);
+        aes_block_xor(p_out, tweak);
+        p_in += AES_BLOCK_SIZE;
+        p_out += AES_BLOCK_SIZE;
+
+        carry = tweak[AES_BLOCK_SIZE - 1u] >> 7u;
+        for (j = AES_BLOCK_SIZE - 1u; j > 0; j--)
+        {
+            tweak[j] = (tweak[j] << 1u) | (tweak[j - 1u] >> 7u);
+        }
+        tweak[0] = (tweak[0] << 1u) ^ (carry ? 0x87u : 0);
+    }
+}
+
+/*
+ * Compare whole-block sectors with the reference, check that every length
+ * round trips in-place and not, and that the multi-sector calls give the
+ * same result as one sector at a time.
+ */
+static int reference_test(void)
+{
+    aes128_xts_key_t    key;
+    uint8_t             xts_key[AES128_XTS_KEY_SIZE];
+    uint8_t             plain[TEST_NUM_SECTORS * TEST_SECTOR_SIZE];
+    uint8_t             cipher[TEST_NUM_SECTORS * TEST_SECTOR_SIZE];
+    uint8_t             reference[TEST_NUM_SECTORS * TEST_SECTOR_SIZE];
+    uint8_t             data[TEST_NUM_SECTORS * TEST_SECTOR_SIZE];
+    uint64_t            sector = 0xFFFFFFFEu;
+    size_t              len;
+    size_t              i;
+
+    for (i = 0; i < sizeof(xts_key); i++)
+    {
+        xts_key[i] = i * 7u + 3u;
+    }
+    for (i = 0; i < sizeof(plain); i++)
+    {
+        plain[i] = i * 13u + 5u;
+    }
+    aes128_xts_init(&key, xts_key);
+
+    for (len = AES_BLOCK_SIZE; len <= MAX_TEST_LEN; len++)
+    {
+        if (!aes128_xts_encrypt_sector(&key, sector, plain, cipher, len))
+        {
+            printf("XTS encrypt of %zu bytes was rejected\n", len);
+            return 1;
+        }
+        if ((len % AES_BLOCK_SIZE) == 0)
+        {
+            xts_reference_encrypt(xts_key, sector, plain, reference, len / AES_BLOCK_SIZE);
+            if (memcmp(cipher, reference, len) != 0)
+            {
+                printf("XTS encrypt of %zu bytes differs from reference\n", len);
+                print_block_hex(cipher, len);
+                return 1;
+            }
+        }
+        else if (memcmp(cipher, reference, len - AES_BLOCK_SIZE - len % AES_BLOCK_SIZE) != 0)
+        {
+            /* Blocks before the stolen one are unaffected by stealing. */
+            printf("XTS encrypt of %zu bytes differs from reference\n", len);
+            return 1;
+        }
+
+        memcpy(data, cipher, len);
+        aes128_xts_decrypt_sector(&key, sector, data, data, len);
+        aes128_xts_decrypt_sector(&key, sector, cipher, cipher, len);
+        if (memcmp(data, plain, len) != 0 || memcmp(cipher, plain, len) != 0)
+        {
+            printf("XTS round trip of %zu bytes failed\n", len);
+            print_block_hex(data, len);
+            return 1;
+        }
+        memcpy(data, plain, len);
+        aes128_xts_encrypt_sector(&key, sector, data, data, len);
+        aes128_xts_encrypt_sector(&key, sector, plain, cipher, len);
+        if (memcmp(data, cipher, len) != 0)
+        {
+            printf("XTS in-place encrypt of %zu bytes failed\n", len);
+            return 1;
+        }
+    }
+
+    for (i = 0; i < TEST_NUM_SECTORS; i++)
+    {
+        aes128_xts_encrypt_sector(&key, sector + i, &plain[i * TEST_SECTOR_SIZE], &reference[i * TEST_SECTOR_SIZE], TEST_SECTOR_SIZE);
+    }
+    if (!aes128_xts_encrypt_sectors(&key, sector, plain, cipher, TEST_SECTOR_SIZE, TEST_NUM_SECTORS)
+        || memcmp(cipher, reference, sizeof(cipher)) != 0)
+    {
+        printf("XTS multi-sector encrypt failed\n");
+        return 1;
+    }
+    if (!aes128_xts_decrypt_sectors(&key, sector, cipher, cipher, TEST_SECTOR_SIZE, TEST_NUM_SECTORS)
+        || memcmp(cipher, plain, sizeof(cipher)) != 0)
+    {
+        printf("XTS multi-sector decrypt failed\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * A sector shorter than one block is rejected, with the output left as it
+ * was, by the single and multi-sector calls in both directions.
+ */
+static int short_sector_test(void)
+{
+    aes128_xts_key_t    key;
+    uint8_t             xts_key[AES128_XTS_KEY_SIZE];
+    uint8_t             plain[AES_BLOCK_SIZE];
+    uint8_t             out[2u * AES_BLOCK_SIZE];
+    uint8_t             unchanged[2u * AES_BLOCK_SIZE];
+    size_t              len;
+
+    memset(xts_key, 0x5Au, sizeof(xts_key));
+    xts_key[AES128_KEY_SIZE] = 0xA5u;
+    memset(plain, 0x11u, sizeof(plain));
+    memset(unchanged, 0xEEu, sizeof(unchanged));
+    aes128_xts_init(&key, xts_key);
+
+    for (len = 0; len < AES_BLOCK_SIZE; len++)
+    {
+        memcpy(out, unchanged, sizeof(out));
+        if (aes128_xts_encrypt_sector(&key, 0, plain, out, len)
+            || aes128_xts_decrypt_sector(&key, 0, plain, out, len)
+            || aes128_xts_encrypt_sectors(&key, 0, plain, out, len, 1u)
+            || aes128_xts_decrypt_sectors(&key, 0, plain, out, len, 1u))
+        {
+            printf("XTS sector of %zu bytes was accepted\n", len);
+            return 1;
+        }
+        if (memcmp(out, unchanged, sizeof(out)) != 0)
+        {
+            printf("XTS sector of %zu bytes changed the output\n", len);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    const aes_engine_t * p_engine;
+    size_t      engine;
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    for (engine = 0; (p_engine = aes_engine_get(engine)) != NULL; engine++)
+    {
+        aes_engine_set(p_engine);
+
+        result = vectors_test();
+        if (result == 0)
+            result = reference_test();
+        if (result == 0)
+            result = short_sector_test();
+        if (result)
+        {
+            printf("Failed with AES engine %s\n", p_engine->name);
+            return result;
+        }
+    }
+    return 0;
+}
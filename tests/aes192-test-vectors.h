@@ -0,0 +1,3859 @@
+
+/* This file was generated by Python program parse-vectors.py
+from the AES KAT (Known Answer Tests), using the following command:
+
+    ./parse-vectors.py --prefix=aes192_ ECBVarKey192.rsp ECBVarTxt192.rsp
+
+This file should not be edited manually.
+
+It is used by tests/aes-vectors-test.c.
+*/
+
+const uint8_t aes192_set0count0key[] = { 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count0plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count0cipher[] = { 0xDE, 0x88, 0x5D, 0xC8, 0x7F, 0x5A, 0x92, 0x59, 0x40, 0x82, 0xD0, 0x2C, 0xC1, 0xE1, 0xB4, 0x2C };
+const vector_data_t aes192_set0count0 = {
+    .set_num = 0,
+    .count = 0,
+    .key = aes192_set0count0key,
+    .plain = aes192_set0count0plain,
+    .cipher = aes192_set0count0cipher,
+};
+
+const uint8_t aes192_set0count1key[] = { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count1plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count1cipher[] = { 0x13, 0x2B, 0x07, 0x4E, 0x80, 0xF2, 0xA5, 0x97, 0xBF, 0x5F, 0xEB, 0xD8, 0xEA, 0x5D, 0xA5, 0x5E };
+const vector_data_t aes192_set0count1 = {
+    .set_num = 0,
+    .count = 1,
+    .key = aes192_set0count1key,
+    .plain = aes192_set0count1plain,
+    .cipher = aes192_set0count1cipher,
+};
+
+const uint8_t aes192_set0count2key[] = { 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count2plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count2cipher[] = { 0x6E, 0xCC, 0xED, 0xF8, 0xDE, 0x59, 0x2C, 0x22, 0xFB, 0x81, 0x34, 0x7B, 0x79, 0xF2, 0xDB, 0x1F };
+const vector_data_t aes192_set0count2 = {
+    .set_num = 0,
+    .count = 2,
+    .key = aes192_set0count2key,
+    .plain = aes192_set0count2plain,
+    .cipher = aes192_set0count2cipher,
+};
+
+const uint8_t aes192_set0count3key[] = { 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count3plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count3cipher[] = { 0x18, 0x0B, 0x09, 0xF2, 0x67, 0xC4, 0x51, 0x45, 0xDB, 0x2F, 0x82, 0x6C, 0x25, 0x82, 0xD3, 0x5C };
+const vector_data_t aes192_set0count3 = {
+    .set_num = 0,
+    .count = 3,
+    .key = aes192_set0count3key,
+    .plain = aes192_set0count3plain,
+    .cipher = aes192_set0count3cipher,
+};
+
+const uint8_t aes192_set0count4key[] = { 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count4plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count4cipher[] = { 0xED, 0xD8, 0x07, 0xEF, 0x76, 0x52, 0xD7, 0xEB, 0x0E, 0x13, 0xC8, 0xB5, 0xE1, 0x5B, 0x3B, 0xC0 };
+const vector_data_t aes192_set0count4 = {
+    .set_num = 0,
+    .count = 4,
+    .key = aes192_set0count4key,
+    .plain = aes192_set0count4plain,
+    .cipher = aes192_set0count4cipher,
+};
+
+const uint8_t aes192_set0count5key[] = { 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count5plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count5cipher[] = { 0x99, 0x78, 0xBC, 0xF8, 0xDD, 0x8F, 0xD7, 0x22, 0x41, 0x22, 0x3A, 0xD2, 0x4B, 0x31, 0xB8, 0xA4 };
+const vector_data_t aes192_set0count5 = {
+    .set_num = 0,
+    .count = 5,
+    .key = aes192_set0count5key,
+    .plain = aes192_set0count5plain,
+    .cipher = aes192_set0count5cipher,
+};
+
+const uint8_t aes192_set0count6key[] = { 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count6plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count6cipher[] = { 0x53, 0x10, 0xF6, 0x54, 0x34, 0x3E, 0x8F, 0x27, 0xE1, 0x2C, 0x83, 0xA4, 0x8D, 0x24, 0xFF, 0x81 };
+const vector_data_t aes192_set0count6 = {
+    .set_num = 0,
+    .count = 6,
+    .key = aes192_set0count6key,
+    .plain = aes192_set0count6plain,
+    .cipher = aes192_set0count6cipher,
+};
+
+const uint8_t aes192_set0count7key[] = { 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count7plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count7cipher[] = { 0x83, 0x3F, 0x71, 0x25, 0x8D, 0x53, 0x03, 0x6B, 0x02, 0x95, 0x2C, 0x76, 0xC7, 0x44, 0xF5, 0xA1 };
+const vector_data_t aes192_set0count7 = {
+    .set_num = 0,
+    .count = 7,
+    .key = aes192_set0count7key,
+    .plain = aes192_set0count7plain,
+    .cipher = aes192_set0count7cipher,
+};
+
+const uint8_t aes192_set0count8key[] = { 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count8plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count8cipher[] = { 0xEB, 0xA8, 0x3F, 0xF2, 0x00, 0xCF, 0xF9, 0x31, 0x8A, 0x92, 0xF8, 0x69, 0x1A, 0x06, 0xB0, 0x9F };
+const vector_data_t aes192_set0count8 = {
+    .set_num = 0,
+    .count = 8,
+    .key = aes192_set0count8key,
+    .plain = aes192_set0count8plain,
+    .cipher = aes192_set0count8cipher,
+};
+
+const uint8_t aes192_set0count9key[] = { 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count9plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count9cipher[] = { 0xFF, 0x62, 0x0C, 0xCB, 0xE9, 0xF3, 0x29, 0x2A, 0xBD, 0xF2, 0x17, 0x6B, 0x09, 0xF0, 0x4E, 0xBA };
+const vector_data_t aes192_set0count9 = {
+    .set_num = 0,
+    .count = 9,
+    .key = aes192_set0count9key,
+    .plain = aes192_set0count9plain,
+    .cipher = aes192_set0count9cipher,
+};
+
+const uint8_t aes192_set0count10key[] = { 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count10plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count10cipher[] = { 0x7A, 0xBA, 0xBC, 0x4B, 0x3F, 0x51, 0x6C, 0x9A, 0xAF, 0xB3, 0x5F, 0x41, 0x40, 0xB5, 0x48, 0xF9 };
+const vector_data_t aes192_set0count10 = {
+    .set_num = 0,
+    .count = 10,
+    .key = aes192_set0count10key,
+    .plain = aes192_set0count10plain,
+    .cipher = aes192_set0count10cipher,
+};
+
+const uint8_t aes192_set0count11key[] = { 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count11plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count11cipher[] = { 0xAA, 0x18, 0x78, 0x24, 0xD9, 0xC4, 0x58, 0x2B, 0x09, 0x16, 0x49, 0x3E, 0xCB, 0xDE, 0x8C, 0x57 };
+const vector_data_t aes192_set0count11 = {
+    .set_num = 0,
+    .count = 11,
+    .key = aes192_set0count11key,
+    .plain = aes192_set0count11plain,
+    .cipher = aes192_set0count11cipher,
+};
+
+const uint8_t aes192_set0count12key[] = { 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count12plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count12cipher[] = { 0x1C, 0x0A, 0xD5, 0x53, 0x17, 0x7F, 0xD5, 0xEA, 0x10, 0x92, 0xC9, 0xD6, 0x26, 0xA2, 0x9D, 0xC4 };
+const vector_data_t aes192_set0count12 = {
+    .set_num = 0,
+    .count = 12,
+    .key = aes192_set0count12key,
+    .plain = aes192_set0count12plain,
+    .cipher = aes192_set0count12cipher,
+};
+
+const uint8_t aes192_set0count13key[] = { 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count13plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count13cipher[] = { 0xA5, 0xDC, 0x46, 0xC3, 0x72, 0x61, 0x19, 0x41, 0x24, 0xEC, 0xAE, 0xBD, 0x68, 0x04, 0x08, 0xEC };
+const vector_data_t aes192_set0count13 = {
+    .set_num = 0,
+    .count = 13,
+    .key = aes192_set0count13key,
+    .plain = aes192_set0count13plain,
+    .cipher = aes192_set0count13cipher,
+};
+
+const uint8_t aes192_set0count14key[] = { 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count14plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count14cipher[] = { 0xE4, 0xF2, 0xF2, 0xAE, 0x23, 0xE9, 0xB1, 0x0B, 0xAC, 0xFA, 0x58, 0x60, 0x15, 0x31, 0xBA, 0x54 };
+const vector_data_t aes192_set0count14 = {
+    .set_num = 0,
+    .count = 14,
+    .key = aes192_set0count14key,
+    .plain = aes192_set0count14plain,
+    .cipher = aes192_set0count14cipher,
+};
+
+const uint8_t aes192_set0count15key[] = { 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count15plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count15cipher[] = { 0xB7, 0xD6, 0x7C, 0xF1, 0xA1, 0xE9, 0x1E, 0x8F, 0xF3, 0xA5, 0x7A, 0x17, 0x2C, 0x7B, 0xF4, 0x12 };
+const vector_data_t aes192_set0count15 = {
+    .set_num = 0,
+    .count = 15,
+    .key = aes192_set0count15key,
+    .plain = aes192_set0count15plain,
+    .cipher = aes192_set0count15cipher,
+};
+
+const uint8_t aes192_set0count16key[] = { 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count16plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count16cipher[] = { 0x26, 0x70, 0x6B, 0xE0, 0x69, 0x67, 0x88, 0x4E, 0x84, 0x7D, 0x13, 0x71, 0x28, 0xCE, 0x47, 0xB3 };
+const vector_data_t aes192_set0count16 = {
+    .set_num = 0,
+    .count = 16,
+    .key = aes192_set0count16key,
+    .plain = aes192_set0count16plain,
+    .cipher = aes192_set0count16cipher,
+};
+
+const uint8_t aes192_set0count17key[] = { 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count17plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count17cipher[] = { 0xB2, 0xF8, 0xB4, 0x09, 0xB0, 0x58, 0x59, 0x09, 0xAA, 0xD3, 0xA7, 0xB5, 0xA2, 0x19, 0x07, 0x2A };
+const vector_data_t aes192_set0count17 = {
+    .set_num = 0,
+    .count = 17,
+    .key = aes192_set0count17key,
+    .plain = aes192_set0count17plain,
+    .cipher = aes192_set0count17cipher,
+};
+
+const uint8_t aes192_set0count18key[] = { 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count18plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count18cipher[] = { 0x5E, 0x4B, 0x7B, 0xFF, 0x02, 0x90, 0xC7, 0x83, 0x44, 0xC5, 0x4A, 0x23, 0xB7, 0x22, 0xCD, 0x20 };
+const vector_data_t aes192_set0count18 = {
+    .set_num = 0,
+    .count = 18,
+    .key = aes192_set0count18key,
+    .plain = aes192_set0count18plain,
+    .cipher = aes192_set0count18cipher,
+};
+
+const uint8_t aes192_set0count19key[] = { 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count19plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count19cipher[] = { 0x07, 0x09, 0x36, 0x57, 0x55, 0x2D, 0x44, 0x14, 0x22, 0x7C, 0xE1, 0x61, 0xE9, 0xEB, 0xF7, 0xDD };
+const vector_data_t aes192_set0count19 = {
+    .set_num = 0,
+    .count = 19,
+    .key = aes192_set0count19key,
+    .plain = aes192_set0count19plain,
+    .cipher = aes192_set0count19cipher,
+};
+
+const uint8_t aes192_set0count20key[] = { 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count20plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count20cipher[] = { 0xE1, 0xAF, 0x1E, 0x7D, 0x8B, 0xC2, 0x25, 0xED, 0x4D, 0xFF, 0xB7, 0x71, 0xEC, 0xBB, 0x9E, 0x67 };
+const vector_data_t aes192_set0count20 = {
+    .set_num = 0,
+    .count = 20,
+    .key = aes192_set0count20key,
+    .plain = aes192_set0count20plain,
+    .cipher = aes192_set0count20cipher,
+};
+
+const uint8_t aes192_set0count21key[] = { 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count21plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count21cipher[] = { 0xEF, 0x65, 0x55, 0x25, 0x36, 0x35, 0xD8, 0x43, 0x21, 0x56, 0xCF, 0xD9, 0xC1, 0x1B, 0x14, 0x5A };
+const vector_data_t aes192_set0count21 = {
+    .set_num = 0,
+    .count = 21,
+    .key = aes192_set0count21key,
+    .plain = aes192_set0count21plain,
+    .cipher = aes192_set0count21cipher,
+};
+
+const uint8_t aes192_set0count22key[] = { 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count22plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count22cipher[] = { 0xFB, 0x40, 0x35, 0x07, 0x4A, 0x5D, 0x42, 0x60, 0xC9, 0x0C, 0xBD, 0x6D, 0xA6, 0xC3, 0xFC, 0xEB };
+const vector_data_t aes192_set0count22 = {
+    .set_num = 0,
+    .count = 22,
+    .key = aes192_set0count22key,
+    .plain = aes192_set0count22plain,
+    .cipher = aes192_set0count22cipher,
+};
+
+const uint8_t aes192_set0count23key[] = { 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count23plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count23cipher[] = { 0x44, 0x6E, 0xE4, 0x16, 0xF9, 0xAD, 0x1C, 0x10, 0x3E, 0xB0, 0xCC, 0x96, 0x75, 0x1C, 0x88, 0xE1 };
+const vector_data_t aes192_set0count23 = {
+    .set_num = 0,
+    .count = 23,
+    .key = aes192_set0count23key,
+    .plain = aes192_set0count23plain,
+    .cipher = aes192_set0count23cipher,
+};
+
+const uint8_t aes192_set0count24key[] = { 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count24plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count24cipher[] = { 0x19, 0x8A, 0xE2, 0xA4, 0x63, 0x7A, 0xC0, 0xA7, 0x89, 0x0A, 0x8F, 0xD1, 0x48, 0x54, 0x45, 0xC9 };
+const vector_data_t aes192_set0count24 = {
+    .set_num = 0,
+    .count = 24,
+    .key = aes192_set0count24key,
+    .plain = aes192_set0count24plain,
+    .cipher = aes192_set0count24cipher,
+};
+
+const uint8_t aes192_set0count25key[] = { 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count25plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count25cipher[] = { 0x56, 0x20, 0x12, 0xEC, 0x8F, 0xAD, 0xED, 0x08, 0x25, 0xFB, 0x2F, 0xA7, 0x0A, 0xB3, 0x0C, 0xBD };
+const vector_data_t aes192_set0count25 = {
+    .set_num = 0,
+    .count = 25,
+    .key = aes192_set0count25key,
+    .plain = aes192_set0count25plain,
+    .cipher = aes192_set0count25cipher,
+};
+
+const uint8_t aes192_set0count26key[] = { 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count26plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count26cipher[] = { 0xCC, 0x8A, 0x64, 0xB4, 0x6B, 0x5D, 0x88, 0xBF, 0x7F, 0x24, 0x7D, 0x4D, 0xBA, 0xF3, 0x8F, 0x05 };
+const vector_data_t aes192_set0count26 = {
+    .set_num = 0,
+    .count = 26,
+    .key = aes192_set0count26key,
+    .plain = aes192_set0count26plain,
+    .cipher = aes192_set0count26cipher,
+};
+
+const uint8_t aes192_set0count27key[] = { 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count27plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count27cipher[] = { 0xA1, 0x68, 0x25, 0x37, 0x62, 0xE2, 0xCC, 0x81, 0xB4, 0x2D, 0x1E, 0x50, 0x01, 0x76, 0x26, 0x99 };
+const vector_data_t aes192_set0count27 = {
+    .set_num = 0,
+    .count = 27,
+    .key = aes192_set0count27key,
+    .plain = aes192_set0count27plain,
+    .cipher = aes192_set0count27cipher,
+};
+
+const uint8_t aes192_set0count28key[] = { 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count28plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count28cipher[] = { 0x1B, 0x41, 0xF8, 0x3B, 0x38, 0xCE, 0x50, 0x32, 0xC6, 0xCD, 0x7A, 0xF9, 0x8C, 0xF6, 0x20, 0x61 };
+const vector_data_t aes192_set0count28 = {
+    .set_num = 0,
+    .count = 28,
+    .key = aes192_set0count28key,
+    .plain = aes192_set0count28plain,
+    .cipher = aes192_set0count28cipher,
+};
+
+const uint8_t aes192_set0count29key[] = { 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count29plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count29cipher[] = { 0x61, 0xA8, 0x99, 0x90, 0xCD, 0x14, 0x11, 0x75, 0x0D, 0x5F, 0xB0, 0xDC, 0x98, 0x84, 0x47, 0xD4 };
+const vector_data_t aes192_set0count29 = {
+    .set_num = 0,
+    .count = 29,
+    .key = aes192_set0count29key,
+    .plain = aes192_set0count29plain,
+    .cipher = aes192_set0count29cipher,
+};
+
+const uint8_t aes192_set0count30key[] = { 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count30plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count30cipher[] = { 0xB5, 0xAC, 0xCC, 0x8E, 0xD6, 0x29, 0xED, 0xF8, 0xC6, 0x8A, 0x53, 0x91, 0x83, 0xB1, 0xEA, 0x82 };
+const vector_data_t aes192_set0count30 = {
+    .set_num = 0,
+    .count = 30,
+    .key = aes192_set0count30key,
+    .plain = aes192_set0count30plain,
+    .cipher = aes192_set0count30cipher,
+};
+
+const uint8_t aes192_set0count31key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count31plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count31cipher[] = { 0xB1, 0x6F, 0xA7, 0x1F, 0x84, 0x6B, 0x81, 0xA1, 0x3F, 0x36, 0x1C, 0x43, 0xA8, 0x51, 0xF2, 0x90 };
+const vector_data_t aes192_set0count31 = {
+    .set_num = 0,
+    .count = 31,
+    .key = aes192_set0count31key,
+    .plain = aes192_set0count31plain,
+    .cipher = aes192_set0count31cipher,
+};
+
+const uint8_t aes192_set0count32key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count32plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count32cipher[] = { 0x4F, 0xAD, 0x6E, 0xFD, 0xFF, 0x59, 0x75, 0xAE, 0xE7, 0x69, 0x22, 0x34, 0xBC, 0xD5, 0x44, 0x88 };
+const vector_data_t aes192_set0count32 = {
+    .set_num = 0,
+    .count = 32,
+    .key = aes192_set0count32key,
+    .plain = aes192_set0count32plain,
+    .cipher = aes192_set0count32cipher,
+};
+
+const uint8_t aes192_set0count33key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count33plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count33cipher[] = { 0xEB, 0xFD, 0xB0, 0x5A, 0x78, 0x3D, 0x03, 0x08, 0x2D, 0xFE, 0x5F, 0xDD, 0x80, 0xA0, 0x0B, 0x17 };
+const vector_data_t aes192_set0count33 = {
+    .set_num = 0,
+    .count = 33,
+    .key = aes192_set0count33key,
+    .plain = aes192_set0count33plain,
+    .cipher = aes192_set0count33cipher,
+};
+
+const uint8_t aes192_set0count34key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count34plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count34cipher[] = { 0xEB, 0x81, 0xB5, 0x84, 0x76, 0x69, 0x97, 0xAF, 0x6B, 0xA5, 0x52, 0x9D, 0x3B, 0xDD, 0x86, 0x09 };
+const vector_data_t aes192_set0count34 = {
+    .set_num = 0,
+    .count = 34,
+    .key = aes192_set0count34key,
+    .plain = aes192_set0count34plain,
+    .cipher = aes192_set0count34cipher,
+};
+
+const uint8_t aes192_set0count35key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count35plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count35cipher[] = { 0x0C, 0xF4, 0xFF, 0x4F, 0x49, 0xC8, 0xA0, 0xCA, 0x06, 0x0C, 0x44, 0x34, 0x99, 0xE2, 0x93, 0x13 };
+const vector_data_t aes192_set0count35 = {
+    .set_num = 0,
+    .count = 35,
+    .key = aes192_set0count35key,
+    .plain = aes192_set0count35plain,
+    .cipher = aes192_set0count35cipher,
+};
+
+const uint8_t aes192_set0count36key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count36plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count36cipher[] = { 0xCC, 0x4B, 0xA8, 0xA8, 0xE0, 0x29, 0xF8, 0xB2, 0x6D, 0x8A, 0xFF, 0xF9, 0xDF, 0x13, 0x3B, 0xB6 };
+const vector_data_t aes192_set0count36 = {
+    .set_num = 0,
+    .count = 36,
+    .key = aes192_set0count36key,
+    .plain = aes192_set0count36plain,
+    .cipher = aes192_set0count36cipher,
+};
+
+const uint8_t aes192_set0count37key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count37plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count37cipher[] = { 0xFE, 0xFE, 0xBF, 0x64, 0x36, 0x0F, 0x38, 0xE4, 0xE6, 0x35, 0x58, 0xF0, 0xFF, 0xC5, 0x50, 0xC3 };
+const vector_data_t aes192_set0count37 = {
+    .set_num = 0,
+    .count = 37,
+    .key = aes192_set0count37key,
+    .plain = aes192_set0count37plain,
+    .cipher = aes192_set0count37cipher,
+};
+
+const uint8_t aes192_set0count38key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count38plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count38cipher[] = { 0x12, 0xAD, 0x98, 0xCB, 0xF7, 0x25, 0x13, 0x7D, 0x6A, 0x81, 0x08, 0xC2, 0xBE, 0xD9, 0x93, 0x22 };
+const vector_data_t aes192_set0count38 = {
+    .set_num = 0,
+    .count = 38,
+    .key = aes192_set0count38key,
+    .plain = aes192_set0count38plain,
+    .cipher = aes192_set0count38cipher,
+};
+
+const uint8_t aes192_set0count39key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count39plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count39cipher[] = { 0x6A, 0xFA, 0xA9, 0x96, 0x22, 0x61, 0x98, 0xB3, 0xE2, 0x61, 0x04, 0x13, 0xCE, 0x1B, 0x3F, 0x78 };
+const vector_data_t aes192_set0count39 = {
+    .set_num = 0,
+    .count = 39,
+    .key = aes192_set0count39key,
+    .plain = aes192_set0count39plain,
+    .cipher = aes192_set0count39cipher,
+};
+
+const uint8_t aes192_set0count40key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count40plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count40cipher[] = { 0x2A, 0x8C, 0xE6, 0x74, 0x7A, 0x7E, 0x39, 0x36, 0x78, 0x28, 0xE2, 0x90, 0x84, 0x85, 0x02, 0xD9 };
+const vector_data_t aes192_set0count40 = {
+    .set_num = 0,
+    .count = 40,
+    .key = aes192_set0count40key,
+    .plain = aes192_set0count40plain,
+    .cipher = aes192_set0count40cipher,
+};
+
+const uint8_t aes192_set0count41key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count41plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count41cipher[] = { 0x22, 0x37, 0x36, 0xE8, 0xB8, 0xF8, 0x9C, 0xA1, 0xE3, 0x7B, 0x6D, 0xEA, 0xB4, 0x0F, 0xAC, 0xF1 };
+const vector_data_t aes192_set0count41 = {
+    .set_num = 0,
+    .count = 41,
+    .key = aes192_set0count41key,
+    .plain = aes192_set0count41plain,
+    .cipher = aes192_set0count41cipher,
+};
+
+const uint8_t aes192_set0count42key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count42plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count42cipher[] = { 0xC0, 0xF7, 0x97, 0xE5, 0x04, 0x18, 0xB9, 0x5F, 0xA6, 0x01, 0x33, 0x33, 0x91, 0x7A, 0x94, 0x80 };
+const vector_data_t aes192_set0count42 = {
+    .set_num = 0,
+    .count = 42,
+    .key = aes192_set0count42key,
+    .plain = aes192_set0count42plain,
+    .cipher = aes192_set0count42cipher,
+};
+
+const uint8_t aes192_set0count43key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count43plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count43cipher[] = { 0xA7, 0x58, 0xDE, 0x37, 0xC2, 0xEC, 0xE2, 0xA0, 0x2C, 0x73, 0xC0, 0x1F, 0xED, 0xC9, 0xA1, 0x32 };
+const vector_data_t aes192_set0count43 = {
+    .set_num = 0,
+    .count = 43,
+    .key = aes192_set0count43key,
+    .plain = aes192_set0count43plain,
+    .cipher = aes192_set0count43cipher,
+};
+
+const uint8_t aes192_set0count44key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count44plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count44cipher[] = { 0x3A, 0x9B, 0x87, 0xAE, 0x77, 0xBA, 0xE7, 0x06, 0x80, 0x39, 0x66, 0xC6, 0x6C, 0x73, 0xAD, 0xBD };
+const vector_data_t aes192_set0count44 = {
+    .set_num = 0,
+    .count = 44,
+    .key = aes192_set0count44key,
+    .plain = aes192_set0count44plain,
+    .cipher = aes192_set0count44cipher,
+};
+
+const uint8_t aes192_set0count45key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count45plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count45cipher[] = { 0xD3, 0x65, 0xAB, 0x8D, 0xF8, 0xFF, 0xD7, 0x82, 0xE3, 0x58, 0x12, 0x1A, 0x4A, 0x4F, 0xC5, 0x41 };
+const vector_data_t aes192_set0count45 = {
+    .set_num = 0,
+    .count = 45,
+    .key = aes192_set0count45key,
+    .plain = aes192_set0count45plain,
+    .cipher = aes192_set0count45cipher,
+};
+
+const uint8_t aes192_set0count46key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count46plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count46cipher[] = { 0xC8, 0xDC, 0xD9, 0xE6, 0xF7, 0x5E, 0x6C, 0x36, 0xC8, 0xDA, 0xEE, 0x04, 0x66, 0xF0, 0xED, 0x74 };
+const vector_data_t aes192_set0count46 = {
+    .set_num = 0,
+    .count = 46,
+    .key = aes192_set0count46key,
+    .plain = aes192_set0count46plain,
+    .cipher = aes192_set0count46cipher,
+};
+
+const uint8_t aes192_set0count47key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count47plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count47cipher[] = { 0xC7, 0x9A, 0x63, 0x7B, 0xEB, 0x1C, 0x03, 0x04, 0xF1, 0x40, 0x14, 0xC0, 0x37, 0xE7, 0x36, 0xDD };
+const vector_data_t aes192_set0count47 = {
+    .set_num = 0,
+    .count = 47,
+    .key = aes192_set0count47key,
+    .plain = aes192_set0count47plain,
+    .cipher = aes192_set0count47cipher,
+};
+
+const uint8_t aes192_set0count48key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count48plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count48cipher[] = { 0x10, 0x5F, 0x0A, 0x25, 0xE8, 0x4A, 0xC9, 0x30, 0xD9, 0x96, 0x28, 0x1A, 0x5F, 0x95, 0x4D, 0xD9 };
+const vector_data_t aes192_set0count48 = {
+    .set_num = 0,
+    .count = 48,
+    .key = aes192_set0count48key,
+    .plain = aes192_set0count48plain,
+    .cipher = aes192_set0count48cipher,
+};
+
+const uint8_t aes192_set0count49key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count49plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count49cipher[] = { 0x42, 0xE4, 0x07, 0x4B, 0x29, 0x27, 0x97, 0x3E, 0x8D, 0x17, 0xFF, 0xA9, 0x2F, 0x7F, 0xE6, 0x15 };
+const vector_data_t aes192_set0count49 = {
+    .set_num = 0,
+    .count = 49,
+    .key = aes192_set0count49key,
+    .plain = aes192_set0count49plain,
+    .cipher = aes192_set0count49cipher,
+};
+
+const uint8_t aes192_set0count50key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count50plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count50cipher[] = { 0x4F, 0xE2, 0xA9, 0xD2, 0xC1, 0x82, 0x44, 0x49, 0xC6, 0x9E, 0x3E, 0x03, 0x98, 0xF1, 0x29, 0x63 };
+const vector_data_t aes192_set0count50 = {
+    .set_num = 0,
+    .count = 50,
+    .key = aes192_set0count50key,
+    .plain = aes192_set0count50plain,
+    .cipher = aes192_set0count50cipher,
+};
+
+const uint8_t aes192_set0count51key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count51plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count51cipher[] = { 0xB7, 0xF2, 0x9C, 0x1E, 0x1F, 0x62, 0x84, 0x7A, 0x15, 0x25, 0x3B, 0x28, 0xA1, 0xE9, 0xD7, 0x12 };
+const vector_data_t aes192_set0count51 = {
+    .set_num = 0,
+    .count = 51,
+    .key = aes192_set0count51key,
+    .plain = aes192_set0count51plain,
+    .cipher = aes192_set0count51cipher,
+};
+
+const uint8_t aes192_set0count52key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count52plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count52cipher[] = { 0x36, 0xED, 0x5D, 0x29, 0xB9, 0x03, 0xF3, 0x1E, 0x89, 0x83, 0xEF, 0x8B, 0x0A, 0x2B, 0xF9, 0x90 };
+const vector_data_t aes192_set0count52 = {
+    .set_num = 0,
+    .count = 52,
+    .key = aes192_set0count52key,
+    .plain = aes192_set0count52plain,
+    .cipher = aes192_set0count52cipher,
+};
+
+const uint8_t aes192_set0count53key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count53plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count53cipher[] = { 0x27, 0xB8, 0x07, 0x02, 0x70, 0x81, 0x0F, 0x9D, 0x02, 0x3F, 0x9D, 0xD7, 0xFF, 0x3B, 0x4A, 0xA2 };
+const vector_data_t aes192_set0count53 = {
+    .set_num = 0,
+    .count = 53,
+    .key = aes192_set0count53key,
+    .plain = aes192_set0count53plain,
+    .cipher = aes192_set0count53cipher,
+};
+
+const uint8_t aes192_set0count54key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count54plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count54cipher[] = { 0x94, 0xD4, 0x6E, 0x15, 0x5C, 0x12, 0x28, 0xF6, 0x1D, 0x1A, 0x0D, 0xB4, 0x81, 0x5E, 0xCC, 0x4B };
+const vector_data_t aes192_set0count54 = {
+    .set_num = 0,
+    .count = 54,
+    .key = aes192_set0count54key,
+    .plain = aes192_set0count54plain,
+    .cipher = aes192_set0count54cipher,
+};
+
+const uint8_t aes192_set0count55key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count55plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count55cipher[] = { 0xCA, 0x61, 0x08, 0xD1, 0xD9, 0x80, 0x71, 0x42, 0x8E, 0xEC, 0xEE, 0xF1, 0x71, 0x4B, 0x96, 0xDD };
+const vector_data_t aes192_set0count55 = {
+    .set_num = 0,
+    .count = 55,
+    .key = aes192_set0count55key,
+    .plain = aes192_set0count55plain,
+    .cipher = aes192_set0count55cipher,
+};
+
+const uint8_t aes192_set0count56key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count56plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count56cipher[] = { 0xDC, 0x5B, 0x25, 0xB7, 0x1B, 0x62, 0x96, 0xCF, 0x73, 0xDD, 0x2C, 0xDC, 0xAC, 0x2F, 0x70, 0xB1 };
+const vector_data_t aes192_set0count56 = {
+    .set_num = 0,
+    .count = 56,
+    .key = aes192_set0count56key,
+    .plain = aes192_set0count56plain,
+    .cipher = aes192_set0count56cipher,
+};
+
+const uint8_t aes192_set0count57key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count57plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count57cipher[] = { 0x44, 0xAB, 0xA9, 0x5E, 0x8A, 0x06, 0xA2, 0xD9, 0xD3, 0x53, 0x0D, 0x26, 0x77, 0x87, 0x8C, 0x80 };
+const vector_data_t aes192_set0count57 = {
+    .set_num = 0,
+    .count = 57,
+    .key = aes192_set0count57key,
+    .plain = aes192_set0count57plain,
+    .cipher = aes192_set0count57cipher,
+};
+
+const uint8_t aes192_set0count58key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count58plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count58cipher[] = { 0xA5, 0x70, 0xD2, 0x0E, 0x89, 0xB4, 0x67, 0xE8, 0xF5, 0x17, 0x60, 0x61, 0xB8, 0x1D, 0xD3, 0x96 };
+const vector_data_t aes192_set0count58 = {
+    .set_num = 0,
+    .count = 58,
+    .key = aes192_set0count58key,
+    .plain = aes192_set0count58plain,
+    .cipher = aes192_set0count58cipher,
+};
+
+const uint8_t aes192_set0count59key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count59plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count59cipher[] = { 0x75, 0x8F, 0x44, 0x67, 0xA5, 0xD8, 0xF1, 0xE7, 0x30, 0x7D, 0xC3, 0x0B, 0x34, 0xE4, 0x04, 0xF4 };
+const vector_data_t aes192_set0count59 = {
+    .set_num = 0,
+    .count = 59,
+    .key = aes192_set0count59key,
+    .plain = aes192_set0count59plain,
+    .cipher = aes192_set0count59cipher,
+};
+
+const uint8_t aes192_set0count60key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count60plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count60cipher[] = { 0xBC, 0xEA, 0x28, 0xE9, 0x07, 0x1B, 0x5A, 0x23, 0x02, 0x97, 0x0F, 0xF3, 0x52, 0x45, 0x1B, 0xC5 };
+const vector_data_t aes192_set0count60 = {
+    .set_num = 0,
+    .count = 60,
+    .key = aes192_set0count60key,
+    .plain = aes192_set0count60plain,
+    .cipher = aes192_set0count60cipher,
+};
+
+const uint8_t aes192_set0count61key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count61plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count61cipher[] = { 0x75, 0x23, 0xC0, 0x0B, 0xC1, 0x77, 0xD3, 0x31, 0xAD, 0x31, 0x2E, 0x09, 0xC9, 0x01, 0x5C, 0x1C };
+const vector_data_t aes192_set0count61 = {
+    .set_num = 0,
+    .count = 61,
+    .key = aes192_set0count61key,
+    .plain = aes192_set0count61plain,
+    .cipher = aes192_set0count61cipher,
+};
+
+const uint8_t aes192_set0count62key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count62plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count62cipher[] = { 0xCC, 0xAC, 0x61, 0xE3, 0x18, 0x37, 0x47, 0xB3, 0xF5, 0x83, 0x6D, 0xA2, 0x1A, 0x1B, 0xC4, 0xF4 };
+const vector_data_t aes192_set0count62 = {
+    .set_num = 0,
+    .count = 62,
+    .key = aes192_set0count62key,
+    .plain = aes192_set0count62plain,
+    .cipher = aes192_set0count62cipher,
+};
+
+const uint8_t aes192_set0count63key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count63plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count63cipher[] = { 0x70, 0x7B, 0x07, 0x57, 0x91, 0x87, 0x88, 0x80, 0xB4, 0x41, 0x89, 0xD3, 0x52, 0x2B, 0x8C, 0x30 };
+const vector_data_t aes192_set0count63 = {
+    .set_num = 0,
+    .count = 63,
+    .key = aes192_set0count63key,
+    .plain = aes192_set0count63plain,
+    .cipher = aes192_set0count63cipher,
+};
+
+const uint8_t aes192_set0count64key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count64plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count64cipher[] = { 0x71, 0x32, 0xD0, 0xC0, 0xE4, 0xA0, 0x75, 0x93, 0xCF, 0x12, 0xEB, 0xB1, 0x2B, 0xE7, 0x68, 0x8C };
+const vector_data_t aes192_set0count64 = {
+    .set_num = 0,
+    .count = 64,
+    .key = aes192_set0count64key,
+    .plain = aes192_set0count64plain,
+    .cipher = aes192_set0count64cipher,
+};
+
+const uint8_t aes192_set0count65key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count65plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count65cipher[] = { 0xEF, 0xFB, 0xAC, 0x16, 0x44, 0xDE, 0xB0, 0xC7, 0x84, 0x27, 0x5F, 0xE5, 0x6E, 0x19, 0xEA, 0xD3 };
+const vector_data_t aes192_set0count65 = {
+    .set_num = 0,
+    .count = 65,
+    .key = aes192_set0count65key,
+    .plain = aes192_set0count65plain,
+    .cipher = aes192_set0count65cipher,
+};
+
+const uint8_t aes192_set0count66key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count66plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count66cipher[] = { 0xA0, 0x05, 0x06, 0x3F, 0x30, 0xF4, 0x22, 0x8B, 0x37, 0x4E, 0x24, 0x59, 0x73, 0x8F, 0x26, 0xBB };
+const vector_data_t aes192_set0count66 = {
+    .set_num = 0,
+    .count = 66,
+    .key = aes192_set0count66key,
+    .plain = aes192_set0count66plain,
+    .cipher = aes192_set0count66cipher,
+};
+
+const uint8_t aes192_set0count67key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count67plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count67cipher[] = { 0x29, 0x97, 0x5B, 0x5F, 0x48, 0xBB, 0x68, 0xFC, 0xBB, 0xC7, 0xCE, 0xA9, 0x3B, 0x45, 0x2E, 0xD7 };
+const vector_data_t aes192_set0count67 = {
+    .set_num = 0,
+    .count = 67,
+    .key = aes192_set0count67key,
+    .plain = aes192_set0count67plain,
+    .cipher = aes192_set0count67cipher,
+};
+
+const uint8_t aes192_set0count68key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count68plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count68cipher[] = { 0xCF, 0x3F, 0x25, 0x76, 0xE2, 0xAF, 0xED, 0xC7, 0x4B, 0xB1, 0xCA, 0x7E, 0xEE, 0xC1, 0xC0, 0xE7 };
+const vector_data_t aes192_set0count68 = {
+    .set_num = 0,
+    .count = 68,
+    .key = aes192_set0count68key,
+    .plain = aes192_set0count68plain,
+    .cipher = aes192_set0count68cipher,
+};
+
+const uint8_t aes192_set0count69key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count69plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count69cipher[] = { 0x07, 0xC4, 0x03, 0xF5, 0xF9, 0x66, 0xE0, 0xE3, 0xD9, 0xF2, 0x96, 0xD6, 0x22, 0x6D, 0xCA, 0x28 };
+const vector_data_t aes192_set0count69 = {
+    .set_num = 0,
+    .count = 69,
+    .key = aes192_set0count69key,
+    .plain = aes192_set0count69plain,
+    .cipher = aes192_set0count69cipher,
+};
+
+const uint8_t aes192_set0count70key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count70plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count70cipher[] = { 0xC8, 0xC2, 0x09, 0x08, 0x24, 0x9A, 0xB4, 0xA3, 0x4D, 0x6D, 0xD0, 0xA3, 0x13, 0x27, 0xFF, 0x1A };
+const vector_data_t aes192_set0count70 = {
+    .set_num = 0,
+    .count = 70,
+    .key = aes192_set0count70key,
+    .plain = aes192_set0count70plain,
+    .cipher = aes192_set0count70cipher,
+};
+
+const uint8_t aes192_set0count71key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count71plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count71cipher[] = { 0xC0, 0x54, 0x13, 0x29, 0xEC, 0xB6, 0x15, 0x9A, 0xB2, 0x3B, 0x7F, 0xC5, 0xE6, 0xA2, 0x1B, 0xCA };
+const vector_data_t aes192_set0count71 = {
+    .set_num = 0,
+    .count = 71,
+    .key = aes192_set0count71key,
+    .plain = aes192_set0count71plain,
+    .cipher = aes192_set0count71cipher,
+};
+
+const uint8_t aes192_set0count72key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count72plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count72cipher[] = { 0x7A, 0xA1, 0xAC, 0xF1, 0xA2, 0xED, 0x9B, 0xA7, 0x2B, 0xC6, 0xDE, 0xB3, 0x1D, 0x88, 0xB8, 0x63 };
+const vector_data_t aes192_set0count72 = {
+    .set_num = 0,
+    .count = 72,
+    .key = aes192_set0count72key,
+    .plain = aes192_set0count72plain,
+    .cipher = aes192_set0count72cipher,
+};
+
+const uint8_t aes192_set0count73key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count73plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count73cipher[] = { 0x80, 0x8B, 0xD8, 0xED, 0xDA, 0xBB, 0x6F, 0x3B, 0xF0, 0xD5, 0xA8, 0xA2, 0x7B, 0xE1, 0xFE, 0x8A };
+const vector_data_t aes192_set0count73 = {
+    .set_num = 0,
+    .count = 73,
+    .key = aes192_set0count73key,
+    .plain = aes192_set0count73plain,
+    .cipher = aes192_set0count73cipher,
+};
+
+const uint8_t aes192_set0count74key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count74plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count74cipher[] = { 0x27, 0x3C, 0x7D, 0x76, 0x85, 0xE1, 0x4E, 0xC6, 0x6B, 0xBB, 0x96, 0xB8, 0xF0, 0x5B, 0x6D, 0xDD };
+const vector_data_t aes192_set0count74 = {
+    .set_num = 0,
+    .count = 74,
+    .key = aes192_set0count74key,
+    .plain = aes192_set0count74plain,
+    .cipher = aes192_set0count74cipher,
+};
+
+const uint8_t aes192_set0count75key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count75plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count75cipher[] = { 0x32, 0x75, 0x2E, 0xEF, 0xC8, 0xC2, 0xA9, 0x3F, 0x91, 0xB6, 0xE7, 0x3E, 0xB0, 0x7C, 0xCA, 0x6E };
+const vector_data_t aes192_set0count75 = {
+    .set_num = 0,
+    .count = 75,
+    .key = aes192_set0count75key,
+    .plain = aes192_set0count75plain,
+    .cipher = aes192_set0count75cipher,
+};
+
+const uint8_t aes192_set0count76key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count76plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count76cipher[] = { 0xD8, 0x93, 0xE7, 0xD6, 0x2F, 0x6C, 0xE5, 0x02, 0xC6, 0x4F, 0x75, 0xE2, 0x81, 0xF9, 0xC0, 0x00 };
+const vector_data_t aes192_set0count76 = {
+    .set_num = 0,
+    .count = 76,
+    .key = aes192_set0count76key,
+    .plain = aes192_set0count76plain,
+    .cipher = aes192_set0count76cipher,
+};
+
+const uint8_t aes192_set0count77key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count77plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count77cipher[] = { 0x8D, 0xFD, 0x99, 0x9B, 0xE5, 0xD0, 0xCF, 0xA3, 0x57, 0x32, 0xC0, 0xDD, 0xC8, 0x8F, 0xF5, 0xA5 };
+const vector_data_t aes192_set0count77 = {
+    .set_num = 0,
+    .count = 77,
+    .key = aes192_set0count77key,
+    .plain = aes192_set0count77plain,
+    .cipher = aes192_set0count77cipher,
+};
+
+const uint8_t aes192_set0count78key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count78plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count78cipher[] = { 0x02, 0x64, 0x7C, 0x76, 0xA3, 0x00, 0xC3, 0x17, 0x3B, 0x84, 0x14, 0x87, 0xEB, 0x2B, 0xAE, 0x9F };
+const vector_data_t aes192_set0count78 = {
+    .set_num = 0,
+    .count = 78,
+    .key = aes192_set0count78key,
+    .plain = aes192_set0count78plain,
+    .cipher = aes192_set0count78cipher,
+};
+
+const uint8_t aes192_set0count79key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count79plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count79cipher[] = { 0x17, 0x2D, 0xF8, 0xB0, 0x2F, 0x04, 0xB5, 0x3A, 0xDA, 0xB0, 0x28, 0xB4, 0xE0, 0x1A, 0xCD, 0x87 };
+const vector_data_t aes192_set0count79 = {
+    .set_num = 0,
+    .count = 79,
+    .key = aes192_set0count79key,
+    .plain = aes192_set0count79plain,
+    .cipher = aes192_set0count79cipher,
+};
+
+const uint8_t aes192_set0count80key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count80plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count80cipher[] = { 0x05, 0x4B, 0x3B, 0xF4, 0x99, 0x8A, 0xEB, 0x05, 0xAF, 0xD8, 0x7E, 0xC5, 0x36, 0x53, 0x3A, 0x36 };
+const vector_data_t aes192_set0count80 = {
+    .set_num = 0,
+    .count = 80,
+    .key = aes192_set0count80key,
+    .plain = aes192_set0count80plain,
+    .cipher = aes192_set0count80cipher,
+};
+
+const uint8_t aes192_set0count81key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count81plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count81cipher[] = { 0x37, 0x83, 0xF7, 0xBF, 0x44, 0xC9, 0x7F, 0x06, 0x52, 0x58, 0xA6, 0x66, 0xCA, 0xE0, 0x30, 0x20 };
+const vector_data_t aes192_set0count81 = {
+    .set_num = 0,
+    .count = 81,
+    .key = aes192_set0count81key,
+    .plain = aes192_set0count81plain,
+    .cipher = aes192_set0count81cipher,
+};
+
+const uint8_t aes192_set0count82key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count82plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count82cipher[] = { 0xAA, 0xD4, 0xC8, 0xA6, 0x3F, 0x80, 0x95, 0x41, 0x04, 0xDE, 0x7B, 0x92, 0xCE, 0xDE, 0x1B, 0xE1 };
+const vector_data_t aes192_set0count82 = {
+    .set_num = 0,
+    .count = 82,
+    .key = aes192_set0count82key,
+    .plain = aes192_set0count82plain,
+    .cipher = aes192_set0count82cipher,
+};
+
+const uint8_t aes192_set0count83key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count83plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count83cipher[] = { 0xCB, 0xFE, 0x61, 0x81, 0x0F, 0xD5, 0x46, 0x7C, 0xCD, 0xAC, 0xB7, 0x58, 0x00, 0xF3, 0xAC, 0x07 };
+const vector_data_t aes192_set0count83 = {
+    .set_num = 0,
+    .count = 83,
+    .key = aes192_set0count83key,
+    .plain = aes192_set0count83plain,
+    .cipher = aes192_set0count83cipher,
+};
+
+const uint8_t aes192_set0count84key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count84plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count84cipher[] = { 0x83, 0x0D, 0x8A, 0x25, 0x90, 0xF7, 0xD8, 0xE1, 0xB5, 0x5A, 0x73, 0x7F, 0x4A, 0xF4, 0x5F, 0x34 };
+const vector_data_t aes192_set0count84 = {
+    .set_num = 0,
+    .count = 84,
+    .key = aes192_set0count84key,
+    .plain = aes192_set0count84plain,
+    .cipher = aes192_set0count84cipher,
+};
+
+const uint8_t aes192_set0count85key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count85plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count85cipher[] = { 0xFF, 0xFC, 0xD4, 0x68, 0x3F, 0x85, 0x80, 0x58, 0xE7, 0x43, 0x14, 0x67, 0x1D, 0x43, 0xFA, 0x2C };
+const vector_data_t aes192_set0count85 = {
+    .set_num = 0,
+    .count = 85,
+    .key = aes192_set0count85key,
+    .plain = aes192_set0count85plain,
+    .cipher = aes192_set0count85cipher,
+};
+
+const uint8_t aes192_set0count86key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count86plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count86cipher[] = { 0x52, 0x3D, 0x0B, 0xAB, 0xBB, 0x82, 0xF4, 0x6E, 0xBC, 0x9E, 0x70, 0xB1, 0xCD, 0x41, 0xDD, 0xD0 };
+const vector_data_t aes192_set0count86 = {
+    .set_num = 0,
+    .count = 86,
+    .key = aes192_set0count86key,
+    .plain = aes192_set0count86plain,
+    .cipher = aes192_set0count86cipher,
+};
+
+const uint8_t aes192_set0count87key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count87plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count87cipher[] = { 0x34, 0x4A, 0xAB, 0x37, 0x08, 0x0D, 0x74, 0x86, 0xF7, 0xD5, 0x42, 0xA3, 0x09, 0xE5, 0x3E, 0xED };
+const vector_data_t aes192_set0count87 = {
+    .set_num = 0,
+    .count = 87,
+    .key = aes192_set0count87key,
+    .plain = aes192_set0count87plain,
+    .cipher = aes192_set0count87cipher,
+};
+
+const uint8_t aes192_set0count88key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count88plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count88cipher[] = { 0x56, 0xC5, 0x60, 0x9D, 0x09, 0x06, 0xB2, 0x3A, 0xB9, 0xCA, 0xCA, 0x81, 0x6F, 0x5D, 0xBE, 0xBD };
+const vector_data_t aes192_set0count88 = {
+    .set_num = 0,
+    .count = 88,
+    .key = aes192_set0count88key,
+    .plain = aes192_set0count88plain,
+    .cipher = aes192_set0count88cipher,
+};
+
+const uint8_t aes192_set0count89key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count89plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count89cipher[] = { 0x70, 0x26, 0x02, 0x6E, 0xED, 0xD9, 0x1A, 0xDC, 0x6D, 0x83, 0x1C, 0xDF, 0x98, 0x94, 0xBD, 0xC6 };
+const vector_data_t aes192_set0count89 = {
+    .set_num = 0,
+    .count = 89,
+    .key = aes192_set0count89key,
+    .plain = aes192_set0count89plain,
+    .cipher = aes192_set0count89cipher,
+};
+
+const uint8_t aes192_set0count90key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count90plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count90cipher[] = { 0x88, 0x33, 0x0B, 0xAA, 0x4F, 0x2B, 0x61, 0x8F, 0xC9, 0xD9, 0xB0, 0x21, 0xBF, 0x50, 0x3D, 0x5A };
+const vector_data_t aes192_set0count90 = {
+    .set_num = 0,
+    .count = 90,
+    .key = aes192_set0count90key,
+    .plain = aes192_set0count90plain,
+    .cipher = aes192_set0count90cipher,
+};
+
+const uint8_t aes192_set0count91key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count91plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count91cipher[] = { 0xFC, 0x9E, 0x0E, 0xA2, 0x24, 0x80, 0xB0, 0xBA, 0xC9, 0x35, 0xC8, 0xA8, 0xEB, 0xEF, 0xCD, 0xCF };
+const vector_data_t aes192_set0count91 = {
+    .set_num = 0,
+    .count = 91,
+    .key = aes192_set0count91key,
+    .plain = aes192_set0count91plain,
+    .cipher = aes192_set0count91cipher,
+};
+
+const uint8_t aes192_set0count92key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count92plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count92cipher[] = { 0x29, 0xCA, 0x77, 0x9F, 0x39, 0x8F, 0xB0, 0x4F, 0x86, 0x7D, 0xA7, 0xE8, 0xA4, 0x47, 0x56, 0xCB };
+const vector_data_t aes192_set0count92 = {
+    .set_num = 0,
+    .count = 92,
+    .key = aes192_set0count92key,
+    .plain = aes192_set0count92plain,
+    .cipher = aes192_set0count92cipher,
+};
+
+const uint8_t aes192_set0count93key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count93plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count93cipher[] = { 0x51, 0xF8, 0x9C, 0x42, 0x98, 0x57, 0x86, 0xBF, 0xC4, 0x3C, 0x6D, 0xF8, 0xAD, 0xA3, 0x68, 0x32 };
+const vector_data_t aes192_set0count93 = {
+    .set_num = 0,
+    .count = 93,
+    .key = aes192_set0count93key,
+    .plain = aes192_set0count93plain,
+    .cipher = aes192_set0count93cipher,
+};
+
+const uint8_t aes192_set0count94key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count94plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count94cipher[] = { 0x6A, 0xC1, 0xDE, 0x5F, 0xB8, 0xF2, 0x1D, 0x87, 0x4E, 0x91, 0xC5, 0x3B, 0x56, 0x0C, 0x50, 0xE3 };
+const vector_data_t aes192_set0count94 = {
+    .set_num = 0,
+    .count = 94,
+    .key = aes192_set0count94key,
+    .plain = aes192_set0count94plain,
+    .cipher = aes192_set0count94cipher,
+};
+
+const uint8_t aes192_set0count95key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count95plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count95cipher[] = { 0x03, 0xAA, 0x90, 0x58, 0x49, 0x0E, 0xDA, 0x30, 0x60, 0x01, 0xA8, 0xA9, 0xF4, 0x8D, 0x0C, 0xA7 };
+const vector_data_t aes192_set0count95 = {
+    .set_num = 0,
+    .count = 95,
+    .key = aes192_set0count95key,
+    .plain = aes192_set0count95plain,
+    .cipher = aes192_set0count95cipher,
+};
+
+const uint8_t aes192_set0count96key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count96plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count96cipher[] = { 0xE3, 0x4E, 0xC7, 0x1D, 0x61, 0x28, 0xD4, 0x87, 0x18, 0x65, 0xD6, 0x17, 0xC3, 0x0B, 0x37, 0xE3 };
+const vector_data_t aes192_set0count96 = {
+    .set_num = 0,
+    .count = 96,
+    .key = aes192_set0count96key,
+    .plain = aes192_set0count96plain,
+    .cipher = aes192_set0count96cipher,
+};
+
+const uint8_t aes192_set0count97key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count97plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count97cipher[] = { 0x14, 0xBE, 0x1C, 0x53, 0x5B, 0x17, 0xCA, 0xBD, 0x0C, 0x4D, 0x93, 0x52, 0x9D, 0x69, 0xBF, 0x47 };
+const vector_data_t aes192_set0count97 = {
+    .set_num = 0,
+    .count = 97,
+    .key = aes192_set0count97key,
+    .plain = aes192_set0count97plain,
+    .cipher = aes192_set0count97cipher,
+};
+
+const uint8_t aes192_set0count98key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count98plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count98cipher[] = { 0xC9, 0xEF, 0x67, 0x75, 0x65, 0x07, 0xBE, 0xEC, 0x9D, 0xD3, 0x86, 0x28, 0x83, 0x47, 0x80, 0x44 };
+const vector_data_t aes192_set0count98 = {
+    .set_num = 0,
+    .count = 98,
+    .key = aes192_set0count98key,
+    .plain = aes192_set0count98plain,
+    .cipher = aes192_set0count98cipher,
+};
+
+const uint8_t aes192_set0count99key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count99plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count99cipher[] = { 0x40, 0xE2, 0x31, 0xFA, 0x5A, 0x59, 0x48, 0xCE, 0x21, 0x34, 0xE9, 0x2F, 0xC0, 0x66, 0x4D, 0x4B };
+const vector_data_t aes192_set0count99 = {
+    .set_num = 0,
+    .count = 99,
+    .key = aes192_set0count99key,
+    .plain = aes192_set0count99plain,
+    .cipher = aes192_set0count99cipher,
+};
+
+const uint8_t aes192_set0count100key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count100plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count100cipher[] = { 0x03, 0x19, 0x4B, 0x8E, 0x5D, 0xDA, 0x55, 0x30, 0xD0, 0xC6, 0x78, 0xC0, 0xB4, 0x8F, 0x5D, 0x92 };
+const vector_data_t aes192_set0count100 = {
+    .set_num = 0,
+    .count = 100,
+    .key = aes192_set0count100key,
+    .plain = aes192_set0count100plain,
+    .cipher = aes192_set0count100cipher,
+};
+
+const uint8_t aes192_set0count101key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count101plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count101cipher[] = { 0x90, 0xBD, 0x08, 0x6F, 0x23, 0x7C, 0xC4, 0xFD, 0x99, 0xF4, 0xD7, 0x6B, 0xDE, 0x6B, 0x48, 0x26 };
+const vector_data_t aes192_set0count101 = {
+    .set_num = 0,
+    .count = 101,
+    .key = aes192_set0count101key,
+    .plain = aes192_set0count101plain,
+    .cipher = aes192_set0count101cipher,
+};
+
+const uint8_t aes192_set0count102key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count102plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count102cipher[] = { 0x19, 0x25, 0x97, 0x61, 0xCA, 0x17, 0x13, 0x0D, 0x6E, 0xD8, 0x6D, 0x57, 0xCD, 0x79, 0x51, 0xEE };
+const vector_data_t aes192_set0count102 = {
+    .set_num = 0,
+    .count = 102,
+    .key = aes192_set0count102key,
+    .plain = aes192_set0count102plain,
+    .cipher = aes192_set0count102cipher,
+};
+
+const uint8_t aes192_set0count103key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count103plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count103cipher[] = { 0xD7, 0xCB, 0xB3, 0xF3, 0x4B, 0x9B, 0x45, 0x0F, 0x24, 0xB0, 0xE8, 0x51, 0x8E, 0x54, 0xDA, 0x6D };
+const vector_data_t aes192_set0count103 = {
+    .set_num = 0,
+    .count = 103,
+    .key = aes192_set0count103key,
+    .plain = aes192_set0count103plain,
+    .cipher = aes192_set0count103cipher,
+};
+
+const uint8_t aes192_set0count104key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count104plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count104cipher[] = { 0x72, 0x5B, 0x9C, 0xAE, 0xBE, 0x9F, 0x7F, 0x41, 0x7F, 0x40, 0x68, 0xD0, 0xD2, 0xEE, 0x20, 0xB3 };
+const vector_data_t aes192_set0count104 = {
+    .set_num = 0,
+    .count = 104,
+    .key = aes192_set0count104key,
+    .plain = aes192_set0count104plain,
+    .cipher = aes192_set0count104cipher,
+};
+
+const uint8_t aes192_set0count105key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count105plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count105cipher[] = { 0x9D, 0x92, 0x4B, 0x93, 0x4A, 0x90, 0xCE, 0x1F, 0xD3, 0x9B, 0x8A, 0x97, 0x94, 0xF8, 0x26, 0x72 };
+const vector_data_t aes192_set0count105 = {
+    .set_num = 0,
+    .count = 105,
+    .key = aes192_set0count105key,
+    .plain = aes192_set0count105plain,
+    .cipher = aes192_set0count105cipher,
+};
+
+const uint8_t aes192_set0count106key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count106plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count106cipher[] = { 0xC5, 0x05, 0x62, 0xBF, 0x09, 0x45, 0x26, 0xA9, 0x1C, 0x5B, 0xC6, 0x3C, 0x0C, 0x22, 0x49, 0x95 };
+const vector_data_t aes192_set0count106 = {
+    .set_num = 0,
+    .count = 106,
+    .key = aes192_set0count106key,
+    .plain = aes192_set0count106plain,
+    .cipher = aes192_set0count106cipher,
+};
+
+const uint8_t aes192_set0count107key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count107plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count107cipher[] = { 0xD2, 0xF1, 0x18, 0x05, 0x04, 0x67, 0x43, 0xBD, 0x74, 0xF5, 0x71, 0x88, 0xD9, 0x18, 0x8D, 0xF7 };
+const vector_data_t aes192_set0count107 = {
+    .set_num = 0,
+    .count = 107,
+    .key = aes192_set0count107key,
+    .plain = aes192_set0count107plain,
+    .cipher = aes192_set0count107cipher,
+};
+
+const uint8_t aes192_set0count108key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count108plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count108cipher[] = { 0x8D, 0xD2, 0x74, 0xBD, 0x0F, 0x1B, 0x58, 0xAE, 0x34, 0x5D, 0x9E, 0x72, 0x33, 0xF9, 0xB8, 0xF3 };
+const vector_data_t aes192_set0count108 = {
+    .set_num = 0,
+    .count = 108,
+    .key = aes192_set0count108key,
+    .plain = aes192_set0count108plain,
+    .cipher = aes192_set0count108cipher,
+};
+
+const uint8_t aes192_set0count109key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count109plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count109cipher[] = { 0x9D, 0x6B, 0xDC, 0x8F, 0x4C, 0xE5, 0xFE, 0xB0, 0xF3, 0xBE, 0xD2, 0xE4, 0xB9, 0xA9, 0xBB, 0x0B };
+const vector_data_t aes192_set0count109 = {
+    .set_num = 0,
+    .count = 109,
+    .key = aes192_set0count109key,
+    .plain = aes192_set0count109plain,
+    .cipher = aes192_set0count109cipher,
+};
+
+const uint8_t aes192_set0count110key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count110plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count110cipher[] = { 0xFD, 0x55, 0x48, 0xBC, 0xF3, 0xF4, 0x25, 0x65, 0xF7, 0xEF, 0xA9, 0x45, 0x62, 0x52, 0x8D, 0x46 };
+const vector_data_t aes192_set0count110 = {
+    .set_num = 0,
+    .count = 110,
+    .key = aes192_set0count110key,
+    .plain = aes192_set0count110plain,
+    .cipher = aes192_set0count110cipher,
+};
+
+const uint8_t aes192_set0count111key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count111plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count111cipher[] = { 0xD2, 0xCC, 0xAE, 0xBD, 0x3A, 0x4C, 0x3E, 0x80, 0xB0, 0x63, 0x74, 0x81, 0x31, 0xBA, 0x4A, 0x71 };
+const vector_data_t aes192_set0count111 = {
+    .set_num = 0,
+    .count = 111,
+    .key = aes192_set0count111key,
+    .plain = aes192_set0count111plain,
+    .cipher = aes192_set0count111cipher,
+};
+
+const uint8_t aes192_set0count112key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count112plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count112cipher[] = { 0xE0, 0x3C, 0xB2, 0x3D, 0x9E, 0x11, 0xC9, 0xD9, 0x3F, 0x11, 0x7E, 0x9C, 0x0A, 0x91, 0xB5, 0x76 };
+const vector_data_t aes192_set0count112 = {
+    .set_num = 0,
+    .count = 112,
+    .key = aes192_set0count112key,
+    .plain = aes192_set0count112plain,
+    .cipher = aes192_set0count112cipher,
+};
+
+const uint8_t aes192_set0count113key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count113plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count113cipher[] = { 0x78, 0xF9, 0x33, 0xA2, 0x08, 0x1A, 0xC1, 0xDB, 0x84, 0xF6, 0x9D, 0x10, 0xF4, 0x52, 0x3F, 0xE0 };
+const vector_data_t aes192_set0count113 = {
+    .set_num = 0,
+    .count = 113,
+    .key = aes192_set0count113key,
+    .plain = aes192_set0count113plain,
+    .cipher = aes192_set0count113cipher,
+};
+
+const uint8_t aes192_set0count114key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count114plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count114cipher[] = { 0x40, 0x61, 0xF7, 0x41, 0x2E, 0xD3, 0x20, 0xDE, 0x0E, 0xDC, 0x88, 0x51, 0xC2, 0xE2, 0x43, 0x6F };
+const vector_data_t aes192_set0count114 = {
+    .set_num = 0,
+    .count = 114,
+    .key = aes192_set0count114key,
+    .plain = aes192_set0count114plain,
+    .cipher = aes192_set0count114cipher,
+};
+
+const uint8_t aes192_set0count115key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count115plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count115cipher[] = { 0x90, 0x64, 0xBA, 0x1C, 0xD0, 0x4C, 0xE6, 0xBA, 0xB9, 0x84, 0x74, 0x33, 0x08, 0x14, 0xB4, 0xD4 };
+const vector_data_t aes192_set0count115 = {
+    .set_num = 0,
+    .count = 115,
+    .key = aes192_set0count115key,
+    .plain = aes192_set0count115plain,
+    .cipher = aes192_set0count115cipher,
+};
+
+const uint8_t aes192_set0count116key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count116plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count116cipher[] = { 0x48, 0x39, 0x1B, 0xFF, 0xB9, 0xCF, 0xFF, 0x80, 0xAC, 0x23, 0x8C, 0x88, 0x6E, 0xF0, 0xA4, 0x61 };
+const vector_data_t aes192_set0count116 = {
+    .set_num = 0,
+    .count = 116,
+    .key = aes192_set0count116key,
+    .plain = aes192_set0count116plain,
+    .cipher = aes192_set0count116cipher,
+};
+
+const uint8_t aes192_set0count117key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count117plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count117cipher[] = { 0xB8, 0xD2, 0xA6, 0x7D, 0xF5, 0xA9, 0x99, 0xFD, 0xBF, 0x93, 0xED, 0xD0, 0x34, 0x32, 0x96, 0xC9 };
+const vector_data_t aes192_set0count117 = {
+    .set_num = 0,
+    .count = 117,
+    .key = aes192_set0count117key,
+    .plain = aes192_set0count117plain,
+    .cipher = aes192_set0count117cipher,
+};
+
+const uint8_t aes192_set0count118key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count118plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count118cipher[] = { 0xAA, 0xCA, 0x73, 0x67, 0x39, 0x6B, 0x69, 0xA2, 0x21, 0xBD, 0x63, 0x2B, 0xEA, 0x38, 0x6E, 0xEC };
+const vector_data_t aes192_set0count118 = {
+    .set_num = 0,
+    .count = 118,
+    .key = aes192_set0count118key,
+    .plain = aes192_set0count118plain,
+    .cipher = aes192_set0count118cipher,
+};
+
+const uint8_t aes192_set0count119key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count119plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count119cipher[] = { 0xA8, 0x0F, 0xD5, 0x02, 0x0D, 0xFE, 0x65, 0xF5, 0xF1, 0x62, 0x93, 0xEC, 0x92, 0xC6, 0xFD, 0x89 };
+const vector_data_t aes192_set0count119 = {
+    .set_num = 0,
+    .count = 119,
+    .key = aes192_set0count119key,
+    .plain = aes192_set0count119plain,
+    .cipher = aes192_set0count119cipher,
+};
+
+const uint8_t aes192_set0count120key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count120plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count120cipher[] = { 0x21, 0x62, 0x99, 0x5B, 0x82, 0x17, 0xA6, 0x7F, 0x1A, 0xBC, 0x34, 0x2E, 0x14, 0x64, 0x06, 0xF8 };
+const vector_data_t aes192_set0count120 = {
+    .set_num = 0,
+    .count = 120,
+    .key = aes192_set0count120key,
+    .plain = aes192_set0count120plain,
+    .cipher = aes192_set0count120cipher,
+};
+
+const uint8_t aes192_set0count121key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count121plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count121cipher[] = { 0xC6, 0xA6, 0x16, 0x4B, 0x7A, 0x60, 0xBA, 0xE4, 0xE9, 0x86, 0xFF, 0xAC, 0x28, 0xDF, 0xAD, 0xD9 };
+const vector_data_t aes192_set0count121 = {
+    .set_num = 0,
+    .count = 121,
+    .key = aes192_set0count121key,
+    .plain = aes192_set0count121plain,
+    .cipher = aes192_set0count121cipher,
+};
+
+const uint8_t aes192_set0count122key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count122plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count122cipher[] = { 0x64, 0xE0, 0xD7, 0xF9, 0x00, 0xE3, 0xD9, 0xC8, 0x3E, 0x4B, 0x8F, 0x96, 0x71, 0x7B, 0x21, 0x46 };
+const vector_data_t aes192_set0count122 = {
+    .set_num = 0,
+    .count = 122,
+    .key = aes192_set0count122key,
+    .plain = aes192_set0count122plain,
+    .cipher = aes192_set0count122cipher,
+};
+
+const uint8_t aes192_set0count123key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count123plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count123cipher[] = { 0x1A, 0xD2, 0x56, 0x1D, 0xE8, 0xC1, 0x23, 0x2F, 0x5D, 0x8D, 0xBA, 0xB4, 0x73, 0x9B, 0x6C, 0xBB };
+const vector_data_t aes192_set0count123 = {
+    .set_num = 0,
+    .count = 123,
+    .key = aes192_set0count123key,
+    .plain = aes192_set0count123plain,
+    .cipher = aes192_set0count123cipher,
+};
+
+const uint8_t aes192_set0count124key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count124plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count124cipher[] = { 0x27, 0x96, 0x89, 0xE9, 0xA5, 0x57, 0xF5, 0x8B, 0x1C, 0x3B, 0xF4, 0x0C, 0x97, 0xA9, 0x09, 0x64 };
+const vector_data_t aes192_set0count124 = {
+    .set_num = 0,
+    .count = 124,
+    .key = aes192_set0count124key,
+    .plain = aes192_set0count124plain,
+    .cipher = aes192_set0count124cipher,
+};
+
+const uint8_t aes192_set0count125key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count125plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count125cipher[] = { 0xC4, 0x63, 0x7E, 0x4A, 0x5E, 0x63, 0x77, 0xF9, 0xCC, 0x5A, 0x86, 0x38, 0x04, 0x5D, 0xE0, 0x29 };
+const vector_data_t aes192_set0count125 = {
+    .set_num = 0,
+    .count = 125,
+    .key = aes192_set0count125key,
+    .plain = aes192_set0count125plain,
+    .cipher = aes192_set0count125cipher,
+};
+
+const uint8_t aes192_set0count126key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count126plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count126cipher[] = { 0x49, 0x2E, 0x60, 0x7E, 0x5A, 0xEA, 0x46, 0x88, 0x59, 0x4B, 0x45, 0xF3, 0xAE, 0xE3, 0xDF, 0x90 };
+const vector_data_t aes192_set0count126 = {
+    .set_num = 0,
+    .count = 126,
+    .key = aes192_set0count126key,
+    .plain = aes192_set0count126plain,
+    .cipher = aes192_set0count126cipher,
+};
+
+const uint8_t aes192_set0count127key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count127plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count127cipher[] = { 0xE8, 0xC4, 0xE4, 0x38, 0x1F, 0xEE, 0xC7, 0x40, 0x54, 0x95, 0x4C, 0x05, 0xB7, 0x77, 0xA0, 0x0A };
+const vector_data_t aes192_set0count127 = {
+    .set_num = 0,
+    .count = 127,
+    .key = aes192_set0count127key,
+    .plain = aes192_set0count127plain,
+    .cipher = aes192_set0count127cipher,
+};
+
+const uint8_t aes192_set0count128key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count128plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count128cipher[] = { 0x91, 0x54, 0x95, 0x14, 0x60, 0x5F, 0x38, 0x24, 0x6C, 0x9B, 0x72, 0x4A, 0xD8, 0x39, 0xF0, 0x1D };
+const vector_data_t aes192_set0count128 = {
+    .set_num = 0,
+    .count = 128,
+    .key = aes192_set0count128key,
+    .plain = aes192_set0count128plain,
+    .cipher = aes192_set0count128cipher,
+};
+
+const uint8_t aes192_set0count129key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count129plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count129cipher[] = { 0x74, 0xB2, 0x4E, 0x3B, 0x6F, 0xEF, 0xE4, 0x0A, 0x4F, 0x9E, 0xF7, 0xAC, 0x6E, 0x44, 0xD7, 0x6A };
+const vector_data_t aes192_set0count129 = {
+    .set_num = 0,
+    .count = 129,
+    .key = aes192_set0count129key,
+    .plain = aes192_set0count129plain,
+    .cipher = aes192_set0count129cipher,
+};
+
+const uint8_t aes192_set0count130key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count130plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count130cipher[] = { 0x24, 0x37, 0xA6, 0x83, 0xDC, 0x5D, 0x4B, 0x52, 0xAB, 0xB4, 0xA1, 0x23, 0xA8, 0xDF, 0x86, 0xC6 };
+const vector_data_t aes192_set0count130 = {
+    .set_num = 0,
+    .count = 130,
+    .key = aes192_set0count130key,
+    .plain = aes192_set0count130plain,
+    .cipher = aes192_set0count130cipher,
+};
+
+const uint8_t aes192_set0count131key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count131plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count131cipher[] = { 0xBB, 0x28, 0x52, 0xC8, 0x91, 0xC5, 0x94, 0x7D, 0x2E, 0xD4, 0x40, 0x32, 0xC4, 0x21, 0xB8, 0x5F };
+const vector_data_t aes192_set0count131 = {
+    .set_num = 0,
+    .count = 131,
+    .key = aes192_set0count131key,
+    .plain = aes192_set0count131plain,
+    .cipher = aes192_set0count131cipher,
+};
+
+const uint8_t aes192_set0count132key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count132plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count132cipher[] = { 0x1B, 0x9F, 0x5F, 0xBD, 0x5E, 0x8A, 0x42, 0x64, 0xC0, 0xA8, 0x5B, 0x80, 0x40, 0x9A, 0xFA, 0x5E };
+const vector_data_t aes192_set0count132 = {
+    .set_num = 0,
+    .count = 132,
+    .key = aes192_set0count132key,
+    .plain = aes192_set0count132plain,
+    .cipher = aes192_set0count132cipher,
+};
+
+const uint8_t aes192_set0count133key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count133plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count133cipher[] = { 0x30, 0xDA, 0xB8, 0x09, 0xF8, 0x5A, 0x91, 0x7F, 0xE9, 0x24, 0x73, 0x3F, 0x42, 0x4A, 0xC5, 0x89 };
+const vector_data_t aes192_set0count133 = {
+    .set_num = 0,
+    .count = 133,
+    .key = aes192_set0count133key,
+    .plain = aes192_set0count133plain,
+    .cipher = aes192_set0count133cipher,
+};
+
+const uint8_t aes192_set0count134key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count134plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count134cipher[] = { 0xEA, 0xEF, 0x5C, 0x1F, 0x8D, 0x60, 0x51, 0x92, 0x64, 0x66, 0x95, 0xCE, 0xAD, 0xC6, 0x5F, 0x32 };
+const vector_data_t aes192_set0count134 = {
+    .set_num = 0,
+    .count = 134,
+    .key = aes192_set0count134key,
+    .plain = aes192_set0count134plain,
+    .cipher = aes192_set0count134cipher,
+};
+
+const uint8_t aes192_set0count135key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count135plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count135cipher[] = { 0xB8, 0xAA, 0x90, 0x04, 0x0B, 0x4C, 0x15, 0xA1, 0x23, 0x16, 0xB7, 0x8E, 0x0F, 0x95, 0x86, 0xFC };
+const vector_data_t aes192_set0count135 = {
+    .set_num = 0,
+    .count = 135,
+    .key = aes192_set0count135key,
+    .plain = aes192_set0count135plain,
+    .cipher = aes192_set0count135cipher,
+};
+
+const uint8_t aes192_set0count136key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count136plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count136cipher[] = { 0x97, 0xFA, 0xC8, 0x29, 0x7C, 0xEA, 0xAB, 0xC8, 0x7D, 0x45, 0x43, 0x50, 0x60, 0x1E, 0x06, 0x73 };
+const vector_data_t aes192_set0count136 = {
+    .set_num = 0,
+    .count = 136,
+    .key = aes192_set0count136key,
+    .plain = aes192_set0count136plain,
+    .cipher = aes192_set0count136cipher,
+};
+
+const uint8_t aes192_set0count137key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count137plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count137cipher[] = { 0x9B, 0x47, 0xEF, 0x56, 0x7A, 0xC2, 0x8D, 0xFE, 0x48, 0x84, 0x92, 0xF1, 0x57, 0xE2, 0xB2, 0xE0 };
+const vector_data_t aes192_set0count137 = {
+    .set_num = 0,
+    .count = 137,
+    .key = aes192_set0count137key,
+    .plain = aes192_set0count137plain,
+    .cipher = aes192_set0count137cipher,
+};
+
+const uint8_t aes192_set0count138key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count138plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count138cipher[] = { 0x1B, 0x84, 0x26, 0x02, 0x7D, 0xDB, 0x96, 0x2B, 0x5C, 0x5B, 0xA7, 0xEB, 0x8B, 0xC9, 0xAB, 0x63 };
+const vector_data_t aes192_set0count138 = {
+    .set_num = 0,
+    .count = 138,
+    .key = aes192_set0count138key,
+    .plain = aes192_set0count138plain,
+    .cipher = aes192_set0count138cipher,
+};
+
+const uint8_t aes192_set0count139key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count139plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count139cipher[] = { 0xE9, 0x17, 0xFC, 0x77, 0xE7, 0x19, 0x92, 0xA1, 0x2D, 0xBE, 0x4C, 0x18, 0x06, 0x8B, 0xEC, 0x82 };
+const vector_data_t aes192_set0count139 = {
+    .set_num = 0,
+    .count = 139,
+    .key = aes192_set0count139key,
+    .plain = aes192_set0count139plain,
+    .cipher = aes192_set0count139cipher,
+};
+
+const uint8_t aes192_set0count140key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count140plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count140cipher[] = { 0xDC, 0xEE, 0xBB, 0xC9, 0x88, 0x40, 0xF8, 0xAE, 0x6D, 0xAF, 0x76, 0x57, 0x3B, 0x7E, 0x56, 0xF4 };
+const vector_data_t aes192_set0count140 = {
+    .set_num = 0,
+    .count = 140,
+    .key = aes192_set0count140key,
+    .plain = aes192_set0count140plain,
+    .cipher = aes192_set0count140cipher,
+};
+
+const uint8_t aes192_set0count141key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count141plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count141cipher[] = { 0x4E, 0x11, 0xA9, 0xF7, 0x42, 0x05, 0x12, 0x5B, 0x61, 0xE0, 0xAE, 0xE0, 0x47, 0xEC, 0xA2, 0x0D };
+const vector_data_t aes192_set0count141 = {
+    .set_num = 0,
+    .count = 141,
+    .key = aes192_set0count141key,
+    .plain = aes192_set0count141plain,
+    .cipher = aes192_set0count141cipher,
+};
+
+const uint8_t aes192_set0count142key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count142plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count142cipher[] = { 0xF6, 0x04, 0x67, 0xF5, 0x5A, 0x1F, 0x17, 0xEA, 0xB8, 0x8E, 0x80, 0x01, 0x20, 0xCB, 0xC2, 0x84 };
+const vector_data_t aes192_set0count142 = {
+    .set_num = 0,
+    .count = 142,
+    .key = aes192_set0count142key,
+    .plain = aes192_set0count142plain,
+    .cipher = aes192_set0count142cipher,
+};
+
+const uint8_t aes192_set0count143key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count143plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count143cipher[] = { 0xD4, 0x36, 0x64, 0x9F, 0x60, 0x0B, 0x44, 0x9E, 0xE2, 0x76, 0x53, 0x0F, 0x0C, 0xD8, 0x3C, 0x11 };
+const vector_data_t aes192_set0count143 = {
+    .set_num = 0,
+    .count = 143,
+    .key = aes192_set0count143key,
+    .plain = aes192_set0count143plain,
+    .cipher = aes192_set0count143cipher,
+};
+
+const uint8_t aes192_set0count144key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count144plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count144cipher[] = { 0x3B, 0xC0, 0xE3, 0x65, 0x6A, 0x9E, 0x3A, 0xC7, 0xCD, 0x37, 0x8A, 0x73, 0x7F, 0x53, 0xB6, 0x37 };
+const vector_data_t aes192_set0count144 = {
+    .set_num = 0,
+    .count = 144,
+    .key = aes192_set0count144key,
+    .plain = aes192_set0count144plain,
+    .cipher = aes192_set0count144cipher,
+};
+
+const uint8_t aes192_set0count145key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count145plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count145cipher[] = { 0x6B, 0xAC, 0xAE, 0x63, 0xD3, 0x3B, 0x92, 0x8A, 0xA8, 0x38, 0x0F, 0x8D, 0x54, 0xD8, 0x8C, 0x17 };
+const vector_data_t aes192_set0count145 = {
+    .set_num = 0,
+    .count = 145,
+    .key = aes192_set0count145key,
+    .plain = aes192_set0count145plain,
+    .cipher = aes192_set0count145cipher,
+};
+
+const uint8_t aes192_set0count146key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count146plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count146cipher[] = { 0x89, 0x35, 0xFF, 0xBC, 0x75, 0xAE, 0x62, 0x51, 0xBF, 0x8E, 0x85, 0x9F, 0x08, 0x5A, 0xDC, 0xB9 };
+const vector_data_t aes192_set0count146 = {
+    .set_num = 0,
+    .count = 146,
+    .key = aes192_set0count146key,
+    .plain = aes192_set0count146plain,
+    .cipher = aes192_set0count146cipher,
+};
+
+const uint8_t aes192_set0count147key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count147plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count147cipher[] = { 0x93, 0xDC, 0x49, 0x70, 0xFE, 0x35, 0xF6, 0x77, 0x47, 0xCB, 0x05, 0x62, 0xC0, 0x6D, 0x87, 0x5A };
+const vector_data_t aes192_set0count147 = {
+    .set_num = 0,
+    .count = 147,
+    .key = aes192_set0count147key,
+    .plain = aes192_set0count147plain,
+    .cipher = aes192_set0count147cipher,
+};
+
+const uint8_t aes192_set0count148key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count148plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count148cipher[] = { 0x14, 0xF9, 0xDF, 0x85, 0x89, 0x75, 0x85, 0x17, 0x97, 0xBA, 0x60, 0x4F, 0xB0, 0xD1, 0x6C, 0xC7 };
+const vector_data_t aes192_set0count148 = {
+    .set_num = 0,
+    .count = 148,
+    .key = aes192_set0count148key,
+    .plain = aes192_set0count148plain,
+    .cipher = aes192_set0count148cipher,
+};
+
+const uint8_t aes192_set0count149key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count149plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count149cipher[] = { 0x02, 0xEA, 0x0C, 0x98, 0xDC, 0xA1, 0x0B, 0x38, 0xC2, 0x1B, 0x3B, 0x14, 0xE8, 0xD1, 0xB7, 0x1F };
+const vector_data_t aes192_set0count149 = {
+    .set_num = 0,
+    .count = 149,
+    .key = aes192_set0count149key,
+    .plain = aes192_set0count149plain,
+    .cipher = aes192_set0count149cipher,
+};
+
+const uint8_t aes192_set0count150key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count150plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count150cipher[] = { 0x8F, 0x09, 0x1B, 0x1B, 0x5B, 0x07, 0x49, 0xB2, 0xAD, 0xC8, 0x03, 0xE6, 0x3D, 0xDA, 0x9B, 0x72 };
+const vector_data_t aes192_set0count150 = {
+    .set_num = 0,
+    .count = 150,
+    .key = aes192_set0count150key,
+    .plain = aes192_set0count150plain,
+    .cipher = aes192_set0count150cipher,
+};
+
+const uint8_t aes192_set0count151key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count151plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count151cipher[] = { 0x05, 0xB3, 0x89, 0xE3, 0x32, 0x2C, 0x6D, 0xA0, 0x83, 0x84, 0x34, 0x5A, 0x41, 0x37, 0xFD, 0x08 };
+const vector_data_t aes192_set0count151 = {
+    .set_num = 0,
+    .count = 151,
+    .key = aes192_set0count151key,
+    .plain = aes192_set0count151plain,
+    .cipher = aes192_set0count151cipher,
+};
+
+const uint8_t aes192_set0count152key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count152plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count152cipher[] = { 0x38, 0x13, 0x08, 0xC4, 0x38, 0xF3, 0x5B, 0x39, 0x9F, 0x10, 0xAD, 0x71, 0xB0, 0x50, 0x27, 0xD8 };
+const vector_data_t aes192_set0count152 = {
+    .set_num = 0,
+    .count = 152,
+    .key = aes192_set0count152key,
+    .plain = aes192_set0count152plain,
+    .cipher = aes192_set0count152cipher,
+};
+
+const uint8_t aes192_set0count153key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count153plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count153cipher[] = { 0x68, 0xC2, 0x30, 0xFC, 0xFA, 0x92, 0x79, 0xC3, 0x40, 0x9F, 0xC4, 0x23, 0xE2, 0xAC, 0xBE, 0x04 };
+const vector_data_t aes192_set0count153 = {
+    .set_num = 0,
+    .count = 153,
+    .key = aes192_set0count153key,
+    .plain = aes192_set0count153plain,
+    .cipher = aes192_set0count153cipher,
+};
+
+const uint8_t aes192_set0count154key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count154plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count154cipher[] = { 0x1C, 0x84, 0xA4, 0x75, 0xAC, 0xB0, 0x11, 0xF3, 0xF5, 0x9F, 0x4F, 0x46, 0xB7, 0x62, 0x74, 0xC0 };
+const vector_data_t aes192_set0count154 = {
+    .set_num = 0,
+    .count = 154,
+    .key = aes192_set0count154key,
+    .plain = aes192_set0count154plain,
+    .cipher = aes192_set0count154cipher,
+};
+
+const uint8_t aes192_set0count155key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count155plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count155cipher[] = { 0x45, 0x11, 0x9B, 0x68, 0xCB, 0x3F, 0x83, 0x99, 0xEE, 0x60, 0x06, 0x6B, 0x56, 0x11, 0xA4, 0xD7 };
+const vector_data_t aes192_set0count155 = {
+    .set_num = 0,
+    .count = 155,
+    .key = aes192_set0count155key,
+    .plain = aes192_set0count155plain,
+    .cipher = aes192_set0count155cipher,
+};
+
+const uint8_t aes192_set0count156key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count156plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count156cipher[] = { 0x94, 0x23, 0x76, 0x2F, 0x52, 0x7A, 0x40, 0x60, 0xFF, 0xCA, 0x31, 0x2D, 0xCC, 0xA2, 0x2A, 0x16 };
+const vector_data_t aes192_set0count156 = {
+    .set_num = 0,
+    .count = 156,
+    .key = aes192_set0count156key,
+    .plain = aes192_set0count156plain,
+    .cipher = aes192_set0count156cipher,
+};
+
+const uint8_t aes192_set0count157key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count157plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count157cipher[] = { 0xF3, 0x61, 0xA2, 0x74, 0x5A, 0x33, 0xF0, 0x56, 0xA5, 0xAC, 0x6A, 0xCE, 0x2F, 0x08, 0xE3, 0x44 };
+const vector_data_t aes192_set0count157 = {
+    .set_num = 0,
+    .count = 157,
+    .key = aes192_set0count157key,
+    .plain = aes192_set0count157plain,
+    .cipher = aes192_set0count157cipher,
+};
+
+const uint8_t aes192_set0count158key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count158plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count158cipher[] = { 0x5E, 0xF1, 0x45, 0x76, 0x6E, 0xCA, 0x84, 0x9F, 0x5D, 0x01, 0x15, 0x36, 0xA6, 0x55, 0x7F, 0xDB };
+const vector_data_t aes192_set0count158 = {
+    .set_num = 0,
+    .count = 158,
+    .key = aes192_set0count158key,
+    .plain = aes192_set0count158plain,
+    .cipher = aes192_set0count158cipher,
+};
+
+const uint8_t aes192_set0count159key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count159plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count159cipher[] = { 0xC9, 0xAF, 0x27, 0xB2, 0xC8, 0x9C, 0x9B, 0x4C, 0xF4, 0xA0, 0xC4, 0x10, 0x6A, 0xC8, 0x03, 0x18 };
+const vector_data_t aes192_set0count159 = {
+    .set_num = 0,
+    .count = 159,
+    .key = aes192_set0count159key,
+    .plain = aes192_set0count159plain,
+    .cipher = aes192_set0count159cipher,
+};
+
+const uint8_t aes192_set0count160key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count160plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count160cipher[] = { 0xFB, 0x9C, 0x4F, 0x16, 0xC6, 0x21, 0xF4, 0xEA, 0xB7, 0xE9, 0xAC, 0x1D, 0x75, 0x51, 0xDD, 0x57 };
+const vector_data_t aes192_set0count160 = {
+    .set_num = 0,
+    .count = 160,
+    .key = aes192_set0count160key,
+    .plain = aes192_set0count160plain,
+    .cipher = aes192_set0count160cipher,
+};
+
+const uint8_t aes192_set0count161key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count161plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count161cipher[] = { 0x13, 0x8E, 0x06, 0xFB, 0xA4, 0x66, 0xFA, 0x70, 0x85, 0x4D, 0x8C, 0x2E, 0x52, 0x4C, 0xFF, 0xB2 };
+const vector_data_t aes192_set0count161 = {
+    .set_num = 0,
+    .count = 161,
+    .key = aes192_set0count161key,
+    .plain = aes192_set0count161plain,
+    .cipher = aes192_set0count161cipher,
+};
+
+const uint8_t aes192_set0count162key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count162plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count162cipher[] = { 0xFB, 0x4B, 0xC7, 0x8B, 0x22, 0x50, 0x70, 0x77, 0x3F, 0x04, 0xC4, 0x04, 0x66, 0xD4, 0xE9, 0x0C };
+const vector_data_t aes192_set0count162 = {
+    .set_num = 0,
+    .count = 162,
+    .key = aes192_set0count162key,
+    .plain = aes192_set0count162plain,
+    .cipher = aes192_set0count162cipher,
+};
+
+const uint8_t aes192_set0count163key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count163plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count163cipher[] = { 0x8B, 0x2C, 0xBF, 0xF1, 0xED, 0x01, 0x50, 0xFE, 0xDA, 0x8A, 0x47, 0x99, 0xBE, 0x94, 0x55, 0x1F };
+const vector_data_t aes192_set0count163 = {
+    .set_num = 0,
+    .count = 163,
+    .key = aes192_set0count163key,
+    .plain = aes192_set0count163plain,
+    .cipher = aes192_set0count163cipher,
+};
+
+const uint8_t aes192_set0count164key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count164plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count164cipher[] = { 0x08, 0xB3, 0x0D, 0x7B, 0x3F, 0x27, 0x96, 0x27, 0x09, 0xA3, 0x6B, 0xCA, 0xDF, 0xB9, 0x74, 0xBD };
+const vector_data_t aes192_set0count164 = {
+    .set_num = 0,
+    .count = 164,
+    .key = aes192_set0count164key,
+    .plain = aes192_set0count164plain,
+    .cipher = aes192_set0count164cipher,
+};
+
+const uint8_t aes192_set0count165key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count165plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count165cipher[] = { 0xFD, 0xF6, 0xD3, 0x2E, 0x04, 0x4D, 0x77, 0xAD, 0xCF, 0x37, 0xFB, 0x97, 0xAC, 0x21, 0x33, 0x26 };
+const vector_data_t aes192_set0count165 = {
+    .set_num = 0,
+    .count = 165,
+    .key = aes192_set0count165key,
+    .plain = aes192_set0count165plain,
+    .cipher = aes192_set0count165cipher,
+};
+
+const uint8_t aes192_set0count166key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count166plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count166cipher[] = { 0x93, 0xCB, 0x28, 0x4E, 0xCD, 0xCF, 0xD7, 0x81, 0xA8, 0xAF, 0xE3, 0x20, 0x77, 0x94, 0x9E, 0x88 };
+const vector_data_t aes192_set0count166 = {
+    .set_num = 0,
+    .count = 166,
+    .key = aes192_set0count166key,
+    .plain = aes192_set0count166plain,
+    .cipher = aes192_set0count166cipher,
+};
+
+const uint8_t aes192_set0count167key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count167plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count167cipher[] = { 0x7B, 0x01, 0x7B, 0xB0, 0x2E, 0xC8, 0x7B, 0x2B, 0x94, 0xC9, 0x6E, 0x40, 0xA2, 0x6F, 0xC7, 0x1A };
+const vector_data_t aes192_set0count167 = {
+    .set_num = 0,
+    .count = 167,
+    .key = aes192_set0count167key,
+    .plain = aes192_set0count167plain,
+    .cipher = aes192_set0count167cipher,
+};
+
+const uint8_t aes192_set0count168key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00 };
+const uint8_t aes192_set0count168plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count168cipher[] = { 0xC5, 0xC0, 0x38, 0xB6, 0x99, 0x06, 0x64, 0xAB, 0x08, 0xA3, 0xAA, 0xA5, 0xDF, 0x9F, 0x32, 0x66 };
+const vector_data_t aes192_set0count168 = {
+    .set_num = 0,
+    .count = 168,
+    .key = aes192_set0count168key,
+    .plain = aes192_set0count168plain,
+    .cipher = aes192_set0count168cipher,
+};
+
+const uint8_t aes192_set0count169key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00 };
+const uint8_t aes192_set0count169plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count169cipher[] = { 0x4B, 0x70, 0x20, 0xBE, 0x37, 0xFA, 0xB6, 0x25, 0x9B, 0x2A, 0x27, 0xF4, 0xEC, 0x55, 0x15, 0x76 };
+const vector_data_t aes192_set0count169 = {
+    .set_num = 0,
+    .count = 169,
+    .key = aes192_set0count169key,
+    .plain = aes192_set0count169plain,
+    .cipher = aes192_set0count169cipher,
+};
+
+const uint8_t aes192_set0count170key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00 };
+const uint8_t aes192_set0count170plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count170cipher[] = { 0x60, 0x13, 0x67, 0x03, 0x37, 0x4F, 0x64, 0xE8, 0x60, 0xB4, 0x8C, 0xE3, 0x1F, 0x93, 0x07, 0x16 };
+const vector_data_t aes192_set0count170 = {
+    .set_num = 0,
+    .count = 170,
+    .key = aes192_set0count170key,
+    .plain = aes192_set0count170plain,
+    .cipher = aes192_set0count170cipher,
+};
+
+const uint8_t aes192_set0count171key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00 };
+const uint8_t aes192_set0count171plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count171cipher[] = { 0x8D, 0x63, 0xA2, 0x69, 0xB1, 0x4D, 0x50, 0x6C, 0xCC, 0x40, 0x1A, 0xB8, 0xA9, 0xF1, 0xB5, 0x91 };
+const vector_data_t aes192_set0count171 = {
+    .set_num = 0,
+    .count = 171,
+    .key = aes192_set0count171key,
+    .plain = aes192_set0count171plain,
+    .cipher = aes192_set0count171cipher,
+};
+
+const uint8_t aes192_set0count172key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00 };
+const uint8_t aes192_set0count172plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count172cipher[] = { 0xD3, 0x17, 0xF8, 0x1D, 0xC6, 0xAA, 0x45, 0x4A, 0xEE, 0x4B, 0xD4, 0xA5, 0xA5, 0xCF, 0xF4, 0xBD };
+const vector_data_t aes192_set0count172 = {
+    .set_num = 0,
+    .count = 172,
+    .key = aes192_set0count172key,
+    .plain = aes192_set0count172plain,
+    .cipher = aes192_set0count172cipher,
+};
+
+const uint8_t aes192_set0count173key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00 };
+const uint8_t aes192_set0count173plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count173cipher[] = { 0xDD, 0xDE, 0xCE, 0xCD, 0x53, 0x54, 0xF0, 0x4D, 0x53, 0x0D, 0x76, 0xED, 0x88, 0x42, 0x46, 0xEB };
+const vector_data_t aes192_set0count173 = {
+    .set_num = 0,
+    .count = 173,
+    .key = aes192_set0count173key,
+    .plain = aes192_set0count173plain,
+    .cipher = aes192_set0count173cipher,
+};
+
+const uint8_t aes192_set0count174key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00 };
+const uint8_t aes192_set0count174plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count174cipher[] = { 0x41, 0xC5, 0x20, 0x5C, 0xC8, 0xFD, 0x8E, 0xDA, 0x9A, 0x3C, 0xFF, 0xD2, 0x51, 0x8F, 0x36, 0x5A };
+const vector_data_t aes192_set0count174 = {
+    .set_num = 0,
+    .count = 174,
+    .key = aes192_set0count174key,
+    .plain = aes192_set0count174plain,
+    .cipher = aes192_set0count174cipher,
+};
+
+const uint8_t aes192_set0count175key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00 };
+const uint8_t aes192_set0count175plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count175cipher[] = { 0xCF, 0x42, 0xFB, 0x47, 0x42, 0x93, 0xD9, 0x6E, 0xCA, 0x9D, 0xB1, 0xB3, 0x7B, 0x1B, 0xA6, 0x76 };
+const vector_data_t aes192_set0count175 = {
+    .set_num = 0,
+    .count = 175,
+    .key = aes192_set0count175key,
+    .plain = aes192_set0count175plain,
+    .cipher = aes192_set0count175cipher,
+};
+
+const uint8_t aes192_set0count176key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00 };
+const uint8_t aes192_set0count176plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count176cipher[] = { 0xA2, 0x31, 0x69, 0x26, 0x07, 0x16, 0x9B, 0x4E, 0xCD, 0xEA, 0xD5, 0xCD, 0x3B, 0x10, 0xDB, 0x3E };
+const vector_data_t aes192_set0count176 = {
+    .set_num = 0,
+    .count = 176,
+    .key = aes192_set0count176key,
+    .plain = aes192_set0count176plain,
+    .cipher = aes192_set0count176cipher,
+};
+
+const uint8_t aes192_set0count177key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00 };
+const uint8_t aes192_set0count177plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count177cipher[] = { 0xAC, 0xE4, 0xB9, 0x1C, 0x9C, 0x66, 0x9E, 0x77, 0xE7, 0xAC, 0xAC, 0xD1, 0x98, 0x59, 0xED, 0x49 };
+const vector_data_t aes192_set0count177 = {
+    .set_num = 0,
+    .count = 177,
+    .key = aes192_set0count177key,
+    .plain = aes192_set0count177plain,
+    .cipher = aes192_set0count177cipher,
+};
+
+const uint8_t aes192_set0count178key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00 };
+const uint8_t aes192_set0count178plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count178cipher[] = { 0x75, 0xDB, 0x7C, 0xFD, 0x4A, 0x7B, 0x2B, 0x62, 0xAB, 0x78, 0xA4, 0x8F, 0x3D, 0xDA, 0xF4, 0xAF };
+const vector_data_t aes192_set0count178 = {
+    .set_num = 0,
+    .count = 178,
+    .key = aes192_set0count178key,
+    .plain = aes192_set0count178plain,
+    .cipher = aes192_set0count178cipher,
+};
+
+const uint8_t aes192_set0count179key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00 };
+const uint8_t aes192_set0count179plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count179cipher[] = { 0xC1, 0xFA, 0xBA, 0x2D, 0x46, 0xE2, 0x59, 0xCF, 0x48, 0x0D, 0x7C, 0x38, 0xE4, 0x57, 0x2A, 0x58 };
+const vector_data_t aes192_set0count179 = {
+    .set_num = 0,
+    .count = 179,
+    .key = aes192_set0count179key,
+    .plain = aes192_set0count179plain,
+    .cipher = aes192_set0count179cipher,
+};
+
+const uint8_t aes192_set0count180key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00 };
+const uint8_t aes192_set0count180plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count180cipher[] = { 0x24, 0x1C, 0x45, 0xBC, 0x6A, 0xE1, 0x6D, 0xEE, 0x6E, 0xB7, 0xBE, 0xA1, 0x28, 0x70, 0x15, 0x82 };
+const vector_data_t aes192_set0count180 = {
+    .set_num = 0,
+    .count = 180,
+    .key = aes192_set0count180key,
+    .plain = aes192_set0count180plain,
+    .cipher = aes192_set0count180cipher,
+};
+
+const uint8_t aes192_set0count181key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00 };
+const uint8_t aes192_set0count181plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count181cipher[] = { 0x8F, 0xD0, 0x30, 0x57, 0xCF, 0x13, 0x64, 0x42, 0x0C, 0x2B, 0x78, 0x06, 0x9A, 0x3E, 0x25, 0x02 };
+const vector_data_t aes192_set0count181 = {
+    .set_num = 0,
+    .count = 181,
+    .key = aes192_set0count181key,
+    .plain = aes192_set0count181plain,
+    .cipher = aes192_set0count181cipher,
+};
+
+const uint8_t aes192_set0count182key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00 };
+const uint8_t aes192_set0count182plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count182cipher[] = { 0xDD, 0xB5, 0x05, 0xE6, 0xCC, 0x13, 0x84, 0xCB, 0xAE, 0xC1, 0xDF, 0x90, 0xB8, 0x0B, 0xEB, 0x20 };
+const vector_data_t aes192_set0count182 = {
+    .set_num = 0,
+    .count = 182,
+    .key = aes192_set0count182key,
+    .plain = aes192_set0count182plain,
+    .cipher = aes192_set0count182cipher,
+};
+
+const uint8_t aes192_set0count183key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+const uint8_t aes192_set0count183plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count183cipher[] = { 0x56, 0x74, 0xA3, 0xBE, 0xD2, 0x7B, 0xF4, 0xBD, 0x36, 0x22, 0xF9, 0xF5, 0xFE, 0x20, 0x83, 0x06 };
+const vector_data_t aes192_set0count183 = {
+    .set_num = 0,
+    .count = 183,
+    .key = aes192_set0count183key,
+    .plain = aes192_set0count183plain,
+    .cipher = aes192_set0count183cipher,
+};
+
+const uint8_t aes192_set0count184key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80 };
+const uint8_t aes192_set0count184plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count184cipher[] = { 0xB6, 0x87, 0xF2, 0x6A, 0x89, 0xCF, 0xBF, 0xBB, 0x8E, 0x5E, 0xEA, 0xC5, 0x40, 0x55, 0x31, 0x5E };
+const vector_data_t aes192_set0count184 = {
+    .set_num = 0,
+    .count = 184,
+    .key = aes192_set0count184key,
+    .plain = aes192_set0count184plain,
+    .cipher = aes192_set0count184cipher,
+};
+
+const uint8_t aes192_set0count185key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0 };
+const uint8_t aes192_set0count185plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count185cipher[] = { 0x05, 0x47, 0xDD, 0x32, 0xD3, 0xB2, 0x9A, 0xB6, 0xA4, 0xCA, 0xEB, 0x60, 0x6C, 0x5B, 0x6F, 0x78 };
+const vector_data_t aes192_set0count185 = {
+    .set_num = 0,
+    .count = 185,
+    .key = aes192_set0count185key,
+    .plain = aes192_set0count185plain,
+    .cipher = aes192_set0count185cipher,
+};
+
+const uint8_t aes192_set0count186key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0 };
+const uint8_t aes192_set0count186plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count186cipher[] = { 0x18, 0x68, 0x61, 0xF8, 0xBC, 0x53, 0x86, 0xD3, 0x1F, 0xB7, 0x7F, 0x72, 0x0C, 0x32, 0x26, 0xE6 };
+const vector_data_t aes192_set0count186 = {
+    .set_num = 0,
+    .count = 186,
+    .key = aes192_set0count186key,
+    .plain = aes192_set0count186plain,
+    .cipher = aes192_set0count186cipher,
+};
+
+const uint8_t aes192_set0count187key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 };
+const uint8_t aes192_set0count187plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count187cipher[] = { 0xEA, 0xCF, 0x1E, 0x6C, 0x42, 0x24, 0xEF, 0xB3, 0x89, 0x00, 0xB1, 0x85, 0xAB, 0x1D, 0xFD, 0x42 };
+const vector_data_t aes192_set0count187 = {
+    .set_num = 0,
+    .count = 187,
+    .key = aes192_set0count187key,
+    .plain = aes192_set0count187plain,
+    .cipher = aes192_set0count187cipher,
+};
+
+const uint8_t aes192_set0count188key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8 };
+const uint8_t aes192_set0count188plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count188cipher[] = { 0xD2, 0x41, 0xAA, 0xB0, 0x5A, 0x42, 0xD3, 0x19, 0xDE, 0x81, 0xD8, 0x74, 0xF5, 0xC7, 0xB9, 0x0D };
+const vector_data_t aes192_set0count188 = {
+    .set_num = 0,
+    .count = 188,
+    .key = aes192_set0count188key,
+    .plain = aes192_set0count188plain,
+    .cipher = aes192_set0count188cipher,
+};
+
+const uint8_t aes192_set0count189key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC };
+const uint8_t aes192_set0count189plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count189cipher[] = { 0x5E, 0xB9, 0xBC, 0x75, 0x9E, 0x2A, 0xD8, 0xD2, 0x14, 0x0A, 0x6C, 0x76, 0x2A, 0xE9, 0xE1, 0xAB };
+const vector_data_t aes192_set0count189 = {
+    .set_num = 0,
+    .count = 189,
+    .key = aes192_set0count189key,
+    .plain = aes192_set0count189plain,
+    .cipher = aes192_set0count189cipher,
+};
+
+const uint8_t aes192_set0count190key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE };
+const uint8_t aes192_set0count190plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count190cipher[] = { 0x01, 0x85, 0x96, 0xE1, 0x5E, 0x78, 0xE2, 0xC0, 0x64, 0x15, 0x9D, 0xEF, 0xCE, 0x5F, 0x30, 0x85 };
+const vector_data_t aes192_set0count190 = {
+    .set_num = 0,
+    .count = 190,
+    .key = aes192_set0count190key,
+    .plain = aes192_set0count190plain,
+    .cipher = aes192_set0count190cipher,
+};
+
+const uint8_t aes192_set0count191key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+const uint8_t aes192_set0count191plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set0count191cipher[] = { 0xDD, 0x8A, 0x49, 0x35, 0x14, 0x23, 0x1C, 0xBF, 0x56, 0xEC, 0xCE, 0xE4, 0xC4, 0x08, 0x89, 0xFB };
+const vector_data_t aes192_set0count191 = {
+    .set_num = 0,
+    .count = 191,
+    .key = aes192_set0count191key,
+    .plain = aes192_set0count191plain,
+    .cipher = aes192_set0count191cipher,
+};
+
+const uint8_t aes192_set1count0key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count0plain[] = { 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count0cipher[] = { 0x6C, 0xD0, 0x25, 0x13, 0xE8, 0xD4, 0xDC, 0x98, 0x6B, 0x4A, 0xFE, 0x08, 0x7A, 0x60, 0xBD, 0x0C };
+const vector_data_t aes192_set1count0 = {
+    .set_num = 1,
+    .count = 0,
+    .key = aes192_set1count0key,
+    .plain = aes192_set1count0plain,
+    .cipher = aes192_set1count0cipher,
+};
+
+const uint8_t aes192_set1count1key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count1plain[] = { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count1cipher[] = { 0x2C, 0xE1, 0xF8, 0xB7, 0xE3, 0x06, 0x27, 0xC1, 0xC4, 0x51, 0x9E, 0xAD, 0xA4, 0x4B, 0xC4, 0x36 };
+const vector_data_t aes192_set1count1 = {
+    .set_num = 1,
+    .count = 1,
+    .key = aes192_set1count1key,
+    .plain = aes192_set1count1plain,
+    .cipher = aes192_set1count1cipher,
+};
+
+const uint8_t aes192_set1count2key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count2plain[] = { 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count2cipher[] = { 0x99, 0x46, 0xB5, 0xF8, 0x7A, 0xF4, 0x46, 0xF5, 0x79, 0x6C, 0x1F, 0xEE, 0x63, 0xA2, 0xDA, 0x24 };
+const vector_data_t aes192_set1count2 = {
+    .set_num = 1,
+    .count = 2,
+    .key = aes192_set1count2key,
+    .plain = aes192_set1count2plain,
+    .cipher = aes192_set1count2cipher,
+};
+
+const uint8_t aes192_set1count3key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count3plain[] = { 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count3cipher[] = { 0x2A, 0x56, 0x03, 0x64, 0xCE, 0x52, 0x9E, 0xFC, 0x21, 0x78, 0x87, 0x79, 0x56, 0x8D, 0x55, 0x55 };
+const vector_data_t aes192_set1count3 = {
+    .set_num = 1,
+    .count = 3,
+    .key = aes192_set1count3key,
+    .plain = aes192_set1count3plain,
+    .cipher = aes192_set1count3cipher,
+};
+
+const uint8_t aes192_set1count4key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count4plain[] = { 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count4cipher[] = { 0x35, 0xC1, 0x47, 0x18, 0x37, 0xAF, 0x44, 0x61, 0x53, 0xBC, 0xE5, 0x5D, 0x5B, 0xA7, 0x2A, 0x0A };
+const vector_data_t aes192_set1count4 = {
+    .set_num = 1,
+    .count = 4,
+    .key = aes192_set1count4key,
+    .plain = aes192_set1count4plain,
+    .cipher = aes192_set1count4cipher,
+};
+
+const uint8_t aes192_set1count5key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count5plain[] = { 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count5cipher[] = { 0xCE, 0x60, 0xBC, 0x52, 0x38, 0x62, 0x34, 0xF1, 0x58, 0xF8, 0x43, 0x41, 0xE5, 0x34, 0xCD, 0x9E };
+const vector_data_t aes192_set1count5 = {
+    .set_num = 1,
+    .count = 5,
+    .key = aes192_set1count5key,
+    .plain = aes192_set1count5plain,
+    .cipher = aes192_set1count5cipher,
+};
+
+const uint8_t aes192_set1count6key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count6plain[] = { 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count6cipher[] = { 0x8C, 0x7C, 0x27, 0xFF, 0x32, 0xBC, 0xF8, 0xDC, 0x2D, 0xC5, 0x7C, 0x90, 0xC2, 0x90, 0x39, 0x61 };
+const vector_data_t aes192_set1count6 = {
+    .set_num = 1,
+    .count = 6,
+    .key = aes192_set1count6key,
+    .plain = aes192_set1count6plain,
+    .cipher = aes192_set1count6cipher,
+};
+
+const uint8_t aes192_set1count7key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count7plain[] = { 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count7cipher[] = { 0x32, 0xBB, 0x6A, 0x7E, 0xC8, 0x44, 0x99, 0xE1, 0x66, 0xF9, 0x36, 0x00, 0x3D, 0x55, 0xA5, 0xBB };
+const vector_data_t aes192_set1count7 = {
+    .set_num = 1,
+    .count = 7,
+    .key = aes192_set1count7key,
+    .plain = aes192_set1count7plain,
+    .cipher = aes192_set1count7cipher,
+};
+
+const uint8_t aes192_set1count8key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count8plain[] = { 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count8cipher[] = { 0xA5, 0xC7, 0x72, 0xE5, 0xC6, 0x26, 0x31, 0xEF, 0x66, 0x0E, 0xE1, 0xD5, 0x87, 0x7F, 0x6D, 0x1B };
+const vector_data_t aes192_set1count8 = {
+    .set_num = 1,
+    .count = 8,
+    .key = aes192_set1count8key,
+    .plain = aes192_set1count8plain,
+    .cipher = aes192_set1count8cipher,
+};
+
+const uint8_t aes192_set1count9key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count9plain[] = { 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count9cipher[] = { 0x03, 0x0D, 0x7E, 0x5B, 0x64, 0xF3, 0x80, 0xA7, 0xE4, 0xEA, 0x53, 0x87, 0xB5, 0xCD, 0x7F, 0x49 };
+const vector_data_t aes192_set1count9 = {
+    .set_num = 1,
+    .count = 9,
+    .key = aes192_set1count9key,
+    .plain = aes192_set1count9plain,
+    .cipher = aes192_set1count9cipher,
+};
+
+const uint8_t aes192_set1count10key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count10plain[] = { 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count10cipher[] = { 0x0D, 0xC9, 0xA2, 0x61, 0x00, 0x37, 0x00, 0x9B, 0x69, 0x8F, 0x11, 0xBB, 0x7E, 0x86, 0xC8, 0x3E };
+const vector_data_t aes192_set1count10 = {
+    .set_num = 1,
+    .count = 10,
+    .key = aes192_set1count10key,
+    .plain = aes192_set1count10plain,
+    .cipher = aes192_set1count10cipher,
+};
+
+const uint8_t aes192_set1count11key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count11plain[] = { 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count11cipher[] = { 0x00, 0x46, 0x61, 0x2C, 0x76, 0x6D, 0x18, 0x40, 0xC2, 0x26, 0x36, 0x4F, 0x1F, 0xA7, 0xED, 0x72 };
+const vector_data_t aes192_set1count11 = {
+    .set_num = 1,
+    .count = 11,
+    .key = aes192_set1count11key,
+    .plain = aes192_set1count11plain,
+    .cipher = aes192_set1count11cipher,
+};
+
+const uint8_t aes192_set1count12key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count12plain[] = { 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count12cipher[] = { 0x48, 0x80, 0xC7, 0xE0, 0x8F, 0x27, 0xBE, 0xFE, 0x78, 0x59, 0x07, 0x43, 0xC0, 0x5E, 0x69, 0x8B };
+const vector_data_t aes192_set1count12 = {
+    .set_num = 1,
+    .count = 12,
+    .key = aes192_set1count12key,
+    .plain = aes192_set1count12plain,
+    .cipher = aes192_set1count12cipher,
+};
+
+const uint8_t aes192_set1count13key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count13plain[] = { 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count13cipher[] = { 0x25, 0x20, 0xCE, 0x82, 0x9A, 0x26, 0x57, 0x7F, 0x0F, 0x48, 0x22, 0xC4, 0xEC, 0xC8, 0x74, 0x01 };
+const vector_data_t aes192_set1count13 = {
+    .set_num = 1,
+    .count = 13,
+    .key = aes192_set1count13key,
+    .plain = aes192_set1count13plain,
+    .cipher = aes192_set1count13cipher,
+};
+
+const uint8_t aes192_set1count14key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count14plain[] = { 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count14cipher[] = { 0x87, 0x65, 0xE8, 0xAC, 0xC1, 0x69, 0x75, 0x83, 0x19, 0xCB, 0x46, 0xDC, 0x7B, 0xCF, 0x3D, 0xCA };
+const vector_data_t aes192_set1count14 = {
+    .set_num = 1,
+    .count = 14,
+    .key = aes192_set1count14key,
+    .plain = aes192_set1count14plain,
+    .cipher = aes192_set1count14cipher,
+};
+
+const uint8_t aes192_set1count15key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count15plain[] = { 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count15cipher[] = { 0xE9, 0x8F, 0x4B, 0xA4, 0xF0, 0x73, 0xDF, 0x4B, 0xAA, 0x11, 0x6D, 0x01, 0x1D, 0xC2, 0x4A, 0x28 };
+const vector_data_t aes192_set1count15 = {
+    .set_num = 1,
+    .count = 15,
+    .key = aes192_set1count15key,
+    .plain = aes192_set1count15plain,
+    .cipher = aes192_set1count15cipher,
+};
+
+const uint8_t aes192_set1count16key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count16plain[] = { 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count16cipher[] = { 0xF3, 0x78, 0xF6, 0x8C, 0x5D, 0xBF, 0x59, 0xE2, 0x11, 0xB3, 0xA6, 0x59, 0xA7, 0x31, 0x7D, 0x94 };
+const vector_data_t aes192_set1count16 = {
+    .set_num = 1,
+    .count = 16,
+    .key = aes192_set1count16key,
+    .plain = aes192_set1count16plain,
+    .cipher = aes192_set1count16cipher,
+};
+
+const uint8_t aes192_set1count17key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count17plain[] = { 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count17cipher[] = { 0x28, 0x3D, 0x3B, 0x06, 0x9D, 0x8E, 0xB9, 0xFB, 0x43, 0x2D, 0x74, 0xB9, 0x6C, 0xA7, 0x62, 0xB4 };
+const vector_data_t aes192_set1count17 = {
+    .set_num = 1,
+    .count = 17,
+    .key = aes192_set1count17key,
+    .plain = aes192_set1count17plain,
+    .cipher = aes192_set1count17cipher,
+};
+
+const uint8_t aes192_set1count18key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count18plain[] = { 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count18cipher[] = { 0xA7, 0xE1, 0x84, 0x2E, 0x8A, 0x87, 0x86, 0x1C, 0x22, 0x1A, 0x50, 0x08, 0x83, 0x24, 0x5C, 0x51 };
+const vector_data_t aes192_set1count18 = {
+    .set_num = 1,
+    .count = 18,
+    .key = aes192_set1count18key,
+    .plain = aes192_set1count18plain,
+    .cipher = aes192_set1count18cipher,
+};
+
+const uint8_t aes192_set1count19key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count19plain[] = { 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count19cipher[] = { 0x77, 0xAA, 0x27, 0x04, 0x71, 0x88, 0x1B, 0xE0, 0x70, 0xFB, 0x52, 0xC7, 0x06, 0x7C, 0xE7, 0x32 };
+const vector_data_t aes192_set1count19 = {
+    .set_num = 1,
+    .count = 19,
+    .key = aes192_set1count19key,
+    .plain = aes192_set1count19plain,
+    .cipher = aes192_set1count19cipher,
+};
+
+const uint8_t aes192_set1count20key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count20plain[] = { 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count20cipher[] = { 0x01, 0xB0, 0xF4, 0x76, 0xD4, 0x84, 0xF4, 0x3F, 0x1A, 0xEB, 0x6E, 0xFA, 0x93, 0x61, 0xA8, 0xAC };
+const vector_data_t aes192_set1count20 = {
+    .set_num = 1,
+    .count = 20,
+    .key = aes192_set1count20key,
+    .plain = aes192_set1count20plain,
+    .cipher = aes192_set1count20cipher,
+};
+
+const uint8_t aes192_set1count21key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count21plain[] = { 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count21cipher[] = { 0x1C, 0x3A, 0x94, 0xF1, 0xC0, 0x52, 0xC5, 0x5C, 0x2D, 0x83, 0x59, 0xAF, 0xF2, 0x16, 0x3B, 0x4F };
+const vector_data_t aes192_set1count21 = {
+    .set_num = 1,
+    .count = 21,
+    .key = aes192_set1count21key,
+    .plain = aes192_set1count21plain,
+    .cipher = aes192_set1count21cipher,
+};
+
+const uint8_t aes192_set1count22key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count22plain[] = { 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count22cipher[] = { 0xE8, 0xA0, 0x67, 0xB6, 0x04, 0xD5, 0x37, 0x3D, 0x8B, 0x0F, 0x2E, 0x05, 0xA0, 0x3B, 0x34, 0x1B };
+const vector_data_t aes192_set1count22 = {
+    .set_num = 1,
+    .count = 22,
+    .key = aes192_set1count22key,
+    .plain = aes192_set1count22plain,
+    .cipher = aes192_set1count22cipher,
+};
+
+const uint8_t aes192_set1count23key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count23plain[] = { 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count23cipher[] = { 0xA7, 0x87, 0x6E, 0xC8, 0x7F, 0x5A, 0x09, 0xBF, 0xEA, 0x42, 0xC7, 0x7D, 0xA3, 0x0F, 0xD5, 0x0E };
+const vector_data_t aes192_set1count23 = {
+    .set_num = 1,
+    .count = 23,
+    .key = aes192_set1count23key,
+    .plain = aes192_set1count23plain,
+    .cipher = aes192_set1count23cipher,
+};
+
+const uint8_t aes192_set1count24key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count24plain[] = { 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count24cipher[] = { 0x0C, 0xF3, 0xE9, 0xD3, 0xA4, 0x2B, 0xE5, 0xB8, 0x54, 0xCA, 0x65, 0xB1, 0x3F, 0x35, 0xF4, 0x8D };
+const vector_data_t aes192_set1count24 = {
+    .set_num = 1,
+    .count = 24,
+    .key = aes192_set1count24key,
+    .plain = aes192_set1count24plain,
+    .cipher = aes192_set1count24cipher,
+};
+
+const uint8_t aes192_set1count25key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count25plain[] = { 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count25cipher[] = { 0x6C, 0x62, 0xF6, 0xBB, 0xCA, 0xB7, 0xC3, 0xE8, 0x21, 0xC9, 0x29, 0x0F, 0x08, 0x89, 0x2D, 0xDA };
+const vector_data_t aes192_set1count25 = {
+    .set_num = 1,
+    .count = 25,
+    .key = aes192_set1count25key,
+    .plain = aes192_set1count25plain,
+    .cipher = aes192_set1count25cipher,
+};
+
+const uint8_t aes192_set1count26key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count26plain[] = { 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count26cipher[] = { 0x7F, 0x5E, 0x05, 0xBD, 0x20, 0x68, 0x73, 0x81, 0x96, 0xFE, 0xE7, 0x9A, 0xCE, 0x7E, 0x3A, 0xEC };
+const vector_data_t aes192_set1count26 = {
+    .set_num = 1,
+    .count = 26,
+    .key = aes192_set1count26key,
+    .plain = aes192_set1count26plain,
+    .cipher = aes192_set1count26cipher,
+};
+
+const uint8_t aes192_set1count27key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count27plain[] = { 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count27cipher[] = { 0x44, 0x0E, 0x0D, 0x73, 0x32, 0x55, 0xCD, 0xA9, 0x2F, 0xB4, 0x6E, 0x84, 0x2F, 0xE5, 0x80, 0x54 };
+const vector_data_t aes192_set1count27 = {
+    .set_num = 1,
+    .count = 27,
+    .key = aes192_set1count27key,
+    .plain = aes192_set1count27plain,
+    .cipher = aes192_set1count27cipher,
+};
+
+const uint8_t aes192_set1count28key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count28plain[] = { 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count28cipher[] = { 0xAA, 0x5D, 0x5B, 0x1C, 0x4E, 0xA1, 0xB7, 0xA2, 0x2E, 0x55, 0x83, 0xAC, 0x2E, 0x9E, 0xD8, 0xA7 };
+const vector_data_t aes192_set1count28 = {
+    .set_num = 1,
+    .count = 28,
+    .key = aes192_set1count28key,
+    .plain = aes192_set1count28plain,
+    .cipher = aes192_set1count28cipher,
+};
+
+const uint8_t aes192_set1count29key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count29plain[] = { 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count29cipher[] = { 0x77, 0xE5, 0x37, 0xE8, 0x9E, 0x84, 0x91, 0xE8, 0x66, 0x2A, 0xAE, 0x3B, 0xC8, 0x09, 0x42, 0x1D };
+const vector_data_t aes192_set1count29 = {
+    .set_num = 1,
+    .count = 29,
+    .key = aes192_set1count29key,
+    .plain = aes192_set1count29plain,
+    .cipher = aes192_set1count29cipher,
+};
+
+const uint8_t aes192_set1count30key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count30plain[] = { 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count30cipher[] = { 0x99, 0x7D, 0xD3, 0xE9, 0xF1, 0x59, 0x8B, 0xFA, 0x73, 0xF7, 0x59, 0x73, 0xF7, 0xE9, 0x3B, 0x76 };
+const vector_data_t aes192_set1count30 = {
+    .set_num = 1,
+    .count = 30,
+    .key = aes192_set1count30key,
+    .plain = aes192_set1count30plain,
+    .cipher = aes192_set1count30cipher,
+};
+
+const uint8_t aes192_set1count31key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count31plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count31cipher[] = { 0x1B, 0x38, 0xD4, 0xF7, 0x45, 0x2A, 0xFE, 0xFC, 0xB7, 0xFC, 0x72, 0x12, 0x44, 0xE4, 0xB7, 0x2E };
+const vector_data_t aes192_set1count31 = {
+    .set_num = 1,
+    .count = 31,
+    .key = aes192_set1count31key,
+    .plain = aes192_set1count31plain,
+    .cipher = aes192_set1count31cipher,
+};
+
+const uint8_t aes192_set1count32key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count32plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count32cipher[] = { 0x0B, 0xE2, 0xB1, 0x82, 0x52, 0xE7, 0x74, 0xDD, 0xA3, 0x0C, 0xDD, 0xA0, 0x2C, 0x69, 0x06, 0xE3 };
+const vector_data_t aes192_set1count32 = {
+    .set_num = 1,
+    .count = 32,
+    .key = aes192_set1count32key,
+    .plain = aes192_set1count32plain,
+    .cipher = aes192_set1count32cipher,
+};
+
+const uint8_t aes192_set1count33key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count33plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count33cipher[] = { 0xD2, 0x69, 0x5E, 0x59, 0xC2, 0x03, 0x61, 0xD8, 0x26, 0x52, 0xD7, 0xD5, 0x8B, 0x6F, 0x11, 0xB2 };
+const vector_data_t aes192_set1count33 = {
+    .set_num = 1,
+    .count = 33,
+    .key = aes192_set1count33key,
+    .plain = aes192_set1count33plain,
+    .cipher = aes192_set1count33cipher,
+};
+
+const uint8_t aes192_set1count34key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count34plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count34cipher[] = { 0x90, 0x2D, 0x88, 0xD1, 0x3E, 0xAE, 0x52, 0x08, 0x9A, 0xBD, 0x61, 0x43, 0xCF, 0xE3, 0x94, 0xE9 };
+const vector_data_t aes192_set1count34 = {
+    .set_num = 1,
+    .count = 34,
+    .key = aes192_set1count34key,
+    .plain = aes192_set1count34plain,
+    .cipher = aes192_set1count34cipher,
+};
+
+const uint8_t aes192_set1count35key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count35plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count35cipher[] = { 0xD4, 0x9B, 0xCE, 0xB3, 0xB8, 0x23, 0xFE, 0xDD, 0x60, 0x2C, 0x30, 0x53, 0x45, 0x73, 0x4B, 0xD2 };
+const vector_data_t aes192_set1count35 = {
+    .set_num = 1,
+    .count = 35,
+    .key = aes192_set1count35key,
+    .plain = aes192_set1count35plain,
+    .cipher = aes192_set1count35cipher,
+};
+
+const uint8_t aes192_set1count36key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count36plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count36cipher[] = { 0x70, 0x7B, 0x1D, 0xBB, 0x0F, 0xFA, 0x40, 0xEF, 0x7D, 0x95, 0xDE, 0xF4, 0x21, 0x23, 0x3F, 0xAE };
+const vector_data_t aes192_set1count36 = {
+    .set_num = 1,
+    .count = 36,
+    .key = aes192_set1count36key,
+    .plain = aes192_set1count36plain,
+    .cipher = aes192_set1count36cipher,
+};
+
+const uint8_t aes192_set1count37key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count37plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count37cipher[] = { 0x7C, 0xA0, 0xC1, 0xD9, 0x33, 0x56, 0xD9, 0xEB, 0x8A, 0xA9, 0x52, 0x08, 0x4D, 0x75, 0xF9, 0x13 };
+const vector_data_t aes192_set1count37 = {
+    .set_num = 1,
+    .count = 37,
+    .key = aes192_set1count37key,
+    .plain = aes192_set1count37plain,
+    .cipher = aes192_set1count37cipher,
+};
+
+const uint8_t aes192_set1count38key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count38plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count38cipher[] = { 0xF2, 0xCB, 0xF9, 0xCB, 0x18, 0x6E, 0x27, 0x0D, 0xD7, 0xBD, 0xB0, 0xC2, 0x8F, 0xEB, 0xC5, 0x7D };
+const vector_data_t aes192_set1count38 = {
+    .set_num = 1,
+    .count = 38,
+    .key = aes192_set1count38key,
+    .plain = aes192_set1count38plain,
+    .cipher = aes192_set1count38cipher,
+};
+
+const uint8_t aes192_set1count39key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count39plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count39cipher[] = { 0xC9, 0x43, 0x37, 0xC3, 0x7C, 0x4E, 0x79, 0x0A, 0xB4, 0x57, 0x80, 0xBD, 0x9C, 0x36, 0x74, 0xA0 };
+const vector_data_t aes192_set1count39 = {
+    .set_num = 1,
+    .count = 39,
+    .key = aes192_set1count39key,
+    .plain = aes192_set1count39plain,
+    .cipher = aes192_set1count39cipher,
+};
+
+const uint8_t aes192_set1count40key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count40plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count40cipher[] = { 0x8E, 0x35, 0x58, 0xC1, 0x35, 0x25, 0x2F, 0xB9, 0xC9, 0xF3, 0x67, 0xED, 0x60, 0x94, 0x67, 0xA1 };
+const vector_data_t aes192_set1count40 = {
+    .set_num = 1,
+    .count = 40,
+    .key = aes192_set1count40key,
+    .plain = aes192_set1count40plain,
+    .cipher = aes192_set1count40cipher,
+};
+
+const uint8_t aes192_set1count41key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count41plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count41cipher[] = { 0x1B, 0x72, 0xEE, 0xAE, 0xE4, 0x89, 0x9B, 0x44, 0x39, 0x14, 0xE5, 0xB3, 0xA5, 0x7F, 0xBA, 0x92 };
+const vector_data_t aes192_set1count41 = {
+    .set_num = 1,
+    .count = 41,
+    .key = aes192_set1count41key,
+    .plain = aes192_set1count41plain,
+    .cipher = aes192_set1count41cipher,
+};
+
+const uint8_t aes192_set1count42key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count42plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count42cipher[] = { 0x01, 0x18, 0x65, 0xF9, 0x1B, 0xC5, 0x68, 0x68, 0xD0, 0x51, 0xE5, 0x2C, 0x9E, 0xFD, 0x59, 0xB7 };
+const vector_data_t aes192_set1count42 = {
+    .set_num = 1,
+    .count = 42,
+    .key = aes192_set1count42key,
+    .plain = aes192_set1count42plain,
+    .cipher = aes192_set1count42cipher,
+};
+
+const uint8_t aes192_set1count43key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count43plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count43cipher[] = { 0xE4, 0x77, 0x13, 0x18, 0xAD, 0x7A, 0x63, 0xDD, 0x68, 0x0F, 0x6E, 0x58, 0x3B, 0x77, 0x47, 0xEA };
+const vector_data_t aes192_set1count43 = {
+    .set_num = 1,
+    .count = 43,
+    .key = aes192_set1count43key,
+    .plain = aes192_set1count43plain,
+    .cipher = aes192_set1count43cipher,
+};
+
+const uint8_t aes192_set1count44key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count44plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count44cipher[] = { 0x61, 0xE3, 0xD1, 0x94, 0x08, 0x8D, 0xC8, 0xD9, 0x7E, 0x9E, 0x6D, 0xB3, 0x74, 0x57, 0xEA, 0xC5 };
+const vector_data_t aes192_set1count44 = {
+    .set_num = 1,
+    .count = 44,
+    .key = aes192_set1count44key,
+    .plain = aes192_set1count44plain,
+    .cipher = aes192_set1count44cipher,
+};
+
+const uint8_t aes192_set1count45key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count45plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count45cipher[] = { 0x36, 0xFF, 0x1E, 0xC9, 0xCC, 0xFB, 0xC3, 0x49, 0xE5, 0xD3, 0x56, 0xD0, 0x63, 0x69, 0x3A, 0xD6 };
+const vector_data_t aes192_set1count45 = {
+    .set_num = 1,
+    .count = 45,
+    .key = aes192_set1count45key,
+    .plain = aes192_set1count45plain,
+    .cipher = aes192_set1count45cipher,
+};
+
+const uint8_t aes192_set1count46key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count46plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count46cipher[] = { 0x3C, 0xC9, 0xE9, 0xA9, 0xBE, 0x8C, 0xC3, 0xF6, 0xFB, 0x2E, 0xA2, 0x40, 0x88, 0xE9, 0xBB, 0x19 };
+const vector_data_t aes192_set1count46 = {
+    .set_num = 1,
+    .count = 46,
+    .key = aes192_set1count46key,
+    .plain = aes192_set1count46plain,
+    .cipher = aes192_set1count46cipher,
+};
+
+const uint8_t aes192_set1count47key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count47plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count47cipher[] = { 0x1E, 0xE5, 0xAB, 0x00, 0x3D, 0xC8, 0x72, 0x2E, 0x74, 0x90, 0x5D, 0x9A, 0x8F, 0xE3, 0xD3, 0x50 };
+const vector_data_t aes192_set1count47 = {
+    .set_num = 1,
+    .count = 47,
+    .key = aes192_set1count47key,
+    .plain = aes192_set1count47plain,
+    .cipher = aes192_set1count47cipher,
+};
+
+const uint8_t aes192_set1count48key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count48plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count48cipher[] = { 0x24, 0x53, 0x39, 0x31, 0x95, 0x84, 0xB0, 0xA4, 0x12, 0x41, 0x28, 0x69, 0xD6, 0xC2, 0xEA, 0xDA };
+const vector_data_t aes192_set1count48 = {
+    .set_num = 1,
+    .count = 48,
+    .key = aes192_set1count48key,
+    .plain = aes192_set1count48plain,
+    .cipher = aes192_set1count48cipher,
+};
+
+const uint8_t aes192_set1count49key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count49plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count49cipher[] = { 0x7B, 0xD4, 0x96, 0x91, 0x81, 0x15, 0xD1, 0x4E, 0xD5, 0x38, 0x08, 0x52, 0x71, 0x6C, 0x88, 0x14 };
+const vector_data_t aes192_set1count49 = {
+    .set_num = 1,
+    .count = 49,
+    .key = aes192_set1count49key,
+    .plain = aes192_set1count49plain,
+    .cipher = aes192_set1count49cipher,
+};
+
+const uint8_t aes192_set1count50key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count50plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count50cipher[] = { 0x27, 0x3A, 0xB2, 0xF2, 0xB4, 0xA3, 0x66, 0xA5, 0x7D, 0x58, 0x2A, 0x33, 0x93, 0x13, 0xC8, 0xB1 };
+const vector_data_t aes192_set1count50 = {
+    .set_num = 1,
+    .count = 50,
+    .key = aes192_set1count50key,
+    .plain = aes192_set1count50plain,
+    .cipher = aes192_set1count50cipher,
+};
+
+const uint8_t aes192_set1count51key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count51plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count51cipher[] = { 0x11, 0x33, 0x65, 0xA9, 0xFF, 0xBE, 0x3B, 0x0C, 0xA6, 0x1E, 0x98, 0x50, 0x75, 0x54, 0x16, 0x8B };
+const vector_data_t aes192_set1count51 = {
+    .set_num = 1,
+    .count = 51,
+    .key = aes192_set1count51key,
+    .plain = aes192_set1count51plain,
+    .cipher = aes192_set1count51cipher,
+};
+
+const uint8_t aes192_set1count52key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count52plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count52cipher[] = { 0xAF, 0xA9, 0x9C, 0x99, 0x7A, 0xC4, 0x78, 0xA0, 0xDE, 0xA4, 0x11, 0x9C, 0x9E, 0x45, 0xF8, 0xB1 };
+const vector_data_t aes192_set1count52 = {
+    .set_num = 1,
+    .count = 52,
+    .key = aes192_set1count52key,
+    .plain = aes192_set1count52plain,
+    .cipher = aes192_set1count52cipher,
+};
+
+const uint8_t aes192_set1count53key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count53plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count53cipher[] = { 0x92, 0x16, 0x30, 0x9A, 0x78, 0x42, 0x43, 0x0B, 0x83, 0xFF, 0xB9, 0x86, 0x38, 0x01, 0x15, 0x12 };
+const vector_data_t aes192_set1count53 = {
+    .set_num = 1,
+    .count = 53,
+    .key = aes192_set1count53key,
+    .plain = aes192_set1count53plain,
+    .cipher = aes192_set1count53cipher,
+};
+
+const uint8_t aes192_set1count54key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count54plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count54cipher[] = { 0x62, 0xAB, 0xC7, 0x92, 0x28, 0x82, 0x58, 0x49, 0x2A, 0x7C, 0xB4, 0x51, 0x45, 0xF4, 0xB7, 0x59 };
+const vector_data_t aes192_set1count54 = {
+    .set_num = 1,
+    .count = 54,
+    .key = aes192_set1count54key,
+    .plain = aes192_set1count54plain,
+    .cipher = aes192_set1count54cipher,
+};
+
+const uint8_t aes192_set1count55key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count55plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count55cipher[] = { 0x53, 0x49, 0x23, 0xC1, 0x69, 0xD5, 0x04, 0xD7, 0x51, 0x9C, 0x15, 0xD3, 0x0E, 0x75, 0x6C, 0x50 };
+const vector_data_t aes192_set1count55 = {
+    .set_num = 1,
+    .count = 55,
+    .key = aes192_set1count55key,
+    .plain = aes192_set1count55plain,
+    .cipher = aes192_set1count55cipher,
+};
+
+const uint8_t aes192_set1count56key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count56plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count56cipher[] = { 0xFA, 0x75, 0xE0, 0x5B, 0xCD, 0xC7, 0xE0, 0x0C, 0x27, 0x3F, 0xA3, 0x3F, 0x6E, 0xE4, 0x41, 0xD2 };
+const vector_data_t aes192_set1count56 = {
+    .set_num = 1,
+    .count = 56,
+    .key = aes192_set1count56key,
+    .plain = aes192_set1count56plain,
+    .cipher = aes192_set1count56cipher,
+};
+
+const uint8_t aes192_set1count57key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count57plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count57cipher[] = { 0x7D, 0x35, 0x0F, 0xA6, 0x05, 0x70, 0x80, 0xF1, 0x08, 0x6A, 0x56, 0xB1, 0x7E, 0xC2, 0x40, 0xDB };
+const vector_data_t aes192_set1count57 = {
+    .set_num = 1,
+    .count = 57,
+    .key = aes192_set1count57key,
+    .plain = aes192_set1count57plain,
+    .cipher = aes192_set1count57cipher,
+};
+
+const uint8_t aes192_set1count58key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count58plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count58cipher[] = { 0xF3, 0x4E, 0x4A, 0x63, 0x24, 0xEA, 0x4A, 0x5C, 0x39, 0xA6, 0x61, 0xC8, 0xFE, 0x5A, 0xDA, 0x8F };
+const vector_data_t aes192_set1count58 = {
+    .set_num = 1,
+    .count = 58,
+    .key = aes192_set1count58key,
+    .plain = aes192_set1count58plain,
+    .cipher = aes192_set1count58cipher,
+};
+
+const uint8_t aes192_set1count59key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count59plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count59cipher[] = { 0x08, 0x82, 0xA1, 0x6F, 0x44, 0x08, 0x8D, 0x42, 0x44, 0x7A, 0x29, 0xAC, 0x09, 0x0E, 0xC1, 0x7E };
+const vector_data_t aes192_set1count59 = {
+    .set_num = 1,
+    .count = 59,
+    .key = aes192_set1count59key,
+    .plain = aes192_set1count59plain,
+    .cipher = aes192_set1count59cipher,
+};
+
+const uint8_t aes192_set1count60key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count60plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count60cipher[] = { 0x3A, 0x3C, 0x15, 0xBF, 0xC1, 0x1A, 0x95, 0x37, 0xC1, 0x30, 0x68, 0x70, 0x04, 0xE1, 0x36, 0xEE };
+const vector_data_t aes192_set1count60 = {
+    .set_num = 1,
+    .count = 60,
+    .key = aes192_set1count60key,
+    .plain = aes192_set1count60plain,
+    .cipher = aes192_set1count60cipher,
+};
+
+const uint8_t aes192_set1count61key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count61plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count61cipher[] = { 0x22, 0xC0, 0xA7, 0x67, 0x8D, 0xC6, 0xD8, 0xCF, 0x5C, 0x8A, 0x6D, 0x5A, 0x99, 0x60, 0x76, 0x7C };
+const vector_data_t aes192_set1count61 = {
+    .set_num = 1,
+    .count = 61,
+    .key = aes192_set1count61key,
+    .plain = aes192_set1count61plain,
+    .cipher = aes192_set1count61cipher,
+};
+
+const uint8_t aes192_set1count62key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count62plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count62cipher[] = { 0xB4, 0x6B, 0x09, 0x80, 0x9D, 0x68, 0xB9, 0xA4, 0x56, 0x43, 0x2A, 0x79, 0xBD, 0xC2, 0xE3, 0x8C };
+const vector_data_t aes192_set1count62 = {
+    .set_num = 1,
+    .count = 62,
+    .key = aes192_set1count62key,
+    .plain = aes192_set1count62plain,
+    .cipher = aes192_set1count62cipher,
+};
+
+const uint8_t aes192_set1count63key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count63plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count63cipher[] = { 0x93, 0xBA, 0xAF, 0xFB, 0x35, 0xFB, 0xE7, 0x39, 0xC1, 0x7C, 0x6A, 0xC2, 0x2E, 0xEC, 0xF1, 0x8F };
+const vector_data_t aes192_set1count63 = {
+    .set_num = 1,
+    .count = 63,
+    .key = aes192_set1count63key,
+    .plain = aes192_set1count63plain,
+    .cipher = aes192_set1count63cipher,
+};
+
+const uint8_t aes192_set1count64key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count64plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count64cipher[] = { 0xC8, 0xAA, 0x80, 0xA7, 0x85, 0x06, 0x75, 0xBC, 0x00, 0x7C, 0x46, 0xDF, 0x06, 0xB4, 0x98, 0x68 };
+const vector_data_t aes192_set1count64 = {
+    .set_num = 1,
+    .count = 64,
+    .key = aes192_set1count64key,
+    .plain = aes192_set1count64plain,
+    .cipher = aes192_set1count64cipher,
+};
+
+const uint8_t aes192_set1count65key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count65plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count65cipher[] = { 0x12, 0xC6, 0xF3, 0x87, 0x7A, 0xF4, 0x21, 0xA9, 0x18, 0xA8, 0x4B, 0x77, 0x58, 0x58, 0x02, 0x1D };
+const vector_data_t aes192_set1count65 = {
+    .set_num = 1,
+    .count = 65,
+    .key = aes192_set1count65key,
+    .plain = aes192_set1count65plain,
+    .cipher = aes192_set1count65cipher,
+};
+
+const uint8_t aes192_set1count66key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count66plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count66cipher[] = { 0x33, 0xF1, 0x23, 0x28, 0x2C, 0x5D, 0x63, 0x39, 0x24, 0xF7, 0xD5, 0xBA, 0x3F, 0x3C, 0xAB, 0x11 };
+const vector_data_t aes192_set1count66 = {
+    .set_num = 1,
+    .count = 66,
+    .key = aes192_set1count66key,
+    .plain = aes192_set1count66plain,
+    .cipher = aes192_set1count66cipher,
+};
+
+const uint8_t aes192_set1count67key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count67plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count67cipher[] = { 0xA8, 0xF1, 0x61, 0x00, 0x27, 0x33, 0xE9, 0x3C, 0xA4, 0x52, 0x7D, 0x22, 0xC1, 0xA0, 0xC5, 0xBB };
+const vector_data_t aes192_set1count67 = {
+    .set_num = 1,
+    .count = 67,
+    .key = aes192_set1count67key,
+    .plain = aes192_set1count67plain,
+    .cipher = aes192_set1count67cipher,
+};
+
+const uint8_t aes192_set1count68key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count68plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count68cipher[] = { 0xB7, 0x2F, 0x70, 0xEB, 0xF3, 0xE3, 0xFD, 0xA2, 0x3F, 0x50, 0x8E, 0xEC, 0x76, 0xB4, 0x2C, 0x02 };
+const vector_data_t aes192_set1count68 = {
+    .set_num = 1,
+    .count = 68,
+    .key = aes192_set1count68key,
+    .plain = aes192_set1count68plain,
+    .cipher = aes192_set1count68cipher,
+};
+
+const uint8_t aes192_set1count69key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count69plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count69cipher[] = { 0x6A, 0x9D, 0x96, 0x5E, 0x62, 0x74, 0x14, 0x3F, 0x25, 0xAF, 0xDC, 0xFC, 0x88, 0xFF, 0xD7, 0x7C };
+const vector_data_t aes192_set1count69 = {
+    .set_num = 1,
+    .count = 69,
+    .key = aes192_set1count69key,
+    .plain = aes192_set1count69plain,
+    .cipher = aes192_set1count69cipher,
+};
+
+const uint8_t aes192_set1count70key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count70plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count70cipher[] = { 0xA0, 0xC7, 0x4F, 0xD0, 0xB9, 0x36, 0x17, 0x64, 0xCE, 0x91, 0xC5, 0x20, 0x0B, 0x09, 0x53, 0x57 };
+const vector_data_t aes192_set1count70 = {
+    .set_num = 1,
+    .count = 70,
+    .key = aes192_set1count70key,
+    .plain = aes192_set1count70plain,
+    .cipher = aes192_set1count70cipher,
+};
+
+const uint8_t aes192_set1count71key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count71plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count71cipher[] = { 0x09, 0x1D, 0x1F, 0xDC, 0x2B, 0xD2, 0xC3, 0x46, 0xCD, 0x50, 0x46, 0xA8, 0xC6, 0x20, 0x91, 0x46 };
+const vector_data_t aes192_set1count71 = {
+    .set_num = 1,
+    .count = 71,
+    .key = aes192_set1count71key,
+    .plain = aes192_set1count71plain,
+    .cipher = aes192_set1count71cipher,
+};
+
+const uint8_t aes192_set1count72key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count72plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count72cipher[] = { 0xE2, 0xA3, 0x75, 0x80, 0x11, 0x6C, 0xFB, 0x71, 0x85, 0x62, 0x54, 0x49, 0x6A, 0xB0, 0xAC, 0xA8 };
+const vector_data_t aes192_set1count72 = {
+    .set_num = 1,
+    .count = 72,
+    .key = aes192_set1count72key,
+    .plain = aes192_set1count72plain,
+    .cipher = aes192_set1count72cipher,
+};
+
+const uint8_t aes192_set1count73key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count73plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count73cipher[] = { 0xE0, 0xB3, 0xA0, 0x07, 0x85, 0x91, 0x7C, 0x7E, 0xFC, 0x9A, 0xDB, 0xA3, 0x22, 0x81, 0x35, 0x71 };
+const vector_data_t aes192_set1count73 = {
+    .set_num = 1,
+    .count = 73,
+    .key = aes192_set1count73key,
+    .plain = aes192_set1count73plain,
+    .cipher = aes192_set1count73cipher,
+};
+
+const uint8_t aes192_set1count74key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count74plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count74cipher[] = { 0x73, 0x3D, 0x41, 0xF4, 0x72, 0x7B, 0x5E, 0xF0, 0xDF, 0x4A, 0xF4, 0xCF, 0x3C, 0xFF, 0xA0, 0xCB };
+const vector_data_t aes192_set1count74 = {
+    .set_num = 1,
+    .count = 74,
+    .key = aes192_set1count74key,
+    .plain = aes192_set1count74plain,
+    .cipher = aes192_set1count74cipher,
+};
+
+const uint8_t aes192_set1count75key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count75plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count75cipher[] = { 0xA9, 0x9E, 0xBB, 0x03, 0x02, 0x60, 0x82, 0x6F, 0x98, 0x1A, 0xD3, 0xE6, 0x44, 0x90, 0xAA, 0x4F };
+const vector_data_t aes192_set1count75 = {
+    .set_num = 1,
+    .count = 75,
+    .key = aes192_set1count75key,
+    .plain = aes192_set1count75plain,
+    .cipher = aes192_set1count75cipher,
+};
+
+const uint8_t aes192_set1count76key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count76plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count76cipher[] = { 0x73, 0xF3, 0x4C, 0x7D, 0x3E, 0xAE, 0x5E, 0x80, 0x08, 0x2C, 0x16, 0x47, 0x52, 0x43, 0x08, 0xEE };
+const vector_data_t aes192_set1count76 = {
+    .set_num = 1,
+    .count = 76,
+    .key = aes192_set1count76key,
+    .plain = aes192_set1count76plain,
+    .cipher = aes192_set1count76cipher,
+};
+
+const uint8_t aes192_set1count77key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count77plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count77cipher[] = { 0x40, 0xEB, 0xD5, 0xAD, 0x08, 0x23, 0x45, 0xB7, 0xA2, 0x09, 0x7C, 0xCD, 0x34, 0x64, 0xDA, 0x02 };
+const vector_data_t aes192_set1count77 = {
+    .set_num = 1,
+    .count = 77,
+    .key = aes192_set1count77key,
+    .plain = aes192_set1count77plain,
+    .cipher = aes192_set1count77cipher,
+};
+
+const uint8_t aes192_set1count78key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count78plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count78cipher[] = { 0x7C, 0xC4, 0xAE, 0x9A, 0x42, 0x4B, 0x2C, 0xEC, 0x90, 0xC9, 0x71, 0x53, 0xC2, 0x45, 0x7E, 0xC5 };
+const vector_data_t aes192_set1count78 = {
+    .set_num = 1,
+    .count = 78,
+    .key = aes192_set1count78key,
+    .plain = aes192_set1count78plain,
+    .cipher = aes192_set1count78cipher,
+};
+
+const uint8_t aes192_set1count79key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count79plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count79cipher[] = { 0x54, 0xD6, 0x32, 0xD0, 0x3A, 0xBA, 0x0B, 0xD0, 0xF9, 0x18, 0x77, 0xEB, 0xDD, 0x4D, 0x09, 0xCB };
+const vector_data_t aes192_set1count79 = {
+    .set_num = 1,
+    .count = 79,
+    .key = aes192_set1count79key,
+    .plain = aes192_set1count79plain,
+    .cipher = aes192_set1count79cipher,
+};
+
+const uint8_t aes192_set1count80key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count80plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count80cipher[] = { 0xD3, 0x42, 0x7B, 0xE7, 0xE4, 0xD2, 0x7C, 0xD5, 0x4F, 0x5F, 0xE3, 0x7B, 0x03, 0xCF, 0x08, 0x97 };
+const vector_data_t aes192_set1count80 = {
+    .set_num = 1,
+    .count = 80,
+    .key = aes192_set1count80key,
+    .plain = aes192_set1count80plain,
+    .cipher = aes192_set1count80cipher,
+};
+
+const uint8_t aes192_set1count81key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count81plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count81cipher[] = { 0xB2, 0x09, 0x97, 0x95, 0xE8, 0x8C, 0xC1, 0x58, 0xFD, 0x75, 0xEA, 0x13, 0x3D, 0x7E, 0x7F, 0xBE };
+const vector_data_t aes192_set1count81 = {
+    .set_num = 1,
+    .count = 81,
+    .key = aes192_set1count81key,
+    .plain = aes192_set1count81plain,
+    .cipher = aes192_set1count81cipher,
+};
+
+const uint8_t aes192_set1count82key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count82plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count82cipher[] = { 0xA6, 0xCA, 0xE4, 0x6F, 0xB6, 0xFA, 0xDF, 0xE7, 0xA2, 0xC3, 0x02, 0xA3, 0x42, 0x42, 0x81, 0x7B };
+const vector_data_t aes192_set1count82 = {
+    .set_num = 1,
+    .count = 82,
+    .key = aes192_set1count82key,
+    .plain = aes192_set1count82plain,
+    .cipher = aes192_set1count82cipher,
+};
+
+const uint8_t aes192_set1count83key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count83plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count83cipher[] = { 0x02, 0x6A, 0x70, 0x24, 0xD6, 0xA9, 0x02, 0xE0, 0xB3, 0xFF, 0xCC, 0xBA, 0xA9, 0x10, 0xCC, 0x3F };
+const vector_data_t aes192_set1count83 = {
+    .set_num = 1,
+    .count = 83,
+    .key = aes192_set1count83key,
+    .plain = aes192_set1count83plain,
+    .cipher = aes192_set1count83cipher,
+};
+
+const uint8_t aes192_set1count84key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count84plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count84cipher[] = { 0x15, 0x6F, 0x07, 0x76, 0x7A, 0x85, 0xA4, 0x31, 0x23, 0x21, 0xF6, 0x39, 0x68, 0x33, 0x8A, 0x01 };
+const vector_data_t aes192_set1count84 = {
+    .set_num = 1,
+    .count = 84,
+    .key = aes192_set1count84key,
+    .plain = aes192_set1count84plain,
+    .cipher = aes192_set1count84cipher,
+};
+
+const uint8_t aes192_set1count85key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count85plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count85cipher[] = { 0x15, 0xEE, 0xC9, 0xEB, 0xF4, 0x2B, 0x9C, 0xA7, 0x68, 0x97, 0xD2, 0xCD, 0x6C, 0x5A, 0x12, 0xE2 };
+const vector_data_t aes192_set1count85 = {
+    .set_num = 1,
+    .count = 85,
+    .key = aes192_set1count85key,
+    .plain = aes192_set1count85plain,
+    .cipher = aes192_set1count85cipher,
+};
+
+const uint8_t aes192_set1count86key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count86plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count86cipher[] = { 0xDB, 0x0D, 0x3A, 0x6F, 0xDC, 0xC1, 0x3F, 0x91, 0x5E, 0x2B, 0x30, 0x2C, 0xEE, 0xB7, 0x0F, 0xD8 };
+const vector_data_t aes192_set1count86 = {
+    .set_num = 1,
+    .count = 86,
+    .key = aes192_set1count86key,
+    .plain = aes192_set1count86plain,
+    .cipher = aes192_set1count86cipher,
+};
+
+const uint8_t aes192_set1count87key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count87plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count87cipher[] = { 0x71, 0xDB, 0xF3, 0x7E, 0x87, 0xA2, 0xE3, 0x4D, 0x15, 0xB2, 0x0E, 0x8F, 0x10, 0xE4, 0x89, 0x24 };
+const vector_data_t aes192_set1count87 = {
+    .set_num = 1,
+    .count = 87,
+    .key = aes192_set1count87key,
+    .plain = aes192_set1count87plain,
+    .cipher = aes192_set1count87cipher,
+};
+
+const uint8_t aes192_set1count88key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count88plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count88cipher[] = { 0xC7, 0x45, 0xC4, 0x51, 0xE9, 0x6F, 0xF3, 0xC0, 0x45, 0xE4, 0x36, 0x7C, 0x83, 0x3E, 0x3B, 0x54 };
+const vector_data_t aes192_set1count88 = {
+    .set_num = 1,
+    .count = 88,
+    .key = aes192_set1count88key,
+    .plain = aes192_set1count88plain,
+    .cipher = aes192_set1count88cipher,
+};
+
+const uint8_t aes192_set1count89key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count89plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count89cipher[] = { 0x34, 0x0D, 0xA0, 0x9C, 0x2D, 0xD1, 0x1C, 0x3B, 0x67, 0x9D, 0x08, 0xCC, 0xD2, 0x7D, 0xD5, 0x95 };
+const vector_data_t aes192_set1count89 = {
+    .set_num = 1,
+    .count = 89,
+    .key = aes192_set1count89key,
+    .plain = aes192_set1count89plain,
+    .cipher = aes192_set1count89cipher,
+};
+
+const uint8_t aes192_set1count90key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count90plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count90cipher[] = { 0x82, 0x79, 0xF7, 0xC0, 0xC2, 0xA0, 0x3E, 0xE6, 0x60, 0xC6, 0xD3, 0x92, 0xDB, 0x02, 0x5D, 0x18 };
+const vector_data_t aes192_set1count90 = {
+    .set_num = 1,
+    .count = 90,
+    .key = aes192_set1count90key,
+    .plain = aes192_set1count90plain,
+    .cipher = aes192_set1count90cipher,
+};
+
+const uint8_t aes192_set1count91key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count91plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count91cipher[] = { 0xA4, 0xB2, 0xC7, 0xD8, 0xEB, 0xA5, 0x31, 0xFF, 0x47, 0xC5, 0x04, 0x1A, 0x55, 0xFB, 0xD1, 0xEC };
+const vector_data_t aes192_set1count91 = {
+    .set_num = 1,
+    .count = 91,
+    .key = aes192_set1count91key,
+    .plain = aes192_set1count91plain,
+    .cipher = aes192_set1count91cipher,
+};
+
+const uint8_t aes192_set1count92key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count92plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count92cipher[] = { 0x74, 0x56, 0x9A, 0x2C, 0xA5, 0xA7, 0xBD, 0x51, 0x31, 0xCE, 0x8D, 0xC7, 0xCB, 0xFB, 0xF7, 0x2F };
+const vector_data_t aes192_set1count92 = {
+    .set_num = 1,
+    .count = 92,
+    .key = aes192_set1count92key,
+    .plain = aes192_set1count92plain,
+    .cipher = aes192_set1count92cipher,
+};
+
+const uint8_t aes192_set1count93key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count93plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count93cipher[] = { 0x37, 0x13, 0xDA, 0x0C, 0x02, 0x19, 0xB6, 0x34, 0x54, 0x03, 0x56, 0x13, 0xB5, 0xA4, 0x03, 0xDD };
+const vector_data_t aes192_set1count93 = {
+    .set_num = 1,
+    .count = 93,
+    .key = aes192_set1count93key,
+    .plain = aes192_set1count93plain,
+    .cipher = aes192_set1count93cipher,
+};
+
+const uint8_t aes192_set1count94key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count94plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count94cipher[] = { 0x88, 0x27, 0x55, 0x1D, 0xDC, 0xC9, 0xDF, 0x23, 0xFA, 0x72, 0xA3, 0xDE, 0x4E, 0x9F, 0x0B, 0x07 };
+const vector_data_t aes192_set1count94 = {
+    .set_num = 1,
+    .count = 94,
+    .key = aes192_set1count94key,
+    .plain = aes192_set1count94plain,
+    .cipher = aes192_set1count94cipher,
+};
+
+const uint8_t aes192_set1count95key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count95plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count95cipher[] = { 0x2E, 0x3F, 0xEB, 0xFD, 0x62, 0x5B, 0xFC, 0xD0, 0xA2, 0xC0, 0x6E, 0xB4, 0x60, 0xDA, 0x17, 0x32 };
+const vector_data_t aes192_set1count95 = {
+    .set_num = 1,
+    .count = 95,
+    .key = aes192_set1count95key,
+    .plain = aes192_set1count95plain,
+    .cipher = aes192_set1count95cipher,
+};
+
+const uint8_t aes192_set1count96key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count96plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count96cipher[] = { 0xEE, 0x82, 0xE6, 0xBA, 0x48, 0x81, 0x56, 0xF7, 0x64, 0x96, 0x31, 0x1D, 0xA6, 0x94, 0x1D, 0xEB };
+const vector_data_t aes192_set1count96 = {
+    .set_num = 1,
+    .count = 96,
+    .key = aes192_set1count96key,
+    .plain = aes192_set1count96plain,
+    .cipher = aes192_set1count96cipher,
+};
+
+const uint8_t aes192_set1count97key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count97plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count97cipher[] = { 0x47, 0x70, 0x44, 0x6F, 0x01, 0xD1, 0xF3, 0x91, 0x25, 0x6E, 0x85, 0xA1, 0xB3, 0x0D, 0x89, 0xD3 };
+const vector_data_t aes192_set1count97 = {
+    .set_num = 1,
+    .count = 97,
+    .key = aes192_set1count97key,
+    .plain = aes192_set1count97plain,
+    .cipher = aes192_set1count97cipher,
+};
+
+const uint8_t aes192_set1count98key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count98plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count98cipher[] = { 0xAF, 0x04, 0xB6, 0x8F, 0x10, 0x4F, 0x21, 0xEF, 0x2A, 0xFB, 0x47, 0x67, 0xCF, 0x74, 0x14, 0x3C };
+const vector_data_t aes192_set1count98 = {
+    .set_num = 1,
+    .count = 98,
+    .key = aes192_set1count98key,
+    .plain = aes192_set1count98plain,
+    .cipher = aes192_set1count98cipher,
+};
+
+const uint8_t aes192_set1count99key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count99plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count99cipher[] = { 0xCF, 0x35, 0x79, 0xA9, 0xBA, 0x38, 0xC8, 0xE4, 0x36, 0x53, 0x17, 0x3E, 0x14, 0xF3, 0xA4, 0xC6 };
+const vector_data_t aes192_set1count99 = {
+    .set_num = 1,
+    .count = 99,
+    .key = aes192_set1count99key,
+    .plain = aes192_set1count99plain,
+    .cipher = aes192_set1count99cipher,
+};
+
+const uint8_t aes192_set1count100key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count100plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count100cipher[] = { 0xB3, 0xBB, 0xA9, 0x04, 0xF4, 0x95, 0x3E, 0x09, 0xB5, 0x48, 0x00, 0xAF, 0x2F, 0x62, 0xE7, 0xD4 };
+const vector_data_t aes192_set1count100 = {
+    .set_num = 1,
+    .count = 100,
+    .key = aes192_set1count100key,
+    .plain = aes192_set1count100plain,
+    .cipher = aes192_set1count100cipher,
+};
+
+const uint8_t aes192_set1count101key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count101plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count101cipher[] = { 0xFC, 0x42, 0x49, 0x65, 0x6E, 0x14, 0xB2, 0x9E, 0xB9, 0xC4, 0x48, 0x29, 0xB4, 0xC5, 0x9A, 0x46 };
+const vector_data_t aes192_set1count101 = {
+    .set_num = 1,
+    .count = 101,
+    .key = aes192_set1count101key,
+    .plain = aes192_set1count101plain,
+    .cipher = aes192_set1count101cipher,
+};
+
+const uint8_t aes192_set1count102key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count102plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count102cipher[] = { 0x9B, 0x31, 0x56, 0x8F, 0xEB, 0xE8, 0x1C, 0xFC, 0x2E, 0x65, 0xAF, 0x1C, 0x86, 0xD1, 0xA3, 0x08 };
+const vector_data_t aes192_set1count102 = {
+    .set_num = 1,
+    .count = 102,
+    .key = aes192_set1count102key,
+    .plain = aes192_set1count102plain,
+    .cipher = aes192_set1count102cipher,
+};
+
+const uint8_t aes192_set1count103key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count103plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count103cipher[] = { 0x9C, 0xA0, 0x9C, 0x25, 0xF2, 0x73, 0xA7, 0x66, 0xDB, 0x98, 0xA4, 0x80, 0xCE, 0x8D, 0xFE, 0xDC };
+const vector_data_t aes192_set1count103 = {
+    .set_num = 1,
+    .count = 103,
+    .key = aes192_set1count103key,
+    .plain = aes192_set1count103plain,
+    .cipher = aes192_set1count103cipher,
+};
+
+const uint8_t aes192_set1count104key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count104plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00 };
+const uint8_t aes192_set1count104cipher[] = { 0xB9, 0x09, 0x92, 0x57, 0x86, 0xF3, 0x4C, 0x3C, 0x92, 0xD9, 0x71, 0x88, 0x3C, 0x9F, 0xBE, 0xDF };
+const vector_data_t aes192_set1count104 = {
+    .set_num = 1,
+    .count = 104,
+    .key = aes192_set1count104key,
+    .plain = aes192_set1count104plain,
+    .cipher = aes192_set1count104cipher,
+};
+
+const uint8_t aes192_set1count105key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count105plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00 };
+const uint8_t aes192_set1count105cipher[] = { 0x82, 0x64, 0x7F, 0x13, 0x32, 0xFE, 0x57, 0x0A, 0x9D, 0x4D, 0x92, 0xB2, 0xEE, 0x77, 0x1D, 0x3B };
+const vector_data_t aes192_set1count105 = {
+    .set_num = 1,
+    .count = 105,
+    .key = aes192_set1count105key,
+    .plain = aes192_set1count105plain,
+    .cipher = aes192_set1count105cipher,
+};
+
+const uint8_t aes192_set1count106key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count106plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00 };
+const uint8_t aes192_set1count106cipher[] = { 0x36, 0x04, 0xA7, 0xE8, 0x08, 0x32, 0xB3, 0xA9, 0x99, 0x54, 0xBC, 0xA6, 0xF5, 0xB9, 0xF5, 0x01 };
+const vector_data_t aes192_set1count106 = {
+    .set_num = 1,
+    .count = 106,
+    .key = aes192_set1count106key,
+    .plain = aes192_set1count106plain,
+    .cipher = aes192_set1count106cipher,
+};
+
+const uint8_t aes192_set1count107key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count107plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00 };
+const uint8_t aes192_set1count107cipher[] = { 0x88, 0x46, 0x07, 0xB1, 0x28, 0xC5, 0xDE, 0x3A, 0xB3, 0x9A, 0x52, 0x9A, 0x1E, 0xF5, 0x1B, 0xEF };
+const vector_data_t aes192_set1count107 = {
+    .set_num = 1,
+    .count = 107,
+    .key = aes192_set1count107key,
+    .plain = aes192_set1count107plain,
+    .cipher = aes192_set1count107cipher,
+};
+
+const uint8_t aes192_set1count108key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count108plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00 };
+const uint8_t aes192_set1count108cipher[] = { 0x67, 0x0C, 0xFA, 0x09, 0x3D, 0x1D, 0xBD, 0xB2, 0x31, 0x70, 0x41, 0x40, 0x41, 0x02, 0x43, 0x5E };
+const vector_data_t aes192_set1count108 = {
+    .set_num = 1,
+    .count = 108,
+    .key = aes192_set1count108key,
+    .plain = aes192_set1count108plain,
+    .cipher = aes192_set1count108cipher,
+};
+
+const uint8_t aes192_set1count109key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count109plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00 };
+const uint8_t aes192_set1count109cipher[] = { 0x7A, 0x86, 0x71, 0x95, 0xF3, 0xCE, 0x87, 0x69, 0xCB, 0xD3, 0x36, 0x50, 0x2F, 0xBB, 0x51, 0x30 };
+const vector_data_t aes192_set1count109 = {
+    .set_num = 1,
+    .count = 109,
+    .key = aes192_set1count109key,
+    .plain = aes192_set1count109plain,
+    .cipher = aes192_set1count109cipher,
+};
+
+const uint8_t aes192_set1count110key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count110plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00 };
+const uint8_t aes192_set1count110cipher[] = { 0x52, 0xEF, 0xCF, 0x64, 0xC7, 0x2B, 0x2F, 0x7C, 0xA5, 0xB3, 0xC8, 0x36, 0xB1, 0x07, 0x8C, 0x15 };
+const vector_data_t aes192_set1count110 = {
+    .set_num = 1,
+    .count = 110,
+    .key = aes192_set1count110key,
+    .plain = aes192_set1count110plain,
+    .cipher = aes192_set1count110cipher,
+};
+
+const uint8_t aes192_set1count111key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count111plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00 };
+const uint8_t aes192_set1count111cipher[] = { 0x40, 0x19, 0x25, 0x0F, 0x6E, 0xEF, 0xB2, 0xAC, 0x5C, 0xCB, 0xCA, 0xE0, 0x44, 0xE7, 0x5C, 0x7E };
+const vector_data_t aes192_set1count111 = {
+    .set_num = 1,
+    .count = 111,
+    .key = aes192_set1count111key,
+    .plain = aes192_set1count111plain,
+    .cipher = aes192_set1count111cipher,
+};
+
+const uint8_t aes192_set1count112key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count112plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00 };
+const uint8_t aes192_set1count112cipher[] = { 0x02, 0x2C, 0x4F, 0x6F, 0x5A, 0x01, 0x7D, 0x29, 0x27, 0x85, 0x62, 0x76, 0x67, 0xDD, 0xEF, 0x24 };
+const vector_data_t aes192_set1count112 = {
+    .set_num = 1,
+    .count = 112,
+    .key = aes192_set1count112key,
+    .plain = aes192_set1count112plain,
+    .cipher = aes192_set1count112cipher,
+};
+
+const uint8_t aes192_set1count113key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count113plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00 };
+const uint8_t aes192_set1count113cipher[] = { 0xE9, 0xC2, 0x10, 0x78, 0xA2, 0xEB, 0x7E, 0x03, 0x25, 0x0F, 0x71, 0x00, 0x0F, 0xA9, 0xE3, 0xED };
+const vector_data_t aes192_set1count113 = {
+    .set_num = 1,
+    .count = 113,
+    .key = aes192_set1count113key,
+    .plain = aes192_set1count113plain,
+    .cipher = aes192_set1count113cipher,
+};
+
+const uint8_t aes192_set1count114key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count114plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00 };
+const uint8_t aes192_set1count114cipher[] = { 0xA1, 0x3E, 0xAE, 0xEB, 0x9C, 0xD3, 0x91, 0xDA, 0x4E, 0x2B, 0x09, 0x49, 0x0B, 0x3E, 0x7F, 0xAD };
+const vector_data_t aes192_set1count114 = {
+    .set_num = 1,
+    .count = 114,
+    .key = aes192_set1count114key,
+    .plain = aes192_set1count114plain,
+    .cipher = aes192_set1count114cipher,
+};
+
+const uint8_t aes192_set1count115key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count115plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00 };
+const uint8_t aes192_set1count115cipher[] = { 0xC9, 0x58, 0xA1, 0x71, 0xDC, 0xA1, 0xD4, 0xED, 0x53, 0xE1, 0xAF, 0x1D, 0x38, 0x08, 0x03, 0xA9 };
+const vector_data_t aes192_set1count115 = {
+    .set_num = 1,
+    .count = 115,
+    .key = aes192_set1count115key,
+    .plain = aes192_set1count115plain,
+    .cipher = aes192_set1count115cipher,
+};
+
+const uint8_t aes192_set1count116key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count116plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00 };
+const uint8_t aes192_set1count116cipher[] = { 0x21, 0x44, 0x2E, 0x07, 0xA1, 0x10, 0x66, 0x7F, 0x25, 0x83, 0xEA, 0xEE, 0xEE, 0x44, 0xDC, 0x8C };
+const vector_data_t aes192_set1count116 = {
+    .set_num = 1,
+    .count = 116,
+    .key = aes192_set1count116key,
+    .plain = aes192_set1count116plain,
+    .cipher = aes192_set1count116cipher,
+};
+
+const uint8_t aes192_set1count117key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count117plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00 };
+const uint8_t aes192_set1count117cipher[] = { 0x59, 0xBB, 0xB3, 0x53, 0xCF, 0x1D, 0xD8, 0x67, 0xA6, 0xE3, 0x37, 0x37, 0xAF, 0x65, 0x5E, 0x99 };
+const vector_data_t aes192_set1count117 = {
+    .set_num = 1,
+    .count = 117,
+    .key = aes192_set1count117key,
+    .plain = aes192_set1count117plain,
+    .cipher = aes192_set1count117cipher,
+};
+
+const uint8_t aes192_set1count118key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count118plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00 };
+const uint8_t aes192_set1count118cipher[] = { 0x43, 0xCD, 0x3B, 0x25, 0x37, 0x5D, 0x0C, 0xE4, 0x10, 0x87, 0xFF, 0x9F, 0xE2, 0x82, 0x96, 0x39 };
+const vector_data_t aes192_set1count118 = {
+    .set_num = 1,
+    .count = 118,
+    .key = aes192_set1count118key,
+    .plain = aes192_set1count118plain,
+    .cipher = aes192_set1count118cipher,
+};
+
+const uint8_t aes192_set1count119key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count119plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+const uint8_t aes192_set1count119cipher[] = { 0x6B, 0x98, 0xB1, 0x7E, 0x80, 0xD1, 0x11, 0x8E, 0x35, 0x16, 0xBD, 0x76, 0x8B, 0x28, 0x5A, 0x84 };
+const vector_data_t aes192_set1count119 = {
+    .set_num = 1,
+    .count = 119,
+    .key = aes192_set1count119key,
+    .plain = aes192_set1count119plain,
+    .cipher = aes192_set1count119cipher,
+};
+
+const uint8_t aes192_set1count120key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count120plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80 };
+const uint8_t aes192_set1count120cipher[] = { 0xAE, 0x47, 0xED, 0x36, 0x76, 0xCA, 0x0C, 0x08, 0xDE, 0xEA, 0x02, 0xD9, 0x5B, 0x81, 0xDB, 0x58 };
+const vector_data_t aes192_set1count120 = {
+    .set_num = 1,
+    .count = 120,
+    .key = aes192_set1count120key,
+    .plain = aes192_set1count120plain,
+    .cipher = aes192_set1count120cipher,
+};
+
+const uint8_t aes192_set1count121key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count121plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0 };
+const uint8_t aes192_set1count121cipher[] = { 0x34, 0xEC, 0x40, 0xDC, 0x20, 0x41, 0x37, 0x95, 0xED, 0x53, 0x62, 0x8E, 0xA7, 0x48, 0x72, 0x0B };
+const vector_data_t aes192_set1count121 = {
+    .set_num = 1,
+    .count = 121,
+    .key = aes192_set1count121key,
+    .plain = aes192_set1count121plain,
+    .cipher = aes192_set1count121cipher,
+};
+
+const uint8_t aes192_set1count122key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count122plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0 };
+const uint8_t aes192_set1count122cipher[] = { 0x4D, 0xC6, 0x81, 0x63, 0xF8, 0xE9, 0x83, 0x54, 0x73, 0x25, 0x35, 0x42, 0xC8, 0xA6, 0x5D, 0x46 };
+const vector_data_t aes192_set1count122 = {
+    .set_num = 1,
+    .count = 122,
+    .key = aes192_set1count122key,
+    .plain = aes192_set1count122plain,
+    .cipher = aes192_set1count122cipher,
+};
+
+const uint8_t aes192_set1count123key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count123plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 };
+const uint8_t aes192_set1count123cipher[] = { 0x2A, 0xAB, 0xB9, 0x99, 0xF4, 0x36, 0x93, 0x17, 0x5A, 0xF6, 0x5C, 0x6C, 0x61, 0x2C, 0x46, 0xFB };
+const vector_data_t aes192_set1count123 = {
+    .set_num = 1,
+    .count = 123,
+    .key = aes192_set1count123key,
+    .plain = aes192_set1count123plain,
+    .cipher = aes192_set1count123cipher,
+};
+
+const uint8_t aes192_set1count124key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count124plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8 };
+const uint8_t aes192_set1count124cipher[] = { 0xE0, 0x1F, 0x94, 0x49, 0x9D, 0xAC, 0x35, 0x47, 0x51, 0x5C, 0x5B, 0x1D, 0x75, 0x6F, 0x0F, 0x58 };
+const vector_data_t aes192_set1count124 = {
+    .set_num = 1,
+    .count = 124,
+    .key = aes192_set1count124key,
+    .plain = aes192_set1count124plain,
+    .cipher = aes192_set1count124cipher,
+};
+
+const uint8_t aes192_set1count125key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count125plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC };
+const uint8_t aes192_set1count125cipher[] = { 0x9D, 0x12, 0x43, 0x5A, 0x46, 0x48, 0x0C, 0xE0, 0x0E, 0xA3, 0x49, 0xF7, 0x17, 0x99, 0xDF, 0x9A };
+const vector_data_t aes192_set1count125 = {
+    .set_num = 1,
+    .count = 125,
+    .key = aes192_set1count125key,
+    .plain = aes192_set1count125plain,
+    .cipher = aes192_set1count125cipher,
+};
+
+const uint8_t aes192_set1count126key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count126plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE };
+const uint8_t aes192_set1count126cipher[] = { 0xCE, 0xF4, 0x1D, 0x16, 0xD2, 0x66, 0xBD, 0xFE, 0x46, 0x93, 0x8A, 0xD7, 0x88, 0x4C, 0xC0, 0xCF };
+const vector_data_t aes192_set1count126 = {
+    .set_num = 1,
+    .count = 126,
+    .key = aes192_set1count126key,
+    .plain = aes192_set1count126plain,
+    .cipher = aes192_set1count126cipher,
+};
+
+const uint8_t aes192_set1count127key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes192_set1count127plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+const uint8_t aes192_set1count127cipher[] = { 0xB1, 0x3D, 0xB4, 0xDA, 0x1F, 0x71, 0x8B, 0xC6, 0x90, 0x47, 0x97, 0xC8, 0x2B, 0xCF, 0x2D, 0x32 };
+const vector_data_t aes192_set1count127 = {
+    .set_num = 1,
+    .count = 127,
+    .key = aes192_set1count127key,
+    .plain = aes192_set1count127plain,
+    .cipher = aes192_set1count127cipher,
+};
+
+const vector_data_t * const aes192_test_vectors[] = {
+    &aes192_set0count0,
+    &aes192_set0count1,
+    &aes192_set0count2,
+    &aes192_set0count3,
+    &aes192_set0count4,
+    &aes192_set0count5,
+    &aes192_set0count6,
+    &aes192_set0count7,
+    &aes192_set0count8,
+    &aes192_set0count9,
+    &aes192_set0count10,
+    &aes192_set0count11,
+    &aes192_set0count12,
+    &aes192_set0count13,
+    &aes192_set0count14,
+    &aes192_set0count15,
+    &aes192_set0count16,
+    &aes192_set0count17,
+    &aes192_set0count18,
+    &aes192_set0count19,
+    &aes192_set0count20,
+    &aes192_set0count21,
+    &aes192_set0count22,
+    &aes192_set0count23,
+    &aes192_set0count24,
+    &aes192_set0count25,
+    &aes192_set0count26,
+    &aes192_set0count27,
+    &aes192_set0count28,
+    &aes192_set0count29,
+    &aes192_set0count30,
+    &aes192_set0count31,
+    &aes192_set0count32,
+    &aes192_set0count33,
+    &aes192_set0count34,
+    &aes192_set0count35,
+    &aes192_set0count36,
+    &aes192_set0count37,
+    &aes192_set0count38,
+    &aes192_set0count39,
+    &aes192_set0count40,
+    &aes192_set0count41,
+    &aes192_set0count42,
+    &aes192_set0count43,
+    &aes192_set0count44,
+    &aes192_set0count45,
+    &aes192_set0count46,
+    &aes192_set0count47,
+    &aes192_set0count48,
+    &aes192_set0count49,
+    &aes192_set0count50,
+    &aes192_set0count51,
+    &aes192_set0count52,
+    &aes192_set0count53,
+    &aes192_set0count54,
+    &aes192_set0count55,
+    &aes192_set0count56,
+    &aes192_set0count57,
+    &aes192_set0count58,
+    &aes192_set0count59,
+    &aes192_set0count60,
+    &aes192_set0count61,
+    &aes192_set0count62,
+    &aes192_set0count63,
+    &aes192_set0count64,
+    &aes192_set0count65,
+    &aes192_set0count66,
+    &aes192_set0count67,
+    &aes192_set0count68,
+    &aes192_set0count69,
+    &aes192_set0count70,
+    &aes192_set0count71,
+    &aes192_set0count72,
+    &aes192_set0count73,
+    &aes192_set0count74,
+    &aes192_set0count75,
+    &aes192_set0count76,
+    &aes192_set0count77,
+    &aes192_set0count78,
+    &aes192_set0count79,
+    &aes192_set0count80,
+    &aes192_set0count81,
+    &aes192_set0count82,
+    &aes192_set0count83,
+    &aes192_set0count84,
+    &aes192_set0count85,
+    &aes192_set0count86,
+    &aes192_set0count87,
+    &aes192_set0count88,
+    &aes192_set0count89,
+    &aes192_set0count90,
+    &aes192_set0count91,
+    &aes192_set0count92,
+    &aes192_set0count93,
+    &aes192_set0count94,
+    &aes192_set0count95,
+    &aes192_set0count96,
+    &aes192_set0count97,
+    &aes192_set0count98,
+    &aes192_set0count99,
+    &aes192_set0count100,
+    &aes192_set0count101,
+    &aes192_set0count102,
+    &aes192_set0count103,
+    &aes192_set0count104,
+    &aes192_set0count105,
+    &aes192_set0count106,
+    &aes192_set0count107,
+    &aes192_set0count108,
+    &aes192_set0count109,
+    &aes192_set0count110,
+    &aes192_set0count111,
+    &aes192_set0count112,
+    &aes192_set0count113,
+    &aes192_set0count114,
+    &aes192_set0count115,
+    &aes192_set0count116,
+    &aes192_set0count117,
+    &aes192_set0count118,
+    &aes192_set0count119,
+    &aes192_set0count120,
+    &aes192_set0count121,
+    &aes192_set0count122,
+    &aes192_set0count123,
+    &aes192_set0count124,
+    &aes192_set0count125,
+    &aes192_set0count126,
+    &aes192_set0count127,
+    &aes192_set0count128,
+    &aes192_set0count129,
+    &aes192_set0count130,
+    &aes192_set0count131,
+    &aes192_set0count132,
+    &aes192_set0count133,
+    &aes192_set0count134,
+    &aes192_set0count135,
+    &aes192_set0count136,
+    &aes192_set0count137,
+    &aes192_set0count138,
+    &aes192_set0count139,
+    &aes192_set0count140,
+    &aes192_set0count141,
+    &aes192_set0count142,
+    &aes192_set0count143,
+    &aes192_set0count144,
+    &aes192_set0count145,
+    &aes192_set0count146,
+    &aes192_set0count147,
+    &aes192_set0count148,
+    &aes192_set0count149,
+    &aes192_set0count150,
+    &aes192_set0count151,
+    &aes192_set0count152,
+    &aes192_set0count153,
+    &aes192_set0count154,
+    &aes192_set0count155,
+    &aes192_set0count156,
+    &aes192_set0count157,
+    &aes192_set0count158,
+    &aes192_set0count159,
+    &aes192_set0count160,
+    &aes192_set0count161,
+    &aes192_set0count162,
+    &aes192_set0count163,
+    &aes192_set0count164,
+    &aes192_set0count165,
+    &aes192_set0count166,
+    &aes192_set0count167,
+    &aes192_set0count168,
+    &aes192_set0count169,
+    &aes192_set0count170,
+    &aes192_set0count171,
+    &aes192_set0count172,
+    &aes192_set0count173,
+    &aes192_set0count174,
+    &aes192_set0count175,
+    &aes192_set0count176,
+    &aes192_set0count177,
+    &aes192_set0count178,
+    &aes192_set0count179,
+    &aes192_set0count180,
+    &aes192_set0count181,
+    &aes192_set0count182,
+    &aes192_set0count183,
+    &aes192_set0count184,
+    &aes192_set0count185,
+    &aes192_set0count186,
+    &aes192_set0count187,
+    &aes192_set0count188,
+    &aes192_set0count189,
+    &aes192_set0count190,
+    &aes192_set0count191,
+    &aes192_set1count0,
+    &aes192_set1count1,
+    &aes192_set1count2,
+    &aes192_set1count3,
+    &aes192_set1count4,
+    &aes192_set1count5,
+    &aes192_set1count6,
+    &aes192_set1count7,
+    &aes192_set1count8,
+    &aes192_set1count9,
+    &aes192_set1count10,
+    &aes192_set1count11,
+    &aes192_set1count12,
+    &aes192_set1count13,
+    &aes192_set1count14,
+    &aes192_set1count15,
+    &aes192_set1count16,
+    &aes192_set1count17,
+    &aes192_set1count18,
+    &aes192_set1count19,
+    &aes192_set1count20,
+    &aes192_set1count21,
+    &aes192_set1count22,
+    &aes192_set1count23,
+    &aes192_set1count24,
+    &aes192_set1count25,
+    &aes192_set1count26,
+    &aes192_set1count27,
+    &aes192_set1count28,
+    &aes192_set1count29,
+    &aes192_set1count30,
+    &aes192_set1count31,
+    &aes192_set1count32,
+    &aes192_set1count33,
+    &aes192_set1count34,
+    &aes192_set1count35,
+    &aes192_set1count36,
+    &aes192_set1count37,
+    &aes192_set1count38,
+    &aes192_set1count39,
+    &aes192_set1count40,
+    &aes192_set1count41,
+    &aes192_set1count42,
+    &aes192_set1count43,
+    &aes192_set1count44,
+    &aes192_set1count45,
+    &aes192_set1count46,
+    &aes192_set1count47,
+    &aes192_set1count48,
+    &aes192_set1count49,
+    &aes192_set1count50,
+    &aes192_set1count51,
+    &aes192_set1count52,
+    &aes192_set1count53,
+    &aes192_set1count54,
+    &aes192_set1count55,
+    &aes192_set1count56,
+    &aes192_set1count57,
+    &aes192_set1count58,
+    &aes192_set1count59,
+    &aes192_set1count60,
+    &aes192_set1count61,
+    &aes192_set1count62,
+    &aes192_set1count63,
+    &aes192_set1count64,
+    &aes192_set1count65,
+    &aes192_set1count66,
+    &aes192_set1count67,
+    &aes192_set1count68,
+    &aes192_set1count69,
+    &aes192_set1count70,
+    &aes192_set1count71,
+    &aes192_set1count72,
+    &aes192_set1count73,
+    &aes192_set1count74,
+    &aes192_set1count75,
+    &aes192_set1count76,
+    &aes192_set1count77,
+    &aes192_set1count78,
+    &aes192_set1count79,
+    &aes192_set1count80,
+    &aes192_set1count81,
+    &aes192_set1count82,
+    &aes192_set1count83,
+    &aes192_set1count84,
+    &aes192_set1count85,
+    &aes192_set1count86,
+    &aes192_set1count87,
+    &aes192_set1count88,
+    &aes192_set1count89,
+    &aes192_set1count90,
+    &aes192_set1count91,
+    &aes192_set1count92,
+    &aes192_set1count93,
+    &aes192_set1count94,
+    &aes192_set1count95,
+    &aes192_set1count96,
+    &aes192_set1count97,
+    &aes192_set1count98,
+    &aes192_set1count99,
+    &aes192_set1count100,
+    &aes192_set1count101,
+    &aes192_set1count102,
+    &aes192_set1count103,
+    &aes192_set1count104,
+    &aes192_set1count105,
+    &aes192_set1count106,
+    &aes192_set1count107,
+    &aes192_set1count108,
+    &aes192_set1count109,
+    &aes192_set1count110,
+    &aes192_set1count111,
+    &aes192_set1count112,
+    &aes192_set1count113,
+    &aes192_set1count114,
+    &aes192_set1count115,
+    &aes192_set1count116,
+    &aes192_set1count117,
+    &aes192_set1count118,
+    &aes192_set1count119,
+    &aes192_set1count120,
+    &aes192_set1count121,
+    &aes192_set1count122,
+    &aes192_set1count123,
+    &aes192_set1count124,
+    &aes192_set1count125,
+    &aes192_set1count126,
+    &aes192_set1count127,
+};
+
+const char * const aes192_set_names[] = {
+    "ECBVarKey192.rsp",
+    "ECBVarTxt192.rsp",
+};
+
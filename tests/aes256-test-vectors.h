@@ -0,0 +1,4627 @@
+
+/* This file was generated by Python program parse-vectors.py
+from the AES KAT (Known Answer Tests), using the following command:
+
+    ./parse-vectors.py --prefix=aes256_ ECBVarKey256.rsp ECBVarTxt256.rsp
+
+This file should not be edited manually.
+
+It is used by tests/aes-vectors-test.c.
+*/
+
+const uint8_t aes256_set0count0key[] = { 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count0plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count0cipher[] = { 0xE3, 0x5A, 0x6D, 0xCB, 0x19, 0xB2, 0x01, 0xA0, 0x1E, 0xBC, 0xFA, 0x8A, 0xA2, 0x2B, 0x57, 0x59 };
+const vector_data_t aes256_set0count0 = {
+    .set_num = 0,
+    .count = 0,
+    .key = aes256_set0count0key,
+    .plain = aes256_set0count0plain,
+    .cipher = aes256_set0count0cipher,
+};
+
+const uint8_t aes256_set0count1key[] = { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count1plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count1cipher[] = { 0xB2, 0x91, 0x69, 0xCD, 0xCF, 0x2D, 0x83, 0xE8, 0x38, 0x12, 0x5A, 0x12, 0xEE, 0x6A, 0xA4, 0x00 };
+const vector_data_t aes256_set0count1 = {
+    .set_num = 0,
+    .count = 1,
+    .key = aes256_set0count1key,
+    .plain = aes256_set0count1plain,
+    .cipher = aes256_set0count1cipher,
+};
+
+const uint8_t aes256_set0count2key[] = { 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count2plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count2cipher[] = { 0xD8, 0xF3, 0xA7, 0x2F, 0xC3, 0xCD, 0xF7, 0x4D, 0xFA, 0xF6, 0xC3, 0xE6, 0xB9, 0x7B, 0x2F, 0xA6 };
+const vector_data_t aes256_set0count2 = {
+    .set_num = 0,
+    .count = 2,
+    .key = aes256_set0count2key,
+    .plain = aes256_set0count2plain,
+    .cipher = aes256_set0count2cipher,
+};
+
+const uint8_t aes256_set0count3key[] = { 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count3plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count3cipher[] = { 0x1C, 0x77, 0x76, 0x79, 0xD5, 0x00, 0x37, 0xC7, 0x94, 0x91, 0xA9, 0x4D, 0xA7, 0x6A, 0x9A, 0x35 };
+const vector_data_t aes256_set0count3 = {
+    .set_num = 0,
+    .count = 3,
+    .key = aes256_set0count3key,
+    .plain = aes256_set0count3plain,
+    .cipher = aes256_set0count3cipher,
+};
+
+const uint8_t aes256_set0count4key[] = { 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count4plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count4cipher[] = { 0x9C, 0xF4, 0x89, 0x3E, 0xCA, 0xFA, 0x0A, 0x02, 0x47, 0xA8, 0x98, 0xE0, 0x40, 0x69, 0x15, 0x59 };
+const vector_data_t aes256_set0count4 = {
+    .set_num = 0,
+    .count = 4,
+    .key = aes256_set0count4key,
+    .plain = aes256_set0count4plain,
+    .cipher = aes256_set0count4cipher,
+};
+
+const uint8_t aes256_set0count5key[] = { 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count5plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count5cipher[] = { 0x8F, 0xBB, 0x41, 0x37, 0x03, 0x73, 0x53, 0x26, 0x31, 0x0A, 0x26, 0x9B, 0xD3, 0xAA, 0x94, 0xB2 };
+const vector_data_t aes256_set0count5 = {
+    .set_num = 0,
+    .count = 5,
+    .key = aes256_set0count5key,
+    .plain = aes256_set0count5plain,
+    .cipher = aes256_set0count5cipher,
+};
+
+const uint8_t aes256_set0count6key[] = { 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count6plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count6cipher[] = { 0x60, 0xE3, 0x22, 0x46, 0xBE, 0xD2, 0xB0, 0xE8, 0x59, 0xE5, 0x5C, 0x1C, 0xC6, 0xB2, 0x65, 0x02 };
+const vector_data_t aes256_set0count6 = {
+    .set_num = 0,
+    .count = 6,
+    .key = aes256_set0count6key,
+    .plain = aes256_set0count6plain,
+    .cipher = aes256_set0count6cipher,
+};
+
+const uint8_t aes256_set0count7key[] = { 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count7plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count7cipher[] = { 0xEC, 0x52, 0xA2, 0x12, 0xF8, 0x0A, 0x09, 0xDF, 0x63, 0x17, 0x02, 0x1B, 0xC2, 0xA9, 0x81, 0x9E };
+const vector_data_t aes256_set0count7 = {
+    .set_num = 0,
+    .count = 7,
+    .key = aes256_set0count7key,
+    .plain = aes256_set0count7plain,
+    .cipher = aes256_set0count7cipher,
+};
+
+const uint8_t aes256_set0count8key[] = { 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count8plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count8cipher[] = { 0xF2, 0x3E, 0x5B, 0x60, 0x0E, 0xB7, 0x0D, 0xBC, 0xCF, 0x6C, 0x0B, 0x1D, 0x9A, 0x68, 0x18, 0x2C };
+const vector_data_t aes256_set0count8 = {
+    .set_num = 0,
+    .count = 8,
+    .key = aes256_set0count8key,
+    .plain = aes256_set0count8plain,
+    .cipher = aes256_set0count8cipher,
+};
+
+const uint8_t aes256_set0count9key[] = { 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count9plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count9cipher[] = { 0xA3, 0xF5, 0x99, 0xD6, 0x3A, 0x82, 0xA9, 0x68, 0xC3, 0x3F, 0xE2, 0x65, 0x90, 0x74, 0x59, 0x70 };
+const vector_data_t aes256_set0count9 = {
+    .set_num = 0,
+    .count = 9,
+    .key = aes256_set0count9key,
+    .plain = aes256_set0count9plain,
+    .cipher = aes256_set0count9cipher,
+};
+
+const uint8_t aes256_set0count10key[] = { 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count10plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count10cipher[] = { 0xD1, 0xCC, 0xB9, 0xB1, 0x33, 0x70, 0x02, 0xCB, 0xAC, 0x42, 0xC5, 0x20, 0xB5, 0xD6, 0x77, 0x22 };
+const vector_data_t aes256_set0count10 = {
+    .set_num = 0,
+    .count = 10,
+    .key = aes256_set0count10key,
+    .plain = aes256_set0count10plain,
+    .cipher = aes256_set0count10cipher,
+};
+
+const uint8_t aes256_set0count11key[] = { 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count11plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count11cipher[] = { 0xCC, 0x11, 0x1F, 0x6C, 0x37, 0xCF, 0x40, 0xA1, 0x15, 0x9D, 0x00, 0xFB, 0x59, 0xFB, 0x04, 0x88 };
+const vector_data_t aes256_set0count11 = {
+    .set_num = 0,
+    .count = 11,
+    .key = aes256_set0count11key,
+    .plain = aes256_set0count11plain,
+    .cipher = aes256_set0count11cipher,
+};
+
+const uint8_t aes256_set0count12key[] = { 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count12plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count12cipher[] = { 0xDC, 0x43, 0xB5, 0x1A, 0xB6, 0x09, 0x05, 0x23, 0x72, 0x98, 0x9A, 0x26, 0xE9, 0xCD, 0xD7, 0x14 };
+const vector_data_t aes256_set0count12 = {
+    .set_num = 0,
+    .count = 12,
+    .key = aes256_set0count12key,
+    .plain = aes256_set0count12plain,
+    .cipher = aes256_set0count12cipher,
+};
+
+const uint8_t aes256_set0count13key[] = { 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count13plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count13cipher[] = { 0x4D, 0xCE, 0xDE, 0x8D, 0xA9, 0xE2, 0x57, 0x8F, 0x39, 0x70, 0x3D, 0x44, 0x33, 0xDC, 0x64, 0x59 };
+const vector_data_t aes256_set0count13 = {
+    .set_num = 0,
+    .count = 13,
+    .key = aes256_set0count13key,
+    .plain = aes256_set0count13plain,
+    .cipher = aes256_set0count13cipher,
+};
+
+const uint8_t aes256_set0count14key[] = { 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count14plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count14cipher[] = { 0x1A, 0x4C, 0x1C, 0x26, 0x3B, 0xBC, 0xCF, 0xAF, 0xC1, 0x17, 0x82, 0x89, 0x46, 0x85, 0xE3, 0xA8 };
+const vector_data_t aes256_set0count14 = {
+    .set_num = 0,
+    .count = 14,
+    .key = aes256_set0count14key,
+    .plain = aes256_set0count14plain,
+    .cipher = aes256_set0count14cipher,
+};
+
+const uint8_t aes256_set0count15key[] = { 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count15plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count15cipher[] = { 0x93, 0x7A, 0xD8, 0x48, 0x80, 0xDB, 0x50, 0x61, 0x34, 0x23, 0xD6, 0xD5, 0x27, 0xA2, 0x82, 0x3D };
+const vector_data_t aes256_set0count15 = {
+    .set_num = 0,
+    .count = 15,
+    .key = aes256_set0count15key,
+    .plain = aes256_set0count15plain,
+    .cipher = aes256_set0count15cipher,
+};
+
+const uint8_t aes256_set0count16key[] = { 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count16plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count16cipher[] = { 0x61, 0x0B, 0x71, 0xDF, 0xC6, 0x88, 0xE1, 0x50, 0xD8, 0x15, 0x2C, 0x5B, 0x35, 0xEB, 0xC1, 0x4D };
+const vector_data_t aes256_set0count16 = {
+    .set_num = 0,
+    .count = 16,
+    .key = aes256_set0count16key,
+    .plain = aes256_set0count16plain,
+    .cipher = aes256_set0count16cipher,
+};
+
+const uint8_t aes256_set0count17key[] = { 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count17plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count17cipher[] = { 0x27, 0xEF, 0x24, 0x95, 0xDA, 0xBF, 0x32, 0x38, 0x85, 0xAA, 0xB3, 0x9C, 0x80, 0xF1, 0x8D, 0x8B };
+const vector_data_t aes256_set0count17 = {
+    .set_num = 0,
+    .count = 17,
+    .key = aes256_set0count17key,
+    .plain = aes256_set0count17plain,
+    .cipher = aes256_set0count17cipher,
+};
+
+const uint8_t aes256_set0count18key[] = { 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count18plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count18cipher[] = { 0x63, 0x3C, 0xAF, 0xEA, 0x39, 0x5B, 0xC0, 0x3A, 0xDA, 0xE3, 0xA1, 0xE2, 0x06, 0x8E, 0x4B, 0x4E };
+const vector_data_t aes256_set0count18 = {
+    .set_num = 0,
+    .count = 18,
+    .key = aes256_set0count18key,
+    .plain = aes256_set0count18plain,
+    .cipher = aes256_set0count18cipher,
+};
+
+const uint8_t aes256_set0count19key[] = { 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count19plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count19cipher[] = { 0x6E, 0x1B, 0x48, 0x2B, 0x53, 0x76, 0x1C, 0xF6, 0x31, 0x81, 0x9B, 0x74, 0x9A, 0x6F, 0x37, 0x24 };
+const vector_data_t aes256_set0count19 = {
+    .set_num = 0,
+    .count = 19,
+    .key = aes256_set0count19key,
+    .plain = aes256_set0count19plain,
+    .cipher = aes256_set0count19cipher,
+};
+
+const uint8_t aes256_set0count20key[] = { 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count20plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count20cipher[] = { 0x97, 0x6E, 0x6F, 0x85, 0x1A, 0xB5, 0x2C, 0x77, 0x19, 0x98, 0xDB, 0xB2, 0xD7, 0x1C, 0x75, 0xA9 };
+const vector_data_t aes256_set0count20 = {
+    .set_num = 0,
+    .count = 20,
+    .key = aes256_set0count20key,
+    .plain = aes256_set0count20plain,
+    .cipher = aes256_set0count20cipher,
+};
+
+const uint8_t aes256_set0count21key[] = { 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count21plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count21cipher[] = { 0x85, 0xF2, 0xBA, 0x84, 0xF8, 0xC3, 0x07, 0xCF, 0x52, 0x5E, 0x12, 0x4C, 0x3E, 0x22, 0xE6, 0xCC };
+const vector_data_t aes256_set0count21 = {
+    .set_num = 0,
+    .count = 21,
+    .key = aes256_set0count21key,
+    .plain = aes256_set0count21plain,
+    .cipher = aes256_set0count21cipher,
+};
+
+const uint8_t aes256_set0count22key[] = { 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count22plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count22cipher[] = { 0x6B, 0xCC, 0xA9, 0x8B, 0xF6, 0xA8, 0x35, 0xFA, 0x64, 0x95, 0x5F, 0x72, 0xDE, 0x41, 0x15, 0xFE };
+const vector_data_t aes256_set0count22 = {
+    .set_num = 0,
+    .count = 22,
+    .key = aes256_set0count22key,
+    .plain = aes256_set0count22plain,
+    .cipher = aes256_set0count22cipher,
+};
+
+const uint8_t aes256_set0count23key[] = { 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count23plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count23cipher[] = { 0x2C, 0x75, 0xE2, 0xD3, 0x6E, 0xEB, 0xD6, 0x54, 0x11, 0xF1, 0x4F, 0xD0, 0xEB, 0x1D, 0x2A, 0x06 };
+const vector_data_t aes256_set0count23 = {
+    .set_num = 0,
+    .count = 23,
+    .key = aes256_set0count23key,
+    .plain = aes256_set0count23plain,
+    .cipher = aes256_set0count23cipher,
+};
+
+const uint8_t aes256_set0count24key[] = { 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count24plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count24cipher[] = { 0xBD, 0x49, 0x29, 0x50, 0x06, 0x25, 0x0F, 0xFC, 0xA5, 0x10, 0x0B, 0x60, 0x07, 0xA0, 0xEA, 0xDE };
+const vector_data_t aes256_set0count24 = {
+    .set_num = 0,
+    .count = 24,
+    .key = aes256_set0count24key,
+    .plain = aes256_set0count24plain,
+    .cipher = aes256_set0count24cipher,
+};
+
+const uint8_t aes256_set0count25key[] = { 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count25plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count25cipher[] = { 0xA1, 0x90, 0x52, 0x7D, 0x0E, 0xF7, 0xC7, 0x0F, 0x45, 0x9C, 0xD3, 0x94, 0x0D, 0xF3, 0x16, 0xEC };
+const vector_data_t aes256_set0count25 = {
+    .set_num = 0,
+    .count = 25,
+    .key = aes256_set0count25key,
+    .plain = aes256_set0count25plain,
+    .cipher = aes256_set0count25cipher,
+};
+
+const uint8_t aes256_set0count26key[] = { 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count26plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count26cipher[] = { 0xBB, 0xD1, 0x09, 0x7A, 0x62, 0x43, 0x3F, 0x79, 0x44, 0x9F, 0xA9, 0x7D, 0x4E, 0xE8, 0x0D, 0xBF };
+const vector_data_t aes256_set0count26 = {
+    .set_num = 0,
+    .count = 26,
+    .key = aes256_set0count26key,
+    .plain = aes256_set0count26plain,
+    .cipher = aes256_set0count26cipher,
+};
+
+const uint8_t aes256_set0count27key[] = { 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count27plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count27cipher[] = { 0x07, 0x05, 0x8E, 0x40, 0x8F, 0x5B, 0x99, 0xB0, 0xE0, 0xF0, 0x61, 0xA1, 0x76, 0x1B, 0x5B, 0x3B };
+const vector_data_t aes256_set0count27 = {
+    .set_num = 0,
+    .count = 27,
+    .key = aes256_set0count27key,
+    .plain = aes256_set0count27plain,
+    .cipher = aes256_set0count27cipher,
+};
+
+const uint8_t aes256_set0count28key[] = { 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count28plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count28cipher[] = { 0x5F, 0xD1, 0xF1, 0x3F, 0xA0, 0xF3, 0x1E, 0x37, 0xFA, 0xBD, 0xE3, 0x28, 0xF8, 0x94, 0xEA, 0xC2 };
+const vector_data_t aes256_set0count28 = {
+    .set_num = 0,
+    .count = 28,
+    .key = aes256_set0count28key,
+    .plain = aes256_set0count28plain,
+    .cipher = aes256_set0count28cipher,
+};
+
+const uint8_t aes256_set0count29key[] = { 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count29plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count29cipher[] = { 0xFC, 0x4A, 0xF7, 0xC9, 0x48, 0xDF, 0x26, 0xE2, 0xEF, 0x3E, 0x01, 0xC1, 0xEE, 0x5B, 0x8F, 0x6F };
+const vector_data_t aes256_set0count29 = {
+    .set_num = 0,
+    .count = 29,
+    .key = aes256_set0count29key,
+    .plain = aes256_set0count29plain,
+    .cipher = aes256_set0count29cipher,
+};
+
+const uint8_t aes256_set0count30key[] = { 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count30plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count30cipher[] = { 0x82, 0x9F, 0xD7, 0x20, 0x8F, 0xB9, 0x2D, 0x44, 0xA0, 0x74, 0xA6, 0x77, 0xEE, 0x98, 0x61, 0xAC };
+const vector_data_t aes256_set0count30 = {
+    .set_num = 0,
+    .count = 30,
+    .key = aes256_set0count30key,
+    .plain = aes256_set0count30plain,
+    .cipher = aes256_set0count30cipher,
+};
+
+const uint8_t aes256_set0count31key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count31plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count31cipher[] = { 0xAD, 0x9F, 0xC6, 0x13, 0xA7, 0x03, 0x25, 0x1B, 0x54, 0xC6, 0x4A, 0x0E, 0x76, 0x43, 0x17, 0x11 };
+const vector_data_t aes256_set0count31 = {
+    .set_num = 0,
+    .count = 31,
+    .key = aes256_set0count31key,
+    .plain = aes256_set0count31plain,
+    .cipher = aes256_set0count31cipher,
+};
+
+const uint8_t aes256_set0count32key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count32plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count32cipher[] = { 0x33, 0xAC, 0x9E, 0xCC, 0xC4, 0xCC, 0x75, 0xE2, 0x71, 0x16, 0x18, 0xF8, 0x0B, 0x15, 0x48, 0xE8 };
+const vector_data_t aes256_set0count32 = {
+    .set_num = 0,
+    .count = 32,
+    .key = aes256_set0count32key,
+    .plain = aes256_set0count32plain,
+    .cipher = aes256_set0count32cipher,
+};
+
+const uint8_t aes256_set0count33key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count33plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count33cipher[] = { 0x20, 0x25, 0xC7, 0x4B, 0x8A, 0xD8, 0xF4, 0xCD, 0xA1, 0x7E, 0xE2, 0x04, 0x9C, 0x4C, 0x90, 0x2D };
+const vector_data_t aes256_set0count33 = {
+    .set_num = 0,
+    .count = 33,
+    .key = aes256_set0count33key,
+    .plain = aes256_set0count33plain,
+    .cipher = aes256_set0count33cipher,
+};
+
+const uint8_t aes256_set0count34key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count34plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count34cipher[] = { 0xF8, 0x5C, 0xA0, 0x5F, 0xE5, 0x28, 0xF1, 0xCE, 0x9B, 0x79, 0x01, 0x66, 0xE8, 0xD5, 0x51, 0xE7 };
+const vector_data_t aes256_set0count34 = {
+    .set_num = 0,
+    .count = 34,
+    .key = aes256_set0count34key,
+    .plain = aes256_set0count34plain,
+    .cipher = aes256_set0count34cipher,
+};
+
+const uint8_t aes256_set0count35key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count35plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count35cipher[] = { 0x6F, 0x62, 0x38, 0xD8, 0x96, 0x60, 0x48, 0xD4, 0x96, 0x71, 0x54, 0xE0, 0xDA, 0xD5, 0xA6, 0xC9 };
+const vector_data_t aes256_set0count35 = {
+    .set_num = 0,
+    .count = 35,
+    .key = aes256_set0count35key,
+    .plain = aes256_set0count35plain,
+    .cipher = aes256_set0count35cipher,
+};
+
+const uint8_t aes256_set0count36key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count36plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count36cipher[] = { 0xF2, 0xB2, 0x1B, 0x4E, 0x76, 0x40, 0xA9, 0xB3, 0x34, 0x6D, 0xE8, 0xB8, 0x2F, 0xB4, 0x1E, 0x49 };
+const vector_data_t aes256_set0count36 = {
+    .set_num = 0,
+    .count = 36,
+    .key = aes256_set0count36key,
+    .plain = aes256_set0count36plain,
+    .cipher = aes256_set0count36cipher,
+};
+
+const uint8_t aes256_set0count37key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count37plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count37cipher[] = { 0xF8, 0x36, 0xF2, 0x51, 0xAD, 0x1D, 0x11, 0xD4, 0x9D, 0xC3, 0x44, 0x62, 0x8B, 0x18, 0x84, 0xE1 };
+const vector_data_t aes256_set0count37 = {
+    .set_num = 0,
+    .count = 37,
+    .key = aes256_set0count37key,
+    .plain = aes256_set0count37plain,
+    .cipher = aes256_set0count37cipher,
+};
+
+const uint8_t aes256_set0count38key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count38plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count38cipher[] = { 0x07, 0x7E, 0x94, 0x70, 0xAE, 0x7A, 0xBE, 0xA5, 0xA9, 0x76, 0x9D, 0x49, 0x18, 0x26, 0x28, 0xC3 };
+const vector_data_t aes256_set0count38 = {
+    .set_num = 0,
+    .count = 38,
+    .key = aes256_set0count38key,
+    .plain = aes256_set0count38plain,
+    .cipher = aes256_set0count38cipher,
+};
+
+const uint8_t aes256_set0count39key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count39plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count39cipher[] = { 0xE0, 0xDC, 0xC2, 0xD2, 0x7F, 0xC9, 0x86, 0x56, 0x33, 0xF8, 0x52, 0x23, 0xCF, 0x0D, 0x61, 0x1F };
+const vector_data_t aes256_set0count39 = {
+    .set_num = 0,
+    .count = 39,
+    .key = aes256_set0count39key,
+    .plain = aes256_set0count39plain,
+    .cipher = aes256_set0count39cipher,
+};
+
+const uint8_t aes256_set0count40key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count40plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count40cipher[] = { 0xBE, 0x66, 0xCF, 0xEA, 0x2F, 0xEC, 0xD6, 0xBF, 0x0E, 0xC7, 0xB4, 0x35, 0x2C, 0x99, 0xBC, 0xAA };
+const vector_data_t aes256_set0count40 = {
+    .set_num = 0,
+    .count = 40,
+    .key = aes256_set0count40key,
+    .plain = aes256_set0count40plain,
+    .cipher = aes256_set0count40cipher,
+};
+
+const uint8_t aes256_set0count41key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count41plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count41cipher[] = { 0xDF, 0x31, 0x14, 0x4F, 0x87, 0xA2, 0xEF, 0x52, 0x3F, 0xAC, 0xDC, 0xF2, 0x1A, 0x42, 0x78, 0x04 };
+const vector_data_t aes256_set0count41 = {
+    .set_num = 0,
+    .count = 41,
+    .key = aes256_set0count41key,
+    .plain = aes256_set0count41plain,
+    .cipher = aes256_set0count41cipher,
+};
+
+const uint8_t aes256_set0count42key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count42plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count42cipher[] = { 0xB5, 0xBB, 0x0F, 0x56, 0x29, 0xFB, 0x6A, 0xAE, 0x5E, 0x18, 0x39, 0xA3, 0xC3, 0x62, 0x5D, 0x63 };
+const vector_data_t aes256_set0count42 = {
+    .set_num = 0,
+    .count = 42,
+    .key = aes256_set0count42key,
+    .plain = aes256_set0count42plain,
+    .cipher = aes256_set0count42cipher,
+};
+
+const uint8_t aes256_set0count43key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count43plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count43cipher[] = { 0x3C, 0x9D, 0xB3, 0x33, 0x53, 0x06, 0xFE, 0x1E, 0xC6, 0x12, 0xBD, 0xBF, 0xAE, 0x6B, 0x60, 0x28 };
+const vector_data_t aes256_set0count43 = {
+    .set_num = 0,
+    .count = 43,
+    .key = aes256_set0count43key,
+    .plain = aes256_set0count43plain,
+    .cipher = aes256_set0count43cipher,
+};
+
+const uint8_t aes256_set0count44key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count44plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count44cipher[] = { 0x3D, 0xD5, 0xC3, 0x46, 0x34, 0xA7, 0x9D, 0x3C, 0xFC, 0xC8, 0x33, 0x97, 0x60, 0xE6, 0xF5, 0xF4 };
+const vector_data_t aes256_set0count44 = {
+    .set_num = 0,
+    .count = 44,
+    .key = aes256_set0count44key,
+    .plain = aes256_set0count44plain,
+    .cipher = aes256_set0count44cipher,
+};
+
+const uint8_t aes256_set0count45key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count45plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count45cipher[] = { 0x82, 0xBD, 0xA1, 0x18, 0xA3, 0xED, 0x7A, 0xF3, 0x14, 0xFA, 0x2C, 0xCC, 0x5C, 0x07, 0xB7, 0x61 };
+const vector_data_t aes256_set0count45 = {
+    .set_num = 0,
+    .count = 45,
+    .key = aes256_set0count45key,
+    .plain = aes256_set0count45plain,
+    .cipher = aes256_set0count45cipher,
+};
+
+const uint8_t aes256_set0count46key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count46plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count46cipher[] = { 0x29, 0x37, 0xA6, 0x4F, 0x7D, 0x4F, 0x46, 0xFE, 0x6F, 0xEA, 0x3B, 0x34, 0x9E, 0xC7, 0x8E, 0x38 };
+const vector_data_t aes256_set0count46 = {
+    .set_num = 0,
+    .count = 46,
+    .key = aes256_set0count46key,
+    .plain = aes256_set0count46plain,
+    .cipher = aes256_set0count46cipher,
+};
+
+const uint8_t aes256_set0count47key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count47plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count47cipher[] = { 0x22, 0x5F, 0x06, 0x8C, 0x28, 0x47, 0x66, 0x05, 0x73, 0x5A, 0xD6, 0x71, 0xBB, 0x8F, 0x39, 0xF3 };
+const vector_data_t aes256_set0count47 = {
+    .set_num = 0,
+    .count = 47,
+    .key = aes256_set0count47key,
+    .plain = aes256_set0count47plain,
+    .cipher = aes256_set0count47cipher,
+};
+
+const uint8_t aes256_set0count48key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count48plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count48cipher[] = { 0xAE, 0x68, 0x2C, 0x5E, 0xCD, 0x71, 0x89, 0x8E, 0x08, 0x94, 0x2A, 0xC9, 0xAA, 0x89, 0x87, 0x5C };
+const vector_data_t aes256_set0count48 = {
+    .set_num = 0,
+    .count = 48,
+    .key = aes256_set0count48key,
+    .plain = aes256_set0count48plain,
+    .cipher = aes256_set0count48cipher,
+};
+
+const uint8_t aes256_set0count49key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count49plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count49cipher[] = { 0x5E, 0x03, 0x1C, 0xB9, 0xD6, 0x76, 0xC3, 0x02, 0x2D, 0x7F, 0x26, 0x22, 0x7E, 0x85, 0xC3, 0x8F };
+const vector_data_t aes256_set0count49 = {
+    .set_num = 0,
+    .count = 49,
+    .key = aes256_set0count49key,
+    .plain = aes256_set0count49plain,
+    .cipher = aes256_set0count49cipher,
+};
+
+const uint8_t aes256_set0count50key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count50plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count50cipher[] = { 0xA7, 0x84, 0x63, 0xFB, 0x06, 0x4D, 0xB5, 0xD5, 0x2B, 0xB6, 0x4B, 0xFE, 0xF6, 0x4F, 0x2D, 0xDA };
+const vector_data_t aes256_set0count50 = {
+    .set_num = 0,
+    .count = 50,
+    .key = aes256_set0count50key,
+    .plain = aes256_set0count50plain,
+    .cipher = aes256_set0count50cipher,
+};
+
+const uint8_t aes256_set0count51key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count51plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count51cipher[] = { 0x8A, 0xA9, 0xB7, 0x5E, 0x78, 0x45, 0x93, 0x87, 0x6C, 0x53, 0xA0, 0x0E, 0xAE, 0x5A, 0xF5, 0x2B };
+const vector_data_t aes256_set0count51 = {
+    .set_num = 0,
+    .count = 51,
+    .key = aes256_set0count51key,
+    .plain = aes256_set0count51plain,
+    .cipher = aes256_set0count51cipher,
+};
+
+const uint8_t aes256_set0count52key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count52plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count52cipher[] = { 0x3F, 0x84, 0x56, 0x6D, 0xF2, 0x3D, 0xA4, 0x8A, 0xF6, 0x92, 0x72, 0x2F, 0xE9, 0x80, 0x57, 0x3A };
+const vector_data_t aes256_set0count52 = {
+    .set_num = 0,
+    .count = 52,
+    .key = aes256_set0count52key,
+    .plain = aes256_set0count52plain,
+    .cipher = aes256_set0count52cipher,
+};
+
+const uint8_t aes256_set0count53key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count53plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count53cipher[] = { 0x31, 0x69, 0x0B, 0x5E, 0xD4, 0x1C, 0x7E, 0xB4, 0x2A, 0x1E, 0x83, 0x27, 0x0A, 0x7F, 0xF0, 0xE6 };
+const vector_data_t aes256_set0count53 = {
+    .set_num = 0,
+    .count = 53,
+    .key = aes256_set0count53key,
+    .plain = aes256_set0count53plain,
+    .cipher = aes256_set0count53cipher,
+};
+
+const uint8_t aes256_set0count54key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count54plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count54cipher[] = { 0x77, 0xDD, 0x77, 0x02, 0x64, 0x6D, 0x55, 0xF0, 0x83, 0x65, 0xE4, 0x77, 0xD3, 0x59, 0x0E, 0xDA };
+const vector_data_t aes256_set0count54 = {
+    .set_num = 0,
+    .count = 54,
+    .key = aes256_set0count54key,
+    .plain = aes256_set0count54plain,
+    .cipher = aes256_set0count54cipher,
+};
+
+const uint8_t aes256_set0count55key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count55plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count55cipher[] = { 0x4C, 0x02, 0x2A, 0xC6, 0x2B, 0x3C, 0xB7, 0x8D, 0x73, 0x9C, 0xC6, 0x7B, 0x3E, 0x20, 0xBB, 0x7E };
+const vector_data_t aes256_set0count55 = {
+    .set_num = 0,
+    .count = 55,
+    .key = aes256_set0count55key,
+    .plain = aes256_set0count55plain,
+    .cipher = aes256_set0count55cipher,
+};
+
+const uint8_t aes256_set0count56key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count56plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count56cipher[] = { 0x09, 0x2F, 0xA1, 0x37, 0xCE, 0x18, 0xB5, 0xDF, 0xE7, 0x90, 0x6F, 0x55, 0x0B, 0xB1, 0x33, 0x70 };
+const vector_data_t aes256_set0count56 = {
+    .set_num = 0,
+    .count = 56,
+    .key = aes256_set0count56key,
+    .plain = aes256_set0count56plain,
+    .cipher = aes256_set0count56cipher,
+};
+
+const uint8_t aes256_set0count57key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count57plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count57cipher[] = { 0x3E, 0x0C, 0xDA, 0xDF, 0x2E, 0x68, 0x35, 0x3C, 0x00, 0x27, 0x67, 0x2C, 0x97, 0x14, 0x4D, 0xD3 };
+const vector_data_t aes256_set0count57 = {
+    .set_num = 0,
+    .count = 57,
+    .key = aes256_set0count57key,
+    .plain = aes256_set0count57plain,
+    .cipher = aes256_set0count57cipher,
+};
+
+const uint8_t aes256_set0count58key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count58plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count58cipher[] = { 0xD8, 0xC4, 0xB2, 0x00, 0xB3, 0x83, 0xFC, 0x1F, 0x2B, 0x2E, 0xA6, 0x77, 0x61, 0x8A, 0x1D, 0x27 };
+const vector_data_t aes256_set0count58 = {
+    .set_num = 0,
+    .count = 58,
+    .key = aes256_set0count58key,
+    .plain = aes256_set0count58plain,
+    .cipher = aes256_set0count58cipher,
+};
+
+const uint8_t aes256_set0count59key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count59plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count59cipher[] = { 0x11, 0x82, 0x5F, 0x99, 0xB0, 0xE9, 0xBB, 0x34, 0x77, 0xC1, 0xC0, 0x71, 0x3B, 0x01, 0x5A, 0xAC };
+const vector_data_t aes256_set0count59 = {
+    .set_num = 0,
+    .count = 59,
+    .key = aes256_set0count59key,
+    .plain = aes256_set0count59plain,
+    .cipher = aes256_set0count59cipher,
+};
+
+const uint8_t aes256_set0count60key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count60plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count60cipher[] = { 0xF8, 0xB9, 0xFF, 0xFB, 0x5C, 0x18, 0x7F, 0x7D, 0xDC, 0x7A, 0xB1, 0x0F, 0x4F, 0xB7, 0x75, 0x76 };
+const vector_data_t aes256_set0count60 = {
+    .set_num = 0,
+    .count = 60,
+    .key = aes256_set0count60key,
+    .plain = aes256_set0count60plain,
+    .cipher = aes256_set0count60cipher,
+};
+
+const uint8_t aes256_set0count61key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count61plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count61cipher[] = { 0xFF, 0xB4, 0xE8, 0x7A, 0x32, 0xB3, 0x7D, 0x6F, 0x2C, 0x83, 0x28, 0xD3, 0xB5, 0x37, 0x78, 0x02 };
+const vector_data_t aes256_set0count61 = {
+    .set_num = 0,
+    .count = 61,
+    .key = aes256_set0count61key,
+    .plain = aes256_set0count61plain,
+    .cipher = aes256_set0count61cipher,
+};
+
+const uint8_t aes256_set0count62key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count62plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count62cipher[] = { 0xD2, 0x76, 0xC1, 0x3A, 0x5D, 0x22, 0x0F, 0x4D, 0xA9, 0x22, 0x4E, 0x74, 0x89, 0x63, 0x91, 0xCE };
+const vector_data_t aes256_set0count62 = {
+    .set_num = 0,
+    .count = 62,
+    .key = aes256_set0count62key,
+    .plain = aes256_set0count62plain,
+    .cipher = aes256_set0count62cipher,
+};
+
+const uint8_t aes256_set0count63key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count63plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count63cipher[] = { 0x94, 0xEF, 0xE7, 0xA0, 0xE2, 0xE0, 0x31, 0xE2, 0x53, 0x6D, 0xA0, 0x1D, 0xF7, 0x99, 0xC9, 0x27 };
+const vector_data_t aes256_set0count63 = {
+    .set_num = 0,
+    .count = 63,
+    .key = aes256_set0count63key,
+    .plain = aes256_set0count63plain,
+    .cipher = aes256_set0count63cipher,
+};
+
+const uint8_t aes256_set0count64key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count64plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count64cipher[] = { 0x8F, 0x8F, 0xD8, 0x22, 0x68, 0x0A, 0x85, 0x97, 0x4E, 0x53, 0xA5, 0xA8, 0xEB, 0x9D, 0x38, 0xDE };
+const vector_data_t aes256_set0count64 = {
+    .set_num = 0,
+    .count = 64,
+    .key = aes256_set0count64key,
+    .plain = aes256_set0count64plain,
+    .cipher = aes256_set0count64cipher,
+};
+
+const uint8_t aes256_set0count65key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count65plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count65cipher[] = { 0xE0, 0xF0, 0xA9, 0x1B, 0x2E, 0x45, 0xF8, 0xCC, 0x37, 0xB7, 0x80, 0x5A, 0x30, 0x42, 0x58, 0x8D };
+const vector_data_t aes256_set0count65 = {
+    .set_num = 0,
+    .count = 65,
+    .key = aes256_set0count65key,
+    .plain = aes256_set0count65plain,
+    .cipher = aes256_set0count65cipher,
+};
+
+const uint8_t aes256_set0count66key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count66plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count66cipher[] = { 0x59, 0x7A, 0x62, 0x52, 0x25, 0x5E, 0x46, 0xD6, 0x36, 0x4D, 0xBE, 0xED, 0xA3, 0x1E, 0x27, 0x9C };
+const vector_data_t aes256_set0count66 = {
+    .set_num = 0,
+    .count = 66,
+    .key = aes256_set0count66key,
+    .plain = aes256_set0count66plain,
+    .cipher = aes256_set0count66cipher,
+};
+
+const uint8_t aes256_set0count67key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count67plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count67cipher[] = { 0xF5, 0x1A, 0x0F, 0x69, 0x44, 0x42, 0xB8, 0xF0, 0x55, 0x71, 0x79, 0x7F, 0xEC, 0x7E, 0xE8, 0xBF };
+const vector_data_t aes256_set0count67 = {
+    .set_num = 0,
+    .count = 67,
+    .key = aes256_set0count67key,
+    .plain = aes256_set0count67plain,
+    .cipher = aes256_set0count67cipher,
+};
+
+const uint8_t aes256_set0count68key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count68plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count68cipher[] = { 0x9F, 0xF0, 0x71, 0xB1, 0x65, 0xB5, 0x19, 0x8A, 0x93, 0xDD, 0xDE, 0xEB, 0xC5, 0x4D, 0x09, 0xB5 };
+const vector_data_t aes256_set0count68 = {
+    .set_num = 0,
+    .count = 68,
+    .key = aes256_set0count68key,
+    .plain = aes256_set0count68plain,
+    .cipher = aes256_set0count68cipher,
+};
+
+const uint8_t aes256_set0count69key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count69plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count69cipher[] = { 0xC2, 0x0A, 0x19, 0xFD, 0x57, 0x58, 0xB0, 0xC4, 0xBC, 0x1A, 0x5D, 0xF8, 0x9C, 0xF7, 0x38, 0x77 };
+const vector_data_t aes256_set0count69 = {
+    .set_num = 0,
+    .count = 69,
+    .key = aes256_set0count69key,
+    .plain = aes256_set0count69plain,
+    .cipher = aes256_set0count69cipher,
+};
+
+const uint8_t aes256_set0count70key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count70plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count70cipher[] = { 0x97, 0x12, 0x01, 0x66, 0x30, 0x71, 0x19, 0xCA, 0x22, 0x80, 0xE9, 0x31, 0x56, 0x68, 0xE9, 0x6F };
+const vector_data_t aes256_set0count70 = {
+    .set_num = 0,
+    .count = 70,
+    .key = aes256_set0count70key,
+    .plain = aes256_set0count70plain,
+    .cipher = aes256_set0count70cipher,
+};
+
+const uint8_t aes256_set0count71key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count71plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count71cipher[] = { 0x4B, 0x3B, 0x9F, 0x1E, 0x09, 0x9C, 0x2A, 0x09, 0xDC, 0x09, 0x1E, 0x90, 0xE4, 0xF1, 0x8F, 0x0A };
+const vector_data_t aes256_set0count71 = {
+    .set_num = 0,
+    .count = 71,
+    .key = aes256_set0count71key,
+    .plain = aes256_set0count71plain,
+    .cipher = aes256_set0count71cipher,
+};
+
+const uint8_t aes256_set0count72key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count72plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count72cipher[] = { 0xEB, 0x04, 0x0B, 0x89, 0x1D, 0x4B, 0x37, 0xF6, 0x85, 0x1F, 0x7E, 0xC2, 0x19, 0xCD, 0x3F, 0x6D };
+const vector_data_t aes256_set0count72 = {
+    .set_num = 0,
+    .count = 72,
+    .key = aes256_set0count72key,
+    .plain = aes256_set0count72plain,
+    .cipher = aes256_set0count72cipher,
+};
+
+const uint8_t aes256_set0count73key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count73plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count73cipher[] = { 0x9F, 0x0F, 0xDE, 0xC0, 0x8B, 0x7F, 0xD7, 0x9A, 0xA3, 0x95, 0x35, 0xBE, 0xA4, 0x2D, 0xB9, 0x2A };
+const vector_data_t aes256_set0count73 = {
+    .set_num = 0,
+    .count = 73,
+    .key = aes256_set0count73key,
+    .plain = aes256_set0count73plain,
+    .cipher = aes256_set0count73cipher,
+};
+
+const uint8_t aes256_set0count74key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count74plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count74cipher[] = { 0x2E, 0x70, 0xF1, 0x68, 0xFC, 0x74, 0xBF, 0x91, 0x1D, 0xF2, 0x40, 0xBC, 0xD2, 0xCE, 0xF2, 0x36 };
+const vector_data_t aes256_set0count74 = {
+    .set_num = 0,
+    .count = 74,
+    .key = aes256_set0count74key,
+    .plain = aes256_set0count74plain,
+    .cipher = aes256_set0count74cipher,
+};
+
+const uint8_t aes256_set0count75key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count75plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count75cipher[] = { 0x46, 0x2C, 0xCD, 0x7F, 0x5F, 0xD1, 0x10, 0x8D, 0xBC, 0x15, 0x2F, 0x3C, 0xAC, 0xAD, 0x32, 0x8B };
+const vector_data_t aes256_set0count75 = {
+    .set_num = 0,
+    .count = 75,
+    .key = aes256_set0count75key,
+    .plain = aes256_set0count75plain,
+    .cipher = aes256_set0count75cipher,
+};
+
+const uint8_t aes256_set0count76key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count76plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count76cipher[] = { 0xA4, 0xAF, 0x53, 0x4A, 0x7D, 0x0B, 0x64, 0x3A, 0x01, 0x86, 0x87, 0x85, 0xD8, 0x6D, 0xFB, 0x95 };
+const vector_data_t aes256_set0count76 = {
+    .set_num = 0,
+    .count = 76,
+    .key = aes256_set0count76key,
+    .plain = aes256_set0count76plain,
+    .cipher = aes256_set0count76cipher,
+};
+
+const uint8_t aes256_set0count77key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count77plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count77cipher[] = { 0xAB, 0x98, 0x02, 0x96, 0x19, 0x7E, 0x1A, 0x50, 0x22, 0x32, 0x6C, 0x31, 0xDA, 0x4B, 0xF6, 0xF3 };
+const vector_data_t aes256_set0count77 = {
+    .set_num = 0,
+    .count = 77,
+    .key = aes256_set0count77key,
+    .plain = aes256_set0count77plain,
+    .cipher = aes256_set0count77cipher,
+};
+
+const uint8_t aes256_set0count78key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count78plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count78cipher[] = { 0xF9, 0x7D, 0x57, 0xB3, 0x33, 0x3B, 0x62, 0x81, 0xB0, 0x7D, 0x48, 0x6D, 0xB2, 0xD4, 0xE2, 0x0C };
+const vector_data_t aes256_set0count78 = {
+    .set_num = 0,
+    .count = 78,
+    .key = aes256_set0count78key,
+    .plain = aes256_set0count78plain,
+    .cipher = aes256_set0count78cipher,
+};
+
+const uint8_t aes256_set0count79key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count79plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count79cipher[] = { 0xF3, 0x3F, 0xA3, 0x67, 0x20, 0x23, 0x1A, 0xFE, 0x4C, 0x75, 0x9A, 0xDE, 0x6B, 0xD6, 0x2E, 0xB6 };
+const vector_data_t aes256_set0count79 = {
+    .set_num = 0,
+    .count = 79,
+    .key = aes256_set0count79key,
+    .plain = aes256_set0count79plain,
+    .cipher = aes256_set0count79cipher,
+};
+
+const uint8_t aes256_set0count80key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count80plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count80cipher[] = { 0xFD, 0xCF, 0xAC, 0x0C, 0x02, 0xCA, 0x53, 0x83, 0x43, 0xC6, 0x81, 0x17, 0xE0, 0xA1, 0x59, 0x38 };
+const vector_data_t aes256_set0count80 = {
+    .set_num = 0,
+    .count = 80,
+    .key = aes256_set0count80key,
+    .plain = aes256_set0count80plain,
+    .cipher = aes256_set0count80cipher,
+};
+
+const uint8_t aes256_set0count81key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count81plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count81cipher[] = { 0xAD, 0x49, 0x16, 0xF5, 0xEE, 0x57, 0x72, 0xBE, 0x76, 0x4F, 0xC0, 0x27, 0xB8, 0xA6, 0xE5, 0x39 };
+const vector_data_t aes256_set0count81 = {
+    .set_num = 0,
+    .count = 81,
+    .key = aes256_set0count81key,
+    .plain = aes256_set0count81plain,
+    .cipher = aes256_set0count81cipher,
+};
+
+const uint8_t aes256_set0count82key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count82plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count82cipher[] = { 0x2E, 0x16, 0x87, 0x3E, 0x16, 0x78, 0x61, 0x0D, 0x7E, 0x14, 0xC0, 0x2D, 0x00, 0x2E, 0xA8, 0x45 };
+const vector_data_t aes256_set0count82 = {
+    .set_num = 0,
+    .count = 82,
+    .key = aes256_set0count82key,
+    .plain = aes256_set0count82plain,
+    .cipher = aes256_set0count82cipher,
+};
+
+const uint8_t aes256_set0count83key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count83plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count83cipher[] = { 0x4E, 0x6E, 0x62, 0x7C, 0x1A, 0xCC, 0x51, 0x34, 0x00, 0x53, 0xA8, 0x23, 0x6D, 0x57, 0x95, 0x76 };
+const vector_data_t aes256_set0count83 = {
+    .set_num = 0,
+    .count = 83,
+    .key = aes256_set0count83key,
+    .plain = aes256_set0count83plain,
+    .cipher = aes256_set0count83cipher,
+};
+
+const uint8_t aes256_set0count84key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count84plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count84cipher[] = { 0xAB, 0x0C, 0x84, 0x10, 0xAE, 0xEE, 0xAD, 0x92, 0xFE, 0xEC, 0x1E, 0xB4, 0x30, 0xD6, 0x52, 0xCB };
+const vector_data_t aes256_set0count84 = {
+    .set_num = 0,
+    .count = 84,
+    .key = aes256_set0count84key,
+    .plain = aes256_set0count84plain,
+    .cipher = aes256_set0count84cipher,
+};
+
+const uint8_t aes256_set0count85key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count85plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count85cipher[] = { 0xE8, 0x6F, 0x7E, 0x23, 0xE8, 0x35, 0xE1, 0x14, 0x97, 0x7F, 0x60, 0xE1, 0xA5, 0x92, 0x20, 0x2E };
+const vector_data_t aes256_set0count85 = {
+    .set_num = 0,
+    .count = 85,
+    .key = aes256_set0count85key,
+    .plain = aes256_set0count85plain,
+    .cipher = aes256_set0count85cipher,
+};
+
+const uint8_t aes256_set0count86key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count86plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count86cipher[] = { 0xE6, 0x8A, 0xD5, 0x05, 0x5A, 0x36, 0x70, 0x41, 0xFA, 0xDE, 0x09, 0xD9, 0xA7, 0x0A, 0x79, 0x4B };
+const vector_data_t aes256_set0count86 = {
+    .set_num = 0,
+    .count = 86,
+    .key = aes256_set0count86key,
+    .plain = aes256_set0count86plain,
+    .cipher = aes256_set0count86cipher,
+};
+
+const uint8_t aes256_set0count87key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count87plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count87cipher[] = { 0x07, 0x91, 0x82, 0x3A, 0x3C, 0x66, 0x6B, 0xB6, 0x16, 0x28, 0x25, 0xE7, 0x86, 0x06, 0xA7, 0xFE };
+const vector_data_t aes256_set0count87 = {
+    .set_num = 0,
+    .count = 87,
+    .key = aes256_set0count87key,
+    .plain = aes256_set0count87plain,
+    .cipher = aes256_set0count87cipher,
+};
+
+const uint8_t aes256_set0count88key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count88plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count88cipher[] = { 0xDC, 0xCA, 0x36, 0x6A, 0x9B, 0xF4, 0x7B, 0x7B, 0x86, 0x8B, 0x77, 0xE2, 0x5C, 0x18, 0xA3, 0x64 };
+const vector_data_t aes256_set0count88 = {
+    .set_num = 0,
+    .count = 88,
+    .key = aes256_set0count88key,
+    .plain = aes256_set0count88plain,
+    .cipher = aes256_set0count88cipher,
+};
+
+const uint8_t aes256_set0count89key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count89plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count89cipher[] = { 0x68, 0x4C, 0x9E, 0xFC, 0x23, 0x7E, 0x4A, 0x44, 0x29, 0x65, 0xF8, 0x4B, 0xCE, 0x20, 0x24, 0x7A };
+const vector_data_t aes256_set0count89 = {
+    .set_num = 0,
+    .count = 89,
+    .key = aes256_set0count89key,
+    .plain = aes256_set0count89plain,
+    .cipher = aes256_set0count89cipher,
+};
+
+const uint8_t aes256_set0count90key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count90plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count90cipher[] = { 0xA8, 0x58, 0x41, 0x1F, 0xFB, 0xE6, 0x3F, 0xDB, 0x9C, 0x8A, 0xA1, 0xBF, 0xAE, 0xD6, 0x7B, 0x52 };
+const vector_data_t aes256_set0count90 = {
+    .set_num = 0,
+    .count = 90,
+    .key = aes256_set0count90key,
+    .plain = aes256_set0count90plain,
+    .cipher = aes256_set0count90cipher,
+};
+
+const uint8_t aes256_set0count91key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count91plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count91cipher[] = { 0x04, 0xBC, 0x3D, 0xA2, 0x17, 0x9C, 0x30, 0x15, 0x49, 0x8B, 0x0E, 0x03, 0x91, 0x0D, 0xB5, 0xB8 };
+const vector_data_t aes256_set0count91 = {
+    .set_num = 0,
+    .count = 91,
+    .key = aes256_set0count91key,
+    .plain = aes256_set0count91plain,
+    .cipher = aes256_set0count91cipher,
+};
+
+const uint8_t aes256_set0count92key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count92plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count92cipher[] = { 0x40, 0x07, 0x1E, 0xEA, 0xB3, 0xF9, 0x35, 0xDB, 0xC2, 0x5D, 0x00, 0x84, 0x14, 0x60, 0x26, 0x0F };
+const vector_data_t aes256_set0count92 = {
+    .set_num = 0,
+    .count = 92,
+    .key = aes256_set0count92key,
+    .plain = aes256_set0count92plain,
+    .cipher = aes256_set0count92cipher,
+};
+
+const uint8_t aes256_set0count93key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count93plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count93cipher[] = { 0x0E, 0xBD, 0x7C, 0x30, 0xED, 0x20, 0x16, 0xE0, 0x8B, 0xA8, 0x06, 0xDD, 0xB0, 0x08, 0xBC, 0xC8 };
+const vector_data_t aes256_set0count93 = {
+    .set_num = 0,
+    .count = 93,
+    .key = aes256_set0count93key,
+    .plain = aes256_set0count93plain,
+    .cipher = aes256_set0count93cipher,
+};
+
+const uint8_t aes256_set0count94key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count94plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count94cipher[] = { 0x15, 0xC6, 0xBE, 0xCF, 0x0F, 0x4C, 0xEC, 0x71, 0x29, 0xCB, 0xD2, 0x2D, 0x1A, 0x79, 0xB1, 0xB8 };
+const vector_data_t aes256_set0count94 = {
+    .set_num = 0,
+    .count = 94,
+    .key = aes256_set0count94key,
+    .plain = aes256_set0count94plain,
+    .cipher = aes256_set0count94cipher,
+};
+
+const uint8_t aes256_set0count95key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count95plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count95cipher[] = { 0x0A, 0xEE, 0xDE, 0x5B, 0x91, 0xF7, 0x21, 0x70, 0x0E, 0x9E, 0x62, 0xED, 0xBF, 0x60, 0xB7, 0x81 };
+const vector_data_t aes256_set0count95 = {
+    .set_num = 0,
+    .count = 95,
+    .key = aes256_set0count95key,
+    .plain = aes256_set0count95plain,
+    .cipher = aes256_set0count95cipher,
+};
+
+const uint8_t aes256_set0count96key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count96plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count96cipher[] = { 0x26, 0x65, 0x81, 0xAF, 0x0D, 0xCF, 0xBE, 0xD1, 0x58, 0x5E, 0x0A, 0x24, 0x2C, 0x64, 0xB8, 0xDF };
+const vector_data_t aes256_set0count96 = {
+    .set_num = 0,
+    .count = 96,
+    .key = aes256_set0count96key,
+    .plain = aes256_set0count96plain,
+    .cipher = aes256_set0count96cipher,
+};
+
+const uint8_t aes256_set0count97key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count97plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count97cipher[] = { 0x66, 0x93, 0xDC, 0x91, 0x16, 0x62, 0xAE, 0x47, 0x32, 0x16, 0xBA, 0x22, 0x18, 0x9A, 0x51, 0x1A };
+const vector_data_t aes256_set0count97 = {
+    .set_num = 0,
+    .count = 97,
+    .key = aes256_set0count97key,
+    .plain = aes256_set0count97plain,
+    .cipher = aes256_set0count97cipher,
+};
+
+const uint8_t aes256_set0count98key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count98plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count98cipher[] = { 0x76, 0x06, 0xFA, 0x36, 0xD8, 0x64, 0x73, 0xE6, 0xFB, 0x3A, 0x1B, 0xB0, 0xE2, 0xC0, 0xAD, 0xF5 };
+const vector_data_t aes256_set0count98 = {
+    .set_num = 0,
+    .count = 98,
+    .key = aes256_set0count98key,
+    .plain = aes256_set0count98plain,
+    .cipher = aes256_set0count98cipher,
+};
+
+const uint8_t aes256_set0count99key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count99plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count99cipher[] = { 0x11, 0x20, 0x78, 0xE9, 0xE1, 0x1F, 0xBB, 0x78, 0xE2, 0x6F, 0xFB, 0x88, 0x99, 0xE9, 0x6B, 0x9A };
+const vector_data_t aes256_set0count99 = {
+    .set_num = 0,
+    .count = 99,
+    .key = aes256_set0count99key,
+    .plain = aes256_set0count99plain,
+    .cipher = aes256_set0count99cipher,
+};
+
+const uint8_t aes256_set0count100key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count100plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count100cipher[] = { 0x40, 0xB2, 0x64, 0xE9, 0x21, 0xE9, 0xE4, 0xA8, 0x26, 0x94, 0x58, 0x9E, 0xF3, 0x79, 0x82, 0x62 };
+const vector_data_t aes256_set0count100 = {
+    .set_num = 0,
+    .count = 100,
+    .key = aes256_set0count100key,
+    .plain = aes256_set0count100plain,
+    .cipher = aes256_set0count100cipher,
+};
+
+const uint8_t aes256_set0count101key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count101plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count101cipher[] = { 0x8D, 0x45, 0x95, 0xCB, 0x4F, 0xA7, 0x02, 0x67, 0x15, 0xF5, 0x5B, 0xD6, 0x8E, 0x28, 0x82, 0xF9 };
+const vector_data_t aes256_set0count101 = {
+    .set_num = 0,
+    .count = 101,
+    .key = aes256_set0count101key,
+    .plain = aes256_set0count101plain,
+    .cipher = aes256_set0count101cipher,
+};
+
+const uint8_t aes256_set0count102key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count102plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count102cipher[] = { 0xB5, 0x88, 0xA3, 0x02, 0xBD, 0xBC, 0x09, 0x19, 0x7D, 0xF1, 0xED, 0xAE, 0x68, 0x92, 0x6E, 0xD9 };
+const vector_data_t aes256_set0count102 = {
+    .set_num = 0,
+    .count = 102,
+    .key = aes256_set0count102key,
+    .plain = aes256_set0count102plain,
+    .cipher = aes256_set0count102cipher,
+};
+
+const uint8_t aes256_set0count103key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count103plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count103cipher[] = { 0x33, 0xF7, 0x50, 0x23, 0x90, 0xB8, 0xA4, 0xA2, 0x21, 0xCF, 0xEC, 0xD0, 0x66, 0x66, 0x24, 0xBA };
+const vector_data_t aes256_set0count103 = {
+    .set_num = 0,
+    .count = 103,
+    .key = aes256_set0count103key,
+    .plain = aes256_set0count103plain,
+    .cipher = aes256_set0count103cipher,
+};
+
+const uint8_t aes256_set0count104key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count104plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count104cipher[] = { 0x3D, 0x20, 0x25, 0x3A, 0xDB, 0xCE, 0x3B, 0xE2, 0x37, 0x37, 0x67, 0xC4, 0xD8, 0x22, 0xC5, 0x66 };
+const vector_data_t aes256_set0count104 = {
+    .set_num = 0,
+    .count = 104,
+    .key = aes256_set0count104key,
+    .plain = aes256_set0count104plain,
+    .cipher = aes256_set0count104cipher,
+};
+
+const uint8_t aes256_set0count105key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count105plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count105cipher[] = { 0xA4, 0x27, 0x34, 0xA3, 0x92, 0x9B, 0xF8, 0x4C, 0xF0, 0x11, 0x6C, 0x98, 0x56, 0xA3, 0xC1, 0x8C };
+const vector_data_t aes256_set0count105 = {
+    .set_num = 0,
+    .count = 105,
+    .key = aes256_set0count105key,
+    .plain = aes256_set0count105plain,
+    .cipher = aes256_set0count105cipher,
+};
+
+const uint8_t aes256_set0count106key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count106plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count106cipher[] = { 0xE3, 0xAB, 0xC4, 0x93, 0x94, 0x57, 0x42, 0x2B, 0xB9, 0x57, 0xDA, 0x3C, 0x56, 0x93, 0x8C, 0x6D };
+const vector_data_t aes256_set0count106 = {
+    .set_num = 0,
+    .count = 106,
+    .key = aes256_set0count106key,
+    .plain = aes256_set0count106plain,
+    .cipher = aes256_set0count106cipher,
+};
+
+const uint8_t aes256_set0count107key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count107plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count107cipher[] = { 0x97, 0x2B, 0xDD, 0x2E, 0x7C, 0x52, 0x51, 0x30, 0xFA, 0xDC, 0x8F, 0x76, 0xFC, 0x6F, 0x4B, 0x3F };
+const vector_data_t aes256_set0count107 = {
+    .set_num = 0,
+    .count = 107,
+    .key = aes256_set0count107key,
+    .plain = aes256_set0count107plain,
+    .cipher = aes256_set0count107cipher,
+};
+
+const uint8_t aes256_set0count108key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count108plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count108cipher[] = { 0x84, 0xA8, 0x3D, 0x7B, 0x94, 0xC6, 0x99, 0xCB, 0xCB, 0x8A, 0x7D, 0x9B, 0x61, 0xF6, 0x40, 0x93 };
+const vector_data_t aes256_set0count108 = {
+    .set_num = 0,
+    .count = 108,
+    .key = aes256_set0count108key,
+    .plain = aes256_set0count108plain,
+    .cipher = aes256_set0count108cipher,
+};
+
+const uint8_t aes256_set0count109key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count109plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count109cipher[] = { 0xCE, 0x61, 0xD6, 0x35, 0x14, 0xAD, 0xED, 0x03, 0xD4, 0x3E, 0x6E, 0xBF, 0xC3, 0xA9, 0x00, 0x1F };
+const vector_data_t aes256_set0count109 = {
+    .set_num = 0,
+    .count = 109,
+    .key = aes256_set0count109key,
+    .plain = aes256_set0count109plain,
+    .cipher = aes256_set0count109cipher,
+};
+
+const uint8_t aes256_set0count110key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count110plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count110cipher[] = { 0x6C, 0x83, 0x9D, 0xD5, 0x8E, 0xEA, 0xE6, 0xB8, 0xA3, 0x6A, 0xF4, 0x8E, 0xD6, 0x3D, 0x2D, 0xC9 };
+const vector_data_t aes256_set0count110 = {
+    .set_num = 0,
+    .count = 110,
+    .key = aes256_set0count110key,
+    .plain = aes256_set0count110plain,
+    .cipher = aes256_set0count110cipher,
+};
+
+const uint8_t aes256_set0count111key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count111plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count111cipher[] = { 0xCD, 0x5E, 0xCE, 0x55, 0xB8, 0xDA, 0x3B, 0xF6, 0x22, 0xC4, 0x10, 0x0D, 0xF5, 0xDE, 0x46, 0xF9 };
+const vector_data_t aes256_set0count111 = {
+    .set_num = 0,
+    .count = 111,
+    .key = aes256_set0count111key,
+    .plain = aes256_set0count111plain,
+    .cipher = aes256_set0count111cipher,
+};
+
+const uint8_t aes256_set0count112key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count112plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count112cipher[] = { 0x3B, 0x6F, 0x46, 0xF4, 0x0E, 0x0A, 0xC5, 0xFC, 0x0A, 0x9C, 0x11, 0x05, 0xF8, 0x00, 0xF4, 0x8D };
+const vector_data_t aes256_set0count112 = {
+    .set_num = 0,
+    .count = 112,
+    .key = aes256_set0count112key,
+    .plain = aes256_set0count112plain,
+    .cipher = aes256_set0count112cipher,
+};
+
+const uint8_t aes256_set0count113key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count113plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count113cipher[] = { 0xBA, 0x26, 0xD4, 0x7D, 0xA3, 0xAE, 0xB0, 0x28, 0xDE, 0x4F, 0xB5, 0xB3, 0xA8, 0x54, 0xA2, 0x4B };
+const vector_data_t aes256_set0count113 = {
+    .set_num = 0,
+    .count = 113,
+    .key = aes256_set0count113key,
+    .plain = aes256_set0count113plain,
+    .cipher = aes256_set0count113cipher,
+};
+
+const uint8_t aes256_set0count114key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count114plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count114cipher[] = { 0x87, 0xF5, 0x3B, 0xF6, 0x20, 0xD3, 0x67, 0x72, 0x68, 0x44, 0x52, 0x12, 0x90, 0x43, 0x89, 0xD5 };
+const vector_data_t aes256_set0count114 = {
+    .set_num = 0,
+    .count = 114,
+    .key = aes256_set0count114key,
+    .plain = aes256_set0count114plain,
+    .cipher = aes256_set0count114cipher,
+};
+
+const uint8_t aes256_set0count115key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count115plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count115cipher[] = { 0x10, 0x61, 0x7D, 0x28, 0xB5, 0xE0, 0xF4, 0x60, 0x54, 0x92, 0xB1, 0x82, 0xA5, 0xD7, 0xF9, 0xF6 };
+const vector_data_t aes256_set0count115 = {
+    .set_num = 0,
+    .count = 115,
+    .key = aes256_set0count115key,
+    .plain = aes256_set0count115plain,
+    .cipher = aes256_set0count115cipher,
+};
+
+const uint8_t aes256_set0count116key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count116plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count116cipher[] = { 0x9A, 0xAE, 0xC4, 0xFA, 0xBB, 0xF6, 0xFA, 0xE2, 0xA7, 0x1F, 0xEF, 0xF0, 0x2E, 0x37, 0x2B, 0x39 };
+const vector_data_t aes256_set0count116 = {
+    .set_num = 0,
+    .count = 116,
+    .key = aes256_set0count116key,
+    .plain = aes256_set0count116plain,
+    .cipher = aes256_set0count116cipher,
+};
+
+const uint8_t aes256_set0count117key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count117plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count117cipher[] = { 0x3A, 0x90, 0xC6, 0x2D, 0x88, 0xB5, 0xC4, 0x28, 0x09, 0xAB, 0xF7, 0x82, 0x48, 0x8E, 0xD1, 0x30 };
+const vector_data_t aes256_set0count117 = {
+    .set_num = 0,
+    .count = 117,
+    .key = aes256_set0count117key,
+    .plain = aes256_set0count117plain,
+    .cipher = aes256_set0count117cipher,
+};
+
+const uint8_t aes256_set0count118key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count118plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count118cipher[] = { 0xF1, 0xF1, 0xC5, 0xA4, 0x08, 0x99, 0xE1, 0x57, 0x72, 0x85, 0x7C, 0xCB, 0x65, 0xC7, 0xA0, 0x9A };
+const vector_data_t aes256_set0count118 = {
+    .set_num = 0,
+    .count = 118,
+    .key = aes256_set0count118key,
+    .plain = aes256_set0count118plain,
+    .cipher = aes256_set0count118cipher,
+};
+
+const uint8_t aes256_set0count119key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count119plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count119cipher[] = { 0x19, 0x08, 0x43, 0xD2, 0x9B, 0x25, 0xA3, 0x89, 0x7C, 0x69, 0x2C, 0xE1, 0xDD, 0x81, 0xEE, 0x52 };
+const vector_data_t aes256_set0count119 = {
+    .set_num = 0,
+    .count = 119,
+    .key = aes256_set0count119key,
+    .plain = aes256_set0count119plain,
+    .cipher = aes256_set0count119cipher,
+};
+
+const uint8_t aes256_set0count120key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count120plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count120cipher[] = { 0xA8, 0x66, 0xBC, 0x65, 0xB6, 0x94, 0x1D, 0x86, 0xE8, 0x42, 0x0A, 0x7F, 0xFB, 0x09, 0x64, 0xDB };
+const vector_data_t aes256_set0count120 = {
+    .set_num = 0,
+    .count = 120,
+    .key = aes256_set0count120key,
+    .plain = aes256_set0count120plain,
+    .cipher = aes256_set0count120cipher,
+};
+
+const uint8_t aes256_set0count121key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count121plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count121cipher[] = { 0x81, 0x93, 0xC6, 0xFF, 0x85, 0x22, 0x5C, 0xED, 0x42, 0x55, 0xE9, 0x2F, 0x6E, 0x07, 0x8A, 0x14 };
+const vector_data_t aes256_set0count121 = {
+    .set_num = 0,
+    .count = 121,
+    .key = aes256_set0count121key,
+    .plain = aes256_set0count121plain,
+    .cipher = aes256_set0count121cipher,
+};
+
+const uint8_t aes256_set0count122key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count122plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count122cipher[] = { 0x96, 0x61, 0xCB, 0x24, 0x24, 0xD7, 0xD4, 0xA3, 0x80, 0xD5, 0x47, 0xF9, 0xE7, 0xEC, 0x1C, 0xB9 };
+const vector_data_t aes256_set0count122 = {
+    .set_num = 0,
+    .count = 122,
+    .key = aes256_set0count122key,
+    .plain = aes256_set0count122plain,
+    .cipher = aes256_set0count122cipher,
+};
+
+const uint8_t aes256_set0count123key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count123plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count123cipher[] = { 0x86, 0xF9, 0x3D, 0x9E, 0xC0, 0x84, 0x53, 0xA0, 0x71, 0xE2, 0xE2, 0x87, 0x78, 0x77, 0xA9, 0xC8 };
+const vector_data_t aes256_set0count123 = {
+    .set_num = 0,
+    .count = 123,
+    .key = aes256_set0count123key,
+    .plain = aes256_set0count123plain,
+    .cipher = aes256_set0count123cipher,
+};
+
+const uint8_t aes256_set0count124key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count124plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count124cipher[] = { 0x27, 0xEE, 0xFA, 0x80, 0xCE, 0x6A, 0x4A, 0x9D, 0x59, 0x8E, 0x3F, 0xEC, 0x36, 0x54, 0x34, 0xD2 };
+const vector_data_t aes256_set0count124 = {
+    .set_num = 0,
+    .count = 124,
+    .key = aes256_set0count124key,
+    .plain = aes256_set0count124plain,
+    .cipher = aes256_set0count124cipher,
+};
+
+const uint8_t aes256_set0count125key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count125plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count125cipher[] = { 0xD6, 0x20, 0x68, 0x44, 0x45, 0x78, 0xE3, 0xAB, 0x39, 0xCE, 0x7E, 0xC9, 0x5D, 0xD0, 0x45, 0xDC };
+const vector_data_t aes256_set0count125 = {
+    .set_num = 0,
+    .count = 125,
+    .key = aes256_set0count125key,
+    .plain = aes256_set0count125plain,
+    .cipher = aes256_set0count125cipher,
+};
+
+const uint8_t aes256_set0count126key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count126plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count126cipher[] = { 0xB5, 0xF7, 0x1D, 0x4D, 0xD9, 0xA7, 0x1F, 0xE5, 0xD8, 0xBC, 0x8B, 0xA7, 0xE6, 0xEA, 0x30, 0x48 };
+const vector_data_t aes256_set0count126 = {
+    .set_num = 0,
+    .count = 126,
+    .key = aes256_set0count126key,
+    .plain = aes256_set0count126plain,
+    .cipher = aes256_set0count126cipher,
+};
+
+const uint8_t aes256_set0count127key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count127plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count127cipher[] = { 0x68, 0x25, 0xA3, 0x47, 0xAC, 0x47, 0x9D, 0x4F, 0x9D, 0x95, 0xC5, 0xCB, 0x8D, 0x3F, 0xD7, 0xE9 };
+const vector_data_t aes256_set0count127 = {
+    .set_num = 0,
+    .count = 127,
+    .key = aes256_set0count127key,
+    .plain = aes256_set0count127plain,
+    .cipher = aes256_set0count127cipher,
+};
+
+const uint8_t aes256_set0count128key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count128plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count128cipher[] = { 0xE3, 0x71, 0x4E, 0x94, 0xA5, 0x77, 0x89, 0x55, 0xCC, 0x03, 0x46, 0x35, 0x8E, 0x94, 0x78, 0x3A };
+const vector_data_t aes256_set0count128 = {
+    .set_num = 0,
+    .count = 128,
+    .key = aes256_set0count128key,
+    .plain = aes256_set0count128plain,
+    .cipher = aes256_set0count128cipher,
+};
+
+const uint8_t aes256_set0count129key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count129plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count129cipher[] = { 0xD8, 0x36, 0xB4, 0x4B, 0xB2, 0x9E, 0x0C, 0x7D, 0x89, 0xFA, 0x4B, 0x2D, 0x4B, 0x67, 0x7D, 0x2A };
+const vector_data_t aes256_set0count129 = {
+    .set_num = 0,
+    .count = 129,
+    .key = aes256_set0count129key,
+    .plain = aes256_set0count129plain,
+    .cipher = aes256_set0count129cipher,
+};
+
+const uint8_t aes256_set0count130key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count130plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count130cipher[] = { 0x5D, 0x45, 0x4B, 0x75, 0x02, 0x1D, 0x76, 0xD4, 0xB8, 0x4F, 0x87, 0x3A, 0x8F, 0x87, 0x7B, 0x92 };
+const vector_data_t aes256_set0count130 = {
+    .set_num = 0,
+    .count = 130,
+    .key = aes256_set0count130key,
+    .plain = aes256_set0count130plain,
+    .cipher = aes256_set0count130cipher,
+};
+
+const uint8_t aes256_set0count131key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count131plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count131cipher[] = { 0xC3, 0x49, 0x8F, 0x7E, 0xCE, 0xD2, 0x09, 0x53, 0x14, 0xFC, 0x28, 0x11, 0x58, 0x85, 0xB3, 0x3F };
+const vector_data_t aes256_set0count131 = {
+    .set_num = 0,
+    .count = 131,
+    .key = aes256_set0count131key,
+    .plain = aes256_set0count131plain,
+    .cipher = aes256_set0count131cipher,
+};
+
+const uint8_t aes256_set0count132key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count132plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count132cipher[] = { 0x6E, 0x66, 0x88, 0x56, 0x53, 0x9A, 0xD8, 0xE4, 0x05, 0xBD, 0x12, 0x3F, 0xE6, 0xC8, 0x85, 0x30 };
+const vector_data_t aes256_set0count132 = {
+    .set_num = 0,
+    .count = 132,
+    .key = aes256_set0count132key,
+    .plain = aes256_set0count132plain,
+    .cipher = aes256_set0count132cipher,
+};
+
+const uint8_t aes256_set0count133key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count133plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count133cipher[] = { 0x86, 0x80, 0xDB, 0x7F, 0x3A, 0x87, 0xB8, 0x60, 0x55, 0x43, 0xCF, 0xDB, 0xE6, 0x75, 0x40, 0x76 };
+const vector_data_t aes256_set0count133 = {
+    .set_num = 0,
+    .count = 133,
+    .key = aes256_set0count133key,
+    .plain = aes256_set0count133plain,
+    .cipher = aes256_set0count133cipher,
+};
+
+const uint8_t aes256_set0count134key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count134plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count134cipher[] = { 0x6C, 0x5D, 0x03, 0xB1, 0x30, 0x69, 0xC3, 0x65, 0x8B, 0x31, 0x79, 0xBE, 0x91, 0xB0, 0x80, 0x0C };
+const vector_data_t aes256_set0count134 = {
+    .set_num = 0,
+    .count = 134,
+    .key = aes256_set0count134key,
+    .plain = aes256_set0count134plain,
+    .cipher = aes256_set0count134cipher,
+};
+
+const uint8_t aes256_set0count135key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count135plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count135cipher[] = { 0xEF, 0x1B, 0x38, 0x4A, 0xC4, 0xD9, 0x3E, 0xDA, 0x00, 0xC9, 0x2A, 0xDD, 0x09, 0x95, 0xEA, 0x5F };
+const vector_data_t aes256_set0count135 = {
+    .set_num = 0,
+    .count = 135,
+    .key = aes256_set0count135key,
+    .plain = aes256_set0count135plain,
+    .cipher = aes256_set0count135cipher,
+};
+
+const uint8_t aes256_set0count136key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count136plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count136cipher[] = { 0xBF, 0x81, 0x15, 0x80, 0x54, 0x71, 0x74, 0x1B, 0xD5, 0xAD, 0x20, 0xA0, 0x39, 0x44, 0x79, 0x0F };
+const vector_data_t aes256_set0count136 = {
+    .set_num = 0,
+    .count = 136,
+    .key = aes256_set0count136key,
+    .plain = aes256_set0count136plain,
+    .cipher = aes256_set0count136cipher,
+};
+
+const uint8_t aes256_set0count137key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count137plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count137cipher[] = { 0xC6, 0x4C, 0x24, 0xB6, 0x89, 0x4B, 0x03, 0x8B, 0x3C, 0x0D, 0x09, 0xB1, 0xDF, 0x06, 0x8B, 0x0B };
+const vector_data_t aes256_set0count137 = {
+    .set_num = 0,
+    .count = 137,
+    .key = aes256_set0count137key,
+    .plain = aes256_set0count137plain,
+    .cipher = aes256_set0count137cipher,
+};
+
+const uint8_t aes256_set0count138key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count138plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count138cipher[] = { 0x39, 0x67, 0xA1, 0x0C, 0xFF, 0xE2, 0x7D, 0x01, 0x78, 0x54, 0x5F, 0xBF, 0x6A, 0x40, 0x54, 0x4B };
+const vector_data_t aes256_set0count138 = {
+    .set_num = 0,
+    .count = 138,
+    .key = aes256_set0count138key,
+    .plain = aes256_set0count138plain,
+    .cipher = aes256_set0count138cipher,
+};
+
+const uint8_t aes256_set0count139key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count139plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count139cipher[] = { 0x7C, 0x85, 0xE9, 0xC9, 0x5D, 0xE1, 0xA9, 0xEC, 0x5A, 0x53, 0x63, 0xA8, 0xA0, 0x53, 0x47, 0x2D };
+const vector_data_t aes256_set0count139 = {
+    .set_num = 0,
+    .count = 139,
+    .key = aes256_set0count139key,
+    .plain = aes256_set0count139plain,
+    .cipher = aes256_set0count139cipher,
+};
+
+const uint8_t aes256_set0count140key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count140plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count140cipher[] = { 0xA9, 0xEE, 0xC0, 0x3C, 0x8A, 0xBE, 0xC7, 0xBA, 0x68, 0x31, 0x5C, 0x2C, 0x8C, 0x23, 0x16, 0xE0 };
+const vector_data_t aes256_set0count140 = {
+    .set_num = 0,
+    .count = 140,
+    .key = aes256_set0count140key,
+    .plain = aes256_set0count140plain,
+    .cipher = aes256_set0count140cipher,
+};
+
+const uint8_t aes256_set0count141key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count141plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count141cipher[] = { 0xCA, 0xC8, 0xE4, 0x14, 0xC2, 0xF3, 0x88, 0x22, 0x7A, 0xE1, 0x49, 0x86, 0xFC, 0x98, 0x35, 0x24 };
+const vector_data_t aes256_set0count141 = {
+    .set_num = 0,
+    .count = 141,
+    .key = aes256_set0count141key,
+    .plain = aes256_set0count141plain,
+    .cipher = aes256_set0count141cipher,
+};
+
+const uint8_t aes256_set0count142key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count142plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count142cipher[] = { 0x5D, 0x94, 0x2B, 0x7F, 0x46, 0x22, 0xCE, 0x05, 0x6C, 0x3C, 0xE3, 0xCE, 0x5F, 0x1D, 0xD9, 0xD6 };
+const vector_data_t aes256_set0count142 = {
+    .set_num = 0,
+    .count = 142,
+    .key = aes256_set0count142key,
+    .plain = aes256_set0count142plain,
+    .cipher = aes256_set0count142cipher,
+};
+
+const uint8_t aes256_set0count143key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count143plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count143cipher[] = { 0xD2, 0x40, 0xD6, 0x48, 0xCE, 0x21, 0xA3, 0x02, 0x02, 0x82, 0xC3, 0xF1, 0xB5, 0x28, 0xA0, 0xB6 };
+const vector_data_t aes256_set0count143 = {
+    .set_num = 0,
+    .count = 143,
+    .key = aes256_set0count143key,
+    .plain = aes256_set0count143plain,
+    .cipher = aes256_set0count143cipher,
+};
+
+const uint8_t aes256_set0count144key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count144plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count144cipher[] = { 0x45, 0xD0, 0x89, 0xC3, 0x6D, 0x5C, 0x5A, 0x4E, 0xFC, 0x68, 0x9E, 0x3B, 0x0D, 0xE1, 0x0D, 0xD5 };
+const vector_data_t aes256_set0count144 = {
+    .set_num = 0,
+    .count = 144,
+    .key = aes256_set0count144key,
+    .plain = aes256_set0count144plain,
+    .cipher = aes256_set0count144cipher,
+};
+
+const uint8_t aes256_set0count145key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count145plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count145cipher[] = { 0xB4, 0xDA, 0x5D, 0xF4, 0xBE, 0xCB, 0x54, 0x62, 0xE0, 0x3A, 0x0E, 0xD0, 0x0D, 0x29, 0x56, 0x29 };
+const vector_data_t aes256_set0count145 = {
+    .set_num = 0,
+    .count = 145,
+    .key = aes256_set0count145key,
+    .plain = aes256_set0count145plain,
+    .cipher = aes256_set0count145cipher,
+};
+
+const uint8_t aes256_set0count146key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count146plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count146cipher[] = { 0xDC, 0xF4, 0xE1, 0x29, 0x13, 0x6C, 0x1A, 0x4B, 0x7A, 0x0F, 0x38, 0x93, 0x5C, 0xC3, 0x4B, 0x2B };
+const vector_data_t aes256_set0count146 = {
+    .set_num = 0,
+    .count = 146,
+    .key = aes256_set0count146key,
+    .plain = aes256_set0count146plain,
+    .cipher = aes256_set0count146cipher,
+};
+
+const uint8_t aes256_set0count147key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count147plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count147cipher[] = { 0xD9, 0xA4, 0xC7, 0x61, 0x8B, 0x0C, 0xE4, 0x8A, 0x3D, 0x5A, 0xEE, 0x1A, 0x1C, 0x01, 0x14, 0xC4 };
+const vector_data_t aes256_set0count147 = {
+    .set_num = 0,
+    .count = 147,
+    .key = aes256_set0count147key,
+    .plain = aes256_set0count147plain,
+    .cipher = aes256_set0count147cipher,
+};
+
+const uint8_t aes256_set0count148key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count148plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count148cipher[] = { 0xCA, 0x35, 0x2D, 0xF0, 0x25, 0xC6, 0x5C, 0x7B, 0x0B, 0xF3, 0x06, 0xFB, 0xEE, 0x0F, 0x36, 0xBA };
+const vector_data_t aes256_set0count148 = {
+    .set_num = 0,
+    .count = 148,
+    .key = aes256_set0count148key,
+    .plain = aes256_set0count148plain,
+    .cipher = aes256_set0count148cipher,
+};
+
+const uint8_t aes256_set0count149key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count149plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count149cipher[] = { 0x23, 0x8A, 0xCA, 0x23, 0xFD, 0x34, 0x09, 0xF3, 0x8A, 0xF6, 0x33, 0x78, 0xED, 0x2F, 0x54, 0x73 };
+const vector_data_t aes256_set0count149 = {
+    .set_num = 0,
+    .count = 149,
+    .key = aes256_set0count149key,
+    .plain = aes256_set0count149plain,
+    .cipher = aes256_set0count149cipher,
+};
+
+const uint8_t aes256_set0count150key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count150plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count150cipher[] = { 0x59, 0x83, 0x6A, 0x0E, 0x06, 0xA7, 0x96, 0x91, 0xB3, 0x66, 0x67, 0xD5, 0x38, 0x0D, 0x81, 0x88 };
+const vector_data_t aes256_set0count150 = {
+    .set_num = 0,
+    .count = 150,
+    .key = aes256_set0count150key,
+    .plain = aes256_set0count150plain,
+    .cipher = aes256_set0count150cipher,
+};
+
+const uint8_t aes256_set0count151key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count151plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count151cipher[] = { 0x33, 0x90, 0x50, 0x80, 0xF7, 0xAC, 0xF1, 0xCD, 0xAE, 0x0A, 0x91, 0xFC, 0x3E, 0x85, 0xAE, 0xE4 };
+const vector_data_t aes256_set0count151 = {
+    .set_num = 0,
+    .count = 151,
+    .key = aes256_set0count151key,
+    .plain = aes256_set0count151plain,
+    .cipher = aes256_set0count151cipher,
+};
+
+const uint8_t aes256_set0count152key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count152plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count152cipher[] = { 0x72, 0xC9, 0xE4, 0x64, 0x6D, 0xBC, 0x3D, 0x63, 0x20, 0xFC, 0x66, 0x89, 0xD9, 0x3E, 0x88, 0x33 };
+const vector_data_t aes256_set0count152 = {
+    .set_num = 0,
+    .count = 152,
+    .key = aes256_set0count152key,
+    .plain = aes256_set0count152plain,
+    .cipher = aes256_set0count152cipher,
+};
+
+const uint8_t aes256_set0count153key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count153plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count153cipher[] = { 0xBA, 0x77, 0x41, 0x3D, 0xEA, 0x59, 0x25, 0xB7, 0xF5, 0x41, 0x7E, 0xA4, 0x7F, 0xF1, 0x9F, 0x59 };
+const vector_data_t aes256_set0count153 = {
+    .set_num = 0,
+    .count = 153,
+    .key = aes256_set0count153key,
+    .plain = aes256_set0count153plain,
+    .cipher = aes256_set0count153cipher,
+};
+
+const uint8_t aes256_set0count154key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count154plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count154cipher[] = { 0x6C, 0xAE, 0x81, 0x29, 0xF8, 0x43, 0xD8, 0x6D, 0xC7, 0x86, 0xA0, 0xFB, 0x1A, 0x18, 0x49, 0x70 };
+const vector_data_t aes256_set0count154 = {
+    .set_num = 0,
+    .count = 154,
+    .key = aes256_set0count154key,
+    .plain = aes256_set0count154plain,
+    .cipher = aes256_set0count154cipher,
+};
+
+const uint8_t aes256_set0count155key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count155plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count155cipher[] = { 0xFC, 0xFE, 0xFB, 0x53, 0x41, 0x00, 0x79, 0x6E, 0xEB, 0xBD, 0x99, 0x02, 0x06, 0x75, 0x4E, 0x19 };
+const vector_data_t aes256_set0count155 = {
+    .set_num = 0,
+    .count = 155,
+    .key = aes256_set0count155key,
+    .plain = aes256_set0count155plain,
+    .cipher = aes256_set0count155cipher,
+};
+
+const uint8_t aes256_set0count156key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count156plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count156cipher[] = { 0x8C, 0x79, 0x1D, 0x5F, 0xDD, 0xDF, 0x47, 0x0D, 0xA0, 0x4F, 0x3E, 0x6D, 0xC4, 0xA5, 0xB5, 0xB5 };
+const vector_data_t aes256_set0count156 = {
+    .set_num = 0,
+    .count = 156,
+    .key = aes256_set0count156key,
+    .plain = aes256_set0count156plain,
+    .cipher = aes256_set0count156cipher,
+};
+
+const uint8_t aes256_set0count157key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count157plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count157cipher[] = { 0xC9, 0x3B, 0xBD, 0xC0, 0x7A, 0x46, 0x11, 0xAE, 0x4B, 0xB2, 0x66, 0xEA, 0x50, 0x34, 0xA3, 0x87 };
+const vector_data_t aes256_set0count157 = {
+    .set_num = 0,
+    .count = 157,
+    .key = aes256_set0count157key,
+    .plain = aes256_set0count157plain,
+    .cipher = aes256_set0count157cipher,
+};
+
+const uint8_t aes256_set0count158key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count158plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count158cipher[] = { 0xC1, 0x02, 0xE3, 0x8E, 0x48, 0x9A, 0xA7, 0x47, 0x62, 0xF3, 0xEF, 0xC5, 0xBB, 0x23, 0x20, 0x5A };
+const vector_data_t aes256_set0count158 = {
+    .set_num = 0,
+    .count = 158,
+    .key = aes256_set0count158key,
+    .plain = aes256_set0count158plain,
+    .cipher = aes256_set0count158cipher,
+};
+
+const uint8_t aes256_set0count159key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count159plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count159cipher[] = { 0x93, 0x20, 0x14, 0x81, 0x66, 0x5C, 0xBA, 0xFC, 0x1F, 0xCC, 0x22, 0x0B, 0xC5, 0x45, 0xFB, 0x3D };
+const vector_data_t aes256_set0count159 = {
+    .set_num = 0,
+    .count = 159,
+    .key = aes256_set0count159key,
+    .plain = aes256_set0count159plain,
+    .cipher = aes256_set0count159cipher,
+};
+
+const uint8_t aes256_set0count160key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count160plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count160cipher[] = { 0x49, 0x60, 0x75, 0x7E, 0xC6, 0xCE, 0x68, 0xCF, 0x19, 0x5E, 0x45, 0x4C, 0xFD, 0x0F, 0x32, 0xCA };
+const vector_data_t aes256_set0count160 = {
+    .set_num = 0,
+    .count = 160,
+    .key = aes256_set0count160key,
+    .plain = aes256_set0count160plain,
+    .cipher = aes256_set0count160cipher,
+};
+
+const uint8_t aes256_set0count161key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count161plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count161cipher[] = { 0xFE, 0xEC, 0x7C, 0xE6, 0xA6, 0xCB, 0xD0, 0x7C, 0x04, 0x34, 0x16, 0x73, 0x7F, 0x1B, 0xBB, 0x33 };
+const vector_data_t aes256_set0count161 = {
+    .set_num = 0,
+    .count = 161,
+    .key = aes256_set0count161key,
+    .plain = aes256_set0count161plain,
+    .cipher = aes256_set0count161cipher,
+};
+
+const uint8_t aes256_set0count162key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count162plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count162cipher[] = { 0x11, 0xC5, 0x41, 0x39, 0x04, 0x48, 0x7A, 0x80, 0x5D, 0x70, 0xA8, 0xED, 0xD9, 0xC3, 0x55, 0x27 };
+const vector_data_t aes256_set0count162 = {
+    .set_num = 0,
+    .count = 162,
+    .key = aes256_set0count162key,
+    .plain = aes256_set0count162plain,
+    .cipher = aes256_set0count162cipher,
+};
+
+const uint8_t aes256_set0count163key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count163plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count163cipher[] = { 0x34, 0x78, 0x46, 0xB2, 0xB2, 0xE3, 0x6F, 0x1F, 0x03, 0x24, 0xC8, 0x6F, 0x7F, 0x1B, 0x98, 0xE2 };
+const vector_data_t aes256_set0count163 = {
+    .set_num = 0,
+    .count = 163,
+    .key = aes256_set0count163key,
+    .plain = aes256_set0count163plain,
+    .cipher = aes256_set0count163cipher,
+};
+
+const uint8_t aes256_set0count164key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count164plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count164cipher[] = { 0x33, 0x2E, 0xEE, 0x1A, 0x0C, 0xBD, 0x19, 0xCA, 0x2D, 0x69, 0xB4, 0x26, 0x89, 0x40, 0x44, 0xF0 };
+const vector_data_t aes256_set0count164 = {
+    .set_num = 0,
+    .count = 164,
+    .key = aes256_set0count164key,
+    .plain = aes256_set0count164plain,
+    .cipher = aes256_set0count164cipher,
+};
+
+const uint8_t aes256_set0count165key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count165plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count165cipher[] = { 0x86, 0x6B, 0x5B, 0x39, 0x77, 0xBA, 0x6E, 0xFA, 0x51, 0x28, 0xEF, 0xBD, 0xA9, 0xFF, 0x03, 0xCD };
+const vector_data_t aes256_set0count165 = {
+    .set_num = 0,
+    .count = 165,
+    .key = aes256_set0count165key,
+    .plain = aes256_set0count165plain,
+    .cipher = aes256_set0count165cipher,
+};
+
+const uint8_t aes256_set0count166key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count166plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count166cipher[] = { 0xCC, 0x14, 0x45, 0xEE, 0x94, 0xC0, 0xF0, 0x8C, 0xDE, 0xE5, 0xC3, 0x44, 0xEC, 0xD1, 0xE2, 0x33 };
+const vector_data_t aes256_set0count166 = {
+    .set_num = 0,
+    .count = 166,
+    .key = aes256_set0count166key,
+    .plain = aes256_set0count166plain,
+    .cipher = aes256_set0count166cipher,
+};
+
+const uint8_t aes256_set0count167key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count167plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count167cipher[] = { 0xBE, 0x28, 0x83, 0x19, 0x02, 0x93, 0x63, 0xC2, 0x62, 0x2F, 0xEB, 0xA4, 0xB0, 0x5D, 0xFD, 0xFE };
+const vector_data_t aes256_set0count167 = {
+    .set_num = 0,
+    .count = 167,
+    .key = aes256_set0count167key,
+    .plain = aes256_set0count167plain,
+    .cipher = aes256_set0count167cipher,
+};
+
+const uint8_t aes256_set0count168key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count168plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count168cipher[] = { 0xCF, 0xD1, 0x87, 0x55, 0x23, 0xF3, 0xCD, 0x21, 0xC3, 0x95, 0x65, 0x1E, 0x6E, 0xE1, 0x5E, 0x56 };
+const vector_data_t aes256_set0count168 = {
+    .set_num = 0,
+    .count = 168,
+    .key = aes256_set0count168key,
+    .plain = aes256_set0count168plain,
+    .cipher = aes256_set0count168cipher,
+};
+
+const uint8_t aes256_set0count169key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count169plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count169cipher[] = { 0xCB, 0x5A, 0x40, 0x86, 0x57, 0x83, 0x7C, 0x53, 0xBF, 0x16, 0xF9, 0xD8, 0x46, 0x5D, 0xCE, 0x19 };
+const vector_data_t aes256_set0count169 = {
+    .set_num = 0,
+    .count = 169,
+    .key = aes256_set0count169key,
+    .plain = aes256_set0count169plain,
+    .cipher = aes256_set0count169cipher,
+};
+
+const uint8_t aes256_set0count170key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count170plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count170cipher[] = { 0xCA, 0x0B, 0xF4, 0x2C, 0xB1, 0x07, 0xF5, 0x5C, 0xCF, 0xF2, 0xFC, 0x09, 0xEE, 0x08, 0xCA, 0x15 };
+const vector_data_t aes256_set0count170 = {
+    .set_num = 0,
+    .count = 170,
+    .key = aes256_set0count170key,
+    .plain = aes256_set0count170plain,
+    .cipher = aes256_set0count170cipher,
+};
+
+const uint8_t aes256_set0count171key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count171plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count171cipher[] = { 0xFD, 0xD9, 0xBB, 0xB4, 0xA7, 0xDC, 0x2E, 0x4A, 0x23, 0x53, 0x6A, 0x58, 0x80, 0xA2, 0xDB, 0x67 };
+const vector_data_t aes256_set0count171 = {
+    .set_num = 0,
+    .count = 171,
+    .key = aes256_set0count171key,
+    .plain = aes256_set0count171plain,
+    .cipher = aes256_set0count171cipher,
+};
+
+const uint8_t aes256_set0count172key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count172plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count172cipher[] = { 0xED, 0xE4, 0x47, 0xB3, 0x62, 0xC4, 0x84, 0x99, 0x3D, 0xEC, 0x94, 0x42, 0xA3, 0xB4, 0x6A, 0xEF };
+const vector_data_t aes256_set0count172 = {
+    .set_num = 0,
+    .count = 172,
+    .key = aes256_set0count172key,
+    .plain = aes256_set0count172plain,
+    .cipher = aes256_set0count172cipher,
+};
+
+const uint8_t aes256_set0count173key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count173plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count173cipher[] = { 0x10, 0xDF, 0xFB, 0x05, 0x90, 0x4B, 0xFF, 0x7C, 0x47, 0x81, 0xDF, 0x78, 0x0A, 0xD2, 0x68, 0x37 };
+const vector_data_t aes256_set0count173 = {
+    .set_num = 0,
+    .count = 173,
+    .key = aes256_set0count173key,
+    .plain = aes256_set0count173plain,
+    .cipher = aes256_set0count173cipher,
+};
+
+const uint8_t aes256_set0count174key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count174plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count174cipher[] = { 0xC3, 0x3B, 0xC1, 0x3E, 0x8D, 0xE8, 0x8A, 0xC2, 0x52, 0x32, 0xAA, 0x74, 0x96, 0x39, 0x87, 0x83 };
+const vector_data_t aes256_set0count174 = {
+    .set_num = 0,
+    .count = 174,
+    .key = aes256_set0count174key,
+    .plain = aes256_set0count174plain,
+    .cipher = aes256_set0count174cipher,
+};
+
+const uint8_t aes256_set0count175key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count175plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count175cipher[] = { 0xCA, 0x35, 0x9C, 0x70, 0x80, 0x3A, 0x3B, 0x2A, 0x3D, 0x54, 0x2E, 0x87, 0x81, 0xDE, 0xA9, 0x75 };
+const vector_data_t aes256_set0count175 = {
+    .set_num = 0,
+    .count = 175,
+    .key = aes256_set0count175key,
+    .plain = aes256_set0count175plain,
+    .cipher = aes256_set0count175cipher,
+};
+
+const uint8_t aes256_set0count176key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count176plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count176cipher[] = { 0xBC, 0xC6, 0x5B, 0x52, 0x6F, 0x88, 0xD0, 0x5B, 0x89, 0xCE, 0x8A, 0x52, 0x02, 0x1F, 0xDB, 0x06 };
+const vector_data_t aes256_set0count176 = {
+    .set_num = 0,
+    .count = 176,
+    .key = aes256_set0count176key,
+    .plain = aes256_set0count176plain,
+    .cipher = aes256_set0count176cipher,
+};
+
+const uint8_t aes256_set0count177key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count177plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count177cipher[] = { 0xDB, 0x91, 0xA3, 0x88, 0x55, 0xC8, 0xC4, 0x64, 0x38, 0x51, 0xFB, 0xFB, 0x35, 0x8B, 0x01, 0x09 };
+const vector_data_t aes256_set0count177 = {
+    .set_num = 0,
+    .count = 177,
+    .key = aes256_set0count177key,
+    .plain = aes256_set0count177plain,
+    .cipher = aes256_set0count177cipher,
+};
+
+const uint8_t aes256_set0count178key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count178plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count178cipher[] = { 0xCA, 0x6E, 0x88, 0x93, 0xA1, 0x14, 0xAE, 0x8E, 0x27, 0xD5, 0xAB, 0x03, 0xA5, 0x49, 0x96, 0x10 };
+const vector_data_t aes256_set0count178 = {
+    .set_num = 0,
+    .count = 178,
+    .key = aes256_set0count178key,
+    .plain = aes256_set0count178plain,
+    .cipher = aes256_set0count178cipher,
+};
+
+const uint8_t aes256_set0count179key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count179plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count179cipher[] = { 0x66, 0x29, 0xD2, 0xB8, 0xDF, 0x97, 0xDA, 0x72, 0x8C, 0xDD, 0x8B, 0x1E, 0x7F, 0x94, 0x50, 0x77 };
+const vector_data_t aes256_set0count179 = {
+    .set_num = 0,
+    .count = 179,
+    .key = aes256_set0count179key,
+    .plain = aes256_set0count179plain,
+    .cipher = aes256_set0count179cipher,
+};
+
+const uint8_t aes256_set0count180key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count180plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count180cipher[] = { 0x45, 0x70, 0xA5, 0xA1, 0x8C, 0xFC, 0x0D, 0xD5, 0x82, 0xF1, 0xD8, 0x8D, 0x5C, 0x9A, 0x17, 0x20 };
+const vector_data_t aes256_set0count180 = {
+    .set_num = 0,
+    .count = 180,
+    .key = aes256_set0count180key,
+    .plain = aes256_set0count180plain,
+    .cipher = aes256_set0count180cipher,
+};
+
+const uint8_t aes256_set0count181key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count181plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count181cipher[] = { 0x72, 0xBC, 0x65, 0xAA, 0x8E, 0x89, 0x56, 0x2E, 0x3F, 0x27, 0x4D, 0x45, 0xAF, 0x1C, 0xD1, 0x0B };
+const vector_data_t aes256_set0count181 = {
+    .set_num = 0,
+    .count = 181,
+    .key = aes256_set0count181key,
+    .plain = aes256_set0count181plain,
+    .cipher = aes256_set0count181cipher,
+};
+
+const uint8_t aes256_set0count182key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count182plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count182cipher[] = { 0x98, 0x55, 0x1D, 0xA1, 0xA6, 0x50, 0x32, 0x76, 0xAE, 0x1C, 0x77, 0x62, 0x5F, 0x9E, 0xA6, 0x15 };
+const vector_data_t aes256_set0count182 = {
+    .set_num = 0,
+    .count = 182,
+    .key = aes256_set0count182key,
+    .plain = aes256_set0count182plain,
+    .cipher = aes256_set0count182cipher,
+};
+
+const uint8_t aes256_set0count183key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count183plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count183cipher[] = { 0x0D, 0xDF, 0xE5, 0x1C, 0xED, 0x7E, 0x3F, 0x4A, 0xE9, 0x27, 0xDA, 0xA3, 0xFE, 0x45, 0x2C, 0xEE };
+const vector_data_t aes256_set0count183 = {
+    .set_num = 0,
+    .count = 183,
+    .key = aes256_set0count183key,
+    .plain = aes256_set0count183plain,
+    .cipher = aes256_set0count183cipher,
+};
+
+const uint8_t aes256_set0count184key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count184plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count184cipher[] = { 0xDB, 0x82, 0x62, 0x51, 0xE4, 0xCE, 0x38, 0x4B, 0x80, 0x21, 0x8B, 0x0E, 0x1D, 0xA1, 0xDD, 0x4C };
+const vector_data_t aes256_set0count184 = {
+    .set_num = 0,
+    .count = 184,
+    .key = aes256_set0count184key,
+    .plain = aes256_set0count184plain,
+    .cipher = aes256_set0count184cipher,
+};
+
+const uint8_t aes256_set0count185key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count185plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count185cipher[] = { 0x2C, 0xAC, 0xF7, 0x28, 0xB8, 0x8A, 0xBB, 0xAD, 0x70, 0x11, 0xED, 0x0E, 0x64, 0xA1, 0x68, 0x0C };
+const vector_data_t aes256_set0count185 = {
+    .set_num = 0,
+    .count = 185,
+    .key = aes256_set0count185key,
+    .plain = aes256_set0count185plain,
+    .cipher = aes256_set0count185cipher,
+};
+
+const uint8_t aes256_set0count186key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count186plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count186cipher[] = { 0x33, 0x0D, 0x8E, 0xE7, 0xC5, 0x67, 0x7E, 0x09, 0x9A, 0xC7, 0x4C, 0x99, 0x94, 0xEE, 0x4C, 0xFB };
+const vector_data_t aes256_set0count186 = {
+    .set_num = 0,
+    .count = 186,
+    .key = aes256_set0count186key,
+    .plain = aes256_set0count186plain,
+    .cipher = aes256_set0count186cipher,
+};
+
+const uint8_t aes256_set0count187key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count187plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count187cipher[] = { 0xED, 0xF6, 0x1A, 0xE3, 0x62, 0xE8, 0x82, 0xDD, 0xC0, 0x16, 0x74, 0x74, 0xA7, 0xA7, 0x7F, 0x3A };
+const vector_data_t aes256_set0count187 = {
+    .set_num = 0,
+    .count = 187,
+    .key = aes256_set0count187key,
+    .plain = aes256_set0count187plain,
+    .cipher = aes256_set0count187cipher,
+};
+
+const uint8_t aes256_set0count188key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count188plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count188cipher[] = { 0x61, 0x68, 0xB0, 0x0B, 0xA7, 0x85, 0x9E, 0x09, 0x70, 0xEC, 0xFD, 0x75, 0x7E, 0xFE, 0xCF, 0x7C };
+const vector_data_t aes256_set0count188 = {
+    .set_num = 0,
+    .count = 188,
+    .key = aes256_set0count188key,
+    .plain = aes256_set0count188plain,
+    .cipher = aes256_set0count188cipher,
+};
+
+const uint8_t aes256_set0count189key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count189plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count189cipher[] = { 0xD1, 0x41, 0x54, 0x47, 0x86, 0x62, 0x30, 0xD2, 0x8B, 0xB1, 0xEA, 0x18, 0xA4, 0xCD, 0xFD, 0x02 };
+const vector_data_t aes256_set0count189 = {
+    .set_num = 0,
+    .count = 189,
+    .key = aes256_set0count189key,
+    .plain = aes256_set0count189plain,
+    .cipher = aes256_set0count189cipher,
+};
+
+const uint8_t aes256_set0count190key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count190plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count190cipher[] = { 0x51, 0x61, 0x83, 0x39, 0x2F, 0x7A, 0x87, 0x63, 0xAF, 0xEC, 0x68, 0xA0, 0x60, 0x26, 0x41, 0x41 };
+const vector_data_t aes256_set0count190 = {
+    .set_num = 0,
+    .count = 190,
+    .key = aes256_set0count190key,
+    .plain = aes256_set0count190plain,
+    .cipher = aes256_set0count190cipher,
+};
+
+const uint8_t aes256_set0count191key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count191plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count191cipher[] = { 0x77, 0x56, 0x5C, 0x8D, 0x73, 0xCF, 0xD4, 0x13, 0x0B, 0x4A, 0xA1, 0x4D, 0x89, 0x11, 0x71, 0x0F };
+const vector_data_t aes256_set0count191 = {
+    .set_num = 0,
+    .count = 191,
+    .key = aes256_set0count191key,
+    .plain = aes256_set0count191plain,
+    .cipher = aes256_set0count191cipher,
+};
+
+const uint8_t aes256_set0count192key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count192plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count192cipher[] = { 0x37, 0x23, 0x2A, 0x4E, 0xD2, 0x1C, 0xCC, 0x27, 0xC1, 0x9C, 0x96, 0x10, 0x07, 0x8C, 0xAB, 0xAC };
+const vector_data_t aes256_set0count192 = {
+    .set_num = 0,
+    .count = 192,
+    .key = aes256_set0count192key,
+    .plain = aes256_set0count192plain,
+    .cipher = aes256_set0count192cipher,
+};
+
+const uint8_t aes256_set0count193key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count193plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count193cipher[] = { 0x80, 0x4F, 0x32, 0xEA, 0x71, 0x82, 0x8C, 0x7D, 0x32, 0x90, 0x77, 0xE7, 0x12, 0x23, 0x16, 0x66 };
+const vector_data_t aes256_set0count193 = {
+    .set_num = 0,
+    .count = 193,
+    .key = aes256_set0count193key,
+    .plain = aes256_set0count193plain,
+    .cipher = aes256_set0count193cipher,
+};
+
+const uint8_t aes256_set0count194key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count194plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count194cipher[] = { 0xD6, 0x44, 0x24, 0xF2, 0x3C, 0xB9, 0x72, 0x15, 0xE9, 0xC2, 0xC6, 0xF2, 0x8D, 0x29, 0xEA, 0xB7 };
+const vector_data_t aes256_set0count194 = {
+    .set_num = 0,
+    .count = 194,
+    .key = aes256_set0count194key,
+    .plain = aes256_set0count194plain,
+    .cipher = aes256_set0count194cipher,
+};
+
+const uint8_t aes256_set0count195key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count195plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count195cipher[] = { 0x02, 0x3E, 0x82, 0xB5, 0x33, 0xF6, 0x8C, 0x75, 0xC2, 0x38, 0xCE, 0xBD, 0xB2, 0xEE, 0x89, 0xA2 };
+const vector_data_t aes256_set0count195 = {
+    .set_num = 0,
+    .count = 195,
+    .key = aes256_set0count195key,
+    .plain = aes256_set0count195plain,
+    .cipher = aes256_set0count195cipher,
+};
+
+const uint8_t aes256_set0count196key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count196plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count196cipher[] = { 0x19, 0x3A, 0x3D, 0x24, 0x15, 0x7A, 0x51, 0xF1, 0xEE, 0x08, 0x93, 0xF6, 0x77, 0x74, 0x17, 0xE7 };
+const vector_data_t aes256_set0count196 = {
+    .set_num = 0,
+    .count = 196,
+    .key = aes256_set0count196key,
+    .plain = aes256_set0count196plain,
+    .cipher = aes256_set0count196cipher,
+};
+
+const uint8_t aes256_set0count197key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count197plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count197cipher[] = { 0x84, 0xEC, 0xAC, 0xFC, 0xD4, 0x00, 0x08, 0x4D, 0x07, 0x86, 0x12, 0xB1, 0x94, 0x5F, 0x2E, 0xF5 };
+const vector_data_t aes256_set0count197 = {
+    .set_num = 0,
+    .count = 197,
+    .key = aes256_set0count197key,
+    .plain = aes256_set0count197plain,
+    .cipher = aes256_set0count197cipher,
+};
+
+const uint8_t aes256_set0count198key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count198plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count198cipher[] = { 0x1D, 0xCD, 0x8B, 0xB1, 0x73, 0x25, 0x9E, 0xB3, 0x3A, 0x52, 0x42, 0xB0, 0xDE, 0x31, 0xA4, 0x55 };
+const vector_data_t aes256_set0count198 = {
+    .set_num = 0,
+    .count = 198,
+    .key = aes256_set0count198key,
+    .plain = aes256_set0count198plain,
+    .cipher = aes256_set0count198cipher,
+};
+
+const uint8_t aes256_set0count199key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count199plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count199cipher[] = { 0x35, 0xE9, 0xED, 0xDB, 0xC3, 0x75, 0xE7, 0x92, 0xC1, 0x99, 0x92, 0xC1, 0x91, 0x65, 0x01, 0x2B };
+const vector_data_t aes256_set0count199 = {
+    .set_num = 0,
+    .count = 199,
+    .key = aes256_set0count199key,
+    .plain = aes256_set0count199plain,
+    .cipher = aes256_set0count199cipher,
+};
+
+const uint8_t aes256_set0count200key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count200plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count200cipher[] = { 0x8A, 0x77, 0x22, 0x31, 0xC0, 0x1D, 0xFD, 0xD7, 0xC9, 0x8E, 0x4C, 0xFD, 0xDC, 0xC0, 0x80, 0x7A };
+const vector_data_t aes256_set0count200 = {
+    .set_num = 0,
+    .count = 200,
+    .key = aes256_set0count200key,
+    .plain = aes256_set0count200plain,
+    .cipher = aes256_set0count200cipher,
+};
+
+const uint8_t aes256_set0count201key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count201plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count201cipher[] = { 0x6E, 0xDA, 0x7F, 0xF6, 0xB8, 0x31, 0x91, 0x80, 0xFF, 0x0D, 0x6E, 0x65, 0x62, 0x9D, 0x01, 0xC3 };
+const vector_data_t aes256_set0count201 = {
+    .set_num = 0,
+    .count = 201,
+    .key = aes256_set0count201key,
+    .plain = aes256_set0count201plain,
+    .cipher = aes256_set0count201cipher,
+};
+
+const uint8_t aes256_set0count202key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count202plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count202cipher[] = { 0xC2, 0x67, 0xEF, 0x0E, 0x2D, 0x01, 0xA9, 0x93, 0x94, 0x4D, 0xD3, 0x97, 0x10, 0x14, 0x13, 0xCB };
+const vector_data_t aes256_set0count202 = {
+    .set_num = 0,
+    .count = 202,
+    .key = aes256_set0count202key,
+    .plain = aes256_set0count202plain,
+    .cipher = aes256_set0count202cipher,
+};
+
+const uint8_t aes256_set0count203key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count203plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count203cipher[] = { 0xE9, 0xF8, 0x0E, 0x9D, 0x84, 0x5B, 0xCC, 0x0F, 0x62, 0x92, 0x6A, 0xF7, 0x2E, 0xAB, 0xCA, 0x39 };
+const vector_data_t aes256_set0count203 = {
+    .set_num = 0,
+    .count = 203,
+    .key = aes256_set0count203key,
+    .plain = aes256_set0count203plain,
+    .cipher = aes256_set0count203cipher,
+};
+
+const uint8_t aes256_set0count204key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count204plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count204cipher[] = { 0x67, 0x02, 0x99, 0x07, 0x27, 0xAA, 0x08, 0x78, 0x63, 0x7B, 0x45, 0xDC, 0xD3, 0xA3, 0xB0, 0x74 };
+const vector_data_t aes256_set0count204 = {
+    .set_num = 0,
+    .count = 204,
+    .key = aes256_set0count204key,
+    .plain = aes256_set0count204plain,
+    .cipher = aes256_set0count204cipher,
+};
+
+const uint8_t aes256_set0count205key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count205plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count205cipher[] = { 0x2E, 0x2E, 0x64, 0x7D, 0x53, 0x60, 0xE0, 0x92, 0x30, 0xA5, 0xD7, 0x38, 0xCA, 0x33, 0x47, 0x1E };
+const vector_data_t aes256_set0count205 = {
+    .set_num = 0,
+    .count = 205,
+    .key = aes256_set0count205key,
+    .plain = aes256_set0count205plain,
+    .cipher = aes256_set0count205cipher,
+};
+
+const uint8_t aes256_set0count206key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count206plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count206cipher[] = { 0x1F, 0x56, 0x41, 0x3C, 0x7A, 0xDD, 0x6F, 0x43, 0xD1, 0xD5, 0x6E, 0x4F, 0x02, 0x19, 0x03, 0x30 };
+const vector_data_t aes256_set0count206 = {
+    .set_num = 0,
+    .count = 206,
+    .key = aes256_set0count206key,
+    .plain = aes256_set0count206plain,
+    .cipher = aes256_set0count206cipher,
+};
+
+const uint8_t aes256_set0count207key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count207plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count207cipher[] = { 0x69, 0xCD, 0x06, 0x06, 0xE1, 0x5A, 0xF7, 0x29, 0xD6, 0xBC, 0xA1, 0x43, 0x01, 0x6D, 0x98, 0x42 };
+const vector_data_t aes256_set0count207 = {
+    .set_num = 0,
+    .count = 207,
+    .key = aes256_set0count207key,
+    .plain = aes256_set0count207plain,
+    .cipher = aes256_set0count207cipher,
+};
+
+const uint8_t aes256_set0count208key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count208plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count208cipher[] = { 0xA0, 0x85, 0xD7, 0xC1, 0xA5, 0x00, 0x87, 0x3A, 0x20, 0x09, 0x9C, 0x4C, 0xAA, 0x3C, 0x3F, 0x5B };
+const vector_data_t aes256_set0count208 = {
+    .set_num = 0,
+    .count = 208,
+    .key = aes256_set0count208key,
+    .plain = aes256_set0count208plain,
+    .cipher = aes256_set0count208cipher,
+};
+
+const uint8_t aes256_set0count209key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count209plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count209cipher[] = { 0x4F, 0xC0, 0xD2, 0x30, 0xF8, 0x89, 0x14, 0x15, 0xB8, 0x7B, 0x83, 0xF9, 0x5F, 0x2E, 0x09, 0xD1 };
+const vector_data_t aes256_set0count209 = {
+    .set_num = 0,
+    .count = 209,
+    .key = aes256_set0count209key,
+    .plain = aes256_set0count209plain,
+    .cipher = aes256_set0count209cipher,
+};
+
+const uint8_t aes256_set0count210key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count210plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count210cipher[] = { 0x43, 0x27, 0xD0, 0x8C, 0x52, 0x3D, 0x8E, 0xBA, 0x69, 0x7A, 0x43, 0x36, 0x50, 0x7D, 0x1F, 0x42 };
+const vector_data_t aes256_set0count210 = {
+    .set_num = 0,
+    .count = 210,
+    .key = aes256_set0count210key,
+    .plain = aes256_set0count210plain,
+    .cipher = aes256_set0count210cipher,
+};
+
+const uint8_t aes256_set0count211key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count211plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count211cipher[] = { 0x7A, 0x15, 0xAA, 0xB8, 0x27, 0x01, 0xEF, 0xA5, 0xAE, 0x36, 0xAB, 0x1D, 0x6B, 0x76, 0x29, 0x0F };
+const vector_data_t aes256_set0count211 = {
+    .set_num = 0,
+    .count = 211,
+    .key = aes256_set0count211key,
+    .plain = aes256_set0count211plain,
+    .cipher = aes256_set0count211cipher,
+};
+
+const uint8_t aes256_set0count212key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count212plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count212cipher[] = { 0x5B, 0xF0, 0x05, 0x18, 0x93, 0xA1, 0x8B, 0xB3, 0x0E, 0x13, 0x9A, 0x58, 0xFE, 0xD0, 0xFA, 0x54 };
+const vector_data_t aes256_set0count212 = {
+    .set_num = 0,
+    .count = 212,
+    .key = aes256_set0count212key,
+    .plain = aes256_set0count212plain,
+    .cipher = aes256_set0count212cipher,
+};
+
+const uint8_t aes256_set0count213key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count213plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count213cipher[] = { 0x97, 0xE8, 0xAD, 0xF6, 0x56, 0x38, 0xFD, 0x9C, 0xDF, 0x3B, 0xC2, 0x2C, 0x17, 0xFE, 0x4D, 0xBD };
+const vector_data_t aes256_set0count213 = {
+    .set_num = 0,
+    .count = 213,
+    .key = aes256_set0count213key,
+    .plain = aes256_set0count213plain,
+    .cipher = aes256_set0count213cipher,
+};
+
+const uint8_t aes256_set0count214key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count214plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count214cipher[] = { 0x1E, 0xE6, 0xEE, 0x32, 0x65, 0x83, 0xA0, 0x58, 0x64, 0x91, 0xC9, 0x64, 0x18, 0xD1, 0xA3, 0x5D };
+const vector_data_t aes256_set0count214 = {
+    .set_num = 0,
+    .count = 214,
+    .key = aes256_set0count214key,
+    .plain = aes256_set0count214plain,
+    .cipher = aes256_set0count214cipher,
+};
+
+const uint8_t aes256_set0count215key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count215plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count215cipher[] = { 0x26, 0xB5, 0x49, 0xC2, 0xEC, 0x75, 0x6F, 0x82, 0xEC, 0xC4, 0x80, 0x08, 0xE5, 0x29, 0x95, 0x6B };
+const vector_data_t aes256_set0count215 = {
+    .set_num = 0,
+    .count = 215,
+    .key = aes256_set0count215key,
+    .plain = aes256_set0count215plain,
+    .cipher = aes256_set0count215cipher,
+};
+
+const uint8_t aes256_set0count216key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count216plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count216cipher[] = { 0x70, 0x37, 0x7B, 0x6D, 0xA6, 0x69, 0xB0, 0x72, 0x12, 0x9E, 0x05, 0x7C, 0xC2, 0x8E, 0x9C, 0xA5 };
+const vector_data_t aes256_set0count216 = {
+    .set_num = 0,
+    .count = 216,
+    .key = aes256_set0count216key,
+    .plain = aes256_set0count216plain,
+    .cipher = aes256_set0count216cipher,
+};
+
+const uint8_t aes256_set0count217key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count217plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count217cipher[] = { 0x9C, 0x94, 0xB8, 0xB0, 0xCB, 0x8B, 0xCC, 0x91, 0x90, 0x72, 0x26, 0x2B, 0x3F, 0xA0, 0x5A, 0xD9 };
+const vector_data_t aes256_set0count217 = {
+    .set_num = 0,
+    .count = 217,
+    .key = aes256_set0count217key,
+    .plain = aes256_set0count217plain,
+    .cipher = aes256_set0count217cipher,
+};
+
+const uint8_t aes256_set0count218key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count218plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count218cipher[] = { 0x2F, 0xBB, 0x83, 0xDF, 0xD0, 0xD7, 0xAB, 0xCB, 0x05, 0xCD, 0x28, 0xCA, 0xD2, 0xDF, 0xB5, 0x23 };
+const vector_data_t aes256_set0count218 = {
+    .set_num = 0,
+    .count = 218,
+    .key = aes256_set0count218key,
+    .plain = aes256_set0count218plain,
+    .cipher = aes256_set0count218cipher,
+};
+
+const uint8_t aes256_set0count219key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count219plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count219cipher[] = { 0x96, 0x87, 0x78, 0x03, 0xDE, 0x77, 0x74, 0x4B, 0xB9, 0x70, 0xD0, 0xA9, 0x1F, 0x4D, 0xEB, 0xAE };
+const vector_data_t aes256_set0count219 = {
+    .set_num = 0,
+    .count = 219,
+    .key = aes256_set0count219key,
+    .plain = aes256_set0count219plain,
+    .cipher = aes256_set0count219cipher,
+};
+
+const uint8_t aes256_set0count220key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count220plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count220cipher[] = { 0x73, 0x79, 0xF3, 0x37, 0x0C, 0xF6, 0xE5, 0xCE, 0x12, 0xAE, 0x59, 0x69, 0xC8, 0xEE, 0xA3, 0x12 };
+const vector_data_t aes256_set0count220 = {
+    .set_num = 0,
+    .count = 220,
+    .key = aes256_set0count220key,
+    .plain = aes256_set0count220plain,
+    .cipher = aes256_set0count220cipher,
+};
+
+const uint8_t aes256_set0count221key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count221plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count221cipher[] = { 0x02, 0xDC, 0x99, 0xFA, 0x3D, 0x4F, 0x98, 0xCE, 0x80, 0x98, 0x5E, 0x72, 0x33, 0x88, 0x93, 0x13 };
+const vector_data_t aes256_set0count221 = {
+    .set_num = 0,
+    .count = 221,
+    .key = aes256_set0count221key,
+    .plain = aes256_set0count221plain,
+    .cipher = aes256_set0count221cipher,
+};
+
+const uint8_t aes256_set0count222key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count222plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count222cipher[] = { 0x1E, 0x38, 0xE7, 0x59, 0x07, 0x5B, 0xA5, 0xCA, 0xB6, 0x45, 0x7D, 0xA5, 0x18, 0x44, 0x29, 0x5A };
+const vector_data_t aes256_set0count222 = {
+    .set_num = 0,
+    .count = 222,
+    .key = aes256_set0count222key,
+    .plain = aes256_set0count222plain,
+    .cipher = aes256_set0count222cipher,
+};
+
+const uint8_t aes256_set0count223key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count223plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count223cipher[] = { 0x70, 0xBE, 0xD8, 0xDB, 0xF6, 0x15, 0x86, 0x8A, 0x1F, 0x9D, 0x9B, 0x05, 0xD3, 0xE7, 0xA2, 0x67 };
+const vector_data_t aes256_set0count223 = {
+    .set_num = 0,
+    .count = 223,
+    .key = aes256_set0count223key,
+    .plain = aes256_set0count223plain,
+    .cipher = aes256_set0count223cipher,
+};
+
+const uint8_t aes256_set0count224key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count224plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count224cipher[] = { 0x23, 0x4B, 0x14, 0x8B, 0x8C, 0xB1, 0xD8, 0xC3, 0x2B, 0x28, 0x7E, 0x89, 0x69, 0x03, 0xD1, 0x50 };
+const vector_data_t aes256_set0count224 = {
+    .set_num = 0,
+    .count = 224,
+    .key = aes256_set0count224key,
+    .plain = aes256_set0count224plain,
+    .cipher = aes256_set0count224cipher,
+};
+
+const uint8_t aes256_set0count225key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count225plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count225cipher[] = { 0x29, 0x4B, 0x03, 0x3D, 0xF4, 0xDA, 0x85, 0x3F, 0x4B, 0xE3, 0xE2, 0x43, 0xF7, 0xE5, 0x13, 0xF4 };
+const vector_data_t aes256_set0count225 = {
+    .set_num = 0,
+    .count = 225,
+    .key = aes256_set0count225key,
+    .plain = aes256_set0count225plain,
+    .cipher = aes256_set0count225cipher,
+};
+
+const uint8_t aes256_set0count226key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count226plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count226cipher[] = { 0x3F, 0x58, 0xC9, 0x50, 0xF0, 0x36, 0x71, 0x60, 0xAD, 0xEC, 0x45, 0xF2, 0x44, 0x1E, 0x74, 0x11 };
+const vector_data_t aes256_set0count226 = {
+    .set_num = 0,
+    .count = 226,
+    .key = aes256_set0count226key,
+    .plain = aes256_set0count226plain,
+    .cipher = aes256_set0count226cipher,
+};
+
+const uint8_t aes256_set0count227key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count227plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count227cipher[] = { 0x37, 0xF6, 0x55, 0x53, 0x6A, 0x70, 0x4E, 0x5A, 0xCE, 0x18, 0x2D, 0x74, 0x2A, 0x82, 0x0C, 0xF4 };
+const vector_data_t aes256_set0count227 = {
+    .set_num = 0,
+    .count = 227,
+    .key = aes256_set0count227key,
+    .plain = aes256_set0count227plain,
+    .cipher = aes256_set0count227cipher,
+};
+
+const uint8_t aes256_set0count228key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count228plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count228cipher[] = { 0xEA, 0x7B, 0xD6, 0xBB, 0x63, 0x41, 0x87, 0x31, 0xAE, 0xAC, 0x79, 0x0F, 0xE4, 0x2D, 0x61, 0xE8 };
+const vector_data_t aes256_set0count228 = {
+    .set_num = 0,
+    .count = 228,
+    .key = aes256_set0count228key,
+    .plain = aes256_set0count228plain,
+    .cipher = aes256_set0count228cipher,
+};
+
+const uint8_t aes256_set0count229key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count229plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count229cipher[] = { 0xE7, 0x4A, 0x4C, 0x99, 0x9B, 0x4C, 0x06, 0x4E, 0x48, 0xBB, 0x1E, 0x41, 0x3F, 0x51, 0xE5, 0xEA };
+const vector_data_t aes256_set0count229 = {
+    .set_num = 0,
+    .count = 229,
+    .key = aes256_set0count229key,
+    .plain = aes256_set0count229plain,
+    .cipher = aes256_set0count229cipher,
+};
+
+const uint8_t aes256_set0count230key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count230plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count230cipher[] = { 0xBA, 0x9E, 0xBE, 0xFD, 0xB4, 0xCC, 0xF3, 0x0F, 0x29, 0x6C, 0xEC, 0xB3, 0xBC, 0x19, 0x43, 0xE8 };
+const vector_data_t aes256_set0count230 = {
+    .set_num = 0,
+    .count = 230,
+    .key = aes256_set0count230key,
+    .plain = aes256_set0count230plain,
+    .cipher = aes256_set0count230cipher,
+};
+
+const uint8_t aes256_set0count231key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count231plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count231cipher[] = { 0x31, 0x94, 0x36, 0x7A, 0x48, 0x98, 0xC5, 0x02, 0xC1, 0x3B, 0xB7, 0x47, 0x86, 0x40, 0xA7, 0x2D };
+const vector_data_t aes256_set0count231 = {
+    .set_num = 0,
+    .count = 231,
+    .key = aes256_set0count231key,
+    .plain = aes256_set0count231plain,
+    .cipher = aes256_set0count231cipher,
+};
+
+const uint8_t aes256_set0count232key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00 };
+const uint8_t aes256_set0count232plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count232cipher[] = { 0xDA, 0x79, 0x77, 0x13, 0x26, 0x3D, 0x6F, 0x33, 0xA5, 0x47, 0x8A, 0x65, 0xEF, 0x60, 0xD4, 0x12 };
+const vector_data_t aes256_set0count232 = {
+    .set_num = 0,
+    .count = 232,
+    .key = aes256_set0count232key,
+    .plain = aes256_set0count232plain,
+    .cipher = aes256_set0count232cipher,
+};
+
+const uint8_t aes256_set0count233key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00 };
+const uint8_t aes256_set0count233plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count233cipher[] = { 0xD1, 0xAC, 0x39, 0xBB, 0x1E, 0xF8, 0x6B, 0x9C, 0x13, 0x44, 0xF2, 0x14, 0x67, 0x9A, 0xA3, 0x76 };
+const vector_data_t aes256_set0count233 = {
+    .set_num = 0,
+    .count = 233,
+    .key = aes256_set0count233key,
+    .plain = aes256_set0count233plain,
+    .cipher = aes256_set0count233cipher,
+};
+
+const uint8_t aes256_set0count234key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00 };
+const uint8_t aes256_set0count234plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count234cipher[] = { 0x2F, 0xDE, 0xA9, 0xE6, 0x50, 0x53, 0x2B, 0xE5, 0xBC, 0x0E, 0x73, 0x25, 0x33, 0x7F, 0xD3, 0x63 };
+const vector_data_t aes256_set0count234 = {
+    .set_num = 0,
+    .count = 234,
+    .key = aes256_set0count234key,
+    .plain = aes256_set0count234plain,
+    .cipher = aes256_set0count234cipher,
+};
+
+const uint8_t aes256_set0count235key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00 };
+const uint8_t aes256_set0count235plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count235cipher[] = { 0xD3, 0xA2, 0x04, 0xDB, 0xD9, 0xC2, 0xAF, 0x15, 0x8B, 0x6C, 0xA6, 0x7A, 0x51, 0x56, 0xCE, 0x4A };
+const vector_data_t aes256_set0count235 = {
+    .set_num = 0,
+    .count = 235,
+    .key = aes256_set0count235key,
+    .plain = aes256_set0count235plain,
+    .cipher = aes256_set0count235cipher,
+};
+
+const uint8_t aes256_set0count236key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00 };
+const uint8_t aes256_set0count236plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count236cipher[] = { 0x3A, 0x0A, 0x0E, 0x75, 0xA8, 0xDA, 0x36, 0x73, 0x5A, 0xEE, 0x66, 0x84, 0xD9, 0x65, 0xA7, 0x78 };
+const vector_data_t aes256_set0count236 = {
+    .set_num = 0,
+    .count = 236,
+    .key = aes256_set0count236key,
+    .plain = aes256_set0count236plain,
+    .cipher = aes256_set0count236cipher,
+};
+
+const uint8_t aes256_set0count237key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00 };
+const uint8_t aes256_set0count237plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count237cipher[] = { 0x52, 0xFC, 0x3E, 0x62, 0x04, 0x92, 0xEA, 0x99, 0x64, 0x1E, 0xA1, 0x68, 0xDA, 0x5B, 0x6D, 0x52 };
+const vector_data_t aes256_set0count237 = {
+    .set_num = 0,
+    .count = 237,
+    .key = aes256_set0count237key,
+    .plain = aes256_set0count237plain,
+    .cipher = aes256_set0count237cipher,
+};
+
+const uint8_t aes256_set0count238key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00 };
+const uint8_t aes256_set0count238plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count238cipher[] = { 0xD2, 0xE0, 0xC7, 0xF1, 0x5B, 0x47, 0x72, 0x46, 0x7D, 0x2C, 0xFC, 0x87, 0x30, 0x00, 0xB2, 0xCA };
+const vector_data_t aes256_set0count238 = {
+    .set_num = 0,
+    .count = 238,
+    .key = aes256_set0count238key,
+    .plain = aes256_set0count238plain,
+    .cipher = aes256_set0count238cipher,
+};
+
+const uint8_t aes256_set0count239key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00 };
+const uint8_t aes256_set0count239plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count239cipher[] = { 0x56, 0x35, 0x31, 0x13, 0x5E, 0x0C, 0x4D, 0x70, 0xA3, 0x8F, 0x8B, 0xDB, 0x19, 0x0B, 0xA0, 0x4E };
+const vector_data_t aes256_set0count239 = {
+    .set_num = 0,
+    .count = 239,
+    .key = aes256_set0count239key,
+    .plain = aes256_set0count239plain,
+    .cipher = aes256_set0count239cipher,
+};
+
+const uint8_t aes256_set0count240key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00 };
+const uint8_t aes256_set0count240plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count240cipher[] = { 0xA8, 0xA3, 0x9A, 0x0F, 0x56, 0x63, 0xF4, 0xC0, 0xFE, 0x5F, 0x2D, 0x3C, 0xAF, 0xFF, 0x42, 0x1A };
+const vector_data_t aes256_set0count240 = {
+    .set_num = 0,
+    .count = 240,
+    .key = aes256_set0count240key,
+    .plain = aes256_set0count240plain,
+    .cipher = aes256_set0count240cipher,
+};
+
+const uint8_t aes256_set0count241key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00 };
+const uint8_t aes256_set0count241plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count241cipher[] = { 0xD9, 0x4B, 0x5E, 0x90, 0xDB, 0x35, 0x4C, 0x1E, 0x42, 0xF6, 0x1F, 0xAB, 0xE1, 0x67, 0xB2, 0xC0 };
+const vector_data_t aes256_set0count241 = {
+    .set_num = 0,
+    .count = 241,
+    .key = aes256_set0count241key,
+    .plain = aes256_set0count241plain,
+    .cipher = aes256_set0count241cipher,
+};
+
+const uint8_t aes256_set0count242key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00 };
+const uint8_t aes256_set0count242plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count242cipher[] = { 0x50, 0xE6, 0xD3, 0xC9, 0xB6, 0x69, 0x8A, 0x7C, 0xD2, 0x76, 0xF9, 0x6B, 0x14, 0x73, 0xF3, 0x5A };
+const vector_data_t aes256_set0count242 = {
+    .set_num = 0,
+    .count = 242,
+    .key = aes256_set0count242key,
+    .plain = aes256_set0count242plain,
+    .cipher = aes256_set0count242cipher,
+};
+
+const uint8_t aes256_set0count243key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00 };
+const uint8_t aes256_set0count243plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count243cipher[] = { 0x93, 0x38, 0xF0, 0x8E, 0x0E, 0xBE, 0xE9, 0x69, 0x05, 0xD8, 0xF2, 0xE8, 0x25, 0x20, 0x8F, 0x43 };
+const vector_data_t aes256_set0count243 = {
+    .set_num = 0,
+    .count = 243,
+    .key = aes256_set0count243key,
+    .plain = aes256_set0count243plain,
+    .cipher = aes256_set0count243cipher,
+};
+
+const uint8_t aes256_set0count244key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00 };
+const uint8_t aes256_set0count244plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count244cipher[] = { 0x8B, 0x37, 0x8C, 0x86, 0x67, 0x2A, 0xA5, 0x4A, 0x3A, 0x26, 0x6B, 0xA1, 0x9D, 0x25, 0x80, 0xCA };
+const vector_data_t aes256_set0count244 = {
+    .set_num = 0,
+    .count = 244,
+    .key = aes256_set0count244key,
+    .plain = aes256_set0count244plain,
+    .cipher = aes256_set0count244cipher,
+};
+
+const uint8_t aes256_set0count245key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00 };
+const uint8_t aes256_set0count245plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count245cipher[] = { 0xCC, 0xA7, 0xC3, 0x08, 0x6F, 0x5F, 0x95, 0x11, 0xB3, 0x12, 0x33, 0xDA, 0x7C, 0xAB, 0x91, 0x60 };
+const vector_data_t aes256_set0count245 = {
+    .set_num = 0,
+    .count = 245,
+    .key = aes256_set0count245key,
+    .plain = aes256_set0count245plain,
+    .cipher = aes256_set0count245cipher,
+};
+
+const uint8_t aes256_set0count246key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00 };
+const uint8_t aes256_set0count246plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count246cipher[] = { 0x5B, 0x40, 0xFF, 0x4E, 0xC9, 0xBE, 0x53, 0x6B, 0xA2, 0x30, 0x35, 0xFA, 0x4F, 0x06, 0x06, 0x4C };
+const vector_data_t aes256_set0count246 = {
+    .set_num = 0,
+    .count = 246,
+    .key = aes256_set0count246key,
+    .plain = aes256_set0count246plain,
+    .cipher = aes256_set0count246cipher,
+};
+
+const uint8_t aes256_set0count247key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+const uint8_t aes256_set0count247plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count247cipher[] = { 0x60, 0xEB, 0x5A, 0xF8, 0x41, 0x6B, 0x25, 0x71, 0x49, 0x37, 0x21, 0x94, 0xE8, 0xB8, 0x87, 0x49 };
+const vector_data_t aes256_set0count247 = {
+    .set_num = 0,
+    .count = 247,
+    .key = aes256_set0count247key,
+    .plain = aes256_set0count247plain,
+    .cipher = aes256_set0count247cipher,
+};
+
+const uint8_t aes256_set0count248key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80 };
+const uint8_t aes256_set0count248plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count248cipher[] = { 0x2F, 0x00, 0x5A, 0x8A, 0xED, 0x8A, 0x36, 0x1C, 0x92, 0xE4, 0x40, 0xC1, 0x55, 0x20, 0xCB, 0xD1 };
+const vector_data_t aes256_set0count248 = {
+    .set_num = 0,
+    .count = 248,
+    .key = aes256_set0count248key,
+    .plain = aes256_set0count248plain,
+    .cipher = aes256_set0count248cipher,
+};
+
+const uint8_t aes256_set0count249key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0 };
+const uint8_t aes256_set0count249plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count249cipher[] = { 0x7B, 0x03, 0x62, 0x76, 0x11, 0x67, 0x8A, 0x99, 0x77, 0x17, 0x57, 0x88, 0x07, 0xA8, 0x00, 0xE2 };
+const vector_data_t aes256_set0count249 = {
+    .set_num = 0,
+    .count = 249,
+    .key = aes256_set0count249key,
+    .plain = aes256_set0count249plain,
+    .cipher = aes256_set0count249cipher,
+};
+
+const uint8_t aes256_set0count250key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0 };
+const uint8_t aes256_set0count250plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count250cipher[] = { 0xCF, 0x78, 0x61, 0x8F, 0x74, 0xF6, 0xF3, 0x69, 0x6E, 0x0A, 0x47, 0x79, 0xB9, 0x0B, 0x5A, 0x77 };
+const vector_data_t aes256_set0count250 = {
+    .set_num = 0,
+    .count = 250,
+    .key = aes256_set0count250key,
+    .plain = aes256_set0count250plain,
+    .cipher = aes256_set0count250cipher,
+};
+
+const uint8_t aes256_set0count251key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 };
+const uint8_t aes256_set0count251plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count251cipher[] = { 0x03, 0x72, 0x03, 0x71, 0xA0, 0x49, 0x62, 0xEA, 0xEA, 0x0A, 0x85, 0x2E, 0x69, 0x97, 0x28, 0x58 };
+const vector_data_t aes256_set0count251 = {
+    .set_num = 0,
+    .count = 251,
+    .key = aes256_set0count251key,
+    .plain = aes256_set0count251plain,
+    .cipher = aes256_set0count251cipher,
+};
+
+const uint8_t aes256_set0count252key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8 };
+const uint8_t aes256_set0count252plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count252cipher[] = { 0x1F, 0x8A, 0x81, 0x33, 0xAA, 0x8C, 0xCF, 0x70, 0xE2, 0xBD, 0x32, 0x85, 0x83, 0x1C, 0xA6, 0xB7 };
+const vector_data_t aes256_set0count252 = {
+    .set_num = 0,
+    .count = 252,
+    .key = aes256_set0count252key,
+    .plain = aes256_set0count252plain,
+    .cipher = aes256_set0count252cipher,
+};
+
+const uint8_t aes256_set0count253key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC };
+const uint8_t aes256_set0count253plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count253cipher[] = { 0x27, 0x93, 0x6B, 0xD2, 0x7F, 0xB1, 0x46, 0x8F, 0xC8, 0xB4, 0x8B, 0xC4, 0x83, 0x32, 0x17, 0x25 };
+const vector_data_t aes256_set0count253 = {
+    .set_num = 0,
+    .count = 253,
+    .key = aes256_set0count253key,
+    .plain = aes256_set0count253plain,
+    .cipher = aes256_set0count253cipher,
+};
+
+const uint8_t aes256_set0count254key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE };
+const uint8_t aes256_set0count254plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count254cipher[] = { 0xB0, 0x7D, 0x4F, 0x3E, 0x2C, 0xD2, 0xEF, 0x2E, 0xB5, 0x45, 0x98, 0x07, 0x54, 0xDF, 0xEA, 0x0F };
+const vector_data_t aes256_set0count254 = {
+    .set_num = 0,
+    .count = 254,
+    .key = aes256_set0count254key,
+    .plain = aes256_set0count254plain,
+    .cipher = aes256_set0count254cipher,
+};
+
+const uint8_t aes256_set0count255key[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+const uint8_t aes256_set0count255plain[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set0count255cipher[] = { 0x4B, 0xF8, 0x5F, 0x1B, 0x5D, 0x54, 0xAD, 0xBC, 0x30, 0x7B, 0x0A, 0x04, 0x83, 0x89, 0xAD, 0xCB };
+const vector_data_t aes256_set0count255 = {
+    .set_num = 0,
+    .count = 255,
+    .key = aes256_set0count255key,
+    .plain = aes256_set0count255plain,
+    .cipher = aes256_set0count255cipher,
+};
+
+const uint8_t aes256_set1count0key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count0plain[] = { 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count0cipher[] = { 0xDD, 0xC6, 0xBF, 0x79, 0x0C, 0x15, 0x76, 0x0D, 0x8D, 0x9A, 0xEB, 0x6F, 0x9A, 0x75, 0xFD, 0x4E };
+const vector_data_t aes256_set1count0 = {
+    .set_num = 1,
+    .count = 0,
+    .key = aes256_set1count0key,
+    .plain = aes256_set1count0plain,
+    .cipher = aes256_set1count0cipher,
+};
+
+const uint8_t aes256_set1count1key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count1plain[] = { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count1cipher[] = { 0x0A, 0x6B, 0xDC, 0x6D, 0x4C, 0x1E, 0x62, 0x80, 0x30, 0x1F, 0xD8, 0xE9, 0x7D, 0xDB, 0xE6, 0x01 };
+const vector_data_t aes256_set1count1 = {
+    .set_num = 1,
+    .count = 1,
+    .key = aes256_set1count1key,
+    .plain = aes256_set1count1plain,
+    .cipher = aes256_set1count1cipher,
+};
+
+const uint8_t aes256_set1count2key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count2plain[] = { 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count2cipher[] = { 0x9B, 0x80, 0xEE, 0xFB, 0x7E, 0xBE, 0x2D, 0x2B, 0x16, 0x24, 0x7A, 0xA0, 0xEF, 0xC7, 0x2F, 0x5D };
+const vector_data_t aes256_set1count2 = {
+    .set_num = 1,
+    .count = 2,
+    .key = aes256_set1count2key,
+    .plain = aes256_set1count2plain,
+    .cipher = aes256_set1count2cipher,
+};
+
+const uint8_t aes256_set1count3key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count3plain[] = { 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count3cipher[] = { 0x7F, 0x2C, 0x5E, 0xCE, 0x07, 0xA9, 0x8D, 0x8B, 0xEE, 0x13, 0xC5, 0x11, 0x77, 0x39, 0x5F, 0xF7 };
+const vector_data_t aes256_set1count3 = {
+    .set_num = 1,
+    .count = 3,
+    .key = aes256_set1count3key,
+    .plain = aes256_set1count3plain,
+    .cipher = aes256_set1count3cipher,
+};
+
+const uint8_t aes256_set1count4key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count4plain[] = { 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count4cipher[] = { 0x78, 0x18, 0xD8, 0x00, 0xDC, 0xF6, 0xF4, 0xBE, 0x1E, 0x0E, 0x94, 0xF4, 0x03, 0xD1, 0xE4, 0xC2 };
+const vector_data_t aes256_set1count4 = {
+    .set_num = 1,
+    .count = 4,
+    .key = aes256_set1count4key,
+    .plain = aes256_set1count4plain,
+    .cipher = aes256_set1count4cipher,
+};
+
+const uint8_t aes256_set1count5key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count5plain[] = { 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count5cipher[] = { 0xE7, 0x4C, 0xD1, 0xC9, 0x2F, 0x09, 0x19, 0xC3, 0x5A, 0x03, 0x24, 0x12, 0x3D, 0x61, 0x77, 0xD3 };
+const vector_data_t aes256_set1count5 = {
+    .set_num = 1,
+    .count = 5,
+    .key = aes256_set1count5key,
+    .plain = aes256_set1count5plain,
+    .cipher = aes256_set1count5cipher,
+};
+
+const uint8_t aes256_set1count6key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count6plain[] = { 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count6cipher[] = { 0x80, 0x92, 0xA4, 0xDC, 0xF2, 0xDA, 0x7E, 0x77, 0xE9, 0x3B, 0xDD, 0x37, 0x1D, 0xFE, 0xD8, 0x2E };
+const vector_data_t aes256_set1count6 = {
+    .set_num = 1,
+    .count = 6,
+    .key = aes256_set1count6key,
+    .plain = aes256_set1count6plain,
+    .cipher = aes256_set1count6cipher,
+};
+
+const uint8_t aes256_set1count7key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count7plain[] = { 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count7cipher[] = { 0x49, 0xAF, 0x6B, 0x37, 0x21, 0x35, 0xAC, 0xEF, 0x10, 0x13, 0x2E, 0x54, 0x8F, 0x21, 0x7B, 0x17 };
+const vector_data_t aes256_set1count7 = {
+    .set_num = 1,
+    .count = 7,
+    .key = aes256_set1count7key,
+    .plain = aes256_set1count7plain,
+    .cipher = aes256_set1count7cipher,
+};
+
+const uint8_t aes256_set1count8key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count8plain[] = { 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count8cipher[] = { 0x8B, 0xCD, 0x40, 0xF9, 0x4E, 0xBB, 0x63, 0xB9, 0xF7, 0x90, 0x96, 0x76, 0xE6, 0x67, 0xF1, 0xE7 };
+const vector_data_t aes256_set1count8 = {
+    .set_num = 1,
+    .count = 8,
+    .key = aes256_set1count8key,
+    .plain = aes256_set1count8plain,
+    .cipher = aes256_set1count8cipher,
+};
+
+const uint8_t aes256_set1count9key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count9plain[] = { 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count9cipher[] = { 0xFE, 0x1C, 0xFF, 0xB8, 0x3F, 0x45, 0xDC, 0xFB, 0x38, 0xB2, 0x9B, 0xE4, 0x38, 0xDB, 0xD3, 0xAB };
+const vector_data_t aes256_set1count9 = {
+    .set_num = 1,
+    .count = 9,
+    .key = aes256_set1count9key,
+    .plain = aes256_set1count9plain,
+    .cipher = aes256_set1count9cipher,
+};
+
+const uint8_t aes256_set1count10key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count10plain[] = { 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count10cipher[] = { 0x0D, 0xC5, 0x8A, 0x8D, 0x88, 0x66, 0x23, 0x70, 0x5A, 0xEC, 0x15, 0xCB, 0x1E, 0x70, 0xDC, 0x0E };
+const vector_data_t aes256_set1count10 = {
+    .set_num = 1,
+    .count = 10,
+    .key = aes256_set1count10key,
+    .plain = aes256_set1count10plain,
+    .cipher = aes256_set1count10cipher,
+};
+
+const uint8_t aes256_set1count11key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count11plain[] = { 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count11cipher[] = { 0xC2, 0x18, 0xFA, 0xA1, 0x60, 0x56, 0xBD, 0x07, 0x74, 0xC3, 0xE8, 0xD7, 0x9C, 0x35, 0xA5, 0xE4 };
+const vector_data_t aes256_set1count11 = {
+    .set_num = 1,
+    .count = 11,
+    .key = aes256_set1count11key,
+    .plain = aes256_set1count11plain,
+    .cipher = aes256_set1count11cipher,
+};
+
+const uint8_t aes256_set1count12key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count12plain[] = { 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count12cipher[] = { 0x04, 0x7B, 0xBA, 0x83, 0xF7, 0xAA, 0x84, 0x17, 0x31, 0x50, 0x4E, 0x01, 0x22, 0x08, 0xFC, 0x9E };
+const vector_data_t aes256_set1count12 = {
+    .set_num = 1,
+    .count = 12,
+    .key = aes256_set1count12key,
+    .plain = aes256_set1count12plain,
+    .cipher = aes256_set1count12cipher,
+};
+
+const uint8_t aes256_set1count13key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count13plain[] = { 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count13cipher[] = { 0xDC, 0x8F, 0x0E, 0x49, 0x15, 0xFD, 0x81, 0xBA, 0x70, 0xA3, 0x31, 0x31, 0x08, 0x82, 0xF6, 0xDA };
+const vector_data_t aes256_set1count13 = {
+    .set_num = 1,
+    .count = 13,
+    .key = aes256_set1count13key,
+    .plain = aes256_set1count13plain,
+    .cipher = aes256_set1count13cipher,
+};
+
+const uint8_t aes256_set1count14key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count14plain[] = { 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count14cipher[] = { 0x15, 0x69, 0x85, 0x9E, 0xA6, 0xB7, 0x20, 0x6C, 0x30, 0xBF, 0x4F, 0xD0, 0xCB, 0xFA, 0xC3, 0x3C };
+const vector_data_t aes256_set1count14 = {
+    .set_num = 1,
+    .count = 14,
+    .key = aes256_set1count14key,
+    .plain = aes256_set1count14plain,
+    .cipher = aes256_set1count14cipher,
+};
+
+const uint8_t aes256_set1count15key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count15plain[] = { 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count15cipher[] = { 0x30, 0x0A, 0xDE, 0x92, 0xF8, 0x8F, 0x48, 0xFA, 0x2D, 0xF7, 0x30, 0xEC, 0x16, 0xEF, 0x44, 0xCD };
+const vector_data_t aes256_set1count15 = {
+    .set_num = 1,
+    .count = 15,
+    .key = aes256_set1count15key,
+    .plain = aes256_set1count15plain,
+    .cipher = aes256_set1count15cipher,
+};
+
+const uint8_t aes256_set1count16key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count16plain[] = { 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count16cipher[] = { 0x1F, 0xE6, 0xCC, 0x3C, 0x05, 0x96, 0x5D, 0xC0, 0x8E, 0xB0, 0x59, 0x0C, 0x95, 0xAC, 0x71, 0xD0 };
+const vector_data_t aes256_set1count16 = {
+    .set_num = 1,
+    .count = 16,
+    .key = aes256_set1count16key,
+    .plain = aes256_set1count16plain,
+    .cipher = aes256_set1count16cipher,
+};
+
+const uint8_t aes256_set1count17key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count17plain[] = { 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count17cipher[] = { 0x59, 0xE8, 0x58, 0xEA, 0xAA, 0x97, 0xFE, 0xC3, 0x81, 0x11, 0x27, 0x5B, 0x6C, 0xF5, 0xAB, 0xC0 };
+const vector_data_t aes256_set1count17 = {
+    .set_num = 1,
+    .count = 17,
+    .key = aes256_set1count17key,
+    .plain = aes256_set1count17plain,
+    .cipher = aes256_set1count17cipher,
+};
+
+const uint8_t aes256_set1count18key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count18plain[] = { 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count18cipher[] = { 0x22, 0x39, 0x45, 0x5E, 0x7A, 0xFE, 0x3B, 0x06, 0x16, 0x10, 0x02, 0x88, 0xCC, 0x5A, 0x72, 0x3B };
+const vector_data_t aes256_set1count18 = {
+    .set_num = 1,
+    .count = 18,
+    .key = aes256_set1count18key,
+    .plain = aes256_set1count18plain,
+    .cipher = aes256_set1count18cipher,
+};
+
+const uint8_t aes256_set1count19key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count19plain[] = { 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count19cipher[] = { 0x3E, 0xE5, 0x00, 0xC5, 0xC8, 0xD6, 0x34, 0x79, 0x71, 0x71, 0x63, 0xE5, 0x5C, 0x5C, 0x45, 0x22 };
+const vector_data_t aes256_set1count19 = {
+    .set_num = 1,
+    .count = 19,
+    .key = aes256_set1count19key,
+    .plain = aes256_set1count19plain,
+    .cipher = aes256_set1count19cipher,
+};
+
+const uint8_t aes256_set1count20key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count20plain[] = { 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count20cipher[] = { 0xD5, 0xE3, 0x8B, 0xF1, 0x5F, 0x16, 0xD9, 0x0E, 0x3E, 0x21, 0x40, 0x41, 0xD7, 0x74, 0xDA, 0xA8 };
+const vector_data_t aes256_set1count20 = {
+    .set_num = 1,
+    .count = 20,
+    .key = aes256_set1count20key,
+    .plain = aes256_set1count20plain,
+    .cipher = aes256_set1count20cipher,
+};
+
+const uint8_t aes256_set1count21key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count21plain[] = { 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count21cipher[] = { 0xB1, 0xF4, 0x06, 0x6E, 0x6F, 0x4F, 0x18, 0x7D, 0xFE, 0x5F, 0x2A, 0xD1, 0xB1, 0x78, 0x19, 0xD0 };
+const vector_data_t aes256_set1count21 = {
+    .set_num = 1,
+    .count = 21,
+    .key = aes256_set1count21key,
+    .plain = aes256_set1count21plain,
+    .cipher = aes256_set1count21cipher,
+};
+
+const uint8_t aes256_set1count22key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count22plain[] = { 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count22cipher[] = { 0x6E, 0xF4, 0xCC, 0x4D, 0xE4, 0x9B, 0x11, 0x06, 0x5D, 0x7A, 0xF2, 0x90, 0x98, 0x54, 0x79, 0x4A };
+const vector_data_t aes256_set1count22 = {
+    .set_num = 1,
+    .count = 22,
+    .key = aes256_set1count22key,
+    .plain = aes256_set1count22plain,
+    .cipher = aes256_set1count22cipher,
+};
+
+const uint8_t aes256_set1count23key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count23plain[] = { 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count23cipher[] = { 0xAC, 0x86, 0xBC, 0x60, 0x6B, 0x66, 0x40, 0xC3, 0x09, 0xE7, 0x82, 0xF2, 0x32, 0xBF, 0x36, 0x7F };
+const vector_data_t aes256_set1count23 = {
+    .set_num = 1,
+    .count = 23,
+    .key = aes256_set1count23key,
+    .plain = aes256_set1count23plain,
+    .cipher = aes256_set1count23cipher,
+};
+
+const uint8_t aes256_set1count24key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count24plain[] = { 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count24cipher[] = { 0x36, 0xAF, 0xF0, 0xEF, 0x7B, 0xF3, 0x28, 0x07, 0x72, 0xCF, 0x4C, 0xAC, 0x80, 0xA0, 0xD2, 0xB2 };
+const vector_data_t aes256_set1count24 = {
+    .set_num = 1,
+    .count = 24,
+    .key = aes256_set1count24key,
+    .plain = aes256_set1count24plain,
+    .cipher = aes256_set1count24cipher,
+};
+
+const uint8_t aes256_set1count25key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count25plain[] = { 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count25cipher[] = { 0x1F, 0x8E, 0xED, 0xEA, 0x0F, 0x62, 0xA1, 0x40, 0x6D, 0x58, 0xCF, 0xC3, 0xEC, 0xEA, 0x72, 0xCF };
+const vector_data_t aes256_set1count25 = {
+    .set_num = 1,
+    .count = 25,
+    .key = aes256_set1count25key,
+    .plain = aes256_set1count25plain,
+    .cipher = aes256_set1count25cipher,
+};
+
+const uint8_t aes256_set1count26key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count26plain[] = { 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count26cipher[] = { 0xAB, 0xF4, 0x15, 0x4A, 0x33, 0x75, 0xA1, 0xD3, 0xE6, 0xB1, 0xD4, 0x54, 0x43, 0x8F, 0x95, 0xA6 };
+const vector_data_t aes256_set1count26 = {
+    .set_num = 1,
+    .count = 26,
+    .key = aes256_set1count26key,
+    .plain = aes256_set1count26plain,
+    .cipher = aes256_set1count26cipher,
+};
+
+const uint8_t aes256_set1count27key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count27plain[] = { 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count27cipher[] = { 0x96, 0xF9, 0x6E, 0x9D, 0x60, 0x7F, 0x66, 0x15, 0xFC, 0x19, 0x20, 0x61, 0xEE, 0x64, 0x8B, 0x07 };
+const vector_data_t aes256_set1count27 = {
+    .set_num = 1,
+    .count = 27,
+    .key = aes256_set1count27key,
+    .plain = aes256_set1count27plain,
+    .cipher = aes256_set1count27cipher,
+};
+
+const uint8_t aes256_set1count28key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count28plain[] = { 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count28cipher[] = { 0xCF, 0x37, 0xCD, 0xAA, 0xA0, 0xD2, 0xD5, 0x36, 0xC7, 0x18, 0x57, 0x63, 0x4C, 0x79, 0x20, 0x64 };
+const vector_data_t aes256_set1count28 = {
+    .set_num = 1,
+    .count = 28,
+    .key = aes256_set1count28key,
+    .plain = aes256_set1count28plain,
+    .cipher = aes256_set1count28cipher,
+};
+
+const uint8_t aes256_set1count29key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count29plain[] = { 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count29cipher[] = { 0xFB, 0xD6, 0x64, 0x0C, 0x80, 0x24, 0x5C, 0x2B, 0x80, 0x53, 0x73, 0xF1, 0x30, 0x70, 0x31, 0x27 };
+const vector_data_t aes256_set1count29 = {
+    .set_num = 1,
+    .count = 29,
+    .key = aes256_set1count29key,
+    .plain = aes256_set1count29plain,
+    .cipher = aes256_set1count29cipher,
+};
+
+const uint8_t aes256_set1count30key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count30plain[] = { 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count30cipher[] = { 0x8D, 0x6A, 0x8A, 0xFE, 0x55, 0xA6, 0xE4, 0x81, 0xBA, 0xDA, 0xE0, 0xD1, 0x46, 0xF4, 0x36, 0xDB };
+const vector_data_t aes256_set1count30 = {
+    .set_num = 1,
+    .count = 30,
+    .key = aes256_set1count30key,
+    .plain = aes256_set1count30plain,
+    .cipher = aes256_set1count30cipher,
+};
+
+const uint8_t aes256_set1count31key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count31plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count31cipher[] = { 0x6A, 0x49, 0x81, 0xF2, 0x91, 0x5E, 0x3E, 0x68, 0xAF, 0x6C, 0x22, 0x38, 0x5D, 0xD0, 0x67, 0x56 };
+const vector_data_t aes256_set1count31 = {
+    .set_num = 1,
+    .count = 31,
+    .key = aes256_set1count31key,
+    .plain = aes256_set1count31plain,
+    .cipher = aes256_set1count31cipher,
+};
+
+const uint8_t aes256_set1count32key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count32plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count32cipher[] = { 0x42, 0xA1, 0x13, 0x6E, 0x5F, 0x8D, 0x8D, 0x21, 0xD3, 0x10, 0x19, 0x98, 0x64, 0x2D, 0x57, 0x3B };
+const vector_data_t aes256_set1count32 = {
+    .set_num = 1,
+    .count = 32,
+    .key = aes256_set1count32key,
+    .plain = aes256_set1count32plain,
+    .cipher = aes256_set1count32cipher,
+};
+
+const uint8_t aes256_set1count33key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count33plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count33cipher[] = { 0x9B, 0x47, 0x15, 0x96, 0xDC, 0x69, 0xAE, 0x15, 0x86, 0xCE, 0xE6, 0x15, 0x8B, 0x0B, 0x01, 0x81 };
+const vector_data_t aes256_set1count33 = {
+    .set_num = 1,
+    .count = 33,
+    .key = aes256_set1count33key,
+    .plain = aes256_set1count33plain,
+    .cipher = aes256_set1count33cipher,
+};
+
+const uint8_t aes256_set1count34key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count34plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count34cipher[] = { 0x75, 0x36, 0x65, 0xC4, 0xAF, 0x1E, 0xFF, 0x33, 0xAA, 0x8B, 0x62, 0x8B, 0xF8, 0x74, 0x1C, 0xFD };
+const vector_data_t aes256_set1count34 = {
+    .set_num = 1,
+    .count = 34,
+    .key = aes256_set1count34key,
+    .plain = aes256_set1count34plain,
+    .cipher = aes256_set1count34cipher,
+};
+
+const uint8_t aes256_set1count35key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count35plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count35cipher[] = { 0x9A, 0x68, 0x2A, 0xCF, 0x40, 0xBE, 0x01, 0xF5, 0xB2, 0xA4, 0x19, 0x3C, 0x9A, 0x82, 0x40, 0x4D };
+const vector_data_t aes256_set1count35 = {
+    .set_num = 1,
+    .count = 35,
+    .key = aes256_set1count35key,
+    .plain = aes256_set1count35plain,
+    .cipher = aes256_set1count35cipher,
+};
+
+const uint8_t aes256_set1count36key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count36plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count36cipher[] = { 0x54, 0xFA, 0xFE, 0x26, 0xE4, 0x28, 0x7F, 0x17, 0xD1, 0x93, 0x5F, 0x87, 0xEB, 0x9A, 0xDE, 0x01 };
+const vector_data_t aes256_set1count36 = {
+    .set_num = 1,
+    .count = 36,
+    .key = aes256_set1count36key,
+    .plain = aes256_set1count36plain,
+    .cipher = aes256_set1count36cipher,
+};
+
+const uint8_t aes256_set1count37key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count37plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count37cipher[] = { 0x49, 0xD5, 0x41, 0xB2, 0xE7, 0x4C, 0xFE, 0x73, 0xE6, 0xA8, 0xE8, 0x22, 0x5F, 0x7B, 0xD4, 0x49 };
+const vector_data_t aes256_set1count37 = {
+    .set_num = 1,
+    .count = 37,
+    .key = aes256_set1count37key,
+    .plain = aes256_set1count37plain,
+    .cipher = aes256_set1count37cipher,
+};
+
+const uint8_t aes256_set1count38key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count38plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count38cipher[] = { 0x11, 0xA4, 0x55, 0x30, 0xF6, 0x24, 0xFF, 0x6F, 0x76, 0xA1, 0xB3, 0x82, 0x66, 0x26, 0xFF, 0x7B };
+const vector_data_t aes256_set1count38 = {
+    .set_num = 1,
+    .count = 38,
+    .key = aes256_set1count38key,
+    .plain = aes256_set1count38plain,
+    .cipher = aes256_set1count38cipher,
+};
+
+const uint8_t aes256_set1count39key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count39plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count39cipher[] = { 0xF9, 0x6B, 0x0C, 0x4A, 0x8B, 0xC6, 0xC8, 0x61, 0x30, 0x28, 0x9F, 0x60, 0xB4, 0x3B, 0x8F, 0xBA };
+const vector_data_t aes256_set1count39 = {
+    .set_num = 1,
+    .count = 39,
+    .key = aes256_set1count39key,
+    .plain = aes256_set1count39plain,
+    .cipher = aes256_set1count39cipher,
+};
+
+const uint8_t aes256_set1count40key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count40plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count40cipher[] = { 0x48, 0xC7, 0xD0, 0xE8, 0x08, 0x34, 0xEB, 0xDC, 0x35, 0xB6, 0x73, 0x5F, 0x76, 0xB4, 0x6C, 0x8B };
+const vector_data_t aes256_set1count40 = {
+    .set_num = 1,
+    .count = 40,
+    .key = aes256_set1count40key,
+    .plain = aes256_set1count40plain,
+    .cipher = aes256_set1count40cipher,
+};
+
+const uint8_t aes256_set1count41key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count41plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count41cipher[] = { 0x24, 0x63, 0x53, 0x1A, 0xB5, 0x4D, 0x66, 0x95, 0x5E, 0x73, 0xED, 0xC4, 0xCB, 0x8E, 0xAA, 0x45 };
+const vector_data_t aes256_set1count41 = {
+    .set_num = 1,
+    .count = 41,
+    .key = aes256_set1count41key,
+    .plain = aes256_set1count41plain,
+    .cipher = aes256_set1count41cipher,
+};
+
+const uint8_t aes256_set1count42key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count42plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count42cipher[] = { 0xAC, 0x9B, 0xD8, 0xE2, 0x53, 0x04, 0x69, 0x13, 0x4B, 0x9D, 0x5B, 0x06, 0x5D, 0x4F, 0x56, 0x5B };
+const vector_data_t aes256_set1count42 = {
+    .set_num = 1,
+    .count = 42,
+    .key = aes256_set1count42key,
+    .plain = aes256_set1count42plain,
+    .cipher = aes256_set1count42cipher,
+};
+
+const uint8_t aes256_set1count43key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count43plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count43cipher[] = { 0x3F, 0x5F, 0x91, 0x06, 0xD0, 0xE5, 0x2F, 0x97, 0x3D, 0x48, 0x90, 0xE6, 0xF3, 0x7E, 0x8A, 0x00 };
+const vector_data_t aes256_set1count43 = {
+    .set_num = 1,
+    .count = 43,
+    .key = aes256_set1count43key,
+    .plain = aes256_set1count43plain,
+    .cipher = aes256_set1count43cipher,
+};
+
+const uint8_t aes256_set1count44key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count44plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count44cipher[] = { 0x20, 0xEB, 0xC8, 0x6F, 0x13, 0x04, 0xD2, 0x72, 0xE2, 0xE2, 0x07, 0xE5, 0x9D, 0xB6, 0x39, 0xF0 };
+const vector_data_t aes256_set1count44 = {
+    .set_num = 1,
+    .count = 44,
+    .key = aes256_set1count44key,
+    .plain = aes256_set1count44plain,
+    .cipher = aes256_set1count44cipher,
+};
+
+const uint8_t aes256_set1count45key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count45plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count45cipher[] = { 0xE6, 0x7A, 0xE6, 0x42, 0x6B, 0xF9, 0x52, 0x6C, 0x97, 0x2C, 0xFF, 0x07, 0x2B, 0x52, 0x25, 0x2C };
+const vector_data_t aes256_set1count45 = {
+    .set_num = 1,
+    .count = 45,
+    .key = aes256_set1count45key,
+    .plain = aes256_set1count45plain,
+    .cipher = aes256_set1count45cipher,
+};
+
+const uint8_t aes256_set1count46key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count46plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count46cipher[] = { 0x1A, 0x51, 0x8D, 0xDD, 0xAF, 0x9E, 0xFA, 0x0D, 0x00, 0x2C, 0xC5, 0x8D, 0x10, 0x7E, 0xDF, 0xC8 };
+const vector_data_t aes256_set1count46 = {
+    .set_num = 1,
+    .count = 46,
+    .key = aes256_set1count46key,
+    .plain = aes256_set1count46plain,
+    .cipher = aes256_set1count46cipher,
+};
+
+const uint8_t aes256_set1count47key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count47plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count47cipher[] = { 0xEA, 0xD7, 0x31, 0xAF, 0x4D, 0x3A, 0x2F, 0xE3, 0xB3, 0x4B, 0xED, 0x04, 0x79, 0x42, 0xA4, 0x9F };
+const vector_data_t aes256_set1count47 = {
+    .set_num = 1,
+    .count = 47,
+    .key = aes256_set1count47key,
+    .plain = aes256_set1count47plain,
+    .cipher = aes256_set1count47cipher,
+};
+
+const uint8_t aes256_set1count48key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count48plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count48cipher[] = { 0xB1, 0xD4, 0xEF, 0xE4, 0x02, 0x42, 0xF8, 0x3E, 0x93, 0xB6, 0xC8, 0xD7, 0xEF, 0xB5, 0xEA, 0xE9 };
+const vector_data_t aes256_set1count48 = {
+    .set_num = 1,
+    .count = 48,
+    .key = aes256_set1count48key,
+    .plain = aes256_set1count48plain,
+    .cipher = aes256_set1count48cipher,
+};
+
+const uint8_t aes256_set1count49key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count49plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count49cipher[] = { 0xCD, 0x2B, 0x1F, 0xEC, 0x11, 0xFD, 0x90, 0x6C, 0x5C, 0x76, 0x30, 0x09, 0x94, 0x43, 0x61, 0x0A };
+const vector_data_t aes256_set1count49 = {
+    .set_num = 1,
+    .count = 49,
+    .key = aes256_set1count49key,
+    .plain = aes256_set1count49plain,
+    .cipher = aes256_set1count49cipher,
+};
+
+const uint8_t aes256_set1count50key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count50plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count50cipher[] = { 0xA1, 0x85, 0x3F, 0xE4, 0x7F, 0xE2, 0x92, 0x89, 0xD1, 0x53, 0x16, 0x1D, 0x06, 0x38, 0x7D, 0x21 };
+const vector_data_t aes256_set1count50 = {
+    .set_num = 1,
+    .count = 50,
+    .key = aes256_set1count50key,
+    .plain = aes256_set1count50plain,
+    .cipher = aes256_set1count50cipher,
+};
+
+const uint8_t aes256_set1count51key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count51plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count51cipher[] = { 0x46, 0x32, 0x15, 0x41, 0x79, 0xA5, 0x55, 0xC1, 0x7E, 0xA6, 0x04, 0xD0, 0x88, 0x9F, 0xAB, 0x14 };
+const vector_data_t aes256_set1count51 = {
+    .set_num = 1,
+    .count = 51,
+    .key = aes256_set1count51key,
+    .plain = aes256_set1count51plain,
+    .cipher = aes256_set1count51cipher,
+};
+
+const uint8_t aes256_set1count52key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count52plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count52cipher[] = { 0xDD, 0x27, 0xCA, 0xC6, 0x40, 0x1A, 0x02, 0x2E, 0x8F, 0x38, 0xF9, 0xF9, 0x3E, 0x77, 0x44, 0x17 };
+const vector_data_t aes256_set1count52 = {
+    .set_num = 1,
+    .count = 52,
+    .key = aes256_set1count52key,
+    .plain = aes256_set1count52plain,
+    .cipher = aes256_set1count52cipher,
+};
+
+const uint8_t aes256_set1count53key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count53plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count53cipher[] = { 0xC0, 0x90, 0x31, 0x3E, 0xB9, 0x86, 0x74, 0xF3, 0x5F, 0x31, 0x23, 0x38, 0x5F, 0xB9, 0x5D, 0x4D };
+const vector_data_t aes256_set1count53 = {
+    .set_num = 1,
+    .count = 53,
+    .key = aes256_set1count53key,
+    .plain = aes256_set1count53plain,
+    .cipher = aes256_set1count53cipher,
+};
+
+const uint8_t aes256_set1count54key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count54plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count54cipher[] = { 0xCC, 0x35, 0x26, 0x26, 0x2B, 0x92, 0xF0, 0x2E, 0xDC, 0xE5, 0x48, 0xF7, 0x16, 0xB9, 0xF4, 0x5C };
+const vector_data_t aes256_set1count54 = {
+    .set_num = 1,
+    .count = 54,
+    .key = aes256_set1count54key,
+    .plain = aes256_set1count54plain,
+    .cipher = aes256_set1count54cipher,
+};
+
+const uint8_t aes256_set1count55key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count55plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count55cipher[] = { 0xC0, 0x83, 0x8D, 0x1A, 0x2B, 0x16, 0xA7, 0xC7, 0xF0, 0xDF, 0xCC, 0x43, 0x3C, 0x39, 0x9C, 0x33 };
+const vector_data_t aes256_set1count55 = {
+    .set_num = 1,
+    .count = 55,
+    .key = aes256_set1count55key,
+    .plain = aes256_set1count55plain,
+    .cipher = aes256_set1count55cipher,
+};
+
+const uint8_t aes256_set1count56key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count56plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count56cipher[] = { 0x0D, 0x9A, 0xC7, 0x56, 0xEB, 0x29, 0x76, 0x95, 0xEE, 0xD4, 0xD3, 0x82, 0xEB, 0x12, 0x6D, 0x26 };
+const vector_data_t aes256_set1count56 = {
+    .set_num = 1,
+    .count = 56,
+    .key = aes256_set1count56key,
+    .plain = aes256_set1count56plain,
+    .cipher = aes256_set1count56cipher,
+};
+
+const uint8_t aes256_set1count57key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count57plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count57cipher[] = { 0x56, 0xED, 0xE9, 0xDD, 0xA3, 0xF6, 0xF1, 0x41, 0xBF, 0xF1, 0x75, 0x7F, 0xA6, 0x89, 0xC3, 0xE1 };
+const vector_data_t aes256_set1count57 = {
+    .set_num = 1,
+    .count = 57,
+    .key = aes256_set1count57key,
+    .plain = aes256_set1count57plain,
+    .cipher = aes256_set1count57cipher,
+};
+
+const uint8_t aes256_set1count58key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count58plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count58cipher[] = { 0x76, 0x8F, 0x52, 0x0E, 0xFE, 0x0F, 0x23, 0xE6, 0x1D, 0x3E, 0xC8, 0xAD, 0x9C, 0xE9, 0x17, 0x74 };
+const vector_data_t aes256_set1count58 = {
+    .set_num = 1,
+    .count = 58,
+    .key = aes256_set1count58key,
+    .plain = aes256_set1count58plain,
+    .cipher = aes256_set1count58cipher,
+};
+
+const uint8_t aes256_set1count59key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count59plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count59cipher[] = { 0xB1, 0x14, 0x4D, 0xDF, 0xA7, 0x57, 0x55, 0x21, 0x33, 0x90, 0xE7, 0xC5, 0x96, 0x66, 0x04, 0x90 };
+const vector_data_t aes256_set1count59 = {
+    .set_num = 1,
+    .count = 59,
+    .key = aes256_set1count59key,
+    .plain = aes256_set1count59plain,
+    .cipher = aes256_set1count59cipher,
+};
+
+const uint8_t aes256_set1count60key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count60plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count60cipher[] = { 0x1D, 0x7C, 0x0C, 0x40, 0x40, 0xB3, 0x55, 0xB9, 0xD1, 0x07, 0xA9, 0x93, 0x25, 0xE3, 0xB0, 0x50 };
+const vector_data_t aes256_set1count60 = {
+    .set_num = 1,
+    .count = 60,
+    .key = aes256_set1count60key,
+    .plain = aes256_set1count60plain,
+    .cipher = aes256_set1count60cipher,
+};
+
+const uint8_t aes256_set1count61key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count61plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count61cipher[] = { 0xD8, 0xE2, 0xBB, 0x1A, 0xE8, 0xEE, 0x3D, 0xCF, 0x5B, 0xF7, 0xD6, 0xC3, 0x8D, 0xA8, 0x2A, 0x1A };
+const vector_data_t aes256_set1count61 = {
+    .set_num = 1,
+    .count = 61,
+    .key = aes256_set1count61key,
+    .plain = aes256_set1count61plain,
+    .cipher = aes256_set1count61cipher,
+};
+
+const uint8_t aes256_set1count62key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count62plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count62cipher[] = { 0xFA, 0xF8, 0x2D, 0x17, 0x8A, 0xF2, 0x5A, 0x98, 0x86, 0xA4, 0x7E, 0x7F, 0x78, 0x9B, 0x98, 0xD7 };
+const vector_data_t aes256_set1count62 = {
+    .set_num = 1,
+    .count = 62,
+    .key = aes256_set1count62key,
+    .plain = aes256_set1count62plain,
+    .cipher = aes256_set1count62cipher,
+};
+
+const uint8_t aes256_set1count63key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count63plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count63cipher[] = { 0x9B, 0x58, 0xDB, 0xFD, 0x77, 0xFE, 0x5A, 0xCA, 0x9C, 0xFC, 0x19, 0x0C, 0xD1, 0xB8, 0x2D, 0x19 };
+const vector_data_t aes256_set1count63 = {
+    .set_num = 1,
+    .count = 63,
+    .key = aes256_set1count63key,
+    .plain = aes256_set1count63plain,
+    .cipher = aes256_set1count63cipher,
+};
+
+const uint8_t aes256_set1count64key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count64plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count64cipher[] = { 0x77, 0xF3, 0x92, 0x08, 0x90, 0x42, 0xE4, 0x78, 0xAC, 0x16, 0xC0, 0xC8, 0x6A, 0x0B, 0x5D, 0xB5 };
+const vector_data_t aes256_set1count64 = {
+    .set_num = 1,
+    .count = 64,
+    .key = aes256_set1count64key,
+    .plain = aes256_set1count64plain,
+    .cipher = aes256_set1count64cipher,
+};
+
+const uint8_t aes256_set1count65key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count65plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count65cipher[] = { 0x19, 0xF0, 0x8E, 0x34, 0x20, 0xEE, 0x69, 0xB4, 0x77, 0xCA, 0x14, 0x20, 0x28, 0x1C, 0x47, 0x82 };
+const vector_data_t aes256_set1count65 = {
+    .set_num = 1,
+    .count = 65,
+    .key = aes256_set1count65key,
+    .plain = aes256_set1count65plain,
+    .cipher = aes256_set1count65cipher,
+};
+
+const uint8_t aes256_set1count66key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count66plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count66cipher[] = { 0xA1, 0xB1, 0x9B, 0xEE, 0xE4, 0xE1, 0x17, 0x13, 0x9F, 0x74, 0xB3, 0xC5, 0x3F, 0xDC, 0xB8, 0x75 };
+const vector_data_t aes256_set1count66 = {
+    .set_num = 1,
+    .count = 66,
+    .key = aes256_set1count66key,
+    .plain = aes256_set1count66plain,
+    .cipher = aes256_set1count66cipher,
+};
+
+const uint8_t aes256_set1count67key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count67plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count67cipher[] = { 0xA3, 0x7A, 0x58, 0x69, 0xB2, 0x18, 0xA9, 0xF3, 0xA0, 0x86, 0x8D, 0x19, 0xAE, 0xA0, 0xAD, 0x6A };
+const vector_data_t aes256_set1count67 = {
+    .set_num = 1,
+    .count = 67,
+    .key = aes256_set1count67key,
+    .plain = aes256_set1count67plain,
+    .cipher = aes256_set1count67cipher,
+};
+
+const uint8_t aes256_set1count68key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count68plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count68cipher[] = { 0xBC, 0x35, 0x94, 0xE8, 0x65, 0xBC, 0xD0, 0x26, 0x1B, 0x13, 0x20, 0x27, 0x31, 0xF3, 0x35, 0x80 };
+const vector_data_t aes256_set1count68 = {
+    .set_num = 1,
+    .count = 68,
+    .key = aes256_set1count68key,
+    .plain = aes256_set1count68plain,
+    .cipher = aes256_set1count68cipher,
+};
+
+const uint8_t aes256_set1count69key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count69plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count69cipher[] = { 0x81, 0x14, 0x41, 0xCE, 0x1D, 0x30, 0x9E, 0xEE, 0x71, 0x85, 0xE8, 0xC7, 0x52, 0xC0, 0x75, 0x57 };
+const vector_data_t aes256_set1count69 = {
+    .set_num = 1,
+    .count = 69,
+    .key = aes256_set1count69key,
+    .plain = aes256_set1count69plain,
+    .cipher = aes256_set1count69cipher,
+};
+
+const uint8_t aes256_set1count70key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count70plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count70cipher[] = { 0x95, 0x99, 0x71, 0xCE, 0x41, 0x34, 0x19, 0x05, 0x63, 0x51, 0x8E, 0x70, 0x0B, 0x98, 0x74, 0xD1 };
+const vector_data_t aes256_set1count70 = {
+    .set_num = 1,
+    .count = 70,
+    .key = aes256_set1count70key,
+    .plain = aes256_set1count70plain,
+    .cipher = aes256_set1count70cipher,
+};
+
+const uint8_t aes256_set1count71key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count71plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count71cipher[] = { 0x76, 0xB5, 0x61, 0x4A, 0x04, 0x27, 0x07, 0xC9, 0x8E, 0x21, 0x32, 0xE2, 0xE8, 0x05, 0xFE, 0x63 };
+const vector_data_t aes256_set1count71 = {
+    .set_num = 1,
+    .count = 71,
+    .key = aes256_set1count71key,
+    .plain = aes256_set1count71plain,
+    .cipher = aes256_set1count71cipher,
+};
+
+const uint8_t aes256_set1count72key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count72plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count72cipher[] = { 0x7D, 0x9F, 0xA6, 0xA5, 0x75, 0x30, 0xD0, 0xF0, 0x36, 0xFE, 0xC3, 0x1C, 0x23, 0x0B, 0x0C, 0xC6 };
+const vector_data_t aes256_set1count72 = {
+    .set_num = 1,
+    .count = 72,
+    .key = aes256_set1count72key,
+    .plain = aes256_set1count72plain,
+    .cipher = aes256_set1count72cipher,
+};
+
+const uint8_t aes256_set1count73key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count73plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count73cipher[] = { 0x96, 0x41, 0x53, 0xA8, 0x3B, 0xF6, 0x98, 0x9A, 0x4B, 0xA8, 0x0D, 0xAA, 0x91, 0xC3, 0xE0, 0x81 };
+const vector_data_t aes256_set1count73 = {
+    .set_num = 1,
+    .count = 73,
+    .key = aes256_set1count73key,
+    .plain = aes256_set1count73plain,
+    .cipher = aes256_set1count73cipher,
+};
+
+const uint8_t aes256_set1count74key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count74plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count74cipher[] = { 0xA0, 0x13, 0x01, 0x4D, 0x4C, 0xE8, 0x05, 0x4C, 0xF2, 0x59, 0x1D, 0x06, 0xF6, 0xF2, 0xF1, 0x76 };
+const vector_data_t aes256_set1count74 = {
+    .set_num = 1,
+    .count = 74,
+    .key = aes256_set1count74key,
+    .plain = aes256_set1count74plain,
+    .cipher = aes256_set1count74cipher,
+};
+
+const uint8_t aes256_set1count75key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count75plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count75cipher[] = { 0xD1, 0xC5, 0xF6, 0x39, 0x9B, 0xF3, 0x82, 0x50, 0x2E, 0x38, 0x5E, 0xEE, 0x14, 0x74, 0xA8, 0x69 };
+const vector_data_t aes256_set1count75 = {
+    .set_num = 1,
+    .count = 75,
+    .key = aes256_set1count75key,
+    .plain = aes256_set1count75plain,
+    .cipher = aes256_set1count75cipher,
+};
+
+const uint8_t aes256_set1count76key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count76plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count76cipher[] = { 0x00, 0x07, 0xE2, 0x0B, 0x82, 0x98, 0xEC, 0x35, 0x4F, 0x0F, 0x5F, 0xE7, 0x47, 0x0F, 0x36, 0xBD };
+const vector_data_t aes256_set1count76 = {
+    .set_num = 1,
+    .count = 76,
+    .key = aes256_set1count76key,
+    .plain = aes256_set1count76plain,
+    .cipher = aes256_set1count76cipher,
+};
+
+const uint8_t aes256_set1count77key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count77plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count77cipher[] = { 0xB9, 0x5B, 0xA0, 0x5B, 0x33, 0x2D, 0xA6, 0x1E, 0xF6, 0x3A, 0x2B, 0x31, 0xFC, 0xAD, 0x98, 0x79 };
+const vector_data_t aes256_set1count77 = {
+    .set_num = 1,
+    .count = 77,
+    .key = aes256_set1count77key,
+    .plain = aes256_set1count77plain,
+    .cipher = aes256_set1count77cipher,
+};
+
+const uint8_t aes256_set1count78key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count78plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count78cipher[] = { 0x46, 0x20, 0xA4, 0x9B, 0xD9, 0x67, 0x49, 0x15, 0x61, 0x66, 0x9A, 0xB2, 0x5D, 0xCE, 0x45, 0xF4 };
+const vector_data_t aes256_set1count78 = {
+    .set_num = 1,
+    .count = 78,
+    .key = aes256_set1count78key,
+    .plain = aes256_set1count78plain,
+    .cipher = aes256_set1count78cipher,
+};
+
+const uint8_t aes256_set1count79key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count79plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count79cipher[] = { 0x12, 0xE7, 0x12, 0x14, 0xAE, 0x8E, 0x04, 0xF0, 0xBB, 0x63, 0xD7, 0x42, 0x5C, 0x6F, 0x14, 0xD5 };
+const vector_data_t aes256_set1count79 = {
+    .set_num = 1,
+    .count = 79,
+    .key = aes256_set1count79key,
+    .plain = aes256_set1count79plain,
+    .cipher = aes256_set1count79cipher,
+};
+
+const uint8_t aes256_set1count80key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count80plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count80cipher[] = { 0x4C, 0xC4, 0x2F, 0xC1, 0x40, 0x7B, 0x00, 0x8F, 0xE3, 0x50, 0x90, 0x7C, 0x09, 0x2E, 0x80, 0xAC };
+const vector_data_t aes256_set1count80 = {
+    .set_num = 1,
+    .count = 80,
+    .key = aes256_set1count80key,
+    .plain = aes256_set1count80plain,
+    .cipher = aes256_set1count80cipher,
+};
+
+const uint8_t aes256_set1count81key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count81plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count81cipher[] = { 0x08, 0xB2, 0x44, 0xCE, 0x7C, 0xBC, 0x8E, 0xE9, 0x7F, 0xBB, 0xA8, 0x08, 0xCB, 0x14, 0x6F, 0xDA };
+const vector_data_t aes256_set1count81 = {
+    .set_num = 1,
+    .count = 81,
+    .key = aes256_set1count81key,
+    .plain = aes256_set1count81plain,
+    .cipher = aes256_set1count81cipher,
+};
+
+const uint8_t aes256_set1count82key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count82plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count82cipher[] = { 0x39, 0xB3, 0x33, 0xE8, 0x69, 0x4F, 0x21, 0x54, 0x6A, 0xD1, 0xED, 0xD9, 0xD8, 0x7E, 0xD9, 0x5B };
+const vector_data_t aes256_set1count82 = {
+    .set_num = 1,
+    .count = 82,
+    .key = aes256_set1count82key,
+    .plain = aes256_set1count82plain,
+    .cipher = aes256_set1count82cipher,
+};
+
+const uint8_t aes256_set1count83key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count83plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count83cipher[] = { 0x3B, 0x27, 0x1F, 0x8A, 0xB2, 0xE6, 0xE4, 0xA2, 0x0B, 0xA8, 0x09, 0x0F, 0x43, 0xBA, 0x78, 0xF3 };
+const vector_data_t aes256_set1count83 = {
+    .set_num = 1,
+    .count = 83,
+    .key = aes256_set1count83key,
+    .plain = aes256_set1count83plain,
+    .cipher = aes256_set1count83cipher,
+};
+
+const uint8_t aes256_set1count84key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count84plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count84cipher[] = { 0x9A, 0xD9, 0x83, 0xF3, 0xBF, 0x65, 0x1C, 0xD0, 0x39, 0x3F, 0x0A, 0x73, 0xCC, 0xCD, 0xEA, 0x50 };
+const vector_data_t aes256_set1count84 = {
+    .set_num = 1,
+    .count = 84,
+    .key = aes256_set1count84key,
+    .plain = aes256_set1count84plain,
+    .cipher = aes256_set1count84cipher,
+};
+
+const uint8_t aes256_set1count85key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count85plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count85cipher[] = { 0x8F, 0x47, 0x6C, 0xBF, 0xF7, 0x5C, 0x1F, 0x72, 0x5C, 0xE1, 0x8E, 0x4B, 0xBC, 0xD1, 0x9B, 0x32 };
+const vector_data_t aes256_set1count85 = {
+    .set_num = 1,
+    .count = 85,
+    .key = aes256_set1count85key,
+    .plain = aes256_set1count85plain,
+    .cipher = aes256_set1count85cipher,
+};
+
+const uint8_t aes256_set1count86key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count86plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count86cipher[] = { 0x90, 0x5B, 0x62, 0x67, 0xF1, 0xD6, 0xAB, 0x53, 0x20, 0x83, 0x5A, 0x13, 0x3F, 0x09, 0x6F, 0x2A };
+const vector_data_t aes256_set1count86 = {
+    .set_num = 1,
+    .count = 86,
+    .key = aes256_set1count86key,
+    .plain = aes256_set1count86plain,
+    .cipher = aes256_set1count86cipher,
+};
+
+const uint8_t aes256_set1count87key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count87plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count87cipher[] = { 0x14, 0x5B, 0x60, 0xD6, 0xD0, 0x19, 0x3C, 0x23, 0xF4, 0x22, 0x18, 0x48, 0xA8, 0x92, 0xD6, 0x1A };
+const vector_data_t aes256_set1count87 = {
+    .set_num = 1,
+    .count = 87,
+    .key = aes256_set1count87key,
+    .plain = aes256_set1count87plain,
+    .cipher = aes256_set1count87cipher,
+};
+
+const uint8_t aes256_set1count88key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count88plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count88cipher[] = { 0x55, 0xCF, 0xB3, 0xFB, 0x6D, 0x75, 0xCA, 0xD0, 0x44, 0x5B, 0xBC, 0x8D, 0xAF, 0xA2, 0x5B, 0x0F };
+const vector_data_t aes256_set1count88 = {
+    .set_num = 1,
+    .count = 88,
+    .key = aes256_set1count88key,
+    .plain = aes256_set1count88plain,
+    .cipher = aes256_set1count88cipher,
+};
+
+const uint8_t aes256_set1count89key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count89plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count89cipher[] = { 0x7B, 0x8E, 0x70, 0x98, 0xE3, 0x57, 0xEF, 0x71, 0x23, 0x7D, 0x46, 0xD8, 0xB0, 0x75, 0xB0, 0xF5 };
+const vector_data_t aes256_set1count89 = {
+    .set_num = 1,
+    .count = 89,
+    .key = aes256_set1count89key,
+    .plain = aes256_set1count89plain,
+    .cipher = aes256_set1count89cipher,
+};
+
+const uint8_t aes256_set1count90key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count90plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count90cipher[] = { 0x2B, 0xF2, 0x72, 0x29, 0x90, 0x1E, 0xB4, 0x0F, 0x2D, 0xF9, 0xD8, 0x39, 0x8D, 0x15, 0x05, 0xAE };
+const vector_data_t aes256_set1count90 = {
+    .set_num = 1,
+    .count = 90,
+    .key = aes256_set1count90key,
+    .plain = aes256_set1count90plain,
+    .cipher = aes256_set1count90cipher,
+};
+
+const uint8_t aes256_set1count91key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count91plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count91cipher[] = { 0x83, 0xA6, 0x34, 0x02, 0xA7, 0x7F, 0x9A, 0xD5, 0xC1, 0xE9, 0x31, 0xA9, 0x31, 0xEC, 0xD7, 0x06 };
+const vector_data_t aes256_set1count91 = {
+    .set_num = 1,
+    .count = 91,
+    .key = aes256_set1count91key,
+    .plain = aes256_set1count91plain,
+    .cipher = aes256_set1count91cipher,
+};
+
+const uint8_t aes256_set1count92key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count92plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count92cipher[] = { 0x6F, 0x8B, 0xA6, 0x52, 0x11, 0x52, 0xD3, 0x1F, 0x2B, 0xAD, 0xA1, 0x84, 0x3E, 0x26, 0xB9, 0x73 };
+const vector_data_t aes256_set1count92 = {
+    .set_num = 1,
+    .count = 92,
+    .key = aes256_set1count92key,
+    .plain = aes256_set1count92plain,
+    .cipher = aes256_set1count92cipher,
+};
+
+const uint8_t aes256_set1count93key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count93plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count93cipher[] = { 0xE5, 0xC3, 0xB8, 0xE3, 0x0F, 0xD2, 0xD8, 0xE6, 0x23, 0x9B, 0x17, 0xB4, 0x4B, 0xD2, 0x3B, 0xBD };
+const vector_data_t aes256_set1count93 = {
+    .set_num = 1,
+    .count = 93,
+    .key = aes256_set1count93key,
+    .plain = aes256_set1count93plain,
+    .cipher = aes256_set1count93cipher,
+};
+
+const uint8_t aes256_set1count94key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count94plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count94cipher[] = { 0x1A, 0xC1, 0xF7, 0x10, 0x2C, 0x59, 0x93, 0x3E, 0x8B, 0x2D, 0xDC, 0x3F, 0x14, 0xE9, 0x4B, 0xAA };
+const vector_data_t aes256_set1count94 = {
+    .set_num = 1,
+    .count = 94,
+    .key = aes256_set1count94key,
+    .plain = aes256_set1count94plain,
+    .cipher = aes256_set1count94cipher,
+};
+
+const uint8_t aes256_set1count95key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count95plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count95cipher[] = { 0x21, 0xD9, 0xBA, 0x49, 0xF2, 0x76, 0xB4, 0x5F, 0x11, 0xAF, 0x8F, 0xC7, 0x1A, 0x08, 0x8E, 0x3D };
+const vector_data_t aes256_set1count95 = {
+    .set_num = 1,
+    .count = 95,
+    .key = aes256_set1count95key,
+    .plain = aes256_set1count95plain,
+    .cipher = aes256_set1count95cipher,
+};
+
+const uint8_t aes256_set1count96key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count96plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count96cipher[] = { 0x64, 0x9F, 0x1C, 0xDD, 0xC3, 0x79, 0x2B, 0x46, 0x38, 0x63, 0x5A, 0x39, 0x2B, 0xC9, 0xBA, 0xDE };
+const vector_data_t aes256_set1count96 = {
+    .set_num = 1,
+    .count = 96,
+    .key = aes256_set1count96key,
+    .plain = aes256_set1count96plain,
+    .cipher = aes256_set1count96cipher,
+};
+
+const uint8_t aes256_set1count97key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count97plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count97cipher[] = { 0xE2, 0x77, 0x5E, 0x4B, 0x59, 0xC1, 0xBC, 0x2E, 0x31, 0xA2, 0x07, 0x8C, 0x11, 0xB5, 0xA0, 0x8C };
+const vector_data_t aes256_set1count97 = {
+    .set_num = 1,
+    .count = 97,
+    .key = aes256_set1count97key,
+    .plain = aes256_set1count97plain,
+    .cipher = aes256_set1count97cipher,
+};
+
+const uint8_t aes256_set1count98key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count98plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count98cipher[] = { 0x2B, 0xE1, 0xFA, 0xE5, 0x04, 0x8A, 0x25, 0x58, 0x2A, 0x67, 0x9C, 0xA1, 0x09, 0x05, 0xEB, 0x80 };
+const vector_data_t aes256_set1count98 = {
+    .set_num = 1,
+    .count = 98,
+    .key = aes256_set1count98key,
+    .plain = aes256_set1count98plain,
+    .cipher = aes256_set1count98cipher,
+};
+
+const uint8_t aes256_set1count99key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count99plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count99cipher[] = { 0xDA, 0x86, 0xF2, 0x92, 0xC6, 0xF4, 0x1E, 0xA3, 0x4F, 0xB2, 0x06, 0x8D, 0xF7, 0x5E, 0xCC, 0x29 };
+const vector_data_t aes256_set1count99 = {
+    .set_num = 1,
+    .count = 99,
+    .key = aes256_set1count99key,
+    .plain = aes256_set1count99plain,
+    .cipher = aes256_set1count99cipher,
+};
+
+const uint8_t aes256_set1count100key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count100plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count100cipher[] = { 0x22, 0x0D, 0xF1, 0x9F, 0x85, 0xD6, 0x9B, 0x1B, 0x56, 0x2F, 0xA6, 0x9A, 0x3C, 0x5B, 0xEC, 0xA5 };
+const vector_data_t aes256_set1count100 = {
+    .set_num = 1,
+    .count = 100,
+    .key = aes256_set1count100key,
+    .plain = aes256_set1count100plain,
+    .cipher = aes256_set1count100cipher,
+};
+
+const uint8_t aes256_set1count101key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count101plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count101cipher[] = { 0x1F, 0x11, 0xD5, 0xD0, 0x35, 0x5E, 0x0B, 0x55, 0x6C, 0xCD, 0xB6, 0xC7, 0xF5, 0x08, 0x3B, 0x4D };
+const vector_data_t aes256_set1count101 = {
+    .set_num = 1,
+    .count = 101,
+    .key = aes256_set1count101key,
+    .plain = aes256_set1count101plain,
+    .cipher = aes256_set1count101cipher,
+};
+
+const uint8_t aes256_set1count102key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count102plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count102cipher[] = { 0x62, 0x52, 0x6B, 0x78, 0xBE, 0x79, 0xCB, 0x38, 0x46, 0x33, 0xC9, 0x1F, 0x83, 0xB4, 0x15, 0x1B };
+const vector_data_t aes256_set1count102 = {
+    .set_num = 1,
+    .count = 102,
+    .key = aes256_set1count102key,
+    .plain = aes256_set1count102plain,
+    .cipher = aes256_set1count102cipher,
+};
+
+const uint8_t aes256_set1count103key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count103plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count103cipher[] = { 0x90, 0xDD, 0xBC, 0xB9, 0x50, 0x84, 0x35, 0x92, 0xDD, 0x47, 0xBB, 0xEF, 0x00, 0xFD, 0xC8, 0x76 };
+const vector_data_t aes256_set1count103 = {
+    .set_num = 1,
+    .count = 103,
+    .key = aes256_set1count103key,
+    .plain = aes256_set1count103plain,
+    .cipher = aes256_set1count103cipher,
+};
+
+const uint8_t aes256_set1count104key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count104plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00 };
+const uint8_t aes256_set1count104cipher[] = { 0x2F, 0xD0, 0xE4, 0x1C, 0x5B, 0x84, 0x02, 0x27, 0x73, 0x54, 0xA7, 0x39, 0x1D, 0x26, 0x18, 0xE2 };
+const vector_data_t aes256_set1count104 = {
+    .set_num = 1,
+    .count = 104,
+    .key = aes256_set1count104key,
+    .plain = aes256_set1count104plain,
+    .cipher = aes256_set1count104cipher,
+};
+
+const uint8_t aes256_set1count105key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count105plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00 };
+const uint8_t aes256_set1count105cipher[] = { 0x3C, 0xDF, 0x13, 0xE7, 0x2D, 0xEE, 0x4C, 0x58, 0x1B, 0xAF, 0xEC, 0x70, 0xB8, 0x5F, 0x96, 0x60 };
+const vector_data_t aes256_set1count105 = {
+    .set_num = 1,
+    .count = 105,
+    .key = aes256_set1count105key,
+    .plain = aes256_set1count105plain,
+    .cipher = aes256_set1count105cipher,
+};
+
+const uint8_t aes256_set1count106key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count106plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00 };
+const uint8_t aes256_set1count106cipher[] = { 0xAF, 0xA2, 0xFF, 0xC1, 0x37, 0x57, 0x70, 0x92, 0xE2, 0xB6, 0x54, 0xFA, 0x19, 0x9D, 0x2C, 0x43 };
+const vector_data_t aes256_set1count106 = {
+    .set_num = 1,
+    .count = 106,
+    .key = aes256_set1count106key,
+    .plain = aes256_set1count106plain,
+    .cipher = aes256_set1count106cipher,
+};
+
+const uint8_t aes256_set1count107key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count107plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00 };
+const uint8_t aes256_set1count107cipher[] = { 0x8D, 0x68, 0x3E, 0xE6, 0x3E, 0x60, 0xD2, 0x08, 0xE3, 0x43, 0xCE, 0x48, 0xDB, 0xC4, 0x4C, 0xAC };
+const vector_data_t aes256_set1count107 = {
+    .set_num = 1,
+    .count = 107,
+    .key = aes256_set1count107key,
+    .plain = aes256_set1count107plain,
+    .cipher = aes256_set1count107cipher,
+};
+
+const uint8_t aes256_set1count108key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count108plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00 };
+const uint8_t aes256_set1count108cipher[] = { 0x70, 0x5A, 0x4E, 0xF8, 0xBA, 0x21, 0x33, 0x72, 0x9C, 0x20, 0x18, 0x5C, 0x3D, 0x3A, 0x47, 0x63 };
+const vector_data_t aes256_set1count108 = {
+    .set_num = 1,
+    .count = 108,
+    .key = aes256_set1count108key,
+    .plain = aes256_set1count108plain,
+    .cipher = aes256_set1count108cipher,
+};
+
+const uint8_t aes256_set1count109key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count109plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00 };
+const uint8_t aes256_set1count109cipher[] = { 0x08, 0x61, 0xA8, 0x61, 0xC3, 0xDB, 0x4E, 0x94, 0x19, 0x42, 0x11, 0xB7, 0x7E, 0xD7, 0x61, 0xB9 };
+const vector_data_t aes256_set1count109 = {
+    .set_num = 1,
+    .count = 109,
+    .key = aes256_set1count109key,
+    .plain = aes256_set1count109plain,
+    .cipher = aes256_set1count109cipher,
+};
+
+const uint8_t aes256_set1count110key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count110plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00 };
+const uint8_t aes256_set1count110cipher[] = { 0x4B, 0x00, 0xC2, 0x7E, 0x8B, 0x26, 0xDA, 0x7E, 0xAB, 0x9D, 0x3A, 0x88, 0xDE, 0xC8, 0xB0, 0x31 };
+const vector_data_t aes256_set1count110 = {
+    .set_num = 1,
+    .count = 110,
+    .key = aes256_set1count110key,
+    .plain = aes256_set1count110plain,
+    .cipher = aes256_set1count110cipher,
+};
+
+const uint8_t aes256_set1count111key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count111plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00 };
+const uint8_t aes256_set1count111cipher[] = { 0x5F, 0x39, 0x7B, 0xF0, 0x30, 0x84, 0x82, 0x0C, 0xC8, 0x81, 0x0D, 0x52, 0xE5, 0xB6, 0x66, 0xE9 };
+const vector_data_t aes256_set1count111 = {
+    .set_num = 1,
+    .count = 111,
+    .key = aes256_set1count111key,
+    .plain = aes256_set1count111plain,
+    .cipher = aes256_set1count111cipher,
+};
+
+const uint8_t aes256_set1count112key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count112plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00 };
+const uint8_t aes256_set1count112cipher[] = { 0x63, 0xFA, 0xFA, 0xBB, 0x72, 0xC0, 0x7B, 0xFB, 0xD3, 0xDD, 0xC9, 0xB1, 0x20, 0x31, 0x04, 0xB8 };
+const vector_data_t aes256_set1count112 = {
+    .set_num = 1,
+    .count = 112,
+    .key = aes256_set1count112key,
+    .plain = aes256_set1count112plain,
+    .cipher = aes256_set1count112cipher,
+};
+
+const uint8_t aes256_set1count113key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count113plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00 };
+const uint8_t aes256_set1count113cipher[] = { 0x68, 0x3E, 0x21, 0x40, 0x58, 0x5B, 0x18, 0x45, 0x2D, 0xD4, 0xFF, 0xBB, 0x93, 0xC9, 0x5D, 0xF9 };
+const vector_data_t aes256_set1count113 = {
+    .set_num = 1,
+    .count = 113,
+    .key = aes256_set1count113key,
+    .plain = aes256_set1count113plain,
+    .cipher = aes256_set1count113cipher,
+};
+
+const uint8_t aes256_set1count114key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count114plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00 };
+const uint8_t aes256_set1count114cipher[] = { 0x28, 0x68, 0x94, 0xE4, 0x8E, 0x53, 0x7F, 0x87, 0x63, 0xB5, 0x67, 0x07, 0xD7, 0xD1, 0x55, 0xC8 };
+const vector_data_t aes256_set1count114 = {
+    .set_num = 1,
+    .count = 114,
+    .key = aes256_set1count114key,
+    .plain = aes256_set1count114plain,
+    .cipher = aes256_set1count114cipher,
+};
+
+const uint8_t aes256_set1count115key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count115plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00 };
+const uint8_t aes256_set1count115cipher[] = { 0xA4, 0x23, 0xDE, 0xAB, 0xC1, 0x73, 0xDC, 0xF7, 0xE2, 0xC4, 0xC5, 0x3E, 0x77, 0xD3, 0x7C, 0xD1 };
+const vector_data_t aes256_set1count115 = {
+    .set_num = 1,
+    .count = 115,
+    .key = aes256_set1count115key,
+    .plain = aes256_set1count115plain,
+    .cipher = aes256_set1count115cipher,
+};
+
+const uint8_t aes256_set1count116key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count116plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00 };
+const uint8_t aes256_set1count116cipher[] = { 0xEB, 0x81, 0x68, 0x31, 0x3E, 0x1C, 0xFD, 0xFD, 0xB5, 0xE9, 0x86, 0xD5, 0x42, 0x9C, 0xF1, 0x72 };
+const vector_data_t aes256_set1count116 = {
+    .set_num = 1,
+    .count = 116,
+    .key = aes256_set1count116key,
+    .plain = aes256_set1count116plain,
+    .cipher = aes256_set1count116cipher,
+};
+
+const uint8_t aes256_set1count117key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count117plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00 };
+const uint8_t aes256_set1count117cipher[] = { 0x27, 0x12, 0x7D, 0xAA, 0xFC, 0x9A, 0xCC, 0xD2, 0xFB, 0x33, 0x4E, 0xC3, 0xEB, 0xA5, 0x23, 0x23 };
+const vector_data_t aes256_set1count117 = {
+    .set_num = 1,
+    .count = 117,
+    .key = aes256_set1count117key,
+    .plain = aes256_set1count117plain,
+    .cipher = aes256_set1count117cipher,
+};
+
+const uint8_t aes256_set1count118key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count118plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00 };
+const uint8_t aes256_set1count118cipher[] = { 0xEE, 0x07, 0x15, 0xB9, 0x6F, 0x72, 0xE3, 0xF7, 0xA2, 0x2A, 0x50, 0x64, 0xFC, 0x59, 0x2F, 0x4C };
+const vector_data_t aes256_set1count118 = {
+    .set_num = 1,
+    .count = 118,
+    .key = aes256_set1count118key,
+    .plain = aes256_set1count118plain,
+    .cipher = aes256_set1count118cipher,
+};
+
+const uint8_t aes256_set1count119key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count119plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+const uint8_t aes256_set1count119cipher[] = { 0x29, 0xEE, 0x52, 0x67, 0x70, 0xF2, 0xA1, 0x1D, 0xCF, 0xA9, 0x89, 0xD1, 0xCE, 0x88, 0x83, 0x0F };
+const vector_data_t aes256_set1count119 = {
+    .set_num = 1,
+    .count = 119,
+    .key = aes256_set1count119key,
+    .plain = aes256_set1count119plain,
+    .cipher = aes256_set1count119cipher,
+};
+
+const uint8_t aes256_set1count120key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count120plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80 };
+const uint8_t aes256_set1count120cipher[] = { 0x04, 0x93, 0x37, 0x0E, 0x05, 0x4B, 0x09, 0x87, 0x11, 0x30, 0xFE, 0x49, 0xAF, 0x73, 0x0A, 0x5A };
+const vector_data_t aes256_set1count120 = {
+    .set_num = 1,
+    .count = 120,
+    .key = aes256_set1count120key,
+    .plain = aes256_set1count120plain,
+    .cipher = aes256_set1count120cipher,
+};
+
+const uint8_t aes256_set1count121key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count121plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0 };
+const uint8_t aes256_set1count121cipher[] = { 0x9B, 0x7B, 0x94, 0x0F, 0x6C, 0x50, 0x9F, 0x9E, 0x44, 0xA4, 0xEE, 0x14, 0x04, 0x48, 0xEE, 0x46 };
+const vector_data_t aes256_set1count121 = {
+    .set_num = 1,
+    .count = 121,
+    .key = aes256_set1count121key,
+    .plain = aes256_set1count121plain,
+    .cipher = aes256_set1count121cipher,
+};
+
+const uint8_t aes256_set1count122key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count122plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0 };
+const uint8_t aes256_set1count122cipher[] = { 0x29, 0x15, 0xBE, 0x4A, 0x1E, 0xCF, 0xDC, 0xBE, 0x3E, 0x02, 0x38, 0x11, 0xA1, 0x2B, 0xB6, 0xC7 };
+const vector_data_t aes256_set1count122 = {
+    .set_num = 1,
+    .count = 122,
+    .key = aes256_set1count122key,
+    .plain = aes256_set1count122plain,
+    .cipher = aes256_set1count122cipher,
+};
+
+const uint8_t aes256_set1count123key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count123plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 };
+const uint8_t aes256_set1count123cipher[] = { 0x72, 0x40, 0xE5, 0x24, 0xBC, 0x51, 0xD8, 0xC4, 0xD4, 0x40, 0xB1, 0xBE, 0x55, 0xD1, 0x06, 0x2C };
+const vector_data_t aes256_set1count123 = {
+    .set_num = 1,
+    .count = 123,
+    .key = aes256_set1count123key,
+    .plain = aes256_set1count123plain,
+    .cipher = aes256_set1count123cipher,
+};
+
+const uint8_t aes256_set1count124key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count124plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8 };
+const uint8_t aes256_set1count124cipher[] = { 0xDA, 0x63, 0x03, 0x9D, 0x38, 0xCB, 0x46, 0x12, 0xB2, 0xDC, 0x36, 0xBA, 0x26, 0x68, 0x4B, 0x93 };
+const vector_data_t aes256_set1count124 = {
+    .set_num = 1,
+    .count = 124,
+    .key = aes256_set1count124key,
+    .plain = aes256_set1count124plain,
+    .cipher = aes256_set1count124cipher,
+};
+
+const uint8_t aes256_set1count125key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count125plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC };
+const uint8_t aes256_set1count125cipher[] = { 0x0F, 0x59, 0xCB, 0x5A, 0x4B, 0x52, 0x2E, 0x2A, 0xC5, 0x6C, 0x1A, 0x64, 0xF5, 0x58, 0xAD, 0x9A };
+const vector_data_t aes256_set1count125 = {
+    .set_num = 1,
+    .count = 125,
+    .key = aes256_set1count125key,
+    .plain = aes256_set1count125plain,
+    .cipher = aes256_set1count125cipher,
+};
+
+const uint8_t aes256_set1count126key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count126plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE };
+const uint8_t aes256_set1count126cipher[] = { 0x7B, 0xFE, 0x9D, 0x87, 0x6C, 0x6D, 0x63, 0xC1, 0xD0, 0x35, 0xDA, 0x8F, 0xE2, 0x1C, 0x40, 0x9D };
+const vector_data_t aes256_set1count126 = {
+    .set_num = 1,
+    .count = 126,
+    .key = aes256_set1count126key,
+    .plain = aes256_set1count126plain,
+    .cipher = aes256_set1count126cipher,
+};
+
+const uint8_t aes256_set1count127key[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+const uint8_t aes256_set1count127plain[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+const uint8_t aes256_set1count127cipher[] = { 0xAC, 0xDA, 0xCE, 0x80, 0x78, 0xA3, 0x2B, 0x1A, 0x18, 0x2B, 0xFA, 0x49, 0x87, 0xCA, 0x13, 0x47 };
+const vector_data_t aes256_set1count127 = {
+    .set_num = 1,
+    .count = 127,
+    .key = aes256_set1count127key,
+    .plain = aes256_set1count127plain,
+    .cipher = aes256_set1count127cipher,
+};
+
+const vector_data_t * const aes256_test_vectors[] = {
+    &aes256_set0count0,
+    &aes256_set0count1,
+    &aes256_set0count2,
+    &aes256_set0count3,
+    &aes256_set0count4,
+    &aes256_set0count5,
+    &aes256_set0count6,
+    &aes256_set0count7,
+    &aes256_set0count8,
+    &aes256_set0count9,
+    &aes256_set0count10,
+    &aes256_set0count11,
+    &aes256_set0count12,
+    &aes256_set0count13,
+    &aes256_set0count14,
+    &aes256_set0count15,
+    &aes256_set0count16,
+    &aes256_set0count17,
+    &aes256_set0count18,
+    &aes256_set0count19,
+    &aes256_set0count20,
+    &aes256_set0count21,
+    &aes256_set0count22,
+    &aes256_set0count23,
+    &aes256_set0count24,
+    &aes256_set0count25,
+    &aes256_set0count26,
+    &aes256_set0count27,
+    &aes256_set0count28,
+    &aes256_set0count29,
+    &aes256_set0count30,
+    &aes256_set0count31,
+    &aes256_set0count32,
+    &aes256_set0count33,
+    &aes256_set0count34,
+    &aes256_set0count35,
+    &aes256_set0count36,
+    &aes256_set0count37,
+    &aes256_set0count38,
+    &aes256_set0count39,
+    &aes256_set0count40,
+    &aes256_set0count41,
+    &aes256_set0count42,
+    &aes256_set0count43,
+    &aes256_set0count44,
+    &aes256_set0count45,
+    &aes256_set0count46,
+    &aes256_set0count47,
+    &aes256_set0count48,
+    &aes256_set0count49,
+    &aes256_set0count50,
+    &aes256_set0count51,
+    &aes256_set0count52,
+    &aes256_set0count53,
+    &aes256_set0count54,
+    &aes256_set0count55,
+    &aes256_set0count56,
+    &aes256_set0count57,
+    &aes256_set0count58,
+    &aes256_set0count59,
+    &aes256_set0count60,
+    &aes256_set0count61,
+    &aes256_set0count62,
+    &aes256_set0count63,
+    &aes256_set0count64,
+    &aes256_set0count65,
+    &aes256_set0count66,
+    &aes256_set0count67,
+    &aes256_set0count68,
+    &aes256_set0count69,
+    &aes256_set0count70,
+    &aes256_set0count71,
+    &aes256_set0count72,
+    &aes256_set0count73,
+    &aes256_set0count74,
+    &aes256_set0count75,
+    &aes256_set0count76,
+    &aes256_set0count77,
+    &aes256_set0count78,
+    &aes256_set0count79,
+    &aes256_set0count80,
+    &aes256_set0count81,
+    &aes256_set0count82,
+    &aes256_set0count83,
+    &aes256_set0count84,
+    &aes256_set0count85,
+    &aes256_set0count86,
+    &aes256_set0count87,
+    &aes256_set0count88,
+    &aes256_set0count89,
+    &aes256_set0count90,
+    &aes256_set0count91,
+    &aes256_set0count92,
+    &aes256_set0count93,
+    &aes256_set0count94,
+    &aes256_set0count95,
+    &aes256_set0count96,
+    &aes256_set0count97,
+    &aes256_set0count98,
+    &aes256_set0count99,
+    &aes256_set0count100,
+    &aes256_set0count101,
+    &aes256_set0count102,
+    &aes256_set0count103,
+    &aes256_set0count104,
+    &aes256_set0count105,
+    &aes256_set0count106,
+    &aes256_set0count107,
+    &aes256_set0count108,
+    &aes256_set0count109,
+    &aes256_set0count110,
+    &aes256_set0count111,
+    &aes256_set0count112,
+    &aes256_set0count113,
+    &aes256_set0count114,
+    &aes256_set0count115,
+    &aes256_set0count116,
+    &aes256_set0count117,
+    &aes256_set0count118,
+    &aes256_set0count119,
+    &aes256_set0count120,
+    &aes256_set0count121,
+    &aes256_set0count122,
+    &aes256_set0count123,
+    &aes256_set0count124,
+    &aes256_set0count125,
+    &aes256_set0count126,
+    &aes256_set0count127,
+    &aes256_set0count128,
+    &aes256_set0count129,
+    &aes256_set0count130,
+    &aes256_set0count131,
+    &aes256_set0count132,
+    &aes256_set0count133,
+    &aes256_set0count134,
+    &aes256_set0count135,
+    &aes256_set0count136,
+    &aes256_set0count137,
+    &aes256_set0count138,
+    &aes256_set0count139,
+    &aes256_set0count140,
+    &aes256_set0count141,
+    &aes256_set0count142,
+    &aes256_set0count143,
+    &aes256_set0count144,
+    &aes256_set0count145,
+    &aes256_set0count146,
+    &aes256_set0count147,
+    &aes256_set0count148,
+    &aes256_set0count149,
+    &aes256_set0count150,
+    &aes256_set0count151,
+    &aes256_set0count152,
+    &aes256_set0count153,
+    &aes256_set0count154,
+    &aes256_set0count155,
+    &aes256_set0count156,
+    &aes256_set0count157,
+    &aes256_set0count158,
+    &aes256_set0count159,
+    &aes256_set0count160,
+    &aes256_set0count161,
+    &aes256_set0count162,
+    &aes256_set0count163,
+    &aes256_set0count164,
+    &aes256_set0count165,
+    &aes256_set0count166,
+    &aes256_set0count167,
+    &aes256_set0count168,
+    &aes256_set0count169,
+    &aes256_set0count170,
+    &aes256_set0count171,
+    &aes256_set0count172,
+    &aes256_set0count173,
+    &aes256_set0count174,
+    &aes256_set0count175,
+    &aes256_set0count176,
+    &aes256_set0count177,
+    &aes256_set0count178,
+    &aes256_set0count179,
+    &aes256_set0count180,
+    &aes256_set0count181,
+    &aes256_set0count182,
+    &aes256_set0count183,
+    &aes256_set0count184,
+    &aes256_set0count185,
+    &aes256_set0count186,
+    &aes256_set0count187,
+    &aes256_set0count188,
+    &aes256_set0count189,
+    &aes256_set0count190,
+    &aes256_set0count191,
+    &aes256_set0count192,
+    &aes256_set0count193,
+    &aes256_set0count194,
+    &aes256_set0count195,
+    &aes256_set0count196,
+    &aes256_set0count197,
+    &aes256_set0count198,
+    &aes256_set0count199,
+    &aes256_set0count200,
+    &aes256_set0count201,
+    &aes256_set0count202,
+    &aes256_set0count203,
+    &aes256_set0count204,
+    &aes256_set0count205,
+    &aes256_set0count206,
+    &aes256_set0count207,
+    &aes256_set0count208,
+    &aes256_set0count209,
+    &aes256_set0count210,
+    &aes256_set0count211,
+    &aes256_set0count212,
+    &aes256_set0count213,
+    &aes256_set0count214,
+    &aes256_set0count215,
+    &aes256_set0count216,
+    &aes256_set0count217,
+    &aes256_set0count218,
+    &aes256_set0count219,
+    &aes256_set0count220,
+    &aes256_set0count221,
+    &aes256_set0count222,
+    &aes256_set0count223,
+    &aes256_set0count224,
+    &aes256_set0count225,
+    &aes256_set0count226,
+    &aes256_set0count227,
+    &aes256_set0count228,
+    &aes256_set0count229,
+    &aes256_set0count230,
+    &aes256_set0count231,
+    &aes256_set0count232,
+    &aes256_set0count233,
+    &aes256_set0count234,
+    &aes256_set0count235,
+    &aes256_set0count236,
+    &aes256_set0count237,
+    &aes256_set0count238,
+    &aes256_set0count239,
+    &aes256_set0count240,
+    &aes256_set0count241,
+    &aes256_set0count242,
+    &aes256_set0count243,
+    &aes256_set0count244,
+    &aes256_set0count245,
+    &aes256_set0count246,
+    &aes256_set0count247,
+    &aes256_set0count248,
+    &aes256_set0count249,
+    &aes256_set0count250,
+    &aes256_set0count251,
+    &aes256_set0count252,
+    &aes256_set0count253,
+    &aes256_set0count254,
+    &aes256_set0count255,
+    &aes256_set1count0,
+    &aes256_set1count1,
+    &aes256_set1count2,
+    &aes256_set1count3,
+    &aes256_set1count4,
+    &aes256_set1count5,
+    &aes256_set1count6,
+    &aes256_set1count7,
+    &aes256_set1count8,
+    &aes256_set1count9,
+    &aes256_set1count10,
+    &aes256_set1count11,
+    &aes256_set1count12,
+    &aes256_set1count13,
+    &aes256_set1count14,
+    &aes256_set1count15,
+    &aes256_set1count16,
+    &aes256_set1count17,
+    &aes256_set1count18,
+    &aes256_set1count19,
+    &aes256_set1count20,
+    &aes256_set1count21,
+    &aes256_set1count22,
+    &aes256_set1count23,
+    &aes256_set1count24,
+    &aes256_set1count25,
+    &aes256_set1count26,
+    &aes256_set1count27,
+    &aes256_set1count28,
+    &aes256_set1count29,
+    &aes256_set1count30,
+    &aes256_set1count31,
+    &aes256_set1count32,
+    &aes256_set1count33,
+    &aes256_set1count34,
+    &aes256_set1count35,
+    &aes256_set1count36,
+    &aes256_set1count37,
+    &aes256_set1count38,
+    &aes256_set1count39,
+    &aes256_set1count40,
+    &aes256_set1count41,
+    &aes256_set1count42,
+    &aes256_set1count43,
+    &aes256_set1count44,
+    &aes256_set1count45,
+    &aes256_set1count46,
+    &aes256_set1count47,
+    &aes256_set1count48,
+    &aes256_set1count49,
+    &aes256_set1count50,
+    &aes256_set1count51,
+    &aes256_set1count52,
+    &aes256_set1count53,
+    &aes256_set1count54,
+    &aes256_set1count55,
+    &aes256_set1count56,
+    &aes256_set1count57,
+    &aes256_set1count58,
+    &aes256_set1count59,
+    &aes256_set1count60,
+    &aes256_set1count61,
+    &aes256_set1count62,
+    &aes256_set1count63,
+    &aes256_set1count64,
+    &aes256_set1count65,
+    &aes256_set1count66,
+    &aes256_set1count67,
+    &aes256_set1count68,
+    &aes256_set1count69,
+    &aes256_set1count70,
+    &aes256_set1count71,
+    &aes256_set1count72,
+    &aes256_set1count73,
+    &aes256_set1count74,
+    &aes256_set1count75,
+    &aes256_set1count76,
+    &aes256_set1count77,
+    &aes256_set1count78,
+    &aes256_set1count79,
+    &aes256_set1count80,
+    &aes256_set1count81,
+    &aes256_set1count82,
+    &aes256_set1count83,
+    &aes256_set1count84,
+    &aes256_set1count85,
+    &aes256_set1count86,
+    &aes256_set1count87,
+    &aes256_set1count88,
+    &aes256_set1count89,
+    &aes256_set1count90,
+    &aes256_set1count91,
+    &aes256_set1count92,
+    &aes256_set1count93,
+    &aes256_set1count94,
+    &aes256_set1count95,
+    &aes256_set1count96,
+    &aes256_set1count97,
+    &aes256_set1count98,
+    &aes256_set1count99,
+    &aes256_set1count100,
+    &aes256_set1count101,
+    &aes256_set1count102,
+    &aes256_set1count103,
+    &aes256_set1count104,
+    &aes256_set1count105,
+    &aes256_set1count106,
+    &aes256_set1count107,
+    &aes256_set1count108,
+    &aes256_set1count109,
+    &aes256_set1count110,
+    &aes256_set1count111,
+    &aes256_set1count112,
+    &aes256_set1count113,
+    &aes256_set1count114,
+    &aes256_set1count115,
+    &aes256_set1count116,
+    &aes256_set1count117,
+    &aes256_set1count118,
+    &aes256_set1count119,
+    &aes256_set1count120,
+    &aes256_set1count121,
+    &aes256_set1count122,
+    &aes256_set1count123,
+    &aes256_set1count124,
+    &aes256_set1count125,
+    &aes256_set1count126,
+    &aes256_set1count127,
+};
+
+const char * const aes256_set_names[] = {
+    "ECBVarKey256.rsp",
+    "ECBVarTxt256.rsp",
+};
+
@@ -0,0 +1,427 @@
+
+#include "gcm.h"
+#include "aes-print-block.h"
+
+#include "gcm-test-vectors.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+/* Enough for the plaintext of any of the test vectors. */
+#define MAX_DATA_SIZE           64u
+
+#define LONG_IV_MAX_SIZE        60u
+#define LONG_IV_AAD_SIZE        20u
+#define LONG_IV_PT_SIZE         60u
+
+#define GMAC_MAX_IV_SIZE        16u
+#define GMAC_MAX_MSG_SIZE       64u
+#define GMAC_BATCH_NUM_MSGS     21u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Test vector with an IV length other than 12 bytes. Key, IV, AAD and
+ * plaintext are generated by long_iv_test_data(). Expected results were
+ * calculated with OpenSSL.
+ */
+typedef struct
+{
+    size_t  iv_len;
+    uint8_t ct[LONG_IV_PT_SIZE];
+    uint8_t tag[AES128_GCM_TAG_SIZE];
+} long_iv_test_vector_t;
+
+/*
+ * GMAC test vector. Key, IV and message are generated by gmac_test_data().
+ * Expected results were calculated with OpenSSL.
+ */
+typedef struct
+{
+    size_t  iv_len;
+    size_t  msg_len;
+    uint8_t tag[AES128_GCM_TAG_SIZE];
+} gmac_test_vector_t;
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+static const long_iv_test_vector_t long_iv_test_vectors[] =
+{
+    {
+        8u,
+        {
+            0x05u, 0xEEu, 0xABu, 0x6Fu, 0x60u, 0xF6u, 0x7Fu, 0x23u, 0xF3u, 0xCCu, 0xCFu, 0x85u, 0x71u, 0xF6u, 0x7Au, 0xCCu,
+            0x40u, 0x87u, 0x66u, 0x1Du, 0x19u, 0xF4u, 0xF5u, 0x61u, 0xA1u, 0x0Du, 0x23u, 0x4Au, 0x95u, 0xC3u, 0x6Eu, 0x0Fu,
+            0x0Fu, 0x8Cu, 0xDCu, 0x5Bu, 0xF9u, 0x22u, 0x80u, 0xFAu, 0x76u, 0x33u, 0xBCu, 0x75u, 0x51u, 0x6Du, 0x79u, 0x71u,
+            0xA6u, 0x31u, 0x16u, 0x82u, 0x6Du, 0xC3u, 0x60u, 0x78u, 0x55u, 0xCEu, 0x93u, 0x6Du,
+        },
+        { 0xEEu, 0x14u, 0x41u, 0xBDu, 0xADu, 0xB5u, 0x33u, 0xF7u, 0xFBu, 0x02u, 0x24u, 0x29u, 0x14u, 0xDCu, 0xA1u, 0x08u, },
+    },
+    {
+        60u,
+        {
+            0x2Fu, 0x75u, 0x11u, 0x39u, 0xBFu, 0x0Du, 0x58u, 0xF4u, 0x6Eu, 0x97u, 0xDCu, 0xB5u, 0x4Cu, 0x4Cu, 0xE8u, 0x40u,
+            0x4Du, 0x86u, 0x44u, 0x98u, 0xFDu, 0xEAu, 0x13u, 0x82u, 0x1Cu, 0x77u, 0xE9u, 0x06u, 0x60u, 0x10u, 0xACu, 0x32u,
+            0x75u, 0xB0u, 0x79u, 0x54u, 0x42u, 0xD8u, 0xAEu, 0xB8u, 0x04u, 0x01u, 0xFBu, 0x0Bu, 0x7Eu, 0x7Bu, 0xAAu, 0x31u,
+            0xF4u, 0xCAu, 0x79u, 0x97u, 0xF7u, 0x13u, 0x12u, 0xECu, 0xD3u, 0x76u, 0x53u, 0x7Au,
+        },
+        { 0xE0u, 0x76u, 0x62u, 0x8Cu, 0x8Bu, 0xB5u, 0x4Fu, 0x7Bu, 0xCAu, 0x1Bu, 0xF0u, 0x2Du, 0x54u, 0xEEu, 0x2Bu, 0x65u, },
+    },
+};
+
+static const gmac_test_vector_t gmac_test_vectors[] =
+{
+    { 12u, 0u, { 0x0Eu, 0xD7u, 0x25u, 0x9Au, 0xDDu, 0x10u, 0x11u, 0xE1u, 0x59u, 0xD0u, 0x0Eu, 0x61u, 0xB1u, 0x92u, 0x54u, 0x10u, } },
+    { 12u, 20u, { 0xBBu, 0xE2u, 0x02u, 0x87u, 0x42u, 0xB8u, 0x97u, 0xC7u, 0x98u, 0xAEu, 0x8Du, 0x2Au, 0x7Du, 0x22u, 0x2Bu, 0xE6u, } },
+    { 12u, 64u, { 0xA8u, 0x94u, 0x35u, 0x2Cu, 0x99u, 0x87u, 0x89u, 0x8Fu, 0x6Fu, 0xEAu, 0xFDu, 0x8Cu, 0x85u, 0x21u, 0x86u, 0xE5u, } },
+    { 16u, 20u, { 0xFDu, 0xDDu, 0xEFu, 0x93u, 0x32u, 0x18u, 0xC4u, 0x99u, 0x0Fu, 0x06u, 0xD2u, 0xCCu, 0x1Cu, 0xAFu, 0xC2u, 0x22u, } },
+};
+
+/* Chunk lengths used to split data in the streaming test. */
+static const size_t stream_chunk_lens[] = { 1u, 3u, 16u, 7u, 17u, 5u, 32u };
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static int check_result(const char * p_name, size_t vector, const uint8_t * p_result, const uint8_t * p_expected, size_t len)
+{
+    if (memcmp(p_result, p_expected, len) != 0)
+    {
+        printf("%s test vector %zu failed\n", p_name, vector);
+
+        printf("Result:\n");
+        print_block_hex(p_result, len);
+
+        printf("Expected:\n");
+        print_block_hex(p_expected, len);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Test one-shot aes128_gcm_seal() and aes128_gcm_open() against the NIST
+ * test vectors, including rejection of a modified tag.
+ */
+static int gcm_seal_open_test(void)
+{
+    size_t              i;
+    const gcm_test_vector_t * p_vector;
+    aes128_gcm_key_t    gcm_key;
+    uint8_t             data[MAX_DATA_SIZE];
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    int                 result;
+
+    for (i = 0; i < GCM_NUM_VECTORS; i++)
+    {
+        p_vector = &gcm_test_vectors[i];
+        aes128_gcm_init(&gcm_key, p_vector->p_key);
+
+        aes128_gcm_seal(&gcm_key, p_vector->p_iv, AES128_GCM_IV_SIZE,
+                        p_vector->p_aad, p_vector->aad_len,
+                        data, p_vector->p_pt, p_vector->pt_len,
+                        tag, p_vector->tag_len);
+        result = check_result("aes128_gcm_seal() ciphertext", i, data, p_vector->p_ct, p_vector->pt_len);
+        if (result)
+            return result;
+        result = check_result("aes128_gcm_seal() tag", i, tag, p_vector->p_tag, p_vector->tag_len);
+        if (result)
+            return result;
+
+        /* In-place decryption of the ciphertext in data[]. */
+        if (!aes128_gcm_open(&gcm_key, p_vector->p_iv, AES128_GCM_IV_SIZE,
+                             p_vector->p_aad, p_vector->aad_len,
+                             data, data, p_vector->pt_len,
+                             p_vector->p_tag, p_vector->tag_len))
+        {
+            printf("aes128_gcm_open() test vector %zu failed to verify\n", i);
+            return 1;
+        }
+        result = check_result("aes128_gcm_open() plaintext", i, data, p_vector->p_pt, p_vector->pt_len);
+        if (result)
+            return result;
+
+        tag[0] ^= 0x01u;
+        if (aes128_gcm_open(&gcm_key, p_vector->p_iv, AES128_GCM_IV_SIZE,
+                            p_vector->p_aad, p_vector->aad_len,
+                            data, p_vector->p_ct, p_vector->pt_len,
+                            tag, p_vector->tag_len))
+        {
+            printf("aes128_gcm_open() test vector %zu accepted a bad tag\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Test aes128_gcm_seal() against the NIST test vectors with the key's GHASH
+ * implementation replaced by each compiled-in one, since aes128_gcm_init()
+ * only uses the one gcm_mul_ops_select() chooses on this CPU.
+ */
+static int gcm_ghash_ops_test(void)
+{
+    size_t              i;
+    size_t              ops_index;
+    const gcm_mul_ops_t * p_ops;
+    const gcm_test_vector_t * p_vector;
+    aes128_gcm_key_t    gcm_key;
+    uint8_t             ghash_key[AES_BLOCK_SIZE];
+    uint8_t             data[MAX_DATA_SIZE];
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    int                 result;
+
+    for (ops_index = 0; (p_ops = gcm_mul_ops_get(ops_index)) != NULL; ops_index++)
+    {
+        for (i = 0; i < GCM_NUM_VECTORS; i++)
+        {
+            p_vector = &gcm_test_vectors[i];
+            aes128_gcm_init(&gcm_key, p_vector->p_key);
+            memset(ghash_key, 0, sizeof(ghash_key));
+            aes128_encrypt(ghash_key, gcm_key.key_schedule);
+            gcm_key.p_ghash_ops = p_ops;
+            p_ops->prepare(&gcm_key.ghash_key, ghash_key);
+
+            aes128_gcm_seal(&gcm_key, p_vector->p_iv, AES128_GCM_IV_SIZE,
+                            p_vector->p_aad, p_vector->aad_len,
+                            data, p_vector->p_pt, p_vector->pt_len,
+                            tag, p_vector->tag_len);
+            result = check_result(p_ops->name, i, tag, p_vector->p_tag, p_vector->tag_len);
+            if (result)
+                return result;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Test the streaming interface, with AAD and data split into chunks of
+ * varying length.
+ */
+static int gcm_stream_test(void)
+{
+    size_t              i;
+    size_t              pos;
+    size_t              chunk_len;
+    size_t              chunk_index;
+    const gcm_test_vector_t * p_vector;
+    aes128_gcm_key_t    gcm_key;
+    aes128_gcm_ctx_t    gcm_ctx;
+    uint8_t             data[MAX_DATA_SIZE];
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    int                 result;
+
+    for (i = 0; i < GCM_NUM_VECTORS; i++)
+    {
+        p_vector = &gcm_test_vectors[i];
+        aes128_gcm_init(&gcm_key, p_vector->p_key);
+
+        aes128_gcm_start(&gcm_ctx, &gcm_key, p_vector->p_iv, AES128_GCM_IV_SIZE);
+        chunk_index = i;
+        for (pos = 0; pos < p_vector->aad_len; pos += chunk_len)
+        {
+            chunk_len = stream_chunk_lens[chunk_index++ % (sizeof(stream_chunk_lens) / sizeof(stream_chunk_lens[0]))];
+            if (chunk_len > p_vector->aad_len - pos)
+                chunk_len = p_vector->aad_len - pos;
+            aes128_gcm_aad(&gcm_ctx, p_vector->p_aad + pos, chunk_len);
+        }
+        for (pos = 0; pos < p_vector->pt_len; pos += chunk_len)
+        {
+            chunk_len = stream_chunk_lens[chunk_index++ % (sizeof(stream_chunk_lens) / sizeof(stream_chunk_lens[0]))];
+            if (chunk_len > p_vector->pt_len - pos)
+                chunk_len = p_vector->pt_len - pos;
+            aes128_gcm_encrypt_update(&gcm_ctx, data + pos, p_vector->p_pt + pos, chunk_len);
+        }
+        aes128_gcm_finish(&gcm_ctx, tag, p_vector->tag_len);
+
+        result = check_result("Streaming encrypt ciphertext", i, data, p_vector->p_ct, p_vector->pt_len);
+        if (result)
+            return result;
+        result = check_result("Streaming encrypt tag", i, tag, p_vector->p_tag, p_vector->tag_len);
+        if (result)
+            return result;
+
+        aes128_gcm_start(&gcm_ctx, &gcm_key, p_vector->p_iv, AES128_GCM_IV_SIZE);
+        aes128_gcm_aad(&gcm_ctx, p_vector->p_aad, p_vector->aad_len);
+        for (pos = 0; pos < p_vector->pt_len; pos += chunk_len)
+        {
+            chunk_len = stream_chunk_lens[chunk_index++ % (sizeof(stream_chunk_lens) / sizeof(stream_chunk_lens[0]))];
+            if (chunk_len > p_vector->pt_len - pos)
+                chunk_len = p_vector->pt_len - pos;
+            aes128_gcm_decrypt_update(&gcm_ctx, data + pos, data + pos, chunk_len);
+        }
+        if (!aes128_gcm_verify(&gcm_ctx, p_vector->p_tag, p_vector->tag_len))
+        {
+            printf("Streaming decrypt test vector %zu failed to verify\n", i);
+            return 1;
+        }
+        result = check_result("Streaming decrypt plaintext", i, data, p_vector->p_pt, p_vector->pt_len);
+        if (result)
+            return result;
+    }
+    return 0;
+}
+
+static void long_iv_test_data(uint8_t * p_key, uint8_t * p_iv, uint8_t * p_aad, uint8_t * p_pt)
+{
+    size_t              i;
+
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+        p_key[i] = i * 7u + 1u;
+    for (i = 0; i < LONG_IV_MAX_SIZE; i++)
+        p_iv[i] = 0xA0u ^ i;
+    for (i = 0; i < LONG_IV_AAD_SIZE; i++)
+        p_aad[i] = i;
+    for (i = 0; i < LONG_IV_PT_SIZE; i++)
+        p_pt[i] = 0x30u + i;
+}
+
+/*
+ * Test IV lengths other than 12 bytes, for which the initial counter block is
+ * calculated by GHASH.
+ */
+static int gcm_long_iv_test(void)
+{
+    size_t              i;
+    aes128_gcm_key_t    gcm_key;
+    uint8_t             key[AES128_KEY_SIZE];
+    uint8_t             iv[LONG_IV_MAX_SIZE];
+    uint8_t             aad[LONG_IV_AAD_SIZE];
+    uint8_t             pt[LONG_IV_PT_SIZE];
+    uint8_t             ct[LONG_IV_PT_SIZE];
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    int                 result;
+
+    long_iv_test_data(key, iv, aad, pt);
+    aes128_gcm_init(&gcm_key, key);
+    for (i = 0; i < sizeof(long_iv_test_vectors) / sizeof(long_iv_test_vectors[0]); i++)
+    {
+        aes128_gcm_seal(&gcm_key, iv, long_iv_test_vectors[i].iv_len,
+                        aad, sizeof(aad), ct, pt, sizeof(pt), tag, sizeof(tag));
+        result = check_result("Long IV ciphertext", i, ct, long_iv_test_vectors[i].ct, sizeof(ct));
+        if (result)
+            return result;
+        result = check_result("Long IV tag", i, tag, long_iv_test_vectors[i].tag, sizeof(tag));
+        if (result)
+            return result;
+    }
+    return 0;
+}
+
+static void gmac_test_data(uint8_t * p_key, uint8_t * p_iv, uint8_t * p_msg)
+{
+    size_t              i;
+
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+        p_key[i] = i;
+    for (i = 0; i < GMAC_MAX_IV_SIZE; i++)
+        p_iv[i] = 0x10u + i;
+    for (i = 0; i < GMAC_MAX_MSG_SIZE; i++)
+        p_msg[i] = i * 3u + 1u;
+}
+
+/*
+ * GMAC one-shot, streaming and verification, and batches of messages of mixed
+ * lengths compared with aes128_gmac() of each.
+ */
+static int gmac_test(void)
+{
+    size_t              i;
+    size_t              chunk;
+    size_t              pos;
+    size_t              len;
+    aes128_gcm_key_t    gcm_key;
+    aes128_gcm_ctx_t    ctx;
+    uint8_t             key[AES128_KEY_SIZE];
+    uint8_t             iv[GMAC_MAX_IV_SIZE];
+    uint8_t             msg[GMAC_MAX_MSG_SIZE];
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    uint8_t             batch_ivs[GMAC_BATCH_NUM_MSGS * AES128_GCM_IV_SIZE];
+    const uint8_t     * p_msgs[GMAC_BATCH_NUM_MSGS];
+    size_t              msg_lens[GMAC_BATCH_NUM_MSGS];
+    uint8_t             batch_tags[GMAC_BATCH_NUM_MSGS * AES128_GCM_TAG_SIZE];
+    int                 result;
+
+    gmac_test_data(key, iv, msg);
+    aes128_gcm_init(&gcm_key, key);
+    for (i = 0; i < sizeof(gmac_test_vectors) / sizeof(gmac_test_vectors[0]); i++)
+    {
+        aes128_gmac(&gcm_key, iv, gmac_test_vectors[i].iv_len, msg, gmac_test_vectors[i].msg_len, tag, sizeof(tag));
+        result = check_result("GMAC tag", i, tag, gmac_test_vectors[i].tag, sizeof(tag));
+        if (result)
+            return result;
+
+        aes128_gmac_start(&ctx, &gcm_key, iv, gmac_test_vectors[i].iv_len);
+        for (pos = 0, chunk = 0; pos < gmac_test_vectors[i].msg_len; pos += len, chunk++)
+        {
+            len = stream_chunk_lens[chunk % (sizeof(stream_chunk_lens) / sizeof(stream_chunk_lens[0]))];
+            if (len > gmac_test_vectors[i].msg_len - pos)
+                len = gmac_test_vectors[i].msg_len - pos;
+            aes128_gmac_update(&ctx, msg + pos, len);
+        }
+        if (!aes128_gmac_verify(&ctx, gmac_test_vectors[i].tag, sizeof(tag)))
+        {
+            printf("Streaming GMAC test vector %zu failed to verify\n", i);
+            return 1;
+        }
+    }
+
+    for (i = 0; i < GMAC_BATCH_NUM_MSGS; i++)
+    {
+        memcpy(&batch_ivs[i * AES128_GCM_IV_SIZE], iv, AES128_GCM_IV_SIZE);
+        batch_ivs[i * AES128_GCM_IV_SIZE] ^= i;
+        p_msgs[i] = msg + i;
+        msg_lens[i] = (i * 7u) % (GMAC_MAX_MSG_SIZE - GMAC_BATCH_NUM_MSGS);
+    }
+    aes128_gmac_batch(&gcm_key, batch_ivs, p_msgs, msg_lens, batch_tags, GMAC_BATCH_NUM_MSGS);
+    for (i = 0; i < GMAC_BATCH_NUM_MSGS; i++)
+    {
+        aes128_gmac(&gcm_key, &batch_ivs[i * AES128_GCM_IV_SIZE], AES128_GCM_IV_SIZE, p_msgs[i], msg_lens[i], tag, sizeof(tag));
+        result = check_result("GMAC batch tag", i, &batch_tags[i * AES128_GCM_TAG_SIZE], tag, sizeof(tag));
+        if (result)
+            return result;
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    result = gcm_seal_open_test();
+    if (result)
+        return result;
+
+    result = gcm_ghash_ops_test();
+    if (result)
+        return result;
+
+    result = gcm_stream_test();
+    if (result)
+        return result;
+
+    result = gcm_long_iv_test();
+    if (result)
+        return result;
+
+    result = gmac_test();
+    if (result)
+        return result;
+
+    return 0;
+}
@@ -0,0 +1,293 @@
+
+#include "gcm-key-cache.h"
+#include "aes-print-block.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define TEST_CAPACITY           8u
+
+#define TEST_NUM_THREADS        4u
+#define TEST_THREAD_OPS         2000u
+#define TEST_THREAD_KEYS        50u
+
+#define TEST_MSG_SIZE           40u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+typedef struct
+{
+    aes128_gcm_key_cache_t    * p_cache;
+    unsigned                    seed;
+    int                         result;
+} thread_test_t;
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+static const uint8_t test_iv[AES128_GCM_IV_SIZE] =
+{
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static void make_key(uint8_t p_aes_key[AES128_KEY_SIZE], uint64_t key_id, uint8_t version)
+{
+    size_t      i;
+
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+    {
+        p_aes_key[i] = (uint8_t)(key_id * 31u + i * 7u + version * 101u);
+    }
+}
+
+/*
+ * Check that a key from the cache gives the same tag as one prepared by
+ * aes128_gcm_init().
+ */
+static int check_key(const aes128_gcm_key_t * p_key, const uint8_t p_aes_key[AES128_KEY_SIZE])
+{
+    aes128_gcm_key_t    reference_key;
+    uint8_t             msg[TEST_MSG_SIZE];
+    uint8_t             out[TEST_MSG_SIZE];
+    uint8_t             tag[AES128_GCM_TAG_SIZE];
+    uint8_t             reference_tag[AES128_GCM_TAG_SIZE];
+
+    if (p_key == NULL)
+    {
+        printf("Key cache returned NULL\n");
+        return 1;
+    }
+    memset(msg, 0x5A, sizeof(msg));
+    aes128_gcm_init(&reference_key, p_aes_key);
+    aes128_gcm_seal(&reference_key, test_iv, sizeof(test_iv), NULL, 0, out, msg, sizeof(msg), reference_tag, sizeof(reference_tag));
+    aes128_gcm_seal(p_key, test_iv, sizeof(test_iv), NULL, 0, out, msg, sizeof(msg), tag, sizeof(tag));
+    if (memcmp(tag, reference_tag, sizeof(tag)) != 0)
+    {
+        printf("Key cache key gives wrong tag\n");
+        print_block_hex(tag, sizeof(tag));
+        return 1;
+    }
+    return 0;
+}
+
+static int check_stats(aes128_gcm_key_cache_t * p_cache, const char * p_name, uint64_t hits, uint64_t misses, uint64_t evictions)
+{
+    aes128_gcm_key_cache_stats_t stats;
+
+    aes128_gcm_key_cache_stats(p_cache, &stats);
+    if (stats.hits != hits || stats.misses != misses || stats.evictions != evictions)
+    {
+        printf("%s: hits %llu misses %llu evictions %llu, expected %llu %llu %llu\n", p_name,
+               (unsigned long long)stats.hits, (unsigned long long)stats.misses, (unsigned long long)stats.evictions,
+               (unsigned long long)hits, (unsigned long long)misses, (unsigned long long)evictions);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Hits, LRU eviction, in-use entries not being evicted, key changes and
+ * removal, on a cache of one stripe.
+ */
+static int lru_test(void)
+{
+    aes128_gcm_key_cache_t    * p_cache;
+    aes128_gcm_key_cache_stats_t stats;
+    const aes128_gcm_key_t    * p_keys[TEST_CAPACITY + 1u];
+    const aes128_gcm_key_t    * p_key;
+    uint8_t                     aes_key[AES128_KEY_SIZE];
+    uint64_t                    key_id;
+    int                         result = 0;
+
+    p_cache = aes128_gcm_key_cache_create(TEST_CAPACITY * aes128_gcm_key_cache_entry_size(), 1u);
+    aes128_gcm_key_cache_stats(p_cache, &stats);
+    if (stats.capacity != TEST_CAPACITY || stats.num_stripes != 1u)
+    {
+        printf("Key cache capacity %zu, stripes %zu\n", stats.capacity, stats.num_stripes);
+        return 1;
+    }
+
+    /* Fill the cache, then look up each key again. */
+    for (key_id = 0; key_id < TEST_CAPACITY; key_id++)
+    {
+        make_key(aes_key, key_id, 0);
+        p_keys[key_id] = aes128_gcm_key_cache_acquire(p_cache, key_id, aes_key);
+        result |= check_key(p_keys[key_id], aes_key);
+        aes128_gcm_key_cache_release(p_cache, p_keys[key_id]);
+    }
+    for (key_id = 0; key_id < TEST_CAPACITY; key_id++)
+    {
+        make_key(aes_key, key_id, 0);
+        p_key = aes128_gcm_key_cache_acquire(p_cache, key_id, aes_key);
+        if (p_key != p_keys[key_id])
+        {
+            printf("Key cache miss for key %llu\n", (unsigned long long)key_id);
+            result = 1;
+        }
+        aes128_gcm_key_cache_release(p_cache, p_key);
+    }
+    result |= check_stats(p_cache, "Fill", TEST_CAPACITY, TEST_CAPACITY, 0);
+
+    /* Use key 0 again, so key 1 is the least recently used and evicted. */
+    make_key(aes_key, 0, 0);
+    aes128_gcm_key_cache_release(p_cache, aes128_gcm_key_cache_acquire(p_cache, 0, aes_key));
+    make_key(aes_key, TEST_CAPACITY, 0);
+    p_key = aes128_gcm_key_cache_acquire(p_cache, TEST_CAPACITY, aes_key);
+    result |= check_key(p_key, aes_key);
+    aes128_gcm_key_cache_release(p_cache, p_key);
+    make_key(aes_key, 0, 0);
+    aes128_gcm_key_cache_release(p_cache, aes128_gcm_key_cache_acquire(p_cache, 0, aes_key));
+    result |= check_stats(p_cache, "Evict", TEST_CAPACITY + 2u, TEST_CAPACITY + 1u, 1u);
+    make_key(aes_key, 1u, 0);
+    aes128_gcm_key_cache_release(p_cache, aes128_gcm_key_cache_acquire(p_cache, 1u, aes_key));
+    result |= check_stats(p_cache, "Evicted key", TEST_CAPACITY + 2u, TEST_CAPACITY + 2u, 2u);
+    if (result)
+        return result;
+
+    /* With every entry in use, a new key can't be added. */
+    for (key_id = 0; key_id < TEST_CAPACITY; key_id++)
+    {
+        make_key(aes_key, key_id, 0);
+        p_keys[key_id] = aes128_gcm_key_cache_acquire(p_cache, key_id, aes_key);
+        result |= check_key(p_keys[key_id], aes_key);
+    }
+    make_key(aes_key, 100u, 0);
+    if (aes128_gcm_key_cache_acquire(p_cache, 100u, aes_key) != NULL)
+    {
+        printf("Key cache evicted a key in use\n");
+        result = 1;
+    }
+
+    /* A changed key for an ID in use gives a new entry, while the old one
+     * stays valid until it is released. */
+    aes128_gcm_key_cache_release(p_cache, p_keys[TEST_CAPACITY - 1u]);
+    make_key(aes_key, 2u, 1u);
+    p_key = aes128_gcm_key_cache_acquire(p_cache, 2u, aes_key);
+    result |= check_key(p_key, aes_key);
+    make_key(aes_key, 2u, 0);
+    result |= check_key(p_keys[2], aes_key);
+    aes128_gcm_key_cache_release(p_cache, p_keys[2]);
+    aes128_gcm_key_cache_release(p_cache, p_key);
+
+    /* Removal of a key in use. */
+    aes128_gcm_key_cache_remove(p_cache, 3u);
+    make_key(aes_key, 3u, 0);
+    result |= check_key(p_keys[3], aes_key);
+    p_key = aes128_gcm_key_cache_acquire(p_cache, 3u, aes_key);
+    if (p_key == p_keys[3])
+    {
+        printf("Key cache found removed key\n");
+        result = 1;
+    }
+    result |= check_key(p_key, aes_key);
+    aes128_gcm_key_cache_release(p_cache, p_key);
+    aes128_gcm_key_cache_release(p_cache, p_keys[3]);
+
+    for (key_id = 0; key_id < TEST_CAPACITY - 1u; key_id++)
+    {
+        if (key_id != 2u && key_id != 3u)
+        {
+            aes128_gcm_key_cache_release(p_cache, p_keys[key_id]);
+        }
+    }
+    aes128_gcm_key_cache_destroy(p_cache);
+    return result;
+}
+
+static void * thread_test_run(void * p_arg)
+{
+    thread_test_t             * p_test = p_arg;
+    const aes128_gcm_key_t    * p_key;
+    uint8_t                     aes_key[AES128_KEY_SIZE];
+    uint64_t                    key_id;
+    size_t                      i;
+
+    for (i = 0; i < TEST_THREAD_OPS && p_test->result == 0; i++)
+    {
+        key_id = rand_r(&p_test->seed) % TEST_THREAD_KEYS;
+        make_key(aes_key, key_id, 0);
+        p_key = aes128_gcm_key_cache_acquire(p_test->p_cache, key_id, aes_key);
+        p_test->result = check_key(p_key, aes_key);
+        if (p_key != NULL)
+        {
+            aes128_gcm_key_cache_release(p_test->p_cache, p_key);
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Several threads using more keys than the cache holds, with several stripes.
+ */
+static int thread_test(void)
+{
+    aes128_gcm_key_cache_t    * p_cache;
+    aes128_gcm_key_cache_stats_t stats;
+    pthread_t                   threads[TEST_NUM_THREADS];
+    thread_test_t               tests[TEST_NUM_THREADS];
+    size_t                      i;
+    int                         result = 0;
+
+    p_cache = aes128_gcm_key_cache_create(TEST_THREAD_KEYS / 2u * aes128_gcm_key_cache_entry_size(), 4u);
+    for (i = 0; i < TEST_NUM_THREADS; i++)
+    {
+        tests[i].p_cache = p_cache;
+        tests[i].seed = i + 1u;
+        tests[i].result = 0;
+        pthread_create(&threads[i], NULL, thread_test_run, &tests[i]);
+    }
+    for (i = 0; i < TEST_NUM_THREADS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        result |= tests[i].result;
+    }
+    aes128_gcm_key_cache_stats(p_cache, &stats);
+    if (stats.hits + stats.misses != TEST_NUM_THREADS * TEST_THREAD_OPS || stats.hits == 0)
+    {
+        printf("Key cache thread test: %llu hits, %llu misses\n",
+               (unsigned long long)stats.hits, (unsigned long long)stats.misses);
+        result = 1;
+    }
+    aes128_gcm_key_cache_destroy(p_cache);
+    return result;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    if (aes128_gcm_key_cache_create(aes128_gcm_key_cache_entry_size() - 1u, 0) != NULL)
+    {
+        printf("Key cache created with no entries\n");
+        return 1;
+    }
+
+    result = lru_test();
+    if (result)
+        return result;
+
+    result = thread_test();
+    if (result)
+        return result;
+
+    return 0;
+}
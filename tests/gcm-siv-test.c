@@ -0,0 +1,777 @@
+#include "gcm-siv.h"
+#include "aes-print-block.h"
+
+#include <string.h>
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define MAX_MSG_SIZE            528u
+#define MAX_AAD_SIZE            20u
+
+/* Messages in the batch test: more than two batches of AES_PARALLEL_BLOCKS,
+ * with a partial one at the end. */
+#define BATCH_TEST_MSGS         19u
+#define BATCH_TEST_MAX_SIZE     70u
+#define BATCH_TEST_AAD_SIZE     64u
+#define BATCH_TEST_PT_SIZE      (BATCH_TEST_MSGS + BATCH_TEST_MAX_SIZE)
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+typedef struct
+{
+    uint8_t             key[AES128_KEY_SIZE];
+    uint8_t             nonce[AES128_GCM_SIV_NONCE_SIZE];
+    size_t              aad_len;
+    uint8_t             aad[MAX_AAD_SIZE];
+    size_t              len;
+    uint8_t             plain[MAX_MSG_SIZE];
+    uint8_t             cipher[MAX_MSG_SIZE];
+    uint8_t             tag[AES128_GCM_SIV_TAG_SIZE];
+} siv_vector_t;
+
+/*****************************************************************************
+ * Look-up tables
+ ****************************************************************************/
+
+/* RFC 8452 appendix A */
+static const uint8_t polyval_h[] =
+{
+    0x25, 0x62, 0x93, 0x47, 0x58, 0x92, 0x42, 0x76, 0x1d, 0x31, 0xf8, 0x26, 0xba, 0x4b, 0x75, 0x7b
+};
+
+static const uint8_t polyval_x[] =
+{
+    0x4f, 0x4f, 0x95, 0x66, 0x8c, 0x83, 0xdf, 0xb6, 0x40, 0x17, 0x62, 0xbb, 0x2d, 0x01, 0xa2, 0x62,
+    0xd1, 0xa2, 0x4d, 0xdd, 0x27, 0x21, 0xd0, 0x06, 0xbb, 0xe4, 0x5f, 0x20, 0xd3, 0xc9, 0xf3, 0x62
+};
+
+static const uint8_t polyval_result[] =
+{
+    0xf7, 0xa3, 0xb4, 0x7b, 0x84, 0x61, 0x19, 0xfa, 0xe5, 0xb7, 0x86, 0x6c, 0xf5, 0xe5, 0xb7, 0x7e
+};
+
+static const siv_vector_t siv_vectors[] =
+{
+    /* RFC 8452 appendix C.1 */
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        0u,
+        { 0 },
+        { 0 },
+        {
+            0xdc, 0x20, 0xe2, 0xd8, 0x3f, 0x25, 0x70, 0x5b, 0xb4, 0x9e, 0x43, 0x9e, 0xca, 0x56, 0xde, 0x25
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        8u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0xb5, 0xd8, 0x39, 0x33, 0x0a, 0xc7, 0xb7, 0x86
+        },
+        {
+            0x57, 0x87, 0x82, 0xff, 0xf6, 0x01, 0x3b, 0x81, 0x5b, 0x28, 0x7c, 0x22, 0x49, 0x3a, 0x36, 0x4c
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        12u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x73, 0x23, 0xea, 0x61, 0xd0, 0x59, 0x32, 0x26, 0x00, 0x47, 0xd9, 0x42
+        },
+        {
+            0xa4, 0x97, 0x8d, 0xb3, 0x57, 0x39, 0x1a, 0x0b, 0xc4, 0xfd, 0xec, 0x8b, 0x0d, 0x10, 0x66, 0x39
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        16u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x74, 0x3f, 0x7c, 0x80, 0x77, 0xab, 0x25, 0xf8, 0x62, 0x4e, 0x2e, 0x94, 0x85, 0x79, 0xcf, 0x77
+        },
+        {
+            0x30, 0x3a, 0xaf, 0x90, 0xf6, 0xfe, 0x21, 0x19, 0x9c, 0x60, 0x68, 0x57, 0x74, 0x37, 0xa0, 0xc4
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        32u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x84, 0xe0, 0x7e, 0x62, 0xba, 0x83, 0xa6, 0x58, 0x54, 0x17, 0x24, 0x5d, 0x7e, 0xc4, 0x13, 0xa9,
+            0xfe, 0x42, 0x7d, 0x63, 0x15, 0xc0, 0x9b, 0x57, 0xce, 0x45, 0xf2, 0xe3, 0x93, 0x6a, 0x94, 0x45
+        },
+        {
+            0x1a, 0x8e, 0x45, 0xdc, 0xd4, 0x57, 0x8c, 0x66, 0x7c, 0xd8, 0x68, 0x47, 0xbf, 0x61, 0x55, 0xff
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        48u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x3f, 0xd2, 0x4c, 0xe1, 0xf5, 0xa6, 0x7b, 0x75, 0xbf, 0x23, 0x51, 0xf1, 0x81, 0xa4, 0x75, 0xc7,
+            0xb8, 0x00, 0xa5, 0xb4, 0xd3, 0xdc, 0xf7, 0x01, 0x06, 0xb1, 0xee, 0xa8, 0x2f, 0xa1, 0xd6, 0x4d,
+            0xf4, 0x2b, 0xf7, 0x22, 0x61, 0x22, 0xfa, 0x92, 0xe1, 0x7a, 0x40, 0xee, 0xaa, 0xc1, 0x20, 0x1b
+        },
+        {
+            0x5e, 0x6e, 0x31, 0x1d, 0xbf, 0x39, 0x5d, 0x35, 0xb0, 0xfe, 0x39, 0xc2, 0x71, 0x43, 0x88, 0xf8
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        0u,
+        { 0 },
+        64u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x24, 0x33, 0x66, 0x8f, 0x10, 0x58, 0x19, 0x0f, 0x6d, 0x43, 0xe3, 0x60, 0xf4, 0xf3, 0x5c, 0xd8,
+            0xe4, 0x75, 0x12, 0x7c, 0xfc, 0xa7, 0x02, 0x8e, 0xa8, 0xab, 0x5c, 0x20, 0xf7, 0xab, 0x2a, 0xf0,
+            0x25, 0x16, 0xa2, 0xbd, 0xcb, 0xc0, 0x8d, 0x52, 0x1b, 0xe3, 0x7f, 0xf2, 0x8c, 0x15, 0x2b, 0xba,
+            0x36, 0x69, 0x7f, 0x25, 0xb4, 0xcd, 0x16, 0x9c, 0x65, 0x90, 0xd1, 0xdd, 0x39, 0x56, 0x6d, 0x3f
+        },
+        {
+            0x8a, 0x26, 0x3d, 0xd3, 0x17, 0xaa, 0x88, 0xd5, 0x6b, 0xdf, 0x39, 0x36, 0xdb, 0xa7, 0x5b, 0xb8
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        8u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x1e, 0x6d, 0xab, 0xa3, 0x56, 0x69, 0xf4, 0x27
+        },
+        {
+            0x3b, 0x0a, 0x1a, 0x25, 0x60, 0x96, 0x9c, 0xdf, 0x79, 0x0d, 0x99, 0x75, 0x9a, 0xbd, 0x15, 0x08
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        12u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x29, 0x6c, 0x78, 0x89, 0xfd, 0x99, 0xf4, 0x19, 0x17, 0xf4, 0x46, 0x20
+        },
+        {
+            0x08, 0x29, 0x9c, 0x51, 0x02, 0x74, 0x5a, 0xaa, 0x3a, 0x0c, 0x46, 0x9f, 0xad, 0x9e, 0x07, 0x5a
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        16u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0xe2, 0xb0, 0xc5, 0xda, 0x79, 0xa9, 0x01, 0xc1, 0x74, 0x5f, 0x70, 0x05, 0x25, 0xcb, 0x33, 0x5b
+        },
+        {
+            0x8f, 0x89, 0x36, 0xec, 0x03, 0x9e, 0x4e, 0x4b, 0xb9, 0x7e, 0xbd, 0x8c, 0x44, 0x57, 0x44, 0x1f
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        32u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x62, 0x00, 0x48, 0xef, 0x3c, 0x1e, 0x73, 0xe5, 0x7e, 0x02, 0xbb, 0x85, 0x62, 0xc4, 0x16, 0xa3,
+            0x19, 0xe7, 0x3e, 0x4c, 0xaa, 0xc8, 0xe9, 0x6a, 0x1e, 0xcb, 0x29, 0x33, 0x14, 0x5a, 0x1d, 0x71
+        },
+        {
+            0xe6, 0xaf, 0x6a, 0x7f, 0x87, 0x28, 0x7d, 0xa0, 0x59, 0xa7, 0x16, 0x84, 0xed, 0x34, 0x98, 0xe1
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        48u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x50, 0xc8, 0x30, 0x3e, 0xa9, 0x39, 0x25, 0xd6, 0x40, 0x90, 0xd0, 0x7b, 0xd1, 0x09, 0xdf, 0xd9,
+            0x51, 0x5a, 0x5a, 0x33, 0x43, 0x10, 0x19, 0xc1, 0x7d, 0x93, 0x46, 0x59, 0x99, 0xa8, 0xb0, 0x05,
+            0x32, 0x01, 0xd7, 0x23, 0x12, 0x0a, 0x85, 0x62, 0xb8, 0x38, 0xcd, 0xff, 0x25, 0xbf, 0x9d, 0x1e
+        },
+        {
+            0x6a, 0x8c, 0xc3, 0x86, 0x5f, 0x76, 0x89, 0x7c, 0x2e, 0x4b, 0x24, 0x5c, 0xf3, 0x1c, 0x51, 0xf2
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        64u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x2f, 0x5c, 0x64, 0x05, 0x9d, 0xb5, 0x5e, 0xe0, 0xfb, 0x84, 0x7e, 0xd5, 0x13, 0x00, 0x37, 0x46,
+            0xac, 0xa4, 0xe6, 0x1c, 0x71, 0x1b, 0x5d, 0xe2, 0xe7, 0xa7, 0x7f, 0xfd, 0x02, 0xda, 0x42, 0xfe,
+            0xec, 0x60, 0x19, 0x10, 0xd3, 0x46, 0x7b, 0xb8, 0xb3, 0x6e, 0xbb, 0xae, 0xbc, 0xe5, 0xfb, 0xa3,
+            0x0d, 0x36, 0xc9, 0x5f, 0x48, 0xa3, 0xe7, 0x98, 0x0f, 0x0e, 0x7a, 0xc2, 0x99, 0x33, 0x2a, 0x80
+        },
+        {
+            0xcd, 0xc4, 0x6a, 0xe4, 0x75, 0x56, 0x3d, 0xe0, 0x37, 0x00, 0x1e, 0xf8, 0x4a, 0xe2, 0x17, 0x44
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        12u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        4u,
+        {
+            0x02, 0x00, 0x00, 0x00
+        },
+        {
+            0xa8, 0xfe, 0x3e, 0x87
+        },
+        {
+            0x07, 0xeb, 0x1f, 0x84, 0xfb, 0x28, 0xf8, 0xcb, 0x73, 0xde, 0x8e, 0x99, 0xe2, 0xf4, 0x8a, 0x14
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        20u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00
+        },
+        18u,
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x00
+        },
+        {
+            0x44, 0xd0, 0xaa, 0xf6, 0xfb, 0x2f, 0x1f, 0x34, 0xad, 0xd5, 0xe8, 0x06, 0x4e, 0x83, 0xe1, 0x2a,
+            0x2a, 0xda
+        },
+        {
+            0xbf, 0xf9, 0xb2, 0xef, 0x00, 0xfb, 0x47, 0x92, 0x0c, 0xc7, 0x2a, 0x0c, 0x0f, 0x13, 0xb9, 0xfd
+        }
+    },
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        18u,
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00
+        },
+        20u,
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x00, 0x00, 0x00
+        },
+        {
+            0x6b, 0xb0, 0xfe, 0xcf, 0x5d, 0xed, 0x9b, 0x77, 0xf9, 0x02, 0xc7, 0xd5, 0xda, 0x23, 0x6a, 0x43,
+            0x91, 0xdd, 0x02, 0x97
+        },
+        {
+            0x24, 0xaf, 0xc9, 0x80, 0x5e, 0x97, 0x6f, 0x45, 0x1e, 0x6d, 0x87, 0xf6, 0xfe, 0x10, 0x65, 0x14
+        }
+    },
+    {
+        {
+            0xee, 0x8e, 0x1e, 0xd9, 0xff, 0x25, 0x40, 0xae, 0x8f, 0x2b, 0xa9, 0xf5, 0x0b, 0xc2, 0xf2, 0x7c
+        },
+        {
+            0x75, 0x2a, 0xba, 0xd3, 0xe0, 0xaf, 0xb5, 0xf4, 0x34, 0xdc, 0x43, 0x10
+        },
+        7u,
+        {
+            0x65, 0x78, 0x61, 0x6d, 0x70, 0x6c, 0x65
+        },
+        11u,
+        {
+            0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64
+        },
+        {
+            0x5d, 0x34, 0x9e, 0xad, 0x17, 0x5e, 0xf6, 0xb1, 0xde, 0xf6, 0xfd
+        },
+        {
+            0x4f, 0xbc, 0xde, 0xb7, 0xe4, 0x79, 0x3f, 0x4a, 0x1d, 0x7e, 0x4f, 0xaa, 0x70, 0x10, 0x0a, 0xf1
+        }
+    },
+    /* Generated with an independent implementation of RFC 8452, using
+     * OpenSSL's AES. The plain text is longer than POLYVAL and CTR process
+     * per chunk. */
+    {
+        {
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        1u,
+        {
+            0x01
+        },
+        528u,
+        {
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x7c, 0x46, 0x79, 0x88, 0x43, 0x1b, 0x51, 0x64, 0xb1, 0xbd, 0xe2, 0x6d, 0xef, 0xed, 0xee, 0xc6,
+            0x30, 0x6a, 0xa6, 0x5f, 0x90, 0xad, 0x2e, 0x6d, 0xb8, 0x5f, 0x2e, 0xe2, 0x1d, 0x33, 0x90, 0x36,
+            0x8b, 0xbf, 0xf7, 0xf9, 0xde, 0xb4, 0x28, 0x1c, 0x82, 0x1a, 0x3c, 0xe6, 0x90, 0x7d, 0xb3, 0x5f,
+            0x3c, 0x11, 0x4f, 0x1c, 0xf5, 0x14, 0x2a, 0x38, 0x72, 0xf8, 0xda, 0x05, 0x5f, 0xe4, 0xe3, 0xbf,
+            0x1c, 0xf7, 0x97, 0x65, 0xdc, 0x7c, 0xc8, 0x7b, 0x65, 0xc8, 0x76, 0x7a, 0x1b, 0xbf, 0xb2, 0xc2,
+            0xf8, 0x9c, 0x8c, 0x46, 0xff, 0x65, 0x65, 0x03, 0x16, 0x23, 0x21, 0x1b, 0x5b, 0x4f, 0x2f, 0x70,
+            0xaa, 0xb3, 0x14, 0xd2, 0xf3, 0x9a, 0xac, 0x9f, 0x55, 0xb0, 0xfb, 0xee, 0x14, 0x46, 0xd0, 0xf3,
+            0xf9, 0xe8, 0xca, 0xb7, 0x8e, 0x06, 0x76, 0x47, 0x8c, 0x7d, 0x85, 0xf3, 0xf4, 0x30, 0x3b, 0xcc,
+            0x83, 0xd3, 0xff, 0x72, 0x4d, 0x40, 0xa5, 0x02, 0x04, 0xbd, 0xec, 0x9a, 0x88, 0xa2, 0xec, 0x53,
+            0xaf, 0x3e, 0xd8, 0xfa, 0x22, 0xcb, 0x18, 0x4c, 0x5b, 0x86, 0x02, 0x54, 0x45, 0x0e, 0xf1, 0x75,
+            0x50, 0x78, 0xca, 0xe6, 0xa0, 0x99, 0x41, 0x1e, 0x87, 0xe0, 0x18, 0x24, 0x95, 0x0d, 0x6c, 0x8c,
+            0xef, 0xcb, 0x42, 0x5b, 0xb9, 0x07, 0xd4, 0x5e, 0xee, 0x2d, 0x26, 0x60, 0xdc, 0x9a, 0xa9, 0xbb,
+            0x95, 0x73, 0x42, 0x57, 0x7a, 0xb7, 0xca, 0x42, 0x80, 0x59, 0x06, 0xdf, 0xf9, 0x05, 0x89, 0xe6,
+            0x63, 0x2c, 0x94, 0x73, 0xa5, 0x3a, 0xa7, 0x98, 0xf8, 0x6a, 0x93, 0x0e, 0xb4, 0x91, 0xad, 0xa5,
+            0x0d, 0xe3, 0x1b, 0xbb, 0x25, 0x62, 0x3a, 0x2f, 0xf1, 0x75, 0x19, 0xe8, 0x7d, 0xf1, 0x17, 0x0f,
+            0x2d, 0x64, 0xa0, 0xa4, 0xd2, 0xfa, 0x7b, 0xb0, 0x7c, 0x60, 0x20, 0xf5, 0x97, 0x80, 0x67, 0xc4,
+            0xd9, 0x4c, 0x5e, 0xcb, 0xb1, 0x17, 0x3b, 0xfd, 0xf3, 0xe9, 0xff, 0xbd, 0x69, 0x7c, 0x82, 0x20,
+            0x0d, 0x2d, 0x57, 0x7c, 0xc5, 0x96, 0x7a, 0x4b, 0xe9, 0x98, 0x2e, 0x91, 0xc7, 0x7d, 0x7e, 0xa8,
+            0x3e, 0x8f, 0x06, 0xd1, 0x3c, 0x07, 0xec, 0x9c, 0xa7, 0xde, 0xe1, 0xd7, 0x90, 0x04, 0xd4, 0x97,
+            0x90, 0xe7, 0xcc, 0xde, 0xb8, 0x86, 0x21, 0xc6, 0x38, 0xb9, 0xdf, 0xbc, 0xd5, 0xf7, 0x29, 0x24,
+            0x91, 0x7a, 0x36, 0xab, 0xa4, 0x66, 0x21, 0x85, 0x04, 0xc1, 0x79, 0x9e, 0x5d, 0x29, 0x3d, 0x8c,
+            0xd8, 0x91, 0x8a, 0x6c, 0x26, 0xa1, 0x35, 0xfd, 0x5e, 0x5e, 0x20, 0x54, 0xbe, 0x55, 0x52, 0xe4,
+            0xff, 0xf9, 0xe0, 0x74, 0xdf, 0xd1, 0x99, 0x1f, 0xa1, 0xea, 0x47, 0xb7, 0xdd, 0xc7, 0x53, 0xbe,
+            0x60, 0x0b, 0x55, 0x2b, 0xa8, 0xee, 0x32, 0xc9, 0xe5, 0x1c, 0x55, 0x36, 0x4f, 0xed, 0x9a, 0x05,
+            0xc5, 0x98, 0x5e, 0x8a, 0xef, 0x45, 0xcb, 0x44, 0x23, 0xcf, 0x20, 0xad, 0x87, 0x35, 0x4f, 0xe3,
+            0x65, 0xe3, 0x07, 0x43, 0x97, 0xd0, 0xbd, 0x67, 0x84, 0x29, 0x84, 0x67, 0x7a, 0xb4, 0xc8, 0xef,
+            0x90, 0xfd, 0xfb, 0xd0, 0x95, 0x52, 0x67, 0xc6, 0xaa, 0xb8, 0x6a, 0x92, 0x7d, 0x7c, 0xd9, 0xc7,
+            0xaf, 0x95, 0xd5, 0x6c, 0x96, 0xe6, 0x60, 0xa1, 0x68, 0x67, 0x54, 0x9a, 0xe2, 0x31, 0x99, 0x3e,
+            0x1f, 0x2d, 0xf7, 0x4c, 0xcf, 0xe6, 0x97, 0x22, 0x2f, 0x9d, 0x3c, 0x1b, 0xe0, 0xb6, 0x37, 0x24,
+            0x94, 0x1f, 0x33, 0xe9, 0x44, 0x40, 0x07, 0x45, 0x02, 0xba, 0x12, 0x68, 0x43, 0x0b, 0x9c, 0x19,
+            0x8d, 0x5c, 0xe2, 0x28, 0xa1, 0xf4, 0xc9, 0xbf, 0xf2, 0x5c, 0xca, 0x79, 0x6d, 0xfa, 0x44, 0x05,
+            0xee, 0xb9, 0xd7, 0x9a, 0x95, 0x44, 0x67, 0x41, 0x04, 0x8e, 0xf2, 0x13, 0xf4, 0x65, 0x84, 0xf3,
+            0x26, 0xff, 0xde, 0xff, 0x0d, 0x06, 0xeb, 0x97, 0xaf, 0x34, 0x78, 0xb5, 0x6f, 0xe5, 0xa4, 0xfc
+        },
+        {
+            0x0d, 0x16, 0xcb, 0x3a, 0x6d, 0x74, 0x78, 0xd5, 0x45, 0x56, 0x09, 0xd6, 0x50, 0x17, 0x62, 0x72
+        }
+    }
+};
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+/* Key, nonce, associated data and plain text for the batch test. */
+static void batch_data_init(uint8_t p_key[AES128_KEY_SIZE], uint8_t p_nonce[AES128_GCM_SIV_NONCE_SIZE],
+                            uint8_t p_aad[BATCH_TEST_AAD_SIZE], uint8_t p_pt[BATCH_TEST_PT_SIZE])
+{
+    size_t              i;
+
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+    {
+        p_key[i] = i * 17u + 5u;
+    }
+    for (i = 0; i < AES128_GCM_SIV_NONCE_SIZE; i++)
+    {
+        p_nonce[i] = 0xA0u + i;
+    }
+    for (i = 0; i < BATCH_TEST_AAD_SIZE; i++)
+    {
+        p_aad[i] = i * 3u + 1u;
+    }
+    for (i = 0; i < BATCH_TEST_PT_SIZE; i++)
+    {
+        p_pt[i] = i * 7u + 2u;
+    }
+}
+
+/* POLYVAL in one call, and continued over two calls. */
+static int polyval_test(void)
+{
+    gcm_polyval_key_t   key;
+    uint8_t             state[AES_BLOCK_SIZE];
+
+    gcm_polyval_prepare(&key, polyval_h);
+    memset(state, 0, sizeof(state));
+    gcm_polyval_blocks(state, polyval_x, 2u, &key);
+    if (memcmp(state, polyval_result, AES_BLOCK_SIZE) != 0)
+    {
+        printf("POLYVAL failed\n");
+        print_block_hex(state, AES_BLOCK_SIZE);
+        return 1;
+    }
+
+    memset(state, 0, sizeof(state));
+    gcm_polyval_blocks(state, polyval_x, 1u, &key);
+    gcm_polyval_blocks(state, polyval_x + AES_BLOCK_SIZE, 1u, &key);
+    if (memcmp(state, polyval_result, AES_BLOCK_SIZE) != 0)
+    {
+        printf("POLYVAL continued failed\n");
+        print_block_hex(state, AES_BLOCK_SIZE);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Seal and open a vector, in-place and not, and check that a wrong tag is
+ * rejected with the output cleared.
+ */
+static int vector_check(size_t index, const siv_vector_t * p_vector)
+{
+    static uint8_t      ct[MAX_MSG_SIZE];
+    static uint8_t      out[MAX_MSG_SIZE];
+    static const uint8_t zero[MAX_MSG_SIZE];
+    aes128_gcm_siv_key_t key;
+    uint8_t             tag[AES128_GCM_SIV_TAG_SIZE];
+    size_t              len = p_vector->len;
+
+    aes128_gcm_siv_init(&key, p_vector->key);
+    memset(tag, 0, sizeof(tag));
+    aes128_gcm_siv_seal(&key, p_vector->nonce, p_vector->aad, p_vector->aad_len, ct, p_vector->plain, len, tag);
+    if ((len && memcmp(ct, p_vector->cipher, len) != 0) || memcmp(tag, p_vector->tag, AES128_GCM_SIV_TAG_SIZE) != 0)
+    {
+        printf("GCM-SIV vector %zu seal failed\n", index);
+        print_block_hex(ct, len);
+        print_block_hex(tag, AES128_GCM_SIV_TAG_SIZE);
+        return 1;
+    }
+
+    if (len)
+    {
+        memcpy(out, p_vector->plain, len);
+    }
+    aes128_gcm_siv_seal(&key, p_vector->nonce, p_vector->aad, p_vector->aad_len, out, out, len, tag);
+    if ((len && memcmp(out, p_vector->cipher, len) != 0) || memcmp(tag, p_vector->tag, AES128_GCM_SIV_TAG_SIZE) != 0)
+    {
+        printf("GCM-SIV vector %zu in-place seal failed\n", index);
+        return 1;
+    }
+    if (!aes128_gcm_siv_open(&key, p_vector->nonce, p_vector->aad, p_vector->aad_len, out, out, len, p_vector->tag)
+        || (len && memcmp(out, p_vector->plain, len) != 0))
+    {
+        printf("GCM-SIV vector %zu open failed\n", index);
+        print_block_hex(out, len);
+        return 1;
+    }
+
+    memcpy(tag, p_vector->tag, AES128_GCM_SIV_TAG_SIZE);
+    tag[0] ^= 0x01u;
+    memset(out, 0xAAu, sizeof(out));
+    if (aes128_gcm_siv_open(&key, p_vector->nonce, p_vector->aad, p_vector->aad_len, out, p_vector->cipher, len, tag)
+        || memcmp(out, zero, len) != 0)
+    {
+        printf("GCM-SIV vector %zu open accepted a wrong tag\n", index);
+        return 1;
+    }
+    return 0;
+}
+
+static int vectors_test(void)
+{
+    size_t              i;
+    int                 result;
+
+    for (i = 0; i < sizeof(siv_vectors) / sizeof(siv_vectors[0]); i++)
+    {
+        result = vector_check(i, &siv_vectors[i]);
+        if (result)
+        {
+            return result;
+        }
+    }
+    return 0;
+}
+
+/*
+ * The batch functions agree with the one-shot ones for messages of mixed
+ * lengths, and a wrong tag in a batch only fails its own message.
+ */
+static int batch_test(void)
+{
+    uint8_t             key_bytes[AES128_KEY_SIZE];
+    uint8_t             nonce[AES128_GCM_SIV_NONCE_SIZE];
+    uint8_t             aad[BATCH_TEST_AAD_SIZE];
+    uint8_t             pt[BATCH_TEST_PT_SIZE];
+    aes128_gcm_siv_key_t key;
+    uint8_t             nonces[BATCH_TEST_MSGS * AES128_GCM_SIV_NONCE_SIZE];
+    uint8_t             outs[BATCH_TEST_MSGS][BATCH_TEST_MAX_SIZE];
+    uint8_t             ct[BATCH_TEST_MAX_SIZE];
+    uint8_t             tags[BATCH_TEST_MSGS * AES128_GCM_SIV_TAG_SIZE];
+    uint8_t             tag[AES128_GCM_SIV_TAG_SIZE];
+    const uint8_t     * p_aads[BATCH_TEST_MSGS];
+    size_t              aad_lens[BATCH_TEST_MSGS];
+    uint8_t           * p_outs[BATCH_TEST_MSGS];
+    const uint8_t     * p_ins[BATCH_TEST_MSGS];
+    size_t              lens[BATCH_TEST_MSGS];
+    bool                valid[BATCH_TEST_MSGS];
+    size_t              i;
+
+    batch_data_init(key_bytes, nonce, aad, pt);
+    aes128_gcm_siv_init(&key, key_bytes);
+    for (i = 0; i < BATCH_TEST_MSGS; i++)
+    {
+        memcpy(&nonces[i * AES128_GCM_SIV_NONCE_SIZE], nonce, AES128_GCM_SIV_NONCE_SIZE);
+        nonces[i * AES128_GCM_SIV_NONCE_SIZE] = i;
+        p_aads[i] = aad + i;
+        aad_lens[i] = (i * 5u) % 23u;
+        p_outs[i] = outs[i];
+        p_ins[i] = pt + i;
+        lens[i] = (i * 13u) % (BATCH_TEST_MAX_SIZE + 1u);
+    }
+
+    aes128_gcm_siv_seal_batch(&key, nonces, p_aads, aad_lens, p_outs, p_ins, lens, tags, BATCH_TEST_MSGS);
+    for (i = 0; i < BATCH_TEST_MSGS; i++)
+    {
+        aes128_gcm_siv_seal(&key, &nonces[i * AES128_GCM_SIV_NONCE_SIZE], p_aads[i], aad_lens[i],
+                            ct, p_ins[i], lens[i], tag);
+        if (memcmp(outs[i], ct, lens[i]) != 0 || memcmp(&tags[i * AES128_GCM_SIV_TAG_SIZE], tag, AES128_GCM_SIV_TAG_SIZE) != 0)
+        {
+            printf("GCM-SIV batch seal message %zu failed\n", i);
+            return 1;
+        }
+    }
+
+    /* No associated data at all. */
+    aes128_gcm_siv_seal_batch(&key, nonces, NULL, NULL, p_outs, p_ins, lens, tags, BATCH_TEST_MSGS);
+    aes128_gcm_siv_seal(&key, &nonces[5u * AES128_GCM_SIV_NONCE_SIZE], NULL, 0, ct, p_ins[5], lens[5], tag);
+    if (memcmp(outs[5], ct, lens[5]) != 0 || memcmp(&tags[5u * AES128_GCM_SIV_TAG_SIZE], tag, AES128_GCM_SIV_TAG_SIZE) != 0)
+    {
+        printf("GCM-SIV batch seal without AAD failed\n");
+        return 1;
+    }
+    if (!aes128_gcm_siv_open_batch(&key, nonces, NULL, NULL, p_outs, (const uint8_t * const *)p_outs, lens,
+                                   tags, NULL, BATCH_TEST_MSGS))
+    {
+        printf("GCM-SIV batch open without AAD failed\n");
+        return 1;
+    }
+
+    /* In-place, with one wrong tag. */
+    aes128_gcm_siv_seal_batch(&key, nonces, p_aads, aad_lens, p_outs, p_ins, lens, tags, BATCH_TEST_MSGS);
+    tags[10u * AES128_GCM_SIV_TAG_SIZE + 3u] ^= 0x10u;
+    if (aes128_gcm_siv_open_batch(&key, nonces, p_aads, aad_lens, p_outs, (const uint8_t * const *)p_outs, lens,
+                                  tags, valid, BATCH_TEST_MSGS))
+    {
+        printf("GCM-SIV batch open accepted a wrong tag\n");
+        return 1;
+    }
+    memset(ct, 0, sizeof(ct));
+    for (i = 0; i < BATCH_TEST_MSGS; i++)
+    {
+        if (valid[i] != (i != 10u) || memcmp(outs[i], valid[i] ? p_ins[i] : ct, lens[i]) != 0)
+        {
+            printf("GCM-SIV batch open message %zu failed\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    const aes_engine_t * p_engine;
+    size_t      engine;
+    int         result;
+
+    (void)argc;
+    (void)argv;
+
+    for (engine = 0; (p_engine = aes_engine_get(engine)) != NULL; engine++)
+    {
+        aes_engine_set(p_engine);
+
+        result = polyval_test();
+        if (result == 0)
+            result = vectors_test();
+        if (result == 0)
+            result = batch_test();
+        if (result)
+        {
+            printf("Failed with AES engine %s\n", p_engine->name);
+            return result;
+        }
+    }
+    return 0;
+}
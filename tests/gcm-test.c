@@ -1,10 +1,12 @@
 
 #include "gcm-mul.h"
+#include "gcm-mul-ops.h"
 #include "aes-min.h"
 #include "aes-print-block.h"
 
 #include "gcm-test-vectors.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <endian.h>
@@ -15,6 +17,10 @@
 
 #define SIMPLE_IV_SIZE          12u
 
+/* Enough for the padded AAD, padded plaintext and lengths block of any of the
+ * test vectors. */
+#define GHASH_BUFFER_SIZE       256u
+
 #define MAX(A, B)               ((A) >= (B) ? (A) : (B))
 #define MIN(A, B)               ((A) <= (B) ? (A) : (B))
 
@@ -22,13 +28,6 @@
  * Types
  ****************************************************************************/
 
-typedef enum
-{
-    TEST_GCM_MUL_BIT_BY_BIT,
-    TEST_GCM_MUL_TABLE4,
-    TEST_GCM_MUL_TABLE8,
-} gcm_mul_implementation_t;
-
 typedef struct
 {
     uint8_t a[AES_BLOCK_SIZE];
@@ -148,6 +147,7 @@ static int gcm_mul_test(void)
 static int gcm_mul_table8_test_one(const uint8_t a[AES_BLOCK_SIZE], const uint8_t b[AES_BLOCK_SIZE], const uint8_t correct_result[AES_BLOCK_SIZE])
 {
     gcm_mul_table8_t mul_table;
+    gcm_mul_table8_lazy_t mul_table_lazy;
     size_t  j;
     int     result;
     uint8_t gmul_out[AES_BLOCK_SIZE];
@@ -162,6 +162,16 @@ static int gcm_mul_table8_test_one(const uint8_t a[AES_BLOCK_SIZE], const uint8_
     gcm_mul_table8(gmul_out, &mul_table);
 
     result = memcmp(gmul_out, correct_result, AES_BLOCK_SIZE) ? 1 : 0;
+    if (result == 0)
+    {
+        /* The lazily built table must give the same result. */
+        gcm_mul_prepare_table8_lazy(&mul_table_lazy, b);
+        memcpy(gmul_out, a, AES_BLOCK_SIZE);
+        gcm_mul_table8_lazy(gmul_out, &mul_table_lazy);
+        result = memcmp(gmul_out, correct_result, AES_BLOCK_SIZE) ? 1 : 0;
+        if (result)
+            printf("gcm_mul_table8_lazy() failed\n");
+    }
     if (result)
     {
         printf("gcm_mul_prepare_table8() result:\n");
@@ -274,7 +284,130 @@ static int gcm_mul_table4_test(void)
     return 0;
 }
 
-static int gcm_test(gcm_mul_implementation_t mul_impl)
+static int gcm_mul_table4_shoup_test_one(const uint8_t a[AES_BLOCK_SIZE], const uint8_t b[AES_BLOCK_SIZE], const uint8_t correct_result[AES_BLOCK_SIZE])
+{
+    gcm_mul_table4_shoup_t mul_table;
+    int     result;
+    uint8_t gmul_out[AES_BLOCK_SIZE];
+
+    /* Prepare the table. */
+    gcm_mul_prepare_table4_shoup(&mul_table, b);
+
+    /* Do the multiply. */
+    memcpy(gmul_out, a, AES_BLOCK_SIZE);
+    gcm_mul_table4_shoup(gmul_out, &mul_table);
+
+    result = memcmp(gmul_out, correct_result, AES_BLOCK_SIZE) ? 1 : 0;
+    if (result)
+    {
+        printf("gcm_mul_table4_shoup() a:\n");
+        print_block_hex(a, AES_BLOCK_SIZE);
+
+        printf("gcm_mul_table4_shoup() b:\n");
+        print_block_hex(b, AES_BLOCK_SIZE);
+
+        printf("gcm_mul_table4_shoup() expected:\n");
+        print_block_hex(correct_result, AES_BLOCK_SIZE);
+
+        printf("gcm_mul_table4_shoup() result:\n");
+        print_block_hex(gmul_out, AES_BLOCK_SIZE);
+
+        return result;
+    }
+    return 0;
+}
+
+static int gcm_mul_table4_shoup_test(void)
+{
+    size_t  i;
+    int     result;
+
+    for (i = 0; i < (sizeof(mul_test_vectors)/sizeof(mul_test_vectors[0])); i++)
+    {
+        result = gcm_mul_table4_shoup_test_one(mul_test_vectors[i].a, mul_test_vectors[i].b, mul_test_vectors[i].result);
+        if (result)
+            return result;
+
+        /* Swapped. */
+        result = gcm_mul_table4_shoup_test_one(mul_test_vectors[i].b, mul_test_vectors[i].a, mul_test_vectors[i].result);
+        if (result)
+            return result;
+    }
+    return 0;
+}
+
+static int gcm_mul_clmul_test_one(const uint8_t a[AES_BLOCK_SIZE], const uint8_t b[AES_BLOCK_SIZE], const uint8_t correct_result[AES_BLOCK_SIZE])
+{
+    gcm_mul_clmul_t mul_ctx;
+    int     result;
+    uint8_t gmul_out[AES_BLOCK_SIZE];
+
+    /* Prepare the key data. */
+    gcm_mul_prepare_clmul(&mul_ctx, b);
+
+    /* Do the multiply. */
+    memcpy(gmul_out, a, AES_BLOCK_SIZE);
+    gcm_mul_clmul(gmul_out, &mul_ctx);
+
+    result = memcmp(gmul_out, correct_result, AES_BLOCK_SIZE) ? 1 : 0;
+    if (result)
+    {
+        printf("gcm_mul_clmul() a:\n");
+        print_block_hex(a, AES_BLOCK_SIZE);
+
+        printf("gcm_mul_clmul() b:\n");
+        print_block_hex(b, AES_BLOCK_SIZE);
+
+        printf("gcm_mul_clmul() expected:\n");
+        print_block_hex(correct_result, AES_BLOCK_SIZE);
+
+        printf("gcm_mul_clmul() result:\n");
+        print_block_hex(gmul_out, AES_BLOCK_SIZE);
+
+        return result;
+    }
+    return 0;
+}
+
+static int gcm_mul_clmul_test(void)
+{
+    size_t  i;
+    int     result;
+
+    for (i = 0; i < (sizeof(mul_test_vectors)/sizeof(mul_test_vectors[0])); i++)
+    {
+        result = gcm_mul_clmul_test_one(mul_test_vectors[i].a, mul_test_vectors[i].b, mul_test_vectors[i].result);
+        if (result)
+            return result;
+
+        /* Swapped. */
+        result = gcm_mul_clmul_test_one(mul_test_vectors[i].b, mul_test_vectors[i].a, mul_test_vectors[i].result);
+        if (result)
+            return result;
+    }
+    return 0;
+}
+
+/*
+ * gcm_mul_table8_lazy() isn't in the registry, since it modifies its table,
+ * so wrap it to run the GCM test vectors through it too.
+ */
+static void table8_lazy_prepare(void * p_ctx, const uint8_t p_key[AES_BLOCK_SIZE])
+{
+    gcm_mul_prepare_table8_lazy(p_ctx, p_key);
+}
+
+static void table8_lazy_mul(uint8_t p_block[AES_BLOCK_SIZE], const void * p_ctx)
+{
+    gcm_mul_table8_lazy(p_block, (gcm_mul_table8_lazy_t *)p_ctx);
+}
+
+static const gcm_mul_ops_t table8_lazy_ops =
+{
+    "table8_lazy", sizeof(gcm_mul_table8_lazy_t), table8_lazy_prepare, table8_lazy_mul, NULL
+};
+
+static int gcm_test(const gcm_mul_ops_t * p_ops)
 {
     size_t              i;
     size_t              data_len;
@@ -287,8 +420,14 @@ static int gcm_test(gcm_mul_implementation_t mul_impl)
     uint8_t             aes_work[AES_BLOCK_SIZE];
     uint8_t             ghash_key[AES_BLOCK_SIZE];
     uint8_t             ghash_work[AES_BLOCK_SIZE];
-    gcm_mul_table8_t    mul_table8;
-    gcm_mul_table4_t    mul_table4;
+    void              * p_ctx;
+
+    p_ctx = malloc(p_ops->ctx_size);
+    if (p_ctx == NULL)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
 
     for (i = 0; i < GCM_NUM_VECTORS; i++)
     {
@@ -301,17 +440,7 @@ static int gcm_test(gcm_mul_implementation_t mul_impl)
         memset(ghash_key, 0, sizeof(ghash_key));
         memcpy(aes_key, gcm_test_vectors[i].p_key, sizeof(aes_key));
         aes128_otfks_encrypt(ghash_key, aes_key);
-        switch (mul_impl)
-        {
-            case TEST_GCM_MUL_BIT_BY_BIT:
-                break;
-            case TEST_GCM_MUL_TABLE4:
-                gcm_mul_prepare_table4(&mul_table4, ghash_key);
-                break;
-            case TEST_GCM_MUL_TABLE8:
-                gcm_mul_prepare_table8(&mul_table8, ghash_key);
-                break;
-        }
+        p_ops->prepare(p_ctx, ghash_key);
 
         /* Compute GHASH for any AAD (additional authenticated data). */
         if (gcm_test_vectors[i].p_aad)
@@ -325,18 +454,7 @@ static int gcm_test(gcm_mul_implementation_t mul_impl)
                     memset(data_block + data_len, 0, sizeof(data_block) - data_len);
 
                 aes_block_xor(ghash_work, data_block);
-                switch (mul_impl)
-                {
-                    case TEST_GCM_MUL_BIT_BY_BIT:
-                        gcm_mul(ghash_work, ghash_key);
-                        break;
-                    case TEST_GCM_MUL_TABLE4:
-                        gcm_mul_table4(ghash_work, &mul_table4);
-                        break;
-                    case TEST_GCM_MUL_TABLE8:
-                        gcm_mul_table8(ghash_work, &mul_table8);
-                        break;
-                }
+                p_ops->mul(ghash_work, p_ctx);
 
                 p_data   += MIN(data_len, sizeof(data_block));
                 data_len -= MIN(data_len, sizeof(data_block));
@@ -362,18 +480,7 @@ static int gcm_test(gcm_mul_implementation_t mul_impl)
                 /* TODO: Verify ciphertext against that in the test vector. */
 
                 aes_block_xor(ghash_work, data_block);
-                switch (mul_impl)
-                {
-                    case TEST_GCM_MUL_BIT_BY_BIT:
-                        gcm_mul(ghash_work, ghash_key);
-                        break;
-                    case TEST_GCM_MUL_TABLE4:
-                        gcm_mul_table4(ghash_work, &mul_table4);
-                        break;
-                    case TEST_GCM_MUL_TABLE8:
-                        gcm_mul_table8(ghash_work, &mul_table8);
-                        break;
-                }
+                p_ops->mul(ghash_work, p_ctx);
 
                 p_data   += MIN(data_len, sizeof(data_block));
                 data_len -= MIN(data_len, sizeof(data_block));
@@ -387,32 +494,178 @@ static int gcm_test(gcm_mul_implementation_t mul_impl)
         ghash_lengths.padding2 = 0;
         ghash_lengths.pt_len = htobe32(gcm_test_vectors[i].pt_len * 8u);
         aes_block_xor(ghash_work, ghash_lengths.bytes);
-        switch (mul_impl)
+        p_ops->mul(ghash_work, p_ctx);
+
+        /* Final AES operation that is XORed with final GHASH value. */
+        iv_block.ctr = htobe32(1);
+        memcpy(aes_work, iv_block.bytes, sizeof(aes_work));
+        memcpy(aes_key, gcm_test_vectors[i].p_key, sizeof(aes_key));
+        aes128_otfks_encrypt(aes_work, aes_key);
+        aes_block_xor(ghash_work, aes_work);
+        /* ghash_work now contains calculated tag. */
+
+        /* Verify tag. */
+        result = memcmp(ghash_work, gcm_test_vectors[i].p_tag, gcm_test_vectors[i].tag_len) ? 1 : 0;
+        if (result)
+        {
+            printf("%s: test vector %zu failed\n", p_ops->name, i);
+
+            printf("Tag result:\n");
+            print_block_hex(ghash_work, gcm_test_vectors[i].tag_len);
+
+            printf("Tag expected:\n");
+            print_block_hex(gcm_test_vectors[i].p_tag, gcm_test_vectors[i].tag_len);
+            free(p_ctx);
+            return result;
+        }
+    }
+    free(p_ctx);
+    return 0;
+}
+
+/*
+ * Check each implementation in the registry against the multiply test
+ * vectors, and its mul_blocks() against the bit-by-bit implementation.
+ */
+static int gcm_mul_ops_test(void)
+{
+    const gcm_mul_ops_t   * p_ops;
+    gcm_mul_ops_ctx_t       ctx;
+    uint8_t                 data[GHASH_BUFFER_SIZE];
+    uint8_t                 gmul_out[AES_BLOCK_SIZE];
+    uint8_t                 expected[AES_BLOCK_SIZE];
+    size_t                  i;
+    size_t                  j;
+    size_t                  num_blocks;
+
+    for (j = 0; j < sizeof(data); j++)
+    {
+        data[j] = j * 37u + 11u;
+    }
+    for (i = 0; (p_ops = gcm_mul_ops_get(i)) != NULL; i++)
+    {
+        if (p_ops->ctx_size > sizeof(ctx) || gcm_mul_ops_find(p_ops->name) != p_ops)
+        {
+            printf("%s: bad registry entry\n", p_ops->name);
+            return 1;
+        }
+        for (j = 0; j < (sizeof(mul_test_vectors)/sizeof(mul_test_vectors[0])); j++)
+        {
+            p_ops->prepare(&ctx, mul_test_vectors[j].b);
+            memcpy(gmul_out, mul_test_vectors[j].a, AES_BLOCK_SIZE);
+            p_ops->mul(gmul_out, &ctx);
+            if (memcmp(gmul_out, mul_test_vectors[j].result, AES_BLOCK_SIZE) != 0)
+            {
+                printf("%s: mul() failed for vector %zu\n", p_ops->name, j);
+                return 1;
+            }
+        }
+        p_ops->prepare(&ctx, mul_test_vectors[0].b);
+        for (num_blocks = 0; num_blocks <= sizeof(data) / AES_BLOCK_SIZE; num_blocks++)
+        {
+            memcpy(expected, mul_test_vectors[0].a, AES_BLOCK_SIZE);
+            for (j = 0; j < num_blocks; j++)
+            {
+                aes_block_xor(expected, data + j * AES_BLOCK_SIZE);
+                gcm_mul(expected, mul_test_vectors[0].b);
+            }
+            memcpy(gmul_out, mul_test_vectors[0].a, AES_BLOCK_SIZE);
+            p_ops->mul_blocks(gmul_out, data, num_blocks, &ctx);
+            if (memcmp(gmul_out, expected, AES_BLOCK_SIZE) != 0)
+            {
+                printf("%s: mul_blocks() failed for %zu blocks\n", p_ops->name, num_blocks);
+                return 1;
+            }
+        }
+    }
+    if (i == 0 || gcm_mul_ops_find("no such implementation") != NULL)
+    {
+        printf("Bad GCM multiply registry\n");
+        return 1;
+    }
+    p_ops = gcm_mul_ops_select();
+    if (p_ops == NULL || p_ops != gcm_mul_ops_select())
+    {
+        printf("gcm_mul_ops_select() failed\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Test gcm_ghash_blocks() by calculating the GHASH of each test vector in a
+ * single call, over a buffer containing the padded AAD, the padded
+ * ciphertext and the lengths block.
+ */
+static int gcm_ghash_blocks_test(void)
+{
+    size_t              i;
+    size_t              j;
+    size_t              buffer_len;
+    int                 result;
+    gcm_iv_t            iv_block;
+    ghash_lengths_t     ghash_lengths;
+    uint8_t             aes_key[AES_BLOCK_SIZE];
+    uint8_t             aes_work[AES_BLOCK_SIZE];
+    uint8_t             ghash_key[AES_BLOCK_SIZE];
+    uint8_t             ghash_work[AES_BLOCK_SIZE];
+    uint8_t             ghash_buffer[GHASH_BUFFER_SIZE];
+    gcm_ghash_key_t     ghash_ctx;
+
+    for (i = 0; i < GCM_NUM_VECTORS; i++)
+    {
+        memset(ghash_key, 0, sizeof(ghash_key));
+        memcpy(aes_key, gcm_test_vectors[i].p_key, sizeof(aes_key));
+        aes128_otfks_encrypt(ghash_key, aes_key);
+        gcm_ghash_prepare(&ghash_ctx, ghash_key);
+
+        /* Padded AAD. */
+        memset(ghash_buffer, 0, sizeof(ghash_buffer));
+        buffer_len = 0;
+        if (gcm_test_vectors[i].p_aad)
         {
-            case TEST_GCM_MUL_BIT_BY_BIT:
-                gcm_mul(ghash_work, ghash_key);
-                break;
-            case TEST_GCM_MUL_TABLE4:
-                gcm_mul_table4(ghash_work, &mul_table4);
-                break;
-            case TEST_GCM_MUL_TABLE8:
-                gcm_mul_table8(ghash_work, &mul_table8);
-                break;
+            memcpy(ghash_buffer, gcm_test_vectors[i].p_aad, gcm_test_vectors[i].aad_len);
+            buffer_len += (gcm_test_vectors[i].aad_len + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
         }
 
+        /* Padded ciphertext. */
+        memcpy(iv_block.iv, gcm_test_vectors[i].p_iv, sizeof(iv_block.iv));
+        for (j = 0; j < gcm_test_vectors[i].pt_len; j++)
+        {
+            if ((j % AES_BLOCK_SIZE) == 0)
+            {
+                iv_block.ctr = htobe32(2u + j / AES_BLOCK_SIZE);
+                memcpy(aes_work, iv_block.bytes, sizeof(aes_work));
+                memcpy(aes_key, gcm_test_vectors[i].p_key, sizeof(aes_key));
+                aes128_otfks_encrypt(aes_work, aes_key);
+            }
+            ghash_buffer[buffer_len + j] = gcm_test_vectors[i].p_pt[j] ^ aes_work[j % AES_BLOCK_SIZE];
+        }
+        buffer_len += (gcm_test_vectors[i].pt_len + AES_BLOCK_SIZE - 1u) / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+
+        /* Lengths block. */
+        ghash_lengths.padding1 = 0;
+        ghash_lengths.aad_len = htobe32(gcm_test_vectors[i].aad_len * 8u);
+        ghash_lengths.padding2 = 0;
+        ghash_lengths.pt_len = htobe32(gcm_test_vectors[i].pt_len * 8u);
+        memcpy(ghash_buffer + buffer_len, ghash_lengths.bytes, AES_BLOCK_SIZE);
+        buffer_len += AES_BLOCK_SIZE;
+
+        memset(ghash_work, 0, sizeof(ghash_work));
+        gcm_ghash_blocks(ghash_work, ghash_buffer, buffer_len / AES_BLOCK_SIZE, &ghash_ctx);
+
         /* Final AES operation that is XORed with final GHASH value. */
         iv_block.ctr = htobe32(1);
         memcpy(aes_work, iv_block.bytes, sizeof(aes_work));
         memcpy(aes_key, gcm_test_vectors[i].p_key, sizeof(aes_key));
         aes128_otfks_encrypt(aes_work, aes_key);
         aes_block_xor(ghash_work, aes_work);
-        /* ghash_work now contains calculated tag. */
 
         /* Verify tag. */
         result = memcmp(ghash_work, gcm_test_vectors[i].p_tag, gcm_test_vectors[i].tag_len) ? 1 : 0;
         if (result)
         {
-            printf("Test vector %zu failed\n", i);
+            printf("gcm_ghash_blocks() test vector %zu failed\n", i);
 
             printf("Tag result:\n");
             print_block_hex(ghash_work, gcm_test_vectors[i].tag_len);
@@ -431,6 +684,8 @@ static int gcm_test(gcm_mul_implementation_t mul_impl)
 
 int main(int argc, char **argv)
 {
+    const gcm_mul_ops_t * p_ops;
+    size_t      i;
     int         result;
 
     (void)argc;
@@ -448,13 +703,29 @@ int main(int argc, char **argv)
     if (result)
         return result;
 
-    result = gcm_test(TEST_GCM_MUL_BIT_BY_BIT);
+    result = gcm_mul_table4_shoup_test();
     if (result)
         return result;
-    result = gcm_test(TEST_GCM_MUL_TABLE4);
+
+    result = gcm_mul_clmul_test();
+    if (result)
+        return result;
+
+    result = gcm_mul_ops_test();
+    if (result)
+        return result;
+
+    for (i = 0; (p_ops = gcm_mul_ops_get(i)) != NULL; i++)
+    {
+        result = gcm_test(p_ops);
+        if (result)
+            return result;
+    }
+    result = gcm_test(&table8_lazy_ops);
     if (result)
         return result;
-    result = gcm_test(TEST_GCM_MUL_TABLE8);
+
+    result = gcm_ghash_blocks_test();
     if (result)
         return result;
 
@@ -0,0 +1,737 @@
+/*****************************************************************************
+ * aes-min-crypt.c
+ *
+ * Encrypt or decrypt a file or stream with AES-128-GCM, in independently
+ * authenticated chunks, so data of any size is handled in constant memory.
+ *
+ * Usage: aes-min-crypt -e|-d -k key-file [-c chunk-size] [-i input] [-o output]
+ *
+ * The key file holds the 16-byte key, either raw or as 32 hex digits. Input
+ * and output default to stdin and stdout. Regular input files are mapped
+ * with mmap(); other input is read by a separate thread into one buffer
+ * while the previous one is encrypted or decrypted and written.
+ *
+ * Encrypted format, with integers big-endian:
+ *
+ *     header:  "AESMINC1" | chunk size (4) | nonce prefix (8)
+ *     chunk:   length (4) | ciphertext (length) | tag (16)
+ *
+ * Every chunk but the last holds exactly chunk size bytes of data; the last
+ * holds less (possibly none), and has bit 31 of its length set. The IV of
+ * chunk n is the random nonce prefix followed by n as 4 bytes, and the
+ * additional data is the header followed by the chunk's length field, so
+ * chunks can't be reordered, moved between files, truncated or extended
+ * without detection.
+ *
+ * When decrypting, each chunk is written once it is verified. If a later
+ * chunk fails, the exit status is non-zero and the output must be discarded.
+ ****************************************************************************/
+
+/*****************************************************************************
+ * Includes
+ ****************************************************************************/
+
+#include "gcm.h"
+#ifdef ENABLE_THREADS
+#include "aes-parallel.h"
+#endif
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef ENABLE_THREADS
+#include <pthread.h>
+#endif
+
+/*****************************************************************************
+ * Defines
+ ****************************************************************************/
+
+#define CRYPT_MAGIC                 "AESMINC1"
+#define CRYPT_MAGIC_SIZE            8u
+#define CRYPT_NONCE_PREFIX_SIZE     8u
+#define CRYPT_HEADER_SIZE           (CRYPT_MAGIC_SIZE + 4u + CRYPT_NONCE_PREFIX_SIZE)
+#define CRYPT_LENGTH_SIZE           4u
+#define CRYPT_CHUNK_OVERHEAD        (CRYPT_LENGTH_SIZE + AES128_GCM_TAG_SIZE)
+#define CRYPT_LAST_CHUNK_FLAG       0x80000000u
+
+#define CRYPT_DEFAULT_CHUNK_SIZE    (1024u * 1024u)
+#define CRYPT_MAX_CHUNK_SIZE        (64u * 1024u * 1024u)
+#define CRYPT_MAX_CHUNKS            0x100000000u
+
+/*****************************************************************************
+ * Types
+ ****************************************************************************/
+
+/*
+ * Input, read in records of record_size bytes. A record shorter than that
+ * (possibly empty) is the last.
+ *
+ * A regular file is mapped, and records point into the mapping. Otherwise
+ * records are read into two buffers alternately, by a reader thread if
+ * ENABLE_THREADS is defined.
+ */
+typedef struct
+{
+    int                 fd;
+    size_t              record_size;
+
+    const uint8_t     * p_map;
+    size_t              map_size;
+    size_t              map_pos;
+
+    uint8_t           * p_buffers[2];
+    size_t              lens[2];
+    bool                full[2];
+    size_t              next;
+    bool                done;
+    int                 read_errno;
+#ifdef ENABLE_THREADS
+    pthread_t           thread;
+    pthread_mutex_t     mutex;
+    pthread_cond_t      cond;
+    bool                stop;
+#endif
+} crypt_input_t;
+
+/*****************************************************************************
+ * Local function prototypes
+ ****************************************************************************/
+
+static void crypt_fail(const char * p_message);
+static void crypt_fail_errno(const char * p_message);
+static void crypt_usage(void);
+static size_t crypt_read_full(int fd, uint8_t * p_buf, size_t len);
+static void crypt_write_full(int fd, const uint8_t * p_buf, size_t len);
+static void crypt_read_key(const char * p_path, uint8_t p_key[AES128_KEY_SIZE]);
+static void crypt_random(uint8_t * p_buf, size_t len);
+
+static void crypt_input_open(crypt_input_t * p_in, int fd);
+#ifdef ENABLE_THREADS
+static void * crypt_input_reader(void * p_arg);
+#endif
+static void crypt_input_header(crypt_input_t * p_in, uint8_t p_header[CRYPT_HEADER_SIZE]);
+static void crypt_input_start(crypt_input_t * p_in, size_t record_size);
+static size_t crypt_input_get(crypt_input_t * p_in, const uint8_t ** pp_data);
+static void crypt_input_release(crypt_input_t * p_in);
+static void crypt_input_close(crypt_input_t * p_in);
+
+static void crypt_seal(const aes128_gcm_key_t * p_key, const uint8_t * p_iv, const uint8_t * p_aad,
+                       uint8_t * p_out, const uint8_t * p_in, size_t len, uint8_t * p_tag);
+static bool crypt_open(const aes128_gcm_key_t * p_key, const uint8_t * p_iv, const uint8_t * p_aad,
+                       uint8_t * p_out, const uint8_t * p_in, size_t len, const uint8_t * p_tag);
+static void crypt_encrypt(const aes128_gcm_key_t * p_key, crypt_input_t * p_in, int out_fd, size_t chunk_size);
+static void crypt_decrypt(const aes128_gcm_key_t * p_key, crypt_input_t * p_in, int out_fd);
+
+/*****************************************************************************
+ * Local inline functions
+ ****************************************************************************/
+
+static inline void crypt_put_u32(uint8_t * p, uint32_t value)
+{
+    p[0] = value >> 24u;
+    p[1] = value >> 16u;
+    p[2] = value >> 8u;
+    p[3] = value;
+}
+
+static inline uint32_t crypt_get_u32(const uint8_t * p)
+{
+    return ((uint32_t)p[0] << 24u) | ((uint32_t)p[1] << 16u) | ((uint32_t)p[2] << 8u) | p[3];
+}
+
+/* IV of a chunk: the nonce prefix from the header, then the chunk index. */
+static inline void crypt_chunk_iv(uint8_t p_iv[AES128_GCM_IV_SIZE], const uint8_t p_header[CRYPT_HEADER_SIZE], uint32_t chunk_index)
+{
+    memcpy(p_iv, &p_header[CRYPT_HEADER_SIZE - CRYPT_NONCE_PREFIX_SIZE], CRYPT_NONCE_PREFIX_SIZE);
+    crypt_put_u32(&p_iv[CRYPT_NONCE_PREFIX_SIZE], chunk_index);
+}
+
+/*****************************************************************************
+ * Functions
+ ****************************************************************************/
+
+int main(int argc, char **argv)
+{
+    aes128_gcm_key_t    key;
+    crypt_input_t       input;
+    uint8_t             aes_key[AES128_KEY_SIZE];
+    const char        * p_key_path = NULL;
+    const char        * p_in_path = NULL;
+    const char        * p_out_path = NULL;
+    unsigned long       chunk_size = CRYPT_DEFAULT_CHUNK_SIZE;
+    char              * p_end;
+    int                 mode = 0;
+    int                 in_fd = STDIN_FILENO;
+    int                 out_fd = STDOUT_FILENO;
+    int                 opt;
+
+    while ((opt = getopt(argc, argv, "edk:c:i:o:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'e':
+            case 'd':
+                mode = opt;
+                break;
+            case 'k':
+                p_key_path = optarg;
+                break;
+            case 'c':
+                chunk_size = strtoul(optarg, &p_end, 0);
+                if (*p_end != '\0' || chunk_size == 0 || chunk_size > CRYPT_MAX_CHUNK_SIZE)
+                {
+                    crypt_fail("invalid chunk size");
+                }
+                break;
+            case 'i':
+                p_in_path = optarg;
+                break;
+            case 'o':
+                p_out_path = optarg;
+                break;
+            default:
+                crypt_usage();
+        }
+    }
+    if (mode == 0 || p_key_path == NULL || optind != argc)
+    {
+        crypt_usage();
+    }
+
+    crypt_read_key(p_key_path, aes_key);
+    aes128_gcm_init(&key, aes_key);
+    memset(aes_key, 0, sizeof(aes_key));
+
+    if (p_in_path != NULL && strcmp(p_in_path, "-") != 0)
+    {
+        in_fd = open(p_in_path, O_RDONLY);
+        if (in_fd < 0)
+        {
+            crypt_fail_errno(p_in_path);
+        }
+    }
+    if (p_out_path != NULL && strcmp(p_out_path, "-") != 0)
+    {
+        out_fd = open(p_out_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        if (out_fd < 0)
+        {
+            crypt_fail_errno(p_out_path);
+        }
+    }
+
+    crypt_input_open(&input, in_fd);
+    if (mode == 'e')
+    {
+        crypt_encrypt(&key, &input, out_fd, chunk_size);
+    }
+    else
+    {
+        crypt_decrypt(&key, &input, out_fd);
+    }
+    crypt_input_close(&input);
+    memset(&key, 0, sizeof(key));
+
+    if (close(out_fd) != 0)
+    {
+        crypt_fail_errno("write");
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * Local functions
+ ****************************************************************************/
+
+static void crypt_fail(const char * p_message)
+{
+    fprintf(stderr, "aes-min-crypt: %s\n", p_message);
+    exit(1);
+}
+
+static void crypt_fail_errno(const char * p_message)
+{
+    fprintf(stderr, "aes-min-crypt: %s: %s\n", p_message, strerror(errno));
+    exit(1);
+}
+
+static void crypt_usage(void)
+{
+    fprintf(stderr, "Usage: aes-min-crypt -e|-d -k key-file [-c chunk-size] [-i input] [-o output]\n"
+                    "  -e             encrypt\n"
+                    "  -d             decrypt\n"
+                    "  -k key-file    16-byte key, raw or as 32 hex digits\n"
+                    "  -c chunk-size  bytes of data per chunk when encrypting (default %u)\n"
+                    "  -i input       input file (default stdin)\n"
+                    "  -o output      output file (default stdout)\n",
+            CRYPT_DEFAULT_CHUNK_SIZE);
+    exit(2);
+}
+
+/* Read until len bytes are read or end of file, returning the number read. */
+static size_t crypt_read_full(int fd, uint8_t * p_buf, size_t len)
+{
+    size_t              done = 0;
+    ssize_t             result;
+
+    while (done < len)
+    {
+        result = read(fd, p_buf + done, len - done);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return (size_t)-1;
+        }
+        if (result == 0)
+            break;
+        done += result;
+    }
+    return done;
+}
+
+static void crypt_write_full(int fd, const uint8_t * p_buf, size_t len)
+{
+    ssize_t             result;
+
+    while (len)
+    {
+        result = write(fd, p_buf, len);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            crypt_fail_errno("write");
+        }
+        p_buf += result;
+        len -= result;
+    }
+}
+
+static void crypt_read_key(const char * p_path, uint8_t p_key[AES128_KEY_SIZE])
+{
+    uint8_t             data[2u * AES128_KEY_SIZE + 2u];
+    char                hex[3];
+    size_t              len;
+    size_t              i;
+    int                 fd;
+
+    fd = open(p_path, O_RDONLY);
+    if (fd < 0)
+    {
+        crypt_fail_errno(p_path);
+    }
+    len = crypt_read_full(fd, data, sizeof(data));
+    if (len == (size_t)-1)
+    {
+        crypt_fail_errno(p_path);
+    }
+    close(fd);
+    if (len == AES128_KEY_SIZE)
+    {
+        memcpy(p_key, data, AES128_KEY_SIZE);
+        memset(data, 0, sizeof(data));
+        return;
+    }
+
+    /* Hex, optionally followed by a line ending. */
+    while (len > 2u * AES128_KEY_SIZE && isspace(data[len - 1u]))
+    {
+        len--;
+    }
+    if (len != 2u * AES128_KEY_SIZE)
+    {
+        crypt_fail("key file must hold 16 bytes or 32 hex digits");
+    }
+    hex[2] = '\0';
+    for (i = 0; i < AES128_KEY_SIZE; i++)
+    {
+        if (!isxdigit(data[2u * i]) || !isxdigit(data[2u * i + 1u]))
+        {
+            crypt_fail("key file must hold 16 bytes or 32 hex digits");
+        }
+        hex[0] = data[2u * i];
+        hex[1] = data[2u * i + 1u];
+        p_key[i] = strtoul(hex, NULL, 16);
+    }
+    memset(data, 0, sizeof(data));
+    memset(hex, 0, sizeof(hex));
+}
+
+static void crypt_random(uint8_t * p_buf, size_t len)
+{
+    int                 fd;
+
+    fd = open("/dev/urandom", O_RDONLY);
+    if (fd < 0)
+    {
+        crypt_fail_errno("/dev/urandom");
+    }
+    if (crypt_read_full(fd, p_buf, len) != len)
+    {
+        crypt_fail("can't read /dev/urandom");
+    }
+    close(fd);
+}
+
+/* Map the input if it is a regular file that fits in the address space. */
+static void crypt_input_open(crypt_input_t * p_in, int fd)
+{
+    struct stat         st;
+    void              * p_map;
+
+    memset(p_in, 0, sizeof(*p_in));
+    p_in->fd = fd;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (uintmax_t)st.st_size <= SIZE_MAX)
+    {
+        p_in->map_size = st.st_size;
+        if (p_in->map_size == 0)
+        {
+            p_in->p_map = (const uint8_t *)"";
+            return;
+        }
+        p_map = mmap(NULL, p_in->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p_map != MAP_FAILED)
+        {
+#ifdef MADV_SEQUENTIAL
+            madvise(p_map, p_in->map_size, MADV_SEQUENTIAL);
+#endif
+            p_in->p_map = p_map;
+        }
+    }
+}
+
+/* Read the header of encrypted input, before crypt_input_start(). */
+static void crypt_input_header(crypt_input_t * p_in, uint8_t p_header[CRYPT_HEADER_SIZE])
+{
+    size_t              len;
+
+    if (p_in->p_map != NULL)
+    {
+        len = (p_in->map_size < CRYPT_HEADER_SIZE) ? p_in->map_size : CRYPT_HEADER_SIZE;
+        memcpy(p_header, p_in->p_map, len);
+        p_in->map_pos = len;
+    }
+    else
+    {
+        len = crypt_read_full(p_in->fd, p_header, CRYPT_HEADER_SIZE);
+        if (len == (size_t)-1)
+        {
+            crypt_fail_errno("read");
+        }
+    }
+    if (len != CRYPT_HEADER_SIZE || memcmp(p_header, CRYPT_MAGIC, CRYPT_MAGIC_SIZE) != 0)
+    {
+        crypt_fail("input is not in aes-min-crypt format");
+    }
+}
+
+#ifdef ENABLE_THREADS
+/* Reader thread, filling the two buffers alternately until end of file. */
+static void * crypt_input_reader(void * p_arg)
+{
+    crypt_input_t     * p_in = p_arg;
+    size_t              index = 0;
+    size_t              len;
+    bool                stop;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&p_in->mutex);
+        while (p_in->full[index] && !p_in->stop)
+        {
+            pthread_cond_wait(&p_in->cond, &p_in->mutex);
+        }
+        stop = p_in->stop;
+        pthread_mutex_unlock(&p_in->mutex);
+        if (stop)
+        {
+            break;
+        }
+
+        len = crypt_read_full(p_in->fd, p_in->p_buffers[index], p_in->record_size);
+
+        pthread_mutex_lock(&p_in->mutex);
+        if (len == (size_t)-1)
+        {
+            p_in->read_errno = errno;
+            len = 0;
+        }
+        p_in->lens[index] = len;
+        p_in->full[index] = true;
+        p_in->done = (len < p_in->record_size);
+        pthread_cond_broadcast(&p_in->cond);
+        pthread_mutex_unlock(&p_in->mutex);
+        if (len < p_in->record_size)
+        {
+            break;
+        }
+        index ^= 1u;
+    }
+    return NULL;
+}
+#endif
+
+static void crypt_input_start(crypt_input_t * p_in, size_t record_size)
+{
+    size_t              i;
+
+    p_in->record_size = record_size;
+    if (p_in->p_map != NULL)
+    {
+        return;
+    }
+    for (i = 0; i < 2u; i++)
+    {
+        p_in->p_buffers[i] = malloc(record_size);
+        if (p_in->p_buffers[i] == NULL)
+        {
+            crypt_fail("out of memory");
+        }
+    }
+#ifdef ENABLE_THREADS
+    pthread_mutex_init(&p_in->mutex, NULL);
+    pthread_cond_init(&p_in->cond, NULL);
+    if (pthread_create(&p_in->thread, NULL, crypt_input_reader, p_in) != 0)
+    {
+        crypt_fail("can't create reader thread");
+    }
+#endif
+}
+
+/*
+ * Get the next record of up to record_size bytes, which stays valid until
+ * crypt_input_release(). Returns 0 after the last record.
+ */
+static size_t crypt_input_get(crypt_input_t * p_in, const uint8_t ** pp_data)
+{
+    size_t              len;
+
+    if (p_in->p_map != NULL)
+    {
+        len = p_in->map_size - p_in->map_pos;
+        if (len > p_in->record_size)
+        {
+            len = p_in->record_size;
+        }
+        *pp_data = p_in->p_map + p_in->map_pos;
+        p_in->map_pos += len;
+        return len;
+    }
+
+#ifdef ENABLE_THREADS
+    pthread_mutex_lock(&p_in->mutex);
+    while (!p_in->full[p_in->next] && !p_in->done)
+    {
+        pthread_cond_wait(&p_in->cond, &p_in->mutex);
+    }
+    len = p_in->full[p_in->next] ? p_in->lens[p_in->next] : 0;
+    pthread_mutex_unlock(&p_in->mutex);
+#else
+    if (p_in->done)
+    {
+        len = 0;
+    }
+    else
+    {
+        len = crypt_read_full(p_in->fd, p_in->p_buffers[p_in->next], p_in->record_size);
+        if (len == (size_t)-1)
+        {
+            p_in->read_errno = errno;
+            len = 0;
+        }
+        p_in->done = (len < p_in->record_size);
+    }
+#endif
+    if (p_in->read_errno != 0)
+    {
+        errno = p_in->read_errno;
+        crypt_fail_errno("read");
+    }
+    *pp_data = p_in->p_buffers[p_in->next];
+    return len;
+}
+
+/* Hand the buffer of the last record back to the reader. */
+static void crypt_input_release(crypt_input_t * p_in)
+{
+    if (p_in->p_map != NULL)
+    {
+        return;
+    }
+#ifdef ENABLE_THREADS
+    pthread_mutex_lock(&p_in->mutex);
+    p_in->full[p_in->next] = false;
+    pthread_cond_broadcast(&p_in->cond);
+    pthread_mutex_unlock(&p_in->mutex);
+#endif
+    p_in->next ^= 1u;
+}
+
+static void crypt_input_close(crypt_input_t * p_in)
+{
+    if (p_in->p_map != NULL)
+    {
+        if (p_in->map_size != 0)
+        {
+            munmap((void *)p_in->p_map, p_in->map_size);
+        }
+    }
+    else if (p_in->record_size != 0)
+    {
+#ifdef ENABLE_THREADS
+        pthread_mutex_lock(&p_in->mutex);
+        p_in->stop = true;
+        pthread_cond_broadcast(&p_in->cond);
+        pthread_mutex_unlock(&p_in->mutex);
+        pthread_join(p_in->thread, NULL);
+        pthread_cond_destroy(&p_in->cond);
+        pthread_mutex_destroy(&p_in->mutex);
+#endif
+        free(p_in->p_buffers[0]);
+        free(p_in->p_buffers[1]);
+    }
+    close(p_in->fd);
+}
+
+/* Seal one chunk of data, so it can be used with the thread pool if there is
+ * one. */
+static void crypt_seal(const aes128_gcm_key_t * p_key, const uint8_t * p_iv, const uint8_t * p_aad,
+                       uint8_t * p_out, const uint8_t * p_in, size_t len, uint8_t * p_tag)
+{
+#ifdef ENABLE_THREADS
+    aes128_gcm_seal_parallel(aes_thread_pool_default(), p_key, p_iv, AES128_GCM_IV_SIZE,
+                             p_aad, CRYPT_HEADER_SIZE + CRYPT_LENGTH_SIZE, p_out, p_in, len, p_tag, AES128_GCM_TAG_SIZE);
+#else
+    aes128_gcm_seal(p_key, p_iv, AES128_GCM_IV_SIZE,
+                    p_aad, CRYPT_HEADER_SIZE + CRYPT_LENGTH_SIZE, p_out, p_in, len, p_tag, AES128_GCM_TAG_SIZE);
+#endif
+}
+
+static bool crypt_open(const aes128_gcm_key_t * p_key, const uint8_t * p_iv, const uint8_t * p_aad,
+                       uint8_t * p_out, const uint8_t * p_in, size_t len, const uint8_t * p_tag)
+{
+#ifdef ENABLE_THREADS
+    return aes128_gcm_open_parallel(aes_thread_pool_default(), p_key, p_iv, AES128_GCM_IV_SIZE,
+                                    p_aad, CRYPT_HEADER_SIZE + CRYPT_LENGTH_SIZE, p_out, p_in, len, p_tag, AES128_GCM_TAG_SIZE);
+#else
+    return aes128_gcm_open(p_key, p_iv, AES128_GCM_IV_SIZE,
+                           p_aad, CRYPT_HEADER_SIZE + CRYPT_LENGTH_SIZE, p_out, p_in, len, p_tag, AES128_GCM_TAG_SIZE);
+#endif
+}
+
+/*
+ * Encrypt the input in chunks of chunk_size bytes. The additional data of
+ * each chunk is the header followed by the chunk's length field, which is
+ * built in aad and copied to the start of the output chunk.
+ */
+static void crypt_encrypt(const aes128_gcm_key_t * p_key, crypt_input_t * p_in, int out_fd, size_t chunk_size)
+{
+    uint8_t             aad[CRYPT_HEADER_SIZE + CRYPT_LENGTH_SIZE];
+    uint8_t             iv[AES128_GCM_IV_SIZE];
+    uint8_t           * p_out;
+    const uint8_t     * p_data;
+    uint64_t            chunk_index;
+    size_t              len;
+
+    memcpy(aad, CRYPT_MAGIC, CRYPT_MAGIC_SIZE);
+    crypt_put_u32(&aad[CRYPT_MAGIC_SIZE], chunk_size);
+    crypt_random(&aad[CRYPT_MAGIC_SIZE + 4u], CRYPT_NONCE_PREFIX_SIZE);
+    crypt_write_full(out_fd, aad, CRYPT_HEADER_SIZE);
+
+    p_out = malloc(chunk_size + CRYPT_CHUNK_OVERHEAD);
+    if (p_out == NULL)
+    {
+        crypt_fail("out of memory");
+    }
+    crypt_input_start(p_in, chunk_size);
+    for (chunk_index = 0; ; chunk_index++)
+    {
+        if (chunk_index == CRYPT_MAX_CHUNKS)
+        {
+            crypt_fail("input too large for chunk size");
+        }
+        len = crypt_input_get(p_in, &p_data);
+        crypt_put_u32(&aad[CRYPT_HEADER_SIZE], (len < chunk_size) ? (len | CRYPT_LAST_CHUNK_FLAG) : len);
+        memcpy(p_out, &aad[CRYPT_HEADER_SIZE], CRYPT_LENGTH_SIZE);
+        crypt_chunk_iv(iv, aad, chunk_index);
+        crypt_seal(p_key, iv, aad, p_out + CRYPT_LENGTH_SIZE, p_data, len, p_out + CRYPT_LENGTH_SIZE + len);
+        crypt_input_release(p_in);
+        crypt_write_full(out_fd, p_out, len + CRYPT_CHUNK_OVERHEAD);
+        if (len < chunk_size)
+        {
+            break;
+        }
+    }
+    free(p_out);
+}
+
+/*
+ * Decrypt the input chunk by chunk. Every encrypted chunk but the last is
+ * chunk size plus CRYPT_CHUNK_OVERHEAD bytes, so the input is read in records
+ * of that size, and the last is the only short one.
+ */
+static void crypt_decrypt(const aes128_gcm_key_t * p_key, crypt_input_t * p_in, int out_fd)
+{
+    uint8_t             aad[CRYPT_HEADER_SIZE + CRYPT_LENGTH_SIZE];
+    uint8_t             iv[AES128_GCM_IV_SIZE];
+    uint8_t           * p_out;
+    const uint8_t     * p_record;
+    uint64_t            chunk_index;
+    size_t              chunk_size;
+    size_t              record_len;
+    uint32_t            length_field;
+    size_t              len;
+    bool                is_last;
+
+    crypt_input_header(p_in, aad);
+    chunk_size = crypt_get_u32(&aad[CRYPT_MAGIC_SIZE]);
+    if (chunk_size == 0 || chunk_size > CRYPT_MAX_CHUNK_SIZE)
+    {
+        crypt_fail("invalid chunk size in header");
+    }
+
+    p_out = malloc(chunk_size);
+    if (p_out == NULL)
+    {
+        crypt_fail("out of memory");
+    }
+    crypt_input_start(p_in, chunk_size + CRYPT_CHUNK_OVERHEAD);
+    for (chunk_index = 0; ; chunk_index++)
+    {
+        record_len = crypt_input_get(p_in, &p_record);
+        if (record_len < CRYPT_CHUNK_OVERHEAD)
+        {
+            crypt_fail("input is truncated");
+        }
+        length_field = crypt_get_u32(p_record);
+        is_last = (length_field & CRYPT_LAST_CHUNK_FLAG) != 0;
+        len = length_field & ~CRYPT_LAST_CHUNK_FLAG;
+        if (record_len != len + CRYPT_CHUNK_OVERHEAD
+            || (is_last ? (len >= chunk_size) : (len != chunk_size || chunk_index + 1u == CRYPT_MAX_CHUNKS)))
+        {
+            crypt_fail("input is corrupt");
+        }
+        memcpy(&aad[CRYPT_HEADER_SIZE], p_record, CRYPT_LENGTH_SIZE);
+        crypt_chunk_iv(iv, aad, chunk_index);
+        if (!crypt_open(p_key, iv, aad, p_out, p_record + CRYPT_LENGTH_SIZE, len, p_record + CRYPT_LENGTH_SIZE + len))
+        {
+            crypt_fail("authentication failed");
+        }
+        crypt_input_release(p_in);
+        crypt_write_full(out_fd, p_out, len);
+        if (is_last)
+        {
+            break;
+        }
+    }
+    free(p_out);
+}